@@ -0,0 +1,275 @@
+#include "scene_benchmark.h"
+
+#include <algorithm>
+#include <cmath>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <numeric>
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/engine.h>
+#include <babylon/engines/headless/headless_canvas.h>
+#include <babylon/engines/headless/recording_gl_rendering_context.h>
+#include <babylon/engines/scene.h>
+
+namespace {
+
+std::atomic<size_t> _allocationCount{0};
+
+} // end of anonymous namespace
+
+// Count every heap allocation made by the benchmark process
+void* operator new(std::size_t size)
+{
+  ++_allocationCount;
+  if (auto ptr = std::malloc(size ? size : 1)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+  return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t /*size*/) noexcept
+{
+  std::free(ptr);
+}
+
+namespace BABYLON {
+namespace Benchmarks {
+
+using Clock = std::chrono::high_resolution_clock;
+
+namespace {
+
+double _elapsedMs(const Clock::time_point& start)
+{
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+    .count();
+}
+
+// Per frame metrics exported in the report
+const std::vector<std::pair<const char*, double FrameSample::*>> _metrics{
+  {"frameTimeMs", &FrameSample::frameTimeMs},
+  {"activeMeshesEvaluationTimeMs",
+   &FrameSample::activeMeshesEvaluationTimeMs},
+  {"renderTargetsTimeMs", &FrameSample::renderTargetsTimeMs},
+  {"drawPhaseTimeMs", &FrameSample::drawPhaseTimeMs},
+  {"allocations", &FrameSample::allocations},
+  {"activeMeshes", &FrameSample::activeMeshes},
+  {"drawCalls", &FrameSample::drawCalls},
+  {"effectBinds", &FrameSample::effectBinds},
+  {"uniformUploads", &FrameSample::uniformUploads},
+  {"stateChanges", &FrameSample::stateChanges},
+  {"bufferBytesUploaded", &FrameSample::bufferBytesUploaded},
+};
+
+} // end of anonymous namespace
+
+MetricSummary MetricSummary::Compute(std::vector<double> samples)
+{
+  MetricSummary summary;
+  if (samples.empty()) {
+    return summary;
+  }
+
+  std::sort(samples.begin(), samples.end());
+  // Nearest-rank percentile
+  const auto percentile = [&samples](double p) {
+    const auto rank = static_cast<size_t>(
+      std::ceil(p / 100.0 * static_cast<double>(samples.size())));
+    return samples[std::min(std::max(rank, size_t(1)), samples.size()) - 1];
+  };
+
+  summary.mean = std::accumulate(samples.begin(), samples.end(), 0.0)
+                 / static_cast<double>(samples.size());
+  summary.min = samples.front();
+  summary.p50 = percentile(50.0);
+  summary.p90 = percentile(90.0);
+  summary.p99 = percentile(99.0);
+  summary.max = samples.back();
+
+  return summary;
+}
+
+nlohmann::json MetricSummary::toJson() const
+{
+  return {{"mean", mean}, {"min", min}, {"p50", p50},
+          {"p90", p90},   {"p99", p99}, {"max", max}};
+}
+
+nlohmann::json SceneBenchmarkResult::toJson() const
+{
+  auto metrics = nlohmann::json::object();
+  for (const auto& metric : _metrics) {
+    std::vector<double> values;
+    values.reserve(samples.size());
+    for (const auto& sample : samples) {
+      values.emplace_back(sample.*(metric.second));
+    }
+    metrics[metric.first] = MetricSummary::Compute(std::move(values)).toJson();
+  }
+
+  return {{"name", name},
+          {"meshCount", meshCount},
+          {"frames", frames},
+          {"setupTimeMs", setupTimeMs},
+          {"metrics", metrics}};
+}
+
+SceneBenchmark::SceneBenchmark(const std::string& name, size_t meshCount)
+    : _name{name}
+    , _meshCount{meshCount}
+    , _canvas{std::make_unique<HeadlessCanvas>(1280, 720)}
+    , _engine{Engine::New(_canvas.get())}
+    , _scene{nullptr}
+{
+  _canvas->recordingContext()->recordCalls = false;
+}
+
+SceneBenchmark::~SceneBenchmark()
+{
+  if (_scene) {
+    _scene->dispose();
+  }
+  _scene.reset();
+  _engine.reset();
+}
+
+SceneBenchmarkResult SceneBenchmark::run(const SceneBuilder& builder,
+                                         size_t frames, size_t warmupFrames,
+                                         const FrameUpdate& update)
+{
+  SceneBenchmarkResult result;
+  result.name      = _name;
+  result.meshCount = _meshCount;
+  result.frames    = frames;
+
+  // Scene creation
+  const auto setupStart = Clock::now();
+  _scene                = Scene::New(_engine.get());
+  auto camera
+    = FreeCamera::New("camera", Vector3(0.f, 80.f, -250.f), _scene.get());
+  camera->setTarget(Vector3::Zero());
+  camera->maxZ = 10000.f;
+  builder(_scene.get());
+  result.setupTimeMs = _elapsedMs(setupStart);
+
+  // Phase timers
+  FrameSample current;
+  Clock::time_point phaseStart;
+  const auto startPhase
+    = [&phaseStart](Scene* /*scene*/, EventState& /*es*/) {
+        phaseStart = Clock::now();
+      };
+  _scene->onBeforeActiveMeshesEvaluationObservable.add(startPhase);
+  _scene->onAfterActiveMeshesEvaluationObservable.add(
+    [&](Scene* /*scene*/, EventState& /*es*/) {
+      current.activeMeshesEvaluationTimeMs += _elapsedMs(phaseStart);
+    });
+  _scene->onBeforeRenderTargetsRenderObservable.add(startPhase);
+  _scene->onAfterRenderTargetsRenderObservable.add(
+    [&](Scene* /*scene*/, EventState& /*es*/) {
+      current.renderTargetsTimeMs += _elapsedMs(phaseStart);
+    });
+  _scene->onBeforeDrawPhaseObservable.add(startPhase);
+  _scene->onAfterDrawPhaseObservable.add(
+    [&](Scene* /*scene*/, EventState& /*es*/) {
+      current.drawPhaseTimeMs += _elapsedMs(phaseStart);
+    });
+
+  auto gl = _canvas->recordingContext();
+  result.samples.reserve(frames);
+  for (size_t frame = 0; frame < warmupFrames + frames; ++frame) {
+    if (update) {
+      update(_scene.get(), frame);
+    }
+
+    current = FrameSample();
+    gl->resetStatistics();
+    const auto allocationsBefore = allocationCount();
+    const auto frameStart        = Clock::now();
+
+    _engine->beginFrame();
+    _scene->render();
+    _engine->endFrame();
+
+    current.frameTimeMs = _elapsedMs(frameStart);
+    current.allocations
+      = static_cast<double>(allocationCount() - allocationsBefore);
+
+    const auto& stats           = gl->statistics();
+    current.activeMeshes        = _scene->getActiveMeshes().size();
+    current.drawCalls           = stats.drawCalls;
+    current.effectBinds         = stats.programBinds;
+    current.uniformUploads      = stats.uniformUploads;
+    current.stateChanges        = stats.stateChanges;
+    current.bufferBytesUploaded = stats.bufferBytesUploaded;
+
+    if (frame >= warmupFrames) {
+      result.samples.emplace_back(current);
+    }
+  }
+
+  _scene->dispose();
+  _scene.reset();
+
+  return result;
+}
+
+size_t allocationCount()
+{
+  return _allocationCount.load(std::memory_order_relaxed);
+}
+
+void report(const SceneBenchmarkResult& result)
+{
+  static nlohmann::json reports = nlohmann::json::array();
+
+  const auto json = result.toJson();
+  reports.push_back(json);
+
+  // Human readable summary
+  const auto& metrics = json["metrics"];
+  std::cout << std::fixed << std::setprecision(3) << result.name << " ("
+            << result.meshCount << " meshes, " << result.frames
+            << " frames):" << std::endl;
+  for (const auto& metric : _metrics) {
+    const auto& summary = metrics[metric.first];
+    std::cout << "\t" << std::left << std::setw(30) << metric.first
+              << " p50: " << summary["p50"].get<double>()
+              << "\tp90: " << summary["p90"].get<double>()
+              << "\tp99: " << summary["p99"].get<double>() << std::endl;
+  }
+
+  // Machine readable report
+  const char* reportPath = std::getenv("BABYLON_BENCHMARK_REPORT");
+  std::ofstream output(reportPath ? reportPath : "scene_benchmarks.json");
+  output << std::setw(2) << nlohmann::json{{"benchmarks", reports}}
+         << std::endl;
+}
+
+} // end of namespace Benchmarks
+} // end of namespace BABYLON
@@ -0,0 +1,132 @@
+#ifndef BABYLON_BENCHMARKS_SCENE_SCENE_BENCHMARK_H
+#define BABYLON_BENCHMARKS_SCENE_SCENE_BENCHMARK_H
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+namespace BABYLON {
+
+class Engine;
+class HeadlessCanvas;
+class Scene;
+
+namespace Benchmarks {
+
+/**
+ * @brief Distribution of a per frame metric.
+ */
+struct MetricSummary {
+  double mean = 0.0;
+  double min  = 0.0;
+  double p50  = 0.0;
+  double p90  = 0.0;
+  double p99  = 0.0;
+  double max  = 0.0;
+
+  /**
+   * @brief Computes the summary of the given samples.
+   */
+  static MetricSummary Compute(std::vector<double> samples);
+
+  nlohmann::json toJson() const;
+}; // end of struct MetricSummary
+
+/**
+ * @brief Measurements taken during a single rendered frame.
+ */
+struct FrameSample {
+  /** Time spent in Scene::render */
+  double frameTimeMs = 0.0;
+  /** Time spent in Scene::_evaluateActiveMeshes */
+  double activeMeshesEvaluationTimeMs = 0.0;
+  /** Time spent rendering the render targets (shadow maps, ...) */
+  double renderTargetsTimeMs = 0.0;
+  /** Time spent in the draw phase (RenderingManager, Mesh::render) */
+  double drawPhaseTimeMs = 0.0;
+  /** Number of heap allocations made during the frame */
+  double allocations = 0.0;
+  /** Number of active meshes */
+  double activeMeshes = 0.0;
+  /** Number of draw calls submitted to the GL context */
+  double drawCalls = 0.0;
+  /** Number of effect (program) binds */
+  double effectBinds = 0.0;
+  /** Number of uniform uploads */
+  double uniformUploads = 0.0;
+  /** Number of GL state changes */
+  double stateChanges = 0.0;
+  /** Number of bytes uploaded to GL buffers */
+  double bufferBytesUploaded = 0.0;
+}; // end of struct FrameSample
+
+/**
+ * @brief Summary of a benchmark run over a synthetic scene.
+ */
+struct SceneBenchmarkResult {
+  std::string name;
+  size_t meshCount   = 0;
+  size_t frames      = 0;
+  double setupTimeMs = 0.0;
+  std::vector<FrameSample> samples;
+
+  nlohmann::json toJson() const;
+}; // end of struct SceneBenchmarkResult
+
+/**
+ * @brief Renders a synthetic scene on a headless engine and measures the CPU
+ * side of every frame.
+ */
+class SceneBenchmark {
+
+public:
+  using SceneBuilder = std::function<void(Scene* scene)>;
+  using FrameUpdate  = std::function<void(Scene* scene, size_t frame)>;
+
+public:
+  SceneBenchmark(const std::string& name, size_t meshCount);
+  ~SceneBenchmark();
+
+  /**
+   * @brief Builds the scene, renders the warmup frames then the measured
+   * frames.
+   * @param builder Callback populating the scene (camera excluded)
+   * @param frames Number of measured frames
+   * @param warmupFrames Number of frames rendered before measuring (effects
+   * compilation, render lists creation...)
+   * @param update Optional callback called before every frame
+   */
+  SceneBenchmarkResult run(const SceneBuilder& builder, size_t frames = 60,
+                           size_t warmupFrames = 5,
+                           const FrameUpdate& update = nullptr);
+
+private:
+  std::string _name;
+  size_t _meshCount;
+  std::unique_ptr<HeadlessCanvas> _canvas;
+  std::unique_ptr<Engine> _engine;
+  std::unique_ptr<Scene> _scene;
+
+}; // end of class SceneBenchmark
+
+/**
+ * @brief Returns the number of heap allocations made by the process so far.
+ */
+size_t allocationCount();
+
+/**
+ * @brief Prints the result and appends it to the machine-readable report.
+ * The report is written as JSON to the file named by the
+ * BABYLON_BENCHMARK_REPORT environment variable (default:
+ * "scene_benchmarks.json" in the working directory).
+ */
+void report(const SceneBenchmarkResult& result);
+
+} // end of namespace Benchmarks
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_BENCHMARKS_SCENE_SCENE_BENCHMARK_H
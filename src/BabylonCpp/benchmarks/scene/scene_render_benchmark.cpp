@@ -0,0 +1,320 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "scene_benchmark.h"
+
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/engines/scene.h>
+#include <babylon/lights/directional_light.h>
+#include <babylon/lights/hemispheric_light.h>
+#include <babylon/lights/shadows/shadow_generator.h>
+#include <babylon/materials/multi_material.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/meshes/instanced_mesh.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/sub_mesh.h>
+#include <babylon/meshes/transform_node.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/particles/particle_system.h>
+
+using namespace BABYLON;
+using namespace BABYLON::Benchmarks;
+
+namespace {
+
+// Number of measured frames per scenario
+constexpr size_t FRAMES = 60;
+// Number of frames rendered before measuring
+constexpr size_t WARMUP_FRAMES = 5;
+
+/**
+ * @brief Spreads the node on a square grid centered on the origin.
+ */
+void placeOnGrid(TransformNode* node, size_t index, size_t count,
+                 float spacing = 3.f)
+{
+  const auto side
+    = static_cast<size_t>(std::ceil(std::sqrt(static_cast<float>(count))));
+  const auto half = static_cast<float>(side) * spacing * 0.5f;
+  node->position  = Vector3(static_cast<float>(index % side) * spacing - half,
+                           0.f,
+                           static_cast<float>(index / side) * spacing - half);
+}
+
+void addHemisphericLight(Scene* scene)
+{
+  HemisphericLight::New("light", Vector3(0.f, 1.f, 0.f), scene);
+}
+
+void runStaticMeshes(size_t count, bool parallelEvaluation = false)
+{
+  const std::string name
+    = parallelEvaluation ? "static_meshes_parallel_" : "static_meshes_";
+  SceneBenchmark benchmark(name + std::to_string(count), count);
+  report(benchmark.run(
+    [count, parallelEvaluation](Scene* scene) {
+      scene->parallelActiveMeshesEvaluation = parallelEvaluation;
+      addHemisphericLight(scene);
+      auto material = StandardMaterial::New("material", scene);
+      for (size_t i = 0; i < count; ++i) {
+        auto box      = Mesh::CreateBox("box" + std::to_string(i), 1.f, scene);
+        box->material = material;
+        placeOnGrid(box.get(), i, count);
+      }
+    },
+    FRAMES, WARMUP_FRAMES));
+}
+
+void runStaticHierarchy(size_t count, bool useTransformHierarchy)
+{
+  const std::string name = useTransformHierarchy ?
+                             "static_hierarchy_transform_hierarchy_" :
+                             "static_hierarchy_";
+  SceneBenchmark benchmark(name + std::to_string(count), count);
+  report(benchmark.run(
+    [count, useTransformHierarchy](Scene* scene) {
+      scene->useTransformHierarchy = useTransformHierarchy;
+      addHemisphericLight(scene);
+      auto material = StandardMaterial::New("material", scene);
+      // Every box is the leaf of a chain of 8 transform nodes
+      for (size_t i = 0; i < count; ++i) {
+        auto root = TransformNode::New("root" + std::to_string(i), scene);
+        placeOnGrid(root.get(), i, count);
+        Node* parent = root.get();
+        for (size_t depth = 0; depth < 7; ++depth) {
+          auto node = TransformNode::New("node" + std::to_string(depth), scene);
+          node->position().y = 0.1f;
+          node->parent       = parent;
+          parent             = node.get();
+        }
+        auto box      = Mesh::CreateBox("box" + std::to_string(i), 1.f, scene);
+        box->material = material;
+        box->parent   = parent;
+      }
+    },
+    FRAMES, WARMUP_FRAMES));
+}
+
+void runInstancedMeshes(size_t count)
+{
+  SceneBenchmark benchmark("instanced_meshes_" + std::to_string(count), count);
+  report(benchmark.run(
+    [count](Scene* scene) {
+      addHemisphericLight(scene);
+      auto box      = Mesh::CreateBox("box", 1.f, scene);
+      box->material = StandardMaterial::New("material", scene);
+      placeOnGrid(box.get(), 0, count);
+      for (size_t i = 1; i < count; ++i) {
+        auto instance = box->createInstance("instance" + std::to_string(i));
+        placeOnGrid(instance.get(), i, count);
+      }
+    },
+    FRAMES, WARMUP_FRAMES));
+}
+
+/**
+ * @brief Creates a box skinned on a chain of bones, every vertex being
+ * influenced by the bone matching its height.
+ */
+MeshPtr createSkinnedBox(const std::string& name, size_t boneCount,
+                         Scene* scene)
+{
+  auto mesh     = Mesh::CreateBox(name, 1.f, scene);
+  auto skeleton = Skeleton::New(name + "_skeleton", name + "_skeleton", scene);
+
+  Bone* parent = nullptr;
+  for (size_t i = 0; i < boneCount; ++i) {
+    auto bone = Bone::New("bone" + std::to_string(i), skeleton.get(), parent,
+                          Matrix::Translation(0.f, 1.f, 0.f));
+    parent    = bone.get();
+  }
+
+  const auto positions = mesh->getVerticesData(VertexBuffer::PositionKind);
+  const auto vertexCount = positions.size() / 3;
+  Float32Array matricesIndices(vertexCount * 4, 0.f);
+  Float32Array matricesWeights(vertexCount * 4, 0.f);
+  for (size_t v = 0; v < vertexCount; ++v) {
+    const auto height = std::clamp(positions[v * 3 + 1] + 0.5f, 0.f, 1.f);
+    matricesIndices[v * 4] = std::floor(height * (boneCount - 1));
+    matricesWeights[v * 4] = 1.f;
+  }
+  mesh->setVerticesData(VertexBuffer::MatricesIndicesKind, matricesIndices,
+                        false);
+  mesh->setVerticesData(VertexBuffer::MatricesWeightsKind, matricesWeights,
+                        false);
+  mesh->skeleton = skeleton;
+
+  return mesh;
+}
+
+void runSkinnedCharacters(size_t count, bool computeBonesUsingShaders)
+{
+  const std::string name = computeBonesUsingShaders ? "skinned_gpu_" :
+                                                      "skinned_cpu_";
+  SceneBenchmark benchmark(name + std::to_string(count), count);
+  report(benchmark.run(
+    [count, computeBonesUsingShaders](Scene* scene) {
+      addHemisphericLight(scene);
+      auto material = StandardMaterial::New("material", scene);
+      for (size_t i = 0; i < count; ++i) {
+        auto mesh
+          = createSkinnedBox("character" + std::to_string(i), 16, scene);
+        mesh->material                 = material;
+        mesh->computeBonesUsingShaders = computeBonesUsingShaders;
+        placeOnGrid(mesh.get(), i, count);
+      }
+    },
+    FRAMES, WARMUP_FRAMES,
+    [](Scene* scene, size_t /*frame*/) {
+      // Animate every bone so that the skeletons are dirty each frame
+      auto axis = Vector3::Forward();
+      for (const auto& skeleton : scene->skeletons) {
+        for (const auto& bone : skeleton->bones) {
+          bone->rotate(axis, 0.01f);
+        }
+      }
+    }));
+}
+
+void runParticleSystems(size_t count, size_t capacity)
+{
+  SceneBenchmark benchmark("particle_systems_" + std::to_string(count), count);
+  report(benchmark.run(
+    [count, capacity](Scene* scene) {
+      // No particle texture is set: the CPU update of the particles is
+      // measured while the draw itself is skipped
+      for (size_t i = 0; i < count; ++i) {
+        auto system = new ParticleSystem("particles" + std::to_string(i),
+                                         capacity, scene);
+        auto emitter = Mesh::CreateBox("emitter" + std::to_string(i), 1.f,
+                                       scene);
+        placeOnGrid(emitter.get(), i, count, 20.f);
+        system->emitter = emitter;
+        system->createConeEmitter(0.1f, Math::PI / 4.f);
+        system->minEmitPower = 2.f;
+        system->maxEmitPower = 2.f;
+        system->updateSpeed  = 1.f / 60.f;
+        system->emitRate     = static_cast<float>(capacity);
+        system->start();
+      }
+    },
+    FRAMES, WARMUP_FRAMES));
+}
+
+void runShadowGenerators(size_t count)
+{
+  SceneBenchmark benchmark("shadow_casters_" + std::to_string(count), count);
+  report(benchmark.run(
+    [count](Scene* scene) {
+      auto light
+        = DirectionalLight::New("sun", Vector3(-1.f, -2.f, -1.f), scene);
+      light->position      = Vector3(200.f, 400.f, 200.f);
+      auto shadowGenerator = ShadowGenerator::New(1024, light);
+
+      auto material = StandardMaterial::New("material", scene);
+      auto ground   = Mesh::CreateGround("ground", 1000.f, 1000.f, 1, scene);
+      ground->material       = material;
+      ground->receiveShadows = true;
+      ground->position().y   = -1.f;
+
+      for (size_t i = 0; i < count; ++i) {
+        auto box      = Mesh::CreateBox("box" + std::to_string(i), 1.f, scene);
+        box->material = material;
+        placeOnGrid(box.get(), i, count);
+        shadowGenerator->addShadowCaster(box);
+      }
+    },
+    FRAMES, WARMUP_FRAMES));
+}
+
+void runMultiMaterials(size_t count)
+{
+  SceneBenchmark benchmark("multi_materials_" + std::to_string(count), count);
+  report(benchmark.run(
+    [count](Scene* scene) {
+      addHemisphericLight(scene);
+      // One material per box face
+      auto multiMaterial = MultiMaterial::New("multi", scene);
+      for (unsigned int face = 0; face < 6; ++face) {
+        auto material = StandardMaterial::New(
+          "material" + std::to_string(face), scene);
+        material->diffuseColor
+          = Color3(face / 6.f, 1.f - face / 6.f, 0.5f);
+        multiMaterial->subMaterials().emplace_back(material);
+      }
+
+      for (size_t i = 0; i < count; ++i) {
+        auto box      = Mesh::CreateBox("box" + std::to_string(i), 1.f, scene);
+        box->material = multiMaterial;
+        box->subMeshes.clear();
+        for (unsigned int face = 0; face < 6; ++face) {
+          SubMesh::CreateFromIndices(face, face * 6, 6, box);
+        }
+        placeOnGrid(box.get(), i, count);
+      }
+    },
+    FRAMES, WARMUP_FRAMES));
+}
+
+} // end of anonymous namespace
+
+TEST(BenchmarkScene, StaticMeshes1k)
+{
+  runStaticMeshes(1000);
+}
+
+TEST(BenchmarkScene, StaticMeshes10k)
+{
+  runStaticMeshes(10000);
+}
+
+TEST(BenchmarkScene, StaticMeshes100k)
+{
+  runStaticMeshes(100000);
+}
+
+TEST(BenchmarkScene, StaticMeshes100kParallelEvaluation)
+{
+  runStaticMeshes(100000, true);
+}
+
+TEST(BenchmarkScene, StaticHierarchy10k)
+{
+  runStaticHierarchy(10000, false);
+}
+
+TEST(BenchmarkScene, StaticHierarchy10kTransformHierarchy)
+{
+  runStaticHierarchy(10000, true);
+}
+
+TEST(BenchmarkScene, InstancedMeshes10k)
+{
+  runInstancedMeshes(10000);
+}
+
+TEST(BenchmarkScene, SkinnedCharactersGpu)
+{
+  runSkinnedCharacters(100, true);
+}
+
+TEST(BenchmarkScene, SkinnedCharactersCpu)
+{
+  runSkinnedCharacters(100, false);
+}
+
+TEST(BenchmarkScene, ParticleSystems)
+{
+  runParticleSystems(10, 2000);
+}
+
+TEST(BenchmarkScene, ShadowCasters1k)
+{
+  runShadowGenerators(1000);
+}
+
+TEST(BenchmarkScene, MultiMaterials1k)
+{
+  runMultiMaterials(1000);
+}
@@ -1,6 +1,8 @@
 #ifndef BABYLON_ANIMATIONS_IANIMATABLE_H
 #define BABYLON_ANIMATIONS_IANIMATABLE_H
 
+#include <functional>
+
 #include <babylon/animations/animation_value.h>
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_enums.h>
@@ -11,6 +13,13 @@ class Animation;
 class Node;
 using AnimationPtr = std::shared_ptr<Animation>;
 
+/**
+ * Setter of an animated property, resolved once from the target property path
+ * so that applying a value does not look the property up again.
+ */
+using AnimationPropertySetter
+  = std::function<void(const AnimationValue& value)>;
+
 class BABYLON_SHARED_EXPORT IAnimatable {
 
 public:
@@ -29,6 +38,15 @@ public:
   virtual void setProperty(const std::vector<std::string>& targetPropertyPath,
                            const AnimationValue& value);
 
+  /**
+   * @brief Resolves an animated property into a setter.
+   * @param targetPropertyPath defines the path of the animated property
+   * @returns the setter of the property, the default implementation forwards
+   * the values to setProperty
+   */
+  virtual AnimationPropertySetter
+  bindProperty(const std::vector<std::string>& targetPropertyPath);
+
   static AnimationValue getProperty(const std::string& key,
                                     const Color3& color);
   static AnimationValue getProperty(const std::string& key,
@@ -47,6 +65,16 @@ public:
   static void setProperty(const std::string& key, Quaternion& quaternion,
                           float value);
 
+  /**
+   * @brief Resolves a component key ("x", "r", ...) into the address of the
+   * component, nullptr if the key is unknown.
+   */
+  static float* bindProperty(const std::string& key, Color3& color);
+  static float* bindProperty(const std::string& key, Color4& color);
+  static float* bindProperty(const std::string& key, Vector2& vector);
+  static float* bindProperty(const std::string& key, Vector3& vector);
+  static float* bindProperty(const std::string& key, Quaternion& quaternion);
+
 protected:
   virtual Node*& get_parent();
   virtual void set_parent(Node* const& parent);
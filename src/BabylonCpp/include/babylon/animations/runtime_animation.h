@@ -1,9 +1,10 @@
 #ifndef BABYLON_ANIMATIONS_RUNTIME_ANIMATION_H
 #define BABYLON_ANIMATIONS_RUNTIME_ANIMATION_H
 
-#include <unordered_map>
+#include <map>
 
 #include <babylon/animations/animation_value.h>
+#include <babylon/animations/ianimatable.h>
 #include <babylon/babylon_api.h>
 
 namespace BABYLON {
@@ -153,6 +154,11 @@ private:
                  const AnimationValue& currentValue, float weight,
                  unsigned int targetIndex = 0);
 
+  /**
+   * @brief Writes a value into the animated property of the target.
+   */
+  void _applyValue(const IAnimatablePtr& target, const AnimationValue& value);
+
 public:
   /**
    * Current frame of the runtime animation
@@ -219,14 +225,16 @@ private:
   AnimationValue _originalBlendValue;
 
   /**
-   * The offsets cache of the runtime animation
+   * The offsets cache of the runtime animation, indexed by the (to, from)
+   * frame range
    */
-  std::unordered_map<std::string, AnimationValue> _offsetsCache;
+  std::map<std::pair<float, float>, AnimationValue> _offsetsCache;
 
   /**
-   * The high limits cache of the runtime animation
+   * The high limits cache of the runtime animation, indexed by the (to, from)
+   * frame range
    */
-  std::unordered_map<std::string, AnimationValue> _highLimitsCache;
+  std::map<std::pair<float, float>, AnimationValue> _highLimitsCache;
 
   /**
    * Specifies if the runtime animation has been stopped
@@ -258,6 +266,11 @@ private:
    */
   std::string _targetPath;
 
+  /**
+   * The setter of the animated property, resolved on first use
+   */
+  AnimationPropertySetter _propertySetter;
+
   /**
    * The weight of the runtime animation
    */
@@ -24,6 +24,7 @@ class IAnimatable;
 class RawTexture;
 class Scene;
 class Skeleton;
+class SkeletonPose;
 using AbstractMeshPtr = std::shared_ptr<AbstractMesh>;
 using IAnimatablePtr  = std::shared_ptr<IAnimatable>;
 using BonePtr         = std::shared_ptr<Bone>;
@@ -173,6 +174,37 @@ public:
    */
   void prepare();
 
+  /**
+   * @brief Hidden
+   * First step of prepare, updates the bones linked to transform nodes and
+   * allocates the matrices storage. Must be called from the main thread.
+   * @returns true if the bone matrices need to be computed
+   */
+  bool _beginPrepare();
+
+  /**
+   * @brief Hidden
+   * Second step of prepare, computes the bone matrices. Only touches the
+   * skeleton, its bones and its matrices so that several skeletons can be
+   * computed concurrently.
+   */
+  void _computeBoneMatrices();
+
+  /**
+   * @brief Hidden
+   * Last step of prepare, uploads the bone matrices texture. Must be called
+   * from the main thread.
+   */
+  void _endPrepare();
+
+  /**
+   * @brief Hidden
+   * Gets the other skeletons owning parents of the bones of this skeleton,
+   * whose bone matrices must be computed first.
+   * @param parentSkeletons defines the list the skeletons are added to
+   */
+  void _getParentSkeletons(std::vector<Skeleton*>& parentSkeletons) const;
+
   /**
    * @brief Gets the list of animatables currently running for this skeleton.
    * @returns an array of animatables
@@ -289,6 +321,9 @@ private:
   void _computeTransformMatrices(Float32Array& targetMatrix,
                                  const std::optional<Matrix>& initialSkinMatrix
                                  = std::nullopt);
+  bool _updatePoseHierarchy();
+  void _computeTransformMatricesFromPose(
+    Float32Array& targetMatrix, const std::optional<Matrix>& initialSkinMatrix);
   void _sortBones(unsigned int index, std::vector<BonePtr>& bones,
                   std::vector<bool>& visited);
 
@@ -309,6 +344,13 @@ public:
    */
   bool needInitialSkinMatrix;
 
+  /**
+   * Defines a boolean indicating that the bone matrices are computed from
+   * contiguous arrays sorted parent first, one level of the hierarchy at a time
+   * with the batch math kernels (false by default)
+   */
+  bool useBatchedBoneEvaluation;
+
   /**
    * Defines a mesh that override the matrix used to get the world matrix (null
    * by default).
@@ -385,6 +427,9 @@ private:
   size_t _uniqueId;
   bool _useTextureToStoreBoneMatrices;
   AnimationPropertiesOverride* _animationPropertiesOverride;
+  std::unique_ptr<SkeletonPose> _pose;
+  std::vector<Bone*> _poseParents;
+  std::vector<int> _poseOutputIndices;
 
 }; // end of class Bone
 
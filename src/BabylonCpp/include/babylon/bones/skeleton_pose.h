@@ -0,0 +1,97 @@
+#ifndef BABYLON_BONES_SKELETON_POSE_H
+#define BABYLON_BONES_SKELETON_POSE_H
+
+#include <optional>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+class Matrix;
+
+/**
+ * @brief Structure of arrays storage of the matrices of the bones of a
+ * skeleton.
+ *
+ * The local, world and inverse bind matrices of the bones are stored in
+ * contiguous arrays sorted parent first and grouped by depth in the hierarchy,
+ * so that the world matrices of a whole level of the hierarchy and the final
+ * transform matrices of all the bones are computed with a single call to the
+ * batch math kernels.
+ */
+class BABYLON_SHARED_EXPORT SkeletonPose {
+
+public:
+  SkeletonPose();
+  ~SkeletonPose();
+
+  /**
+   * @brief Sets the hierarchy of the bones.
+   * @param parentIndices defines the index of the parent of each bone (-1 for
+   * the root bones)
+   * @param outputIndices defines the matrix index at which the transform matrix
+   * of each bone is written (-1 to skip the bone)
+   * @returns false if the hierarchy is invalid (unknown parent or cycle), in
+   * which case the pose is left empty
+   */
+  bool setHierarchy(const std::vector<int>& parentIndices,
+                    const std::vector<int>& outputIndices);
+
+  /**
+   * @brief Gets the number of bones of the pose.
+   */
+  size_t boneCount() const;
+
+  /**
+   * @brief Sets the local matrix of a bone.
+   * @param bone defines the index of the bone
+   * @param matrix defines the 16 floats of the matrix
+   */
+  void setLocalMatrix(size_t bone, const float* matrix);
+
+  /**
+   * @brief Sets the inverse bind matrix (inverted absolute transform) of a
+   * bone.
+   * @param bone defines the index of the bone
+   * @param matrix defines the 16 floats of the matrix
+   */
+  void setInverseBindMatrix(size_t bone, const float* matrix);
+
+  /**
+   * @brief Copies the world matrix of a bone computed by the last evaluation.
+   * @param bone defines the index of the bone
+   * @param result defines the target matrix
+   */
+  void getWorldMatrixToRef(size_t bone, Matrix& result) const;
+
+  /**
+   * @brief Computes the world matrices of the bones and writes the transform
+   * matrices (inverse bind matrix multiplied by the world matrix) to the target
+   * array. Matrices which do not fit in the target array are skipped.
+   * @param initialSkinMatrix defines the matrix the root bones are attached to
+   * @param transformMatrices defines the target array
+   */
+  void evaluate(const std::optional<Matrix>& initialSkinMatrix,
+                Float32Array& transformMatrices);
+
+private:
+  // Slot of each bone in the evaluation order
+  std::vector<size_t> _slots;
+  // First slot of each level of the hierarchy, followed by the slot count
+  std::vector<size_t> _levelOffsets;
+  // Slot of the parent of each slot (unused for the root bones)
+  std::vector<size_t> _parentSlots;
+  // Matrix index of the transform matrix of each slot
+  std::vector<int> _outputIndices;
+  Float32Array _locals;
+  Float32Array _worlds;
+  Float32Array _inverseBinds;
+  Float32Array _parentWorlds;
+  Float32Array _transforms;
+
+}; // end of class SkeletonPose
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_BONES_SKELETON_POSE_H
@@ -47,10 +47,17 @@ public:
                      bool hasMaterial);
   /** Hidden */
   void _collide(std::vector<Plane>& trianglePlaneArray,
-                const std::vector<Vector3> pts, const IndicesArray& indices,
+                const std::vector<Vector3>& pts, const IndicesArray& indices,
                 size_t indexStart, size_t indexEnd, unsigned int decal,
                 bool hasMaterial);
   /** Hidden */
+  void _collide(std::vector<Plane>& trianglePlaneArray,
+                const std::vector<Vector3>& pts, const IndicesArray& indices,
+                const std::vector<size_t>& triangleIndexStarts,
+                unsigned int decal, bool hasMaterial);
+  /** Hidden */
+  void _getSweptBoundsToRef(Vector3& minimum, Vector3& maximum) const;
+  /** Hidden */
   void _getResponse(Vector3& pos, Vector3& vel);
 
 protected:
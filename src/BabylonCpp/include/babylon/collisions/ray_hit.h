@@ -0,0 +1,50 @@
+#ifndef BABYLON_COLLISIONS_RAY_HIT_H
+#define BABYLON_COLLISIONS_RAY_HIT_H
+
+#include <cstddef>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+class AbstractMesh;
+
+/**
+ * @brief Compact result of a ray of a picking batch.
+ * @see Scene::pickBatch
+ */
+struct BABYLON_SHARED_EXPORT RayHit {
+  /**
+   * Picked mesh, nullptr when the ray did not hit anything
+   */
+  AbstractMesh* mesh = nullptr;
+  /**
+   * Index of the picked face
+   */
+  size_t faceId = 0;
+  /**
+   * Index of the picked sub mesh
+   */
+  size_t subMeshId = 0;
+  /**
+   * World space distance from the ray origin to the hit point
+   */
+  float distance = 0.f;
+  /**
+   * Barycentric coordinates of the hit point in the picked face
+   */
+  float bu = 0.f;
+  float bv = 0.f;
+
+  /**
+   * @brief Gets whether the ray hit a mesh.
+   */
+  bool hit() const
+  {
+    return mesh != nullptr;
+  }
+}; // end of struct RayHit
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_COLLISIONS_RAY_HIT_H
@@ -29,12 +29,14 @@ public:
   bool empty();
   unsigned int level() const;
   system_time_point_t timestamp() const;
+  void setTimestamp(const system_time_point_t& timestamp);
   std::string getReadableTimestamp() const;
   std::string const& file() const;
   void setFile(char const* file);
   int const& lineNumber() const;
   void setLineNumber(int lineNumber);
   std::string const& threadId() const;
+  void setThreadId(const std::string& threadId);
   std::string const& context() const;
   std::string const& function() const;
   void setFunction(char const* func);
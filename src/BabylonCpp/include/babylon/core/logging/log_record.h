@@ -0,0 +1,133 @@
+#ifndef BABYLON_CORE_LOGGING_LOG_RECORD_H
+#define BABYLON_CORE_LOGGING_LOG_RECORD_H
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <streambuf>
+#include <thread>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Static description of a BABYLON_LOG_* statement, also holding its
+ * rate limiting state.
+ */
+struct BABYLON_SHARED_EXPORT LogCallSite {
+  LogCallSite(unsigned int iLevel, const char* iFile, int iLineNumber,
+              const char* iFunction, const char* iPrettyFunction)
+      : level{iLevel}
+      , file{iFile}
+      , lineNumber{iLineNumber}
+      , function{iFunction}
+      , prettyFunction{iPrettyFunction}
+      , windowStart{0}
+      , windowCount{0}
+      , suppressedCount{0}
+  {
+  }
+
+  const unsigned int level;
+  const char* const file;
+  const int lineNumber;
+  const char* const function;
+  const char* const prettyFunction;
+  // Start of the current one second window, in steady clock nanoseconds
+  std::atomic<int64_t> windowStart;
+  // Number of messages accepted during the current window
+  std::atomic<uint32_t> windowCount;
+  // Number of messages rejected since the last accepted one
+  std::atomic<uint32_t> suppressedCount;
+}; // end of struct LogCallSite
+
+/**
+ * @brief Fixed size binary log record, queued by the logging threads and
+ * formatted into a LogMessage by the logger thread.
+ */
+struct BABYLON_SHARED_EXPORT LogRecord {
+  /** Size of the context and message text, longer texts are truncated */
+  static constexpr size_t TextCapacity = 448;
+
+  const LogCallSite* callSite = nullptr;
+  system_time_point_t timestamp;
+  std::thread::id threadId;
+  /** Number of messages of the call site suppressed by the rate limiting */
+  uint32_t suppressedCount = 0;
+  uint16_t contextLength   = 0;
+  uint16_t messageLength   = 0;
+  /** Context followed by the message, not null terminated */
+  char text[TextCapacity];
+}; // end of struct LogRecord
+
+/**
+ * @brief Writes the context and the message of a log record without memory
+ * allocation.
+ */
+class BABYLON_SHARED_EXPORT LogRecordWriter : private std::streambuf {
+
+public:
+  /**
+   * @brief Starts a record for the given call site.
+   * @param callSite defines the log statement
+   * @param suppressedCount defines the number of suppressed messages of the
+   * call site
+   */
+  LogRecordWriter(const LogCallSite& callSite, uint32_t suppressedCount);
+  ~LogRecordWriter() override;
+
+  LogRecordWriter(const LogRecordWriter&) = delete;
+  LogRecordWriter& operator=(const LogRecordWriter&) = delete;
+
+  /**
+   * @brief Returns the stream of the context, to be written before the
+   * message.
+   */
+  std::ostream& context();
+
+  /**
+   * @brief Writes the arguments separated by spaces.
+   */
+  template <typename TF, typename... TR>
+  inline void write(TF&& msg, TR&&... rest)
+  {
+    _beginMessage();
+    _stream << msg;
+    ((_stream << " " << rest), ...);
+  }
+  inline void write()
+  {
+    _beginMessage();
+  }
+
+// Use "-Wall" to generate warnings in case of illegal printf format.
+#ifndef __GNUC__
+#define                                                                        \
+  __attribute__(x) // Disable 'attributes' if compiler does not support 'em
+#endif
+  /**
+   * @brief Writes a printf like message.
+   */
+  void writef(const char* printf_like_message, ...)
+    __attribute__((format(printf, 2, 3)));
+
+  /**
+   * @brief Returns the completed record.
+   */
+  const LogRecord& record();
+
+private:
+  int_type overflow(int_type ch) override;
+  void _beginMessage();
+
+private:
+  LogRecord _record;
+  std::ostream _stream;
+
+}; // end of class LogRecordWriter
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_LOGGING_LOG_RECORD_H
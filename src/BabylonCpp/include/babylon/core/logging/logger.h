@@ -2,11 +2,17 @@
 #define BABYLON_CORE_LOGGING_LOGGER_H
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 
 #include <babylon/core/delegates/delegate.h>
 #include <babylon/core/logging/log_levels.h>
 #include <babylon/core/logging/log_message.h>
+#include <babylon/core/logging/log_record.h>
 
 #if _MSC_VER && !__INTEL_COMPILER
 #ifndef __PRETTY_FUNCTION__
@@ -20,6 +26,12 @@
 #define thread_local __declspec(thread)
 #endif
 
+// Most detailed level compiled, the log statements of the higher levels are
+// removed at compile time
+#ifndef BABYLON_LOG_MAX_LEVEL
+#define BABYLON_LOG_MAX_LEVEL 5 // BABYLON::LogLevels::LEVEL_TRACE
+#endif
+
 namespace BABYLON {
 
 struct LogMessageHandler {
@@ -41,12 +53,20 @@ struct LogMessageHandler {
 /**
  * @brief Logger used througouht the application to allow configuration of
  * the log level required for the messages.
+ *
+ * The BABYLON_LOG_* statements write fixed size records into a preallocated
+ * lock-free queue. A logger thread turns them into log messages and calls the
+ * listeners, so the listeners may be called from another thread than the
+ * logging one. Records are dropped when the queue is full.
  */
 class BABYLON_SHARED_EXPORT Logger {
 
 public:
   using LogMessageListener = SA::delegate<void(const LogMessage&)>;
 
+  /** Maximum number of records waiting for the logger thread */
+  static constexpr size_t QueueCapacity = 1 << 11;
+
 public:
   static Logger& Instance()
   {
@@ -71,6 +91,50 @@ public:
   void log(const LogMessage& logMessage);
   bool takes(unsigned int level);
 
+  /**
+   * @brief Applies the rate limiting of a log statement.
+   * @param callSite defines the log statement
+   * @param suppressedCount receives the number of messages of the statement
+   * suppressed since the last accepted one
+   * @returns true if the message should be logged
+   */
+  bool admit(LogCallSite& callSite, uint32_t& suppressedCount);
+
+  /**
+   * @brief Queues a record for the logger thread, or dispatches it to the
+   * listeners when the logger is synchronous.
+   * @param record defines the record to log
+   */
+  void post(const LogRecord& record);
+
+  /**
+   * @brief Waits until the queued records are dispatched to the listeners.
+   */
+  void flush();
+
+  /**
+   * @brief Returns true if the records are dispatched by the logger thread.
+   */
+  bool isAsynchronous() const;
+
+  /**
+   * @brief Sets whether the records are dispatched by the logger thread or by
+   * the logging threads.
+   */
+  void setAsynchronous(bool value);
+
+  /**
+   * @brief Returns the maximum number of messages logged per second by a log
+   * statement, 0 when unlimited.
+   */
+  unsigned int maxMessagesPerSecond() const;
+
+  /**
+   * @brief Sets the maximum number of messages logged per second by a log
+   * statement, 0 for unlimited.
+   */
+  void setMaxMessagesPerSecond(unsigned int value);
+
   bool isSubscribed(unsigned int level, LogMessageListener& logMsgListener);
   void registerLogMessageListener(LogMessageListener& logMsgListener);
   void registerLogMessageListener(unsigned int level,
@@ -83,34 +147,60 @@ protected:
   Logger();
   ~Logger();
 
+private:
+  struct Slot;
+
+  bool _push(const LogRecord& record);
+  bool _pop(LogRecord& record);
+  void _run();
+  void _dispatch(const LogRecord& record);
+  void _dispatch(const LogMessage& logMessage);
+
 private:
   LogMessageHandler _impl;
+  // Protects the listeners, recursive so that a listener can log
+  std::recursive_mutex _listenersMutex;
+  std::atomic<bool> _asynchronous;
+  std::atomic<unsigned int> _maxMessagesPerSecond;
+  // Bounded multiple producers single consumer queue
+  std::unique_ptr<Slot[]> _slots;
+  std::atomic<size_t> _enqueuePosition;
+  size_t _dequeuePosition;
+  // Queue position up to which the records are dispatched
+  std::atomic<size_t> _dispatchedPosition;
+  // Highest queue position a flushing thread waits for
+  std::atomic<size_t> _flushPosition;
+  std::atomic<size_t> _droppedCount;
+  std::atomic<bool> _stopped;
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  std::condition_variable _flushedCondition;
+  std::thread _thread;
 
 }; // end of class LogChannel
 
 } // end of namespace BABYLON
 
-#define BABYLON_LOG_MSG(level, context, ...)                                   \
-  if (BABYLON::Logger::Instance().takes(level)) {                              \
-    std::ostringstream _ctx;                                                   \
-    _ctx << context;                                                           \
-    BABYLON::LogMessage _logMessage                                            \
-      = BABYLON::Logger::CreateMessage(level, _ctx.str(), __FILE__, __LINE__,  \
-                                       __FUNCTION__, __PRETTY_FUNCTION__);     \
-    _logMessage.write(__VA_ARGS__);                                            \
-    BABYLON::Logger::Instance().log(std::move(_logMessage));                   \
+#define BABYLON_LOG_RECORD(level, log_context, write_call)                     \
+  if ((level) <= BABYLON_LOG_MAX_LEVEL                                         \
+      && BABYLON::Logger::Instance().takes(level)) {                           \
+    static BABYLON::LogCallSite _logCallSite{                                  \
+      level, __FILE__, __LINE__, __FUNCTION__, __PRETTY_FUNCTION__};           \
+    uint32_t _logSuppressedCount = 0;                                          \
+    if (BABYLON::Logger::Instance().admit(_logCallSite,                        \
+                                          _logSuppressedCount)) {              \
+      BABYLON::LogRecordWriter _logWriter{_logCallSite, _logSuppressedCount};  \
+      _logWriter.context() << log_context;                                     \
+      _logWriter.write_call;                                                   \
+      BABYLON::Logger::Instance().post(_logWriter.record());                   \
+    }                                                                          \
   }
 
+#define BABYLON_LOG_MSG(level, context, ...)                                   \
+  BABYLON_LOG_RECORD(level, context, write(__VA_ARGS__))
+
 #define BABYLON_LOGF_MSG(level, context, printf_like_message, ...)             \
-  if (BABYLON::Logger::Instance().takes(level)) {                              \
-    std::ostringstream _ctx;                                                   \
-    _ctx << context;                                                           \
-    BABYLON::LogMessage _logMessage                                            \
-      = BABYLON::Logger::CreateMessage(level, _ctx.str(), __FILE__, __LINE__,  \
-                                       __FUNCTION__, __PRETTY_FUNCTION__);     \
-    _logMessage.writef(printf_like_message, __VA_ARGS__);                      \
-    BABYLON::Logger::Instance().log(std::move(_logMessage));                   \
-  }
+  BABYLON_LOG_RECORD(level, context, writef(printf_like_message, __VA_ARGS__))
 
 // -- Default API syntax with variadic input parameters --
 #define BABYLON_LOG_ERROR(context, ...)                                        \
@@ -0,0 +1,85 @@
+#ifndef BABYLON_CORE_THREAD_POOL_H
+#define BABYLON_CORE_THREAD_POOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Fixed size pool of worker threads used to run engine internal tasks
+ * in parallel (active meshes evaluation, skinning, simplification...).
+ */
+class BABYLON_SHARED_EXPORT ThreadPool {
+
+public:
+  using Task      = std::function<void()>;
+  using RangeTask = std::function<void(size_t begin, size_t end)>;
+
+public:
+  /**
+   * @brief Creates a pool with the given number of worker threads.
+   * @param threadCount number of worker threads, when 0 one worker per
+   * hardware thread minus the calling thread is created
+   */
+  explicit ThreadPool(size_t threadCount = 0);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /**
+   * @brief Returns the process wide pool shared by the engine.
+   */
+  static ThreadPool& Default();
+
+  /**
+   * @brief Returns the number of worker threads.
+   */
+  size_t threadCount() const;
+
+  /**
+   * @brief Returns true when called from one of the workers of this pool.
+   */
+  bool isWorkerThread() const;
+
+  /**
+   * @brief Queues a task to be run on a worker thread.
+   * @param task the task to run
+   * @return a future becoming ready once the task has run
+   */
+  std::future<void> enqueue(Task task);
+
+  /**
+   * @brief Splits the range [0, count) into chunks of at most grainSize
+   * elements and processes them in parallel. The calling thread takes part in
+   * the work and the call returns once every chunk has been processed. The
+   * first exception thrown by a chunk is rethrown to the caller.
+   * @param count number of elements to process
+   * @param grainSize maximum number of elements per chunk
+   * @param task function processing the elements in [begin, end)
+   */
+  void parallelFor(size_t count, size_t grainSize, const RangeTask& task);
+
+private:
+  void _workerLoop();
+
+private:
+  std::vector<std::thread> _workers;
+  std::deque<Task> _tasks;
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  bool _stopping;
+
+}; // end of class ThreadPool
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_THREAD_POOL_H
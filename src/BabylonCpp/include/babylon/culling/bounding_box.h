@@ -206,7 +206,7 @@ public:
 
 private:
   Matrix _worldMatrix;
-  static std::array<Vector3, 3> TmpVector3;
+  static std::array<Vector3, 3>& TmpVector3();
 
 }; // end of class BoundingBox
 
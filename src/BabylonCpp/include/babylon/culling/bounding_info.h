@@ -155,7 +155,7 @@ public:
 
 private:
   bool _isLocked;
-  static std::array<Vector3, 2> TmpVector3;
+  static std::array<Vector3, 2>& TmpVector3();
 
 }; // end of class BoundingInfo
 
@@ -0,0 +1,145 @@
+#ifndef BABYLON_CULLING_DYNAMIC_BVH_H
+#define BABYLON_CULLING_DYNAMIC_BVH_H
+
+#include <array>
+#include <utility>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/math/vector3.h>
+
+namespace BABYLON {
+
+class Plane;
+
+/**
+ * @brief Bounding volume hierarchy of boxes that can be moved, added and
+ * removed individually.
+ *
+ * Each box is stored in a leaf enlarged by a margin, so that a box moving
+ * inside its enlarged bounds does not modify the tree. Otherwise its leaf is
+ * removed and inserted again at the place that least increases the surface of
+ * the tree, and the ancestors are refitted and rebalanced by rotations.
+ */
+class BABYLON_SHARED_EXPORT DynamicBVH {
+
+public:
+  /** Identifier of a missing node */
+  static constexpr int NullNode = -1;
+
+public:
+  /**
+   * @brief Creates an empty hierarchy.
+   * @param margin defines by how much the boxes are enlarged, relatively to
+   * their size
+   */
+  DynamicBVH(float margin = 0.1f);
+  ~DynamicBVH();
+
+  /**
+   * @brief Adds a box to the hierarchy.
+   * @param minimum defines the minimum of the box
+   * @param maximum defines the maximum of the box
+   * @param data defines the value returned when the box is selected
+   * @returns the identifier of the box
+   */
+  int createProxy(const Vector3& minimum, const Vector3& maximum, size_t data);
+
+  /**
+   * @brief Removes a box from the hierarchy.
+   * @param proxyId defines the identifier of the box
+   */
+  void destroyProxy(int proxyId);
+
+  /**
+   * @brief Updates the bounds of a box.
+   * @param proxyId defines the identifier of the box
+   * @param minimum defines the new minimum of the box
+   * @param maximum defines the new maximum of the box
+   * @returns true if the tree was modified, false if the box still fits in
+   * its enlarged bounds
+   */
+  bool moveProxy(int proxyId, const Vector3& minimum, const Vector3& maximum);
+
+  /**
+   * @brief Gets whether a box still fits in the enlarged bounds of a proxy, in
+   * which case moveProxy does not modify the tree. It can be called
+   * concurrently as long as the tree is not modified.
+   * @param proxyId defines the identifier of the box
+   * @param minimum defines the new minimum of the box
+   * @param maximum defines the new maximum of the box
+   * @returns true if the box fits in the enlarged bounds of the proxy
+   */
+  bool fitsProxy(int proxyId, const Vector3& minimum,
+                 const Vector3& maximum) const;
+
+  /**
+   * @brief Gets the value associated to a box.
+   * @param proxyId defines the identifier of the box
+   */
+  size_t getData(int proxyId) const;
+
+  /**
+   * @brief Gets the number of boxes of the hierarchy.
+   */
+  size_t proxyCount() const;
+
+  /**
+   * @brief Gets the height of the tree, 0 for a single leaf.
+   */
+  int height() const;
+
+  /**
+   * @brief Selects the boxes whose enlarged bounds are in the frustum.
+   * @param frustumPlanes defines the frustum planes
+   * @param selection defines the list to which the values of the selected
+   * boxes are appended
+   */
+  void select(const std::array<Plane, 6>& frustumPlanes,
+              std::vector<size_t>& selection) const;
+
+private:
+  struct Node {
+    Vector3 minimum;
+    Vector3 maximum;
+    // Parent, or next free node when the node is not used
+    int parent;
+    int child1;
+    int child2;
+    // Height of the subtree, 0 for a leaf and -1 for a free node
+    int height;
+    size_t data;
+
+    bool isLeaf() const
+    {
+      return child1 == NullNode;
+    }
+  }; // end of struct Node
+
+  int _allocateNode();
+  void _freeNode(int nodeId);
+  void _insertLeaf(int leaf);
+  void _removeLeaf(int leaf);
+  int _balance(int nodeId);
+  void _refit(int nodeId);
+
+public:
+  /**
+   * Relative margin by which the boxes are enlarged
+   */
+  float margin;
+
+private:
+  std::vector<Node> _nodes;
+  int _root;
+  int _freeList;
+  size_t _proxyCount;
+  // Traversal stack reused by the selections, nodes known to be entirely in
+  // the frustum are flagged
+  mutable std::vector<std::pair<int, bool>> _stack;
+
+}; // end of class DynamicBVH
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_DYNAMIC_BVH_H
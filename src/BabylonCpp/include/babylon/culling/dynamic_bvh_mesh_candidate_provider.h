@@ -0,0 +1,104 @@
+#ifndef BABYLON_CULLING_DYNAMIC_BVH_MESH_CANDIDATE_PROVIDER_H
+#define BABYLON_CULLING_DYNAMIC_BVH_MESH_CANDIDATE_PROVIDER_H
+
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/culling/dynamic_bvh.h>
+#include <babylon/engines/iactive_mesh_candidate_provider.h>
+#include <babylon/misc/observer.h>
+
+namespace BABYLON {
+
+class AbstractMesh;
+class Scene;
+
+/**
+ * @brief Active mesh candidate provider keeping the world bounding boxes of
+ * the meshes of a scene in a dynamic bounding volume hierarchy.
+ *
+ * Unlike the selection octree, which has to be rebuilt when the meshes move,
+ * the hierarchy is maintained incrementally: only the meshes leaving their
+ * enlarged bounds are reinserted. The candidates are then selected against
+ * the frustum in time proportional to the visible part of the tree, and every
+ * mesh is stored in a single leaf so no duplicate has to be removed.
+ *
+ * When the scene evaluates its active meshes in parallel, the world matrices
+ * of the meshes and the checks of their boxes against their enlarged bounds
+ * are computed on the worker threads as well, only the modifications of the
+ * tree are serial.
+ *
+ * The provider registers itself on the scene when created and unregisters
+ * itself when destroyed, which must happen before the scene is disposed.
+ */
+class BABYLON_SHARED_EXPORT DynamicBVHMeshCandidateProvider
+    : public IActiveMeshCandidateProvider {
+
+public:
+  /**
+   * @brief Creates the provider and adds the meshes of the scene to it.
+   * @param scene defines the scene whose meshes are selected
+   * @param margin defines by how much the boxes are enlarged, relatively to
+   * their size
+   */
+  DynamicBVHMeshCandidateProvider(Scene* scene, float margin = 0.1f);
+  ~DynamicBVHMeshCandidateProvider() override;
+
+  /**
+   * @brief Return the list of active mesh candidates: the meshes whose
+   * bounding box may be in the frustum of the scene, and the meshes that are
+   * always selected.
+   * @param scene defines the current scene
+   * @returns the list of active mesh candidates
+   */
+  std::vector<AbstractMesh*> getMeshes(Scene* scene) override;
+
+  /**
+   * @brief Indicates if the meshes have been checked to make sure they are
+   * isEnabled().
+   */
+  bool checksIsEnabled() const override;
+
+  /**
+   * @brief Gets the hierarchy of the mesh bounding boxes.
+   */
+  const DynamicBVH& bvh() const;
+
+private:
+  enum class EntryUpdate {
+    // The box of the mesh still fits in its enlarged bounds
+    None,
+    // The mesh must be inserted or moved in the hierarchy
+    Move,
+    // The mesh is selected regardless of its bounding box
+    Unbounded,
+  }; // end of enum class EntryUpdate
+
+  struct Entry {
+    AbstractMesh* mesh;
+    // DynamicBVH::NullNode when the mesh is not in the hierarchy
+    int proxyId;
+    EntryUpdate update;
+    // Whether the entry is evaluated on a worker thread
+    bool concurrent;
+  }; // end of struct Entry
+
+  void _addMesh(AbstractMesh* mesh);
+  void _removeMesh(AbstractMesh* mesh);
+  // Only reads the hierarchy, so that the entries can be evaluated
+  // concurrently
+  void _evaluateEntry(Entry& entry, bool computeWorldMatrix) const;
+
+private:
+  Scene* _scene;
+  DynamicBVH _bvh;
+  std::vector<Entry> _entries;
+  std::vector<size_t> _selection;
+  Observer<AbstractMesh>::Ptr _onNewMeshAddedObserver;
+  Observer<AbstractMesh>::Ptr _onMeshRemovedObserver;
+
+}; // end of class DynamicBVHMeshCandidateProvider
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_DYNAMIC_BVH_MESH_CANDIDATE_PROVIDER_H
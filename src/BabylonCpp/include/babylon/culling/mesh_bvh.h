@@ -0,0 +1,140 @@
+#ifndef BABYLON_CULLING_MESH_BVH_H
+#define BABYLON_CULLING_MESH_BVH_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/collisions/intersection_info.h>
+#include <babylon/core/structs.h>
+#include <babylon/math/vector3.h>
+
+namespace BABYLON {
+
+class Ray;
+
+/**
+ * @brief Bounding volume hierarchy of the triangles of an indexed geometry,
+ * used to speed up picking and collisions, or of a list of boxes.
+ *
+ * The hierarchy is built top-down with binned surface area heuristic splits
+ * and stored as a flat array of nodes in depth-first order: the first child
+ * of an internal node directly follows it.
+ */
+class BABYLON_SHARED_EXPORT MeshBVH {
+
+public:
+  using TrianglePredicate = std::function<bool(
+    const Vector3& p0, const Vector3& p1, const Vector3& p2, const Ray& ray)>;
+
+  /**
+   * @brief Node of the hierarchy.
+   */
+  struct Node {
+    /** Bounds of the triangles of the node */
+    std::array<float, 3> minimum;
+    std::array<float, 3> maximum;
+    /** Leaf: index of the first primitive of the leaf in the primitive list;
+     * internal node: index of the second child */
+    uint32_t offset;
+    /** Number of primitives of a leaf, 0 for an internal node */
+    uint16_t count;
+    /** Split axis of an internal node */
+    uint16_t axis;
+  }; // end of struct Node
+
+  /** Maximum number of primitives of a leaf */
+  static constexpr size_t MaxLeafPrimitives = 4;
+
+  /** Number of bins evaluated per axis when splitting a node */
+  static constexpr size_t BinCount = 12;
+
+public:
+  /**
+   * @brief Builds the hierarchy of the triangles of an indexed geometry.
+   * @param positions defines the vertex positions
+   * @param indices defines the indices, 3 per triangle
+   */
+  MeshBVH(const std::vector<Vector3>& positions, const IndicesArray& indices);
+
+  /**
+   * @brief Builds the hierarchy of a list of boxes.
+   * @param bounds defines the boxes
+   */
+  explicit MeshBVH(const std::vector<MinMax>& bounds);
+  ~MeshBVH();
+
+  /**
+   * @brief Gets the number of primitives (triangles or boxes) of the
+   * hierarchy.
+   */
+  size_t primitiveCount() const;
+
+  /**
+   * @brief Gets the nodes of the hierarchy, the root being the first one.
+   */
+  const std::vector<Node>& nodes() const;
+
+  /**
+   * @brief Intersects a ray with the triangles of an index range, giving the
+   * same result as testing every triangle of the range.
+   * @param ray defines the ray, in the space of the positions
+   * @param positions defines the positions the hierarchy was built from
+   * @param indices defines the indices the hierarchy was built from
+   * @param indexStart defines the first index of the range
+   * @param indexCount defines the number of indices of the range
+   * @param fastCheck defines whether the first hit is returned instead of the
+   * closest one
+   * @param trianglePredicate defines an optional filter of the triangles
+   * @returns the intersection info of the hit, faceId being the index of the
+   * triangle in the index buffer
+   */
+  std::optional<IntersectionInfo>
+  intersectsRay(Ray& ray, const std::vector<Vector3>& positions,
+                const IndicesArray& indices, size_t indexStart,
+                size_t indexCount, bool fastCheck,
+                const TrianglePredicate& trianglePredicate = nullptr) const;
+
+  /**
+   * @brief Visits the primitives of the leaves crossed by a ray, the nearest
+   * leaves first.
+   * @param ray defines the ray
+   * @param callback defines the function called with the index of each
+   * primitive, returning the distance along the ray beyond which leaves are
+   * skipped, or a negative value to stop the traversal
+   */
+  void forEachRayCandidate(
+    const Ray& ray,
+    const std::function<float(size_t primitive)>& callback) const;
+
+  /**
+   * @brief Collects the triangles of an index range whose bounds overlap a
+   * box.
+   * @param minimum defines the minimum of the box
+   * @param maximum defines the maximum of the box
+   * @param positions defines the positions the hierarchy was built from
+   * @param indices defines the indices the hierarchy was built from
+   * @param indexStart defines the first index of the range
+   * @param indexCount defines the number of indices of the range
+   * @param triangles defines the list to which the index of the first index
+   * of each overlapping triangle is appended
+   */
+  void intersectsBox(const Vector3& minimum, const Vector3& maximum,
+                     const std::vector<Vector3>& positions,
+                     const IndicesArray& indices, size_t indexStart,
+                     size_t indexCount, std::vector<size_t>& triangles) const;
+
+private:
+  std::vector<Node> _nodes;
+  // Index of each primitive (first index / 3 for triangles), ordered by leaf
+  std::vector<uint32_t> _primitives;
+
+}; // end of class MeshBVH
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_MESH_BVH_H
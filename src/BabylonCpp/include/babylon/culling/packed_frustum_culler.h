@@ -0,0 +1,79 @@
+#ifndef BABYLON_CULLING_PACKED_FRUSTUM_CULLER_H
+#define BABYLON_CULLING_PACKED_FRUSTUM_CULLER_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/math/vector3.h>
+
+namespace BABYLON {
+
+class BoundingInfo;
+class Plane;
+
+/**
+ * @brief Frustum culling of a batch of bounding volumes stored in structures
+ * of arrays.
+ *
+ * The world bounding spheres and boxes are copied in packed arrays, tested
+ * several at a time with the SIMD kernels of MathKernels. The volumes are
+ * grouped in blocks whose bounds are tested first: a block outside of the
+ * frustum is culled and a block entirely inside is kept without testing its
+ * volumes, otherwise its volumes are only tested against the planes crossing
+ * the block. The plane which culled a block is tested first the next time.
+ */
+class BABYLON_SHARED_EXPORT PackedFrustumCuller {
+
+public:
+  /** Number of volumes per block, a multiple of all the SIMD widths */
+  static constexpr size_t BlockSize = 32;
+
+public:
+  PackedFrustumCuller();
+  ~PackedFrustumCuller();
+
+  /**
+   * @brief Removes all the volumes and reserves memory for a new batch.
+   * @param capacity defines the maximum number of volumes of the batch
+   */
+  void reset(size_t capacity);
+
+  /**
+   * @brief Appends the world bounding volumes of a bounding info.
+   * @param boundingInfo defines the bounding info, updated in world space
+   * @returns the index of the volume in the batch
+   */
+  size_t add(const BoundingInfo& boundingInfo);
+
+  /**
+   * @brief Gets the number of volumes of the batch.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Tests the volumes of the batch against the frustum, same as
+   * BoundingInfo::isInFrustum with the standard culling strategy.
+   * @param frustumPlanes defines the frustum planes
+   * @param visible defines the list receiving 1 for the volumes in the
+   * frustum and 0 for the others, resized to the number of volumes
+   */
+  void cull(const std::array<Plane, 6>& frustumPlanes,
+            std::vector<uint8_t>& visible);
+
+private:
+  // Packed components, each one stored in an array of _stride floats
+  std::vector<float> _volumes;
+  size_t _stride;
+  size_t _count;
+  std::vector<Vector3> _blockMinimums;
+  std::vector<Vector3> _blockMaximums;
+  // Index of the plane which culled each block during the last test
+  std::vector<uint8_t> _blockCullingPlanes;
+
+}; // end of class PackedFrustumCuller
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_PACKED_FRUSTUM_CULLER_H
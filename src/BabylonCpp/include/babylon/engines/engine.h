@@ -48,6 +48,7 @@ class InternalTexture;
 class IPipelineContext;
 struct IRenderTargetOptions;
 class Material;
+struct MaterialDefines;
 class PassPostProcess;
 class PostProcess;
 class ProgressEvent;
@@ -992,11 +993,21 @@ public:
    * @param indexParameters defines an object containing the index values to use
    * to compile shaders (like the maximum number of simultaneous lights)
    * @returns the new Effect
+   * @remark When options.defines is empty and options.materialDefines is set,
+   * the compiled effects are looked up through the hash of the material
+   * defines and the defines string is only built for new effects.
    */
   EffectPtr createEffect(
     const std::string& baseName, EffectCreationOptions& options, Engine* engine,
     const std::function<void(const EffectPtr& effect)>& onCompiled = nullptr);
 
+  /**
+   * @brief Hidden
+   * Returns the number of compiled effects indexed by the hash of their
+   * material defines.
+   */
+  size_t _getCompiledEffectsByDefinesCount() const;
+
   /**
    * @brief Create a new effect (used to store vertex/fragment shaders).
    * @param baseName defines the base name of the effect (The name of file
@@ -2791,6 +2802,17 @@ private:
   std::optional<_TimeToken> _currentNonTimestampToken;
 
   std::unordered_map<std::string, EffectPtr> _compiledEffects;
+  // Effects created from material defines, indexed by the hash of their base
+  // name and defines. The copy of the defines loses their derived type, the
+  // image processing defines are kept aside as a bit mask
+  struct CompiledEffectDefines {
+    std::string baseName;
+    std::shared_ptr<MaterialDefines> defines;
+    uint32_t imageProcessingBitMask;
+    EffectPtr effect;
+  }; // end of struct CompiledEffectDefines
+  std::unordered_map<uint64_t, std::vector<CompiledEffectDefines>>
+    _compiledEffectsByDefines;
   std::vector<bool> _vertexAttribArraysEnabled;
   GL::IGLVertexArrayObject* _cachedVertexArrayObject;
   bool _uintIndicesCurrentlySet;
@@ -0,0 +1,48 @@
+#ifndef BABYLON_ENGINES_HEADLESS_HEADLESS_CANVAS_H
+#define BABYLON_ENGINES_HEADLESS_HEADLESS_CANVAS_H
+
+#include <babylon/babylon_api.h>
+#include <babylon/interfaces/icanvas.h>
+
+namespace BABYLON {
+
+namespace GL {
+class RecordingGLRenderingContext;
+} // end of namespace GL
+
+/**
+ * @brief Canvas stand-in without any window or GPU context. The 3D context of
+ * a headless canvas is a RecordingGLRenderingContext, which allows to create
+ * an Engine and render scenes on machines without a display or GL driver
+ * (CI machines, benchmark hosts, servers).
+ */
+class BABYLON_SHARED_EXPORT HeadlessCanvas : public ICanvas {
+
+public:
+  /**
+   * @brief Creates a new headless canvas.
+   * @param width The width of the canvas (and of its drawing buffer)
+   * @param height The height of the canvas (and of its drawing buffer)
+   */
+  HeadlessCanvas(int width = 1024, int height = 768);
+  ~HeadlessCanvas() override;
+
+  ClientRect& getBoundingClientRect() override;
+  bool onlyRenderBoundingClientRect() const override;
+  bool initializeContext3d() override;
+  ICanvasRenderingContext2D* getContext2d() override;
+  GL::IGLRenderingContext* getContext3d(const EngineOptions& options) override;
+
+  /**
+   * @brief Returns the recording context used as 3D context by this canvas.
+   */
+  GL::RecordingGLRenderingContext* recordingContext();
+
+private:
+  GL::RecordingGLRenderingContext* _recordingContext;
+
+}; // end of class HeadlessCanvas
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ENGINES_HEADLESS_HEADLESS_CANVAS_H
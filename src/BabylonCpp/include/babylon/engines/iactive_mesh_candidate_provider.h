@@ -0,0 +1,37 @@
+#ifndef BABYLON_ENGINES_IACTIVE_MESH_CANDIDATE_PROVIDER_H
+#define BABYLON_ENGINES_IACTIVE_MESH_CANDIDATE_PROVIDER_H
+
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+class AbstractMesh;
+class Scene;
+
+/**
+ * @brief Interface used to let developers provide their own mesh selection
+ * mechanism.
+ * @see Scene::setActiveMeshCandidateProvider
+ */
+struct BABYLON_SHARED_EXPORT IActiveMeshCandidateProvider {
+  virtual ~IActiveMeshCandidateProvider() = default;
+
+  /**
+   * @brief Return the list of active meshes.
+   * @param scene defines the current scene
+   * @returns the list of active meshes
+   */
+  virtual std::vector<AbstractMesh*> getMeshes(Scene* scene) = 0;
+
+  /**
+   * @brief Indicates if the meshes have been checked to make sure they are
+   * isEnabled().
+   */
+  virtual bool checksIsEnabled() const = 0;
+}; // end of struct IActiveMeshCandidateProvider
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ENGINES_IACTIVE_MESH_CANDIDATE_PROVIDER_H
@@ -195,6 +195,14 @@ public:
    */
   void _markSyncedWithParent();
 
+  /**
+   * @brief Hidden
+   * Returns true if the node was synchronized with the last world matrix
+   * update of its parent. Unlike isSynchronizedWithParent, the parent chain is
+   * not validated.
+   */
+  bool _isSyncedWithParentUpdate() const;
+
   /**
    * @brief Hidden
    */
@@ -3,10 +3,12 @@
 
 #include <nlohmann/json.hpp>
 #include <regex>
+#include <unordered_set>
 #include <variant>
 
 #include <babylon/animations/ianimatable.h>
 #include <babylon/babylon_api.h>
+#include <babylon/collisions/ray_hit.h>
 #include <babylon/core/structs.h>
 #include <babylon/culling/octrees/octree.h>
 #include <babylon/engines/abstract_scene.h>
@@ -58,6 +60,7 @@ class KeyboardInfoPre;
 class Mesh;
 class Node;
 class OutlineRenderer;
+class PackedFrustumCuller;
 class PostProcess;
 class PostProcessManager;
 class PostProcessRenderPipelineManager;
@@ -67,6 +70,7 @@ class RenderingManager;
 class RuntimeAnimation;
 class SimplificationQueue;
 class SoundTrack;
+class TransformHierarchy;
 class UniformBuffer;
 using AnimatablePtr             = std::shared_ptr<Animatable>;
 using BoundingBoxRendererPtr    = std::shared_ptr<BoundingBoxRenderer>;
@@ -1453,6 +1457,29 @@ public:
   multiPickWithRay(const Ray& ray,
                    const std::function<bool(AbstractMesh* mesh)>& predicate);
 
+  /**
+   * @brief Launches a batch of rays against the meshes of the scene. The
+   * meshes are gathered once for the whole batch and the rays are distributed
+   * over the worker threads.
+   * @param rays The rays (in world space) to use to pick meshes
+   * @param predicate Predicate function used to determine eligible meshes. Can
+   * be set to null. In this case, a mesh must be enabled, visible and with
+   * isPickable set to true. It is called once per mesh for the whole batch
+   * @param fastCheck Defines whether each ray stops at its first hit instead
+   * of looking for the closest one
+   * @param trianglePredicate Predicate function used to select faces, called
+   * from the worker threads. Can be set to null
+   * @returns the hit of each ray, in the order of the rays
+   */
+  std::vector<RayHit> pickBatch(
+    const std::vector<Ray>& rays,
+    const std::function<bool(const AbstractMeshPtr& mesh)>& predicate = nullptr,
+    bool fastCheck = false,
+    const std::function<bool(const Vector3& p0, const Vector3& p1,
+                             const Vector3& p2, const Ray& ray)>&
+      trianglePredicate
+    = nullptr);
+
   /**
    * @brief Force the value of meshUnderPointer.
    * @param mesh defines the mesh to use
@@ -1756,7 +1783,13 @@ private:
   void _processLateAnimationBindings();
   void _evaluateSubMesh(SubMesh* subMesh, AbstractMesh* mesh);
   void _evaluateActiveMeshes();
+  void _evaluateActiveMeshCandidatesInParallel(
+    std::vector<AbstractMesh*>& meshes, TransformHierarchy* transformHierarchy);
+  void _evaluateActiveMeshCandidatesPacked(
+    std::vector<AbstractMesh*>& meshes, TransformHierarchy* transformHierarchy,
+    bool checkIsEnabled);
   void _activeMesh(AbstractMesh* sourceMesh, AbstractMesh* mesh);
+  void _prepareActiveSkeletonsInParallel();
   void _renderForCamera(const CameraPtr& camera,
                         const CameraPtr& rigParent = nullptr);
   void _processSubCameras(const CameraPtr& camera);
@@ -2981,6 +3014,53 @@ public:
    */
   bool dispatchAllSubMeshesOfActiveMeshes;
 
+  /**
+   * Gets or sets a boolean indicating that the world matrices and the frustum
+   * tests of the active mesh candidates are computed on the worker threads of
+   * the default thread pool. The active meshes are then merged serially in the
+   * candidates order (This could help when you are CPU bound with a large
+   * number of meshes)
+   */
+  bool parallelActiveMeshesEvaluation;
+
+  /**
+   * Gets or sets the minimum number of active mesh candidates required to
+   * evaluate them in parallel. Default is 1024
+   */
+  size_t parallelActiveMeshesEvaluationThreshold;
+
+  /**
+   * Gets or sets a boolean indicating that the frustum tests of the active
+   * mesh candidates are batched: their world bounding volumes are packed and
+   * tested several at a time with SIMD instructions, by blocks of nearby
+   * meshes (This could help when you are CPU bound with a large number of
+   * meshes). Not used when the candidates are evaluated in parallel
+   */
+  bool packedFrustumCulling;
+
+  /**
+   * Gets or sets the minimum number of active mesh candidates required to
+   * batch their frustum tests. Default is 256
+   */
+  size_t packedFrustumCullingThreshold;
+
+  /**
+   * Gets or sets a boolean indicating that the bone matrices of the active
+   * skeletons are computed on the worker threads of the default thread pool,
+   * once all the active meshes are evaluated (This could help when you are CPU
+   * bound with a large number of animated skeletons)
+   */
+  bool parallelSkeletonsEvaluation;
+
+  /**
+   * Gets or sets a boolean indicating that the world matrices are updated by a
+   * scene wide transform hierarchy before evaluating the active meshes: the
+   * nodes are visited once in topological order and only the dirty subtrees
+   * are recomputed (This could help with deep hierarchies or large static
+   * scenes)
+   */
+  bool useTransformHierarchy;
+
   /** Hidden */
   std::vector<IParticleSystem*> _activeParticleSystems;
 
@@ -3429,7 +3509,17 @@ private:
   std::vector<MaterialPtr> _processedMaterials;
   std::vector<RenderTargetTexturePtr> _renderTargets;
   std::vector<SkeletonPtr> _activeSkeletons;
+  std::unordered_set<Skeleton*> _activeSkeletonsSet;
   std::vector<Mesh*> _softwareSkinnedMeshes;
+  std::unordered_set<Mesh*> _softwareSkinnedMeshesSet;
+  // Per candidate flags filled by the parallel or packed active meshes
+  // evaluation
+  std::vector<uint8_t> _activeMeshCandidateStates;
+  std::unique_ptr<PackedFrustumCuller> _packedFrustumCuller;
+  // Candidate index and visibility of each packed bounding volume
+  std::vector<size_t> _packedCandidateIndices;
+  std::vector<uint8_t> _packedCandidateVisibilities;
+  std::unique_ptr<TransformHierarchy> _transformHierarchy;
   std::unique_ptr<RenderingManager> _renderingManager;
   Matrix _transformMatrix;
   std::unique_ptr<UniformBuffer> _sceneUbo;
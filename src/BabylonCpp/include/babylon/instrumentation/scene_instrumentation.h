@@ -5,6 +5,7 @@
 #include <babylon/interfaces/idisposable.h>
 #include <babylon/misc/observer.h>
 #include <babylon/misc/perf_counter.h>
+#include <babylon/misc/profiler.h>
 
 namespace BABYLON {
 
@@ -198,6 +199,23 @@ protected:
    */
   PerfCounter& get_textureCollisionsCounter();
 
+  /**
+   * @brief Gets the profile capture status.
+   */
+  bool get_captureProfile() const;
+
+  /**
+   * @brief Enable or disable the profile capture: the performance counters of
+   * all the threads are recorded by the default profiler.
+   */
+  void set_captureProfile(bool value);
+
+  /**
+   * @brief Gets the time spent in each performance counter during the last
+   * frame.
+   */
+  std::vector<ProfileSummary>& get_frameProfileSummaries();
+
 public:
   // Properties
 
@@ -319,6 +337,18 @@ public:
    */
   ReadOnlyProperty<SceneInstrumentation, PerfCounter> textureCollisionsCounter;
 
+  /**
+   * Profile capture status.
+   */
+  Property<SceneInstrumentation, bool> captureProfile;
+
+  /**
+   * Time spent in each performance counter during the last frame, sorted by
+   * decreasing total time.
+   */
+  ReadOnlyProperty<SceneInstrumentation, std::vector<ProfileSummary>>
+    frameProfileSummaries;
+
 private:
   bool _captureActiveMeshesEvaluationTime;
   PerfCounter _activeMeshesEvaluationTime;
@@ -350,6 +380,9 @@ private:
   bool _captureCameraRenderTime;
   PerfCounter _cameraRenderTime;
 
+  bool _captureProfile;
+  std::vector<ProfileSummary> _frameProfileSummaries;
+
   // Observers
   Observer<Scene>::Ptr _onBeforeActiveMeshesEvaluationObserver;
   Observer<Scene>::Ptr _onAfterActiveMeshesEvaluationObserver;
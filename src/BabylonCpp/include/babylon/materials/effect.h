@@ -5,6 +5,8 @@
 #include <babylon/babylon_common.h>
 #include <babylon/misc/observable.h>
 #include <babylon/misc/observer.h>
+#include <array>
+#include <initializer_list>
 #include <unordered_map>
 
 namespace BABYLON {
@@ -34,6 +36,15 @@ class IGLProgram;
 class IGLUniformLocation;
 } // end of namespace GL
 
+/**
+ * @brief Process wide integer handle of a uniform name, returned by
+ * Effect::GetUniformId. Setting a uniform through its id avoids hashing the
+ * uniform name on every call.
+ */
+struct BABYLON_SHARED_EXPORT UniformId {
+  size_t value;
+}; // end of struct UniformId
+
 /**
  * @brief Effect containing vertex and fragment shader that can be executed on
  * an object.
@@ -54,6 +65,14 @@ public:
    */
   static std::unordered_map<std::string, std::string>& IncludesShadersStore();
 
+  /**
+   * @brief Returns the id of a uniform name. The same name always gives the
+   * same id, ids are shared by all the effects.
+   * @param uniformName Name of the uniform variable.
+   * @returns the id of the uniform.
+   */
+  static UniformId GetUniformId(const std::string& uniformName);
+
 public:
   template <typename... Ts>
   static EffectPtr New(Ts&&... args)
@@ -254,12 +273,6 @@ public:
   void setTextureFromPostProcessOutput(const std::string& channel,
                                        PostProcess* postProcess);
 
-  bool _cacheMatrix(const std::string& uniformName, const Matrix& matrix);
-  bool _cacheFloat2(const std::string& uniformName, float x, float y);
-  bool _cacheFloat3(const std::string& uniformName, float x, float y, float z);
-  bool _cacheFloat4(const std::string& uniformName, float x, float y, float z,
-                    float w);
-
   /**
    * @brief Binds a buffer to a uniform.
    * @param buffer Buffer to bind.
@@ -282,6 +295,14 @@ public:
    */
   Effect& setInt(const std::string& uniformName, int value);
 
+  /**
+   * @brief Sets an interger value on a uniform variable.
+   * @param uniformId Id of the variable returned by GetUniformId.
+   * @param value Value to be set.
+   * @returns this effect.
+   */
+  Effect& setInt(UniformId uniformId, int value);
+
   /**
    * @brief Sets an int array on a uniform variable.
    * @param uniformName Name of the variable.
@@ -404,6 +425,14 @@ public:
    */
   Effect& setMatrices(const std::string& uniformName, Float32Array matrices);
 
+  /**
+   * @brief Sets matrices on a uniform variable.
+   * @param uniformId Id of the variable returned by GetUniformId.
+   * @param matrices matrices to be set.
+   * @returns this effect.
+   */
+  Effect& setMatrices(UniformId uniformId, const Float32Array& matrices);
+
   /**
    * @brief Sets matrix on a uniform variable.
    * @param uniformName Name of the variable.
@@ -412,6 +441,14 @@ public:
    */
   Effect& setMatrix(const std::string& uniformName, const Matrix& matrix);
 
+  /**
+   * @brief Sets matrix on a uniform variable.
+   * @param uniformId Id of the variable returned by GetUniformId.
+   * @param matrix matrix to be set.
+   * @returns this effect.
+   */
+  Effect& setMatrix(UniformId uniformId, const Matrix& matrix);
+
   /**
    * @brief Sets a 3x3 matrix on a uniform variable. (Speicified as
    * [1,2,3,4,5,6,7,8,9] will result in [1,2,3][4,5,6][7,8,9] matrix)
@@ -440,6 +477,14 @@ public:
    */
   Effect& setFloat(const std::string& uniformName, float value);
 
+  /**
+   * @brief Sets a float on a uniform variable.
+   * @param uniformId Id of the variable returned by GetUniformId.
+   * @param value value to be set.
+   * @returns this effect.
+   */
+  Effect& setFloat(UniformId uniformId, float value);
+
   /**
    * @brief Sets a boolean on a uniform variable.
    * @param uniformName Name of the variable.
@@ -465,6 +510,15 @@ public:
    */
   Effect& setFloat2(const std::string& uniformName, float x, float y);
 
+  /**
+   * @brief Sets a float2 on a uniform variable.
+   * @param uniformId Id of the variable returned by GetUniformId.
+   * @param x First float in float2.
+   * @param y Second float in float2.
+   * @returns this effect.
+   */
+  Effect& setFloat2(UniformId uniformId, float x, float y);
+
   /**
    * @brief Sets a Vector3 on a uniform variable.
    * @param uniformName Name of the variable.
@@ -473,6 +527,14 @@ public:
    */
   Effect& setVector3(const std::string& uniformName, const Vector3& vector3);
 
+  /**
+   * @brief Sets a Vector3 on a uniform variable.
+   * @param uniformId Id of the variable returned by GetUniformId.
+   * @param vector3 Value to be set.
+   * @returns this effect.
+   */
+  Effect& setVector3(UniformId uniformId, const Vector3& vector3);
+
   /**
    * @brief Sets a float3 on a uniform variable.
    * @param uniformName Name of the variable.
@@ -483,6 +545,16 @@ public:
    */
   Effect& setFloat3(const std::string& uniformName, float x, float y, float z);
 
+  /**
+   * @brief Sets a float3 on a uniform variable.
+   * @param uniformId Id of the variable returned by GetUniformId.
+   * @param x First float in float3.
+   * @param y Second float in float3.
+   * @param z Third float in float3.
+   * @returns this effect.
+   */
+  Effect& setFloat3(UniformId uniformId, float x, float y, float z);
+
   /**
    * @brief Sets a Vector4 on a uniform variable.
    * @param uniformName Name of the variable.
@@ -491,6 +563,14 @@ public:
    */
   Effect& setVector4(const std::string& uniformName, const Vector4& vector4);
 
+  /**
+   * @brief Sets a Vector4 on a uniform variable.
+   * @param uniformId Id of the variable returned by GetUniformId.
+   * @param vector4 Value to be set.
+   * @returns this effect.
+   */
+  Effect& setVector4(UniformId uniformId, const Vector4& vector4);
+
   /**
    * @brief Sets a float4 on a uniform variable.
    * @param uniformName Name of the variable.
@@ -503,6 +583,17 @@ public:
   Effect& setFloat4(const std::string& uniformName, float x, float y, float z,
                     float w);
 
+  /**
+   * @brief Sets a float4 on a uniform variable.
+   * @param uniformId Id of the variable returned by GetUniformId.
+   * @param x First float in float4.
+   * @param y Second float in float4.
+   * @param z Third float in float4.
+   * @param w Fourth float in float4.
+   * @returns this effect.
+   */
+  Effect& setFloat4(UniformId uniformId, float x, float y, float z, float w);
+
   /**
    * @brief Sets a Color3 on a uniform variable.
    * @param uniformName Name of the variable.
@@ -511,6 +602,14 @@ public:
    */
   Effect& setColor3(const std::string& uniformName, const Color3& color3);
 
+  /**
+   * @brief Sets a Color3 on a uniform variable.
+   * @param uniformId Id of the variable returned by GetUniformId.
+   * @param color3 Value to be set.
+   * @returns this effect.
+   */
+  Effect& setColor3(UniformId uniformId, const Color3& color3);
+
   /**
    * @brief Sets a Color4 on a uniform variable.
    * @param uniformName Name of the variable.
@@ -521,6 +620,15 @@ public:
   Effect& setColor4(const std::string& uniformName, const Color3& color3,
                     float alpha);
 
+  /**
+   * @brief Sets a Color4 on a uniform variable.
+   * @param uniformId Id of the variable returned by GetUniformId.
+   * @param color3 Value to be set.
+   * @param alpha Alpha value to be set.
+   * @returns this effect.
+   */
+  Effect& setColor4(UniformId uniformId, const Color3& color3, float alpha);
+
   /**
    * @brief Sets a Color4 on a uniform variable.
    * @param uniformName defines the name of the variable
@@ -591,6 +699,29 @@ private:
   _processIncludes(const std::string& sourceCode,
                    const std::function<void(const std::string&)>& callback);
   std::string _processPrecision(std::string source);
+  void _initializeUniformIndices();
+  int _getUniformIndex(const std::string& uniformName) const;
+  int _getUniformIndex(UniformId uniformId) const;
+  void _invalidateCachedValue(int index);
+  bool _cacheMatrix(int index, const Matrix& matrix);
+  bool _cacheFloats(int index, std::initializer_list<float> values);
+  Effect& _setInt(int index, int value);
+  Effect& _setMatrices(int index, const Float32Array& matrices);
+  Effect& _setMatrix(int index, const Matrix& matrix);
+  Effect& _setFloat(int index, float value);
+  Effect& _setFloat2(int index, float x, float y);
+  Effect& _setFloat3(int index, float x, float y, float z);
+  Effect& _setFloat4(int index, float x, float y, float z, float w);
+
+private:
+  /**
+   * Last value sent to a uniform, used to skip the redundant updates.
+   */
+  struct UniformValueCache {
+    bool isValid{false};
+    int updateFlag{0};
+    std::array<float, 4> values{};
+  }; // end of struct UniformValueCache
 
 public:
   /**
@@ -668,7 +799,12 @@ private:
   std::string _vertexSourceCodeOverride;
   std::string _fragmentSourceCodeOverride;
   std::vector<std::string> _transformFeedbackVaryings;
-  std::unordered_map<std::string, Float32Array> _valueCache;
+  // Index in the uniforms names of the uniforms, by name and by uniform id
+  std::unordered_map<std::string, int> _uniformIndices;
+  std::vector<int> _uniformIndicesById;
+  // Locations and cached values of the uniforms, by index
+  std::vector<GL::IGLUniformLocation*> _uniformLocations;
+  std::vector<UniformValueCache> _uniformValueCache;
   static std::unordered_map<unsigned int, GL::IGLBuffer*> _baseCache;
 
 }; // end of class Effect
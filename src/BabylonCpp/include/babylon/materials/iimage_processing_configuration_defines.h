@@ -1,6 +1,7 @@
 #ifndef BABYLON_MATERIALS_IIMAGE_PROCESSING_CONFIGURATION_DEFINES_H
 #define BABYLON_MATERIALS_IIMAGE_PROCESSING_CONFIGURATION_DEFINES_H
 
+#include <cstdint>
 #include <ostream>
 
 #include <babylon/babylon_api.h>
@@ -38,6 +39,12 @@ struct BABYLON_SHARED_EXPORT IImageProcessingConfigurationDefines {
    */
   std::string convertToString() const;
 
+  /**
+   * @brief Returns the define values as bits, the first define being the most
+   * significant one.
+   */
+  uint32_t toBitMask() const;
+
 }; // end of struct IImageProcessingConfigurationDefines
 
 } // end of namespace BABYLON
@@ -0,0 +1,133 @@
+#ifndef BABYLON_MATERIALS_MATERIAL_DEFINE_FLAGS_H
+#define BABYLON_MATERIALS_MATERIAL_DEFINE_FLAGS_H
+
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Set of boolean material defines stored as a bitset.
+ *
+ * Every define name is registered once in a process wide schema which gives
+ * it a fixed bit index, all the material defines instances therefore share the
+ * same layout. Comparing, copying and hashing two sets of defines only
+ * involves a few machine words instead of walking a map of strings.
+ */
+class BABYLON_SHARED_EXPORT MaterialDefineFlags {
+
+public:
+  /**
+   * @brief Reference to a single define, returned by the subscript operator.
+   */
+  class BABYLON_SHARED_EXPORT Reference {
+
+  public:
+    Reference(MaterialDefineFlags& flags, size_t index);
+
+    operator bool() const;
+    Reference& operator=(bool value);
+    Reference& operator=(const Reference& other);
+
+  private:
+    MaterialDefineFlags& _flags;
+    size_t _index;
+
+  }; // end of class Reference
+
+public:
+  MaterialDefineFlags();
+  MaterialDefineFlags(
+    std::initializer_list<std::pair<std::string, bool>> defines);
+  MaterialDefineFlags(const MaterialDefineFlags& other) = default;
+  MaterialDefineFlags(MaterialDefineFlags&& other)      = default;
+  MaterialDefineFlags& operator=(const MaterialDefineFlags& other) = default;
+  MaterialDefineFlags& operator=(MaterialDefineFlags&& other) = default;
+  MaterialDefineFlags&
+  operator=(std::initializer_list<std::pair<std::string, bool>> defines);
+  ~MaterialDefineFlags();
+
+  /**
+   * @brief Returns the bit index of a define name, registering the name in
+   * the schema if needed.
+   */
+  static size_t IndexOf(const std::string& define);
+
+  /**
+   * @brief Returns the name of the define registered at the given bit index.
+   */
+  static const std::string& NameOf(size_t index);
+
+  /**
+   * @brief Returns a reference to a define, the define is added (unset) to
+   * the set if not present.
+   */
+  Reference operator[](const std::string& define);
+  Reference operator[](size_t index);
+
+  bool operator==(const MaterialDefineFlags& rhs) const;
+  bool operator!=(const MaterialDefineFlags& rhs) const;
+
+  /**
+   * @brief Returns true if the define is part of the set.
+   */
+  bool contains(const std::string& define) const;
+
+  /**
+   * @brief Returns the value of a define, false if not part of the set.
+   */
+  bool get(const std::string& define) const;
+  bool get(size_t index) const;
+
+  /**
+   * @brief Adds the define to the set and sets its value.
+   */
+  void set(size_t index, bool value);
+
+  /**
+   * @brief Returns the number of defines part of the set.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Returns true if both sets have the same defines enabled, the
+   * defines part of the sets but unset are ignored.
+   */
+  bool hasSameValues(const MaterialDefineFlags& other) const;
+
+  /**
+   * @brief Returns a hash of the enabled defines, consistent with
+   * hasSameValues. The hash is cached until the next modification.
+   */
+  uint64_t hash() const;
+
+  /**
+   * @brief Calls the callback for every define part of the set, in bit index
+   * order.
+   */
+  void
+  forEach(const std::function<void(const std::string& define, bool value)>&
+            callback) const;
+
+private:
+  void _declare(size_t index);
+
+private:
+  // One bit per define part of the set and one bit per define value
+  std::vector<uint64_t> _declared;
+  std::vector<uint64_t> _values;
+  size_t _size;
+  mutable uint64_t _hash;
+  mutable bool _isHashValid;
+
+}; // end of class MaterialDefineFlags
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MATERIALS_MATERIAL_DEFINE_FLAGS_H
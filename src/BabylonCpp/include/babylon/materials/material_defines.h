@@ -5,6 +5,7 @@
 
 #include <babylon/babylon_api.h>
 #include <babylon/materials/imaterial_defines.h>
+#include <babylon/materials/material_define_flags.h>
 
 namespace BABYLON {
 
@@ -108,8 +109,35 @@ struct BABYLON_SHARED_EXPORT MaterialDefines : public IMaterialDefines {
    */
   virtual std::string toString() const override;
 
+  /**
+   * @brief Returns true if both instances hold the same define values, i.e.
+   * if they would produce the same shader, regardless of their dirty state.
+   * The image processing defines of the derived defines are compared too.
+   * @param other - A material define instance to compare to.
+   */
+  bool hasSameDefines(const MaterialDefines& other) const;
+
+  /**
+   * @brief Hidden
+   * Same as hasSameDefines, the image processing defines of the derived
+   * defines excepted. Used for the copies which lost their derived type.
+   */
+  bool _hasSameBaseDefines(const MaterialDefines& other) const;
+
+  /**
+   * @brief Returns the image processing defines of the derived defines as a
+   * bit mask, 0 when the defines hold none.
+   */
+  uint32_t imageProcessingBitMask() const;
+
+  /**
+   * @brief Returns a 64-bit hash of the define values, consistent with
+   * hasSameDefines.
+   */
+  uint64_t hash() const;
+
   // Properties
-  std::unordered_map<std::string, bool> boolDef;
+  MaterialDefineFlags boolDef;
   std::unordered_map<std::string, unsigned int> intDef;
   std::unordered_map<std::string, float> floatDef;
   std::unordered_map<std::string, std::string> stringDef;
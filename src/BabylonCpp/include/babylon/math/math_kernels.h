@@ -0,0 +1,196 @@
+#ifndef BABYLON_MATH_MATH_KERNELS_H
+#define BABYLON_MATH_MATH_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Instruction sets for which math kernels are compiled.
+ */
+enum class SIMDInstructionSet {
+  /** Portable C++ implementation */
+  Scalar = 0,
+  /** x86 SSE 4.1, 4 lanes */
+  SSE4 = 1,
+  /** x86 AVX2, 8 lanes */
+  AVX2 = 2,
+  /** ARM NEON, 4 lanes */
+  NEON = 3,
+}; // end of enum class SIMDInstructionSet
+
+/**
+ * @brief Batch math kernels working on arrays of matrices and vectors.
+ *
+ * Matrices are stored as 16 consecutive floats using the layout of
+ * Matrix::m(), vectors as 3 consecutive floats and quaternions as 4
+ * consecutive floats (x, y, z, w). Bounding volumes and particles are stored
+ * as structures of arrays. Every kernel produces the same results as
+ * the matching Matrix / Vector3 method applied to each element.
+ *
+ * All the variants are built into the library and the best one supported by
+ * the host CPU is selected at runtime, see MathKernels::Get().
+ */
+struct BABYLON_SHARED_EXPORT MathKernels {
+
+  /**
+   * @brief Multiplies left[i] by right[i] for each matrix, same as
+   * Matrix::multiplyToArray. The result can alias the inputs.
+   */
+  using MultiplyMatricesFn = void (*)(const float* left, const float* right,
+                                      float* result, size_t count);
+
+  /**
+   * @brief Inverts each matrix, same as Matrix::invertToRef (a matrix which is
+   * not invertible is copied unchanged).
+   */
+  using InvertMatricesFn = void (*)(const float* matrices, float* result,
+                                    size_t count);
+
+  /**
+   * @brief Transforms each vector by the given matrix, same as
+   * Vector3::TransformCoordinatesToRef.
+   */
+  using TransformCoordinatesFn = void (*)(const float* vectors,
+                                          const float* transformation,
+                                          float* result, size_t count);
+
+  /**
+   * @brief Composes a matrix from each scaling, rotation and translation, same
+   * as Matrix::ComposeToRef.
+   */
+  using ComposeMatricesFn
+    = void (*)(const float* scalings, const float* rotations,
+               const float* translations, float* result, size_t count);
+
+  /**
+   * @brief Decomposes each matrix into its scaling, rotation and translation,
+   * same as Matrix::decompose. Matrices with a null scaling get an identity
+   * rotation.
+   */
+  using DecomposeMatricesFn = void (*)(const float* matrices, float* scalings,
+                                       float* rotations, float* translations,
+                                       size_t count);
+
+  /**
+   * @brief Tests bounding volumes against planes, same as
+   * BoundingSphere::isInFrustum followed by BoundingBox::isInFrustum.
+   *
+   * The volumes are packed in CullVolumeComponents arrays of stride floats,
+   * see the BoundingVolumeComponent enum, and each plane is stored as 4 floats
+   * (normal, d). visible[i] is set to 1 if volume i is not outside any plane,
+   * 0 otherwise.
+   */
+  using CullBoundingVolumesFn
+    = void (*)(const float* volumes, size_t stride, const float* planes,
+               size_t planeCount, uint8_t* visible, size_t count);
+
+  /**
+   * Components of the packed bounding volumes: the bounding sphere, then the
+   * bounding box as its center and its three half axes in world space
+   */
+  enum BoundingVolumeComponent : size_t {
+    SphereCenterX = 0,
+    SphereCenterY,
+    SphereCenterZ,
+    SphereRadius,
+    BoxCenterX,
+    BoxCenterY,
+    BoxCenterZ,
+    BoxAxis0X,
+    BoxAxis0Y,
+    BoxAxis0Z,
+    BoxAxis1X,
+    BoxAxis1Y,
+    BoxAxis1Z,
+    BoxAxis2X,
+    BoxAxis2Y,
+    BoxAxis2Z,
+    CullVolumeComponents,
+  }; // end of enum BoundingVolumeComponent
+
+  /**
+   * @brief Advances particles by the given age step, same as the built-in
+   * behaviours of ParticleSystem: the age stops at the life time, the color
+   * moves by its step (the alpha staying positive), the angle by the angular
+   * speed, the position by the direction and the direction by the gravity.
+   *
+   * The particles are packed in ParticleComponents arrays of stride floats,
+   * see the ParticleComponent enum, and the gravity is stored as 3 floats.
+   */
+  using UpdateParticlesFn = void (*)(float* particles, size_t stride,
+                                     float updateSpeed, const float* gravity,
+                                     size_t count);
+
+  /**
+   * Components of the packed particles updated by updateParticles
+   */
+  enum ParticleComponent : size_t {
+    ParticlePositionX = 0,
+    ParticlePositionY,
+    ParticlePositionZ,
+    ParticleDirectionX,
+    ParticleDirectionY,
+    ParticleDirectionZ,
+    ParticleColorR,
+    ParticleColorG,
+    ParticleColorB,
+    ParticleColorA,
+    ParticleColorStepR,
+    ParticleColorStepG,
+    ParticleColorStepB,
+    ParticleColorStepA,
+    ParticleAge,
+    ParticleLifeTime,
+    ParticleAngle,
+    ParticleAngularSpeed,
+    ParticleComponents,
+  }; // end of enum ParticleComponent
+
+  /**
+   * @brief Returns the kernels of the best instruction set supported by the
+   * host CPU, detected on first use.
+   */
+  static const MathKernels& Get();
+
+  /**
+   * @brief Returns the kernels of the given instruction set or nullptr when it
+   * is not compiled in or not supported by the host CPU.
+   */
+  static const MathKernels* Get(SIMDInstructionSet instructionSet);
+
+  /**
+   * @brief Returns the portable kernels, always available.
+   */
+  static const MathKernels& Scalar();
+
+  /**
+   * @brief Returns the best instruction set supported by the host CPU.
+   */
+  static SIMDInstructionSet DetectInstructionSet();
+
+  /**
+   * Hidden (Kernels of each instruction set, nullptr when not compiled in.
+   * They do not check that the host CPU supports them)
+   */
+  static const MathKernels* _SSE4Kernels();
+  static const MathKernels* _AVX2Kernels();
+  static const MathKernels* _NEONKernels();
+
+  SIMDInstructionSet instructionSet;
+  MultiplyMatricesFn multiplyMatrices;
+  InvertMatricesFn invertMatrices;
+  TransformCoordinatesFn transformCoordinates;
+  ComposeMatricesFn composeMatrices;
+  DecomposeMatricesFn decomposeMatrices;
+  CullBoundingVolumesFn cullBoundingVolumes;
+  UpdateParticlesFn updateParticles;
+
+}; // end of struct MathKernels
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MATH_MATH_KERNELS_H
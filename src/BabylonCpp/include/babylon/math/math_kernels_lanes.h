@@ -0,0 +1,494 @@
+#ifndef BABYLON_MATH_MATH_KERNELS_LANES_H
+#define BABYLON_MATH_MATH_KERNELS_LANES_H
+
+#include <babylon/math/math_kernels.h>
+
+/**
+ * Generic implementation of the batch math kernels, shared by all the
+ * instruction sets. A lane type processes Width matrices / vectors at once, one
+ * per register lane, and provides:
+ *  - static constexpr size_t Width,
+ *  - static Lane Load(const float* data, size_t stride), lane i reading
+ *    data[i * stride], stride being 1 for the structures of arrays,
+ *  - void store(float* data, size_t stride) const,
+ *  - static Lane Splat(float value), Sqrt(Lane), the arithmetic operators
+ *    and the unary minus,
+ *  - the comparison operators returning a Lane::Mask, And(Mask, Mask),
+ *    Or(Mask, Mask) and Select(Mask, Lane, Lane).
+ *
+ * This header must only be included by the translation units of the kernels,
+ * each of them defining its lane type in an anonymous namespace so that the
+ * instantiations compiled with different target flags never get merged.
+ */
+namespace BABYLON {
+namespace detail {
+
+template <typename Lane>
+inline void LoadMatrixLanes(const float* matrices, Lane (&m)[16])
+{
+  for (size_t k = 0; k < 16; ++k) {
+    m[k] = Lane::Load(matrices + k, 16);
+  }
+}
+
+template <typename Lane>
+inline void StoreMatrixLanes(const Lane (&m)[16], float* matrices)
+{
+  for (size_t k = 0; k < 16; ++k) {
+    m[k].store(matrices + k, 16);
+  }
+}
+
+template <typename Lane>
+inline void MultiplyMatrixLanes(const float* left, const float* right,
+                                float* result)
+{
+  Lane l[16], r[16], res[16];
+  LoadMatrixLanes(left, l);
+  LoadMatrixLanes(right, r);
+  for (size_t row = 0; row < 16; row += 4) {
+    for (size_t col = 0; col < 4; ++col) {
+      res[row + col] = l[row] * r[col] + l[row + 1] * r[col + 4]
+                       + l[row + 2] * r[col + 8] + l[row + 3] * r[col + 12];
+    }
+  }
+  StoreMatrixLanes(res, result);
+}
+
+template <typename Lane>
+inline Lane DeterminantLanes(const Lane (&m)[16])
+{
+  const auto det_22_33 = m[10] * m[15] - m[14] * m[11];
+  const auto det_21_33 = m[9] * m[15] - m[13] * m[11];
+  const auto det_21_32 = m[9] * m[14] - m[13] * m[10];
+  const auto det_20_33 = m[8] * m[15] - m[12] * m[11];
+  const auto det_20_32 = m[8] * m[14] - m[10] * m[12];
+  const auto det_20_31 = m[8] * m[13] - m[12] * m[9];
+
+  const auto cofact_00 = m[5] * det_22_33 - m[6] * det_21_33 + m[7] * det_21_32;
+  const auto cofact_01 = m[4] * det_22_33 - m[6] * det_20_33 + m[7] * det_20_32;
+  const auto cofact_02 = m[4] * det_21_33 - m[5] * det_20_33 + m[7] * det_20_31;
+  const auto cofact_03 = m[4] * det_21_32 - m[5] * det_20_32 + m[6] * det_20_31;
+
+  return m[0] * cofact_00 - m[1] * cofact_01 + m[2] * cofact_02
+         - m[3] * cofact_03;
+}
+
+template <typename Lane>
+inline void InvertMatrixLanes(const float* matrices, float* result)
+{
+  // Same cofactor expansion as Matrix::invertToRef
+  Lane m[16];
+  LoadMatrixLanes(matrices, m);
+  const auto m00 = m[0], m01 = m[1], m02 = m[2], m03 = m[3];
+  const auto m10 = m[4], m11 = m[5], m12 = m[6], m13 = m[7];
+  const auto m20 = m[8], m21 = m[9], m22 = m[10], m23 = m[11];
+  const auto m30 = m[12], m31 = m[13], m32 = m[14], m33 = m[15];
+
+  const auto det_22_33 = m22 * m33 - m32 * m23;
+  const auto det_21_33 = m21 * m33 - m31 * m23;
+  const auto det_21_32 = m21 * m32 - m31 * m22;
+  const auto det_20_33 = m20 * m33 - m30 * m23;
+  const auto det_20_32 = m20 * m32 - m22 * m30;
+  const auto det_20_31 = m20 * m31 - m30 * m21;
+
+  const auto cofact_00 = m11 * det_22_33 - m12 * det_21_33 + m13 * det_21_32;
+  const auto cofact_01 = -(m10 * det_22_33 - m12 * det_20_33 + m13 * det_20_32);
+  const auto cofact_02 = m10 * det_21_33 - m11 * det_20_33 + m13 * det_20_31;
+  const auto cofact_03 = -(m10 * det_21_32 - m11 * det_20_32 + m12 * det_20_31);
+
+  const auto det
+    = m00 * cofact_00 + m01 * cofact_01 + m02 * cofact_02 + m03 * cofact_03;
+  // Matrices which are not invertible are copied unchanged
+  const auto singular = det == Lane::Splat(0.f);
+
+  const auto detInv    = Lane::Splat(1.f) / det;
+  const auto det_12_33 = m12 * m33 - m32 * m13;
+  const auto det_11_33 = m11 * m33 - m31 * m13;
+  const auto det_11_32 = m11 * m32 - m31 * m12;
+  const auto det_10_33 = m10 * m33 - m30 * m13;
+  const auto det_10_32 = m10 * m32 - m30 * m12;
+  const auto det_10_31 = m10 * m31 - m30 * m11;
+  const auto det_12_23 = m12 * m23 - m22 * m13;
+  const auto det_11_23 = m11 * m23 - m21 * m13;
+  const auto det_11_22 = m11 * m22 - m21 * m12;
+  const auto det_10_23 = m10 * m23 - m20 * m13;
+  const auto det_10_22 = m10 * m22 - m20 * m12;
+  const auto det_10_21 = m10 * m21 - m20 * m11;
+
+  const auto cofact_10 = -(m01 * det_22_33 - m02 * det_21_33 + m03 * det_21_32);
+  const auto cofact_11 = m00 * det_22_33 - m02 * det_20_33 + m03 * det_20_32;
+  const auto cofact_12 = -(m00 * det_21_33 - m01 * det_20_33 + m03 * det_20_31);
+  const auto cofact_13 = m00 * det_21_32 - m01 * det_20_32 + m02 * det_20_31;
+
+  const auto cofact_20 = m01 * det_12_33 - m02 * det_11_33 + m03 * det_11_32;
+  const auto cofact_21 = -(m00 * det_12_33 - m02 * det_10_33 + m03 * det_10_32);
+  const auto cofact_22 = m00 * det_11_33 - m01 * det_10_33 + m03 * det_10_31;
+  const auto cofact_23 = -(m00 * det_11_32 - m01 * det_10_32 + m02 * det_10_31);
+
+  const auto cofact_30 = -(m01 * det_12_23 - m02 * det_11_23 + m03 * det_11_22);
+  const auto cofact_31 = m00 * det_12_23 - m02 * det_10_23 + m03 * det_10_22;
+  const auto cofact_32 = -(m00 * det_11_23 - m01 * det_10_23 + m03 * det_10_21);
+  const auto cofact_33 = m00 * det_11_22 - m01 * det_10_22 + m02 * det_10_21;
+
+  const Lane inverse[16] = {
+    cofact_00 * detInv, cofact_10 * detInv, cofact_20 * detInv,
+    cofact_30 * detInv, //
+    cofact_01 * detInv, cofact_11 * detInv, cofact_21 * detInv,
+    cofact_31 * detInv, //
+    cofact_02 * detInv, cofact_12 * detInv, cofact_22 * detInv,
+    cofact_32 * detInv, //
+    cofact_03 * detInv, cofact_13 * detInv, cofact_23 * detInv,
+    cofact_33 * detInv, //
+  };
+  for (size_t k = 0; k < 16; ++k) {
+    Select(singular, m[k], inverse[k]).store(result + k, 16);
+  }
+}
+
+template <typename Lane>
+inline void TransformCoordinatesLanes(const float* vectors,
+                                      const float* transformation,
+                                      float* result)
+{
+  // Same as Vector3::TransformCoordinatesFromFloatsToRef
+  const auto x = Lane::Load(vectors, 3);
+  const auto y = Lane::Load(vectors + 1, 3);
+  const auto z = Lane::Load(vectors + 2, 3);
+  Lane m[16];
+  for (size_t k = 0; k < 16; ++k) {
+    m[k] = Lane::Splat(transformation[k]);
+  }
+
+  const auto rx = x * m[0] + y * m[4] + z * m[8] + m[12];
+  const auto ry = x * m[1] + y * m[5] + z * m[9] + m[13];
+  const auto rz = x * m[2] + y * m[6] + z * m[10] + m[14];
+  const auto rw = Lane::Splat(1.f) / (x * m[3] + y * m[7] + z * m[11] + m[15]);
+
+  (rx * rw).store(result, 3);
+  (ry * rw).store(result + 1, 3);
+  (rz * rw).store(result + 2, 3);
+}
+
+template <typename Lane>
+inline void ComposeMatrixLanes(const float* scalings, const float* rotations,
+                               const float* translations, float* result)
+{
+  // Same as Matrix::ComposeToRef
+  const auto x = Lane::Load(rotations, 4), y = Lane::Load(rotations + 1, 4),
+             z = Lane::Load(rotations + 2, 4), w = Lane::Load(rotations + 3, 4);
+  const auto x2 = x + x, y2 = y + y, z2 = z + z;
+  const auto xx = x * x2, xy = x * y2, xz = x * z2;
+  const auto yy = y * y2, yz = y * z2, zz = z * z2;
+  const auto wx = w * x2, wy = w * y2, wz = w * z2;
+
+  const auto sx = Lane::Load(scalings, 3), sy = Lane::Load(scalings + 1, 3),
+             sz = Lane::Load(scalings + 2, 3);
+  const auto one = Lane::Splat(1.f), zero = Lane::Splat(0.f);
+
+  const Lane m[16] = {
+    (one - (yy + zz)) * sx,
+    (xy + wz) * sx,
+    (xz - wy) * sx,
+    zero, //
+    (xy - wz) * sy,
+    (one - (xx + zz)) * sy,
+    (yz + wx) * sy,
+    zero, //
+    (xz + wy) * sz,
+    (yz - wx) * sz,
+    (one - (xx + yy)) * sz,
+    zero, //
+    Lane::Load(translations, 3),
+    Lane::Load(translations + 1, 3),
+    Lane::Load(translations + 2, 3),
+    one, //
+  };
+  StoreMatrixLanes(m, result);
+}
+
+template <typename Lane>
+inline void DecomposeMatrixLanes(const float* matrices, float* scalings,
+                                 float* rotations, float* translations)
+{
+  // Same as Matrix::decompose
+  Lane m[16];
+  LoadMatrixLanes(matrices, m);
+  m[12].store(translations, 3);
+  m[13].store(translations + 1, 3);
+  m[14].store(translations + 2, 3);
+
+  const auto zero = Lane::Splat(0.f);
+  const auto sx   = Sqrt(m[0] * m[0] + m[1] * m[1] + m[2] * m[2]);
+  auto sy         = Sqrt(m[4] * m[4] + m[5] * m[5] + m[6] * m[6]);
+  const auto sz   = Sqrt(m[8] * m[8] + m[9] * m[9] + m[10] * m[10]);
+
+  sy = Select(DeterminantLanes(m) <= zero, sy * Lane::Splat(-1.f), sy);
+  sx.store(scalings, 3);
+  sy.store(scalings + 1, 3);
+  sz.store(scalings + 2, 3);
+
+  // Same as Quaternion::FromRotationMatrixToRef on the unscaled rotation, the
+  // 4 branches are evaluated and the right one is selected per lane
+  const auto one = Lane::Splat(1.f);
+  const auto isx = one / sx, isy = one / sy, isz = one / sz;
+  const auto m11 = m[0] * isx, m12 = m[4] * isy, m13 = m[8] * isz;
+  const auto m21 = m[1] * isx, m22 = m[5] * isy, m23 = m[9] * isz;
+  const auto m31 = m[2] * isx, m32 = m[6] * isy, m33 = m[10] * isz;
+  const auto trace   = m11 + m22 + m33;
+  const auto half    = Lane::Splat(0.5f);
+  const auto quarter = Lane::Splat(0.25f);
+  const auto two     = Lane::Splat(2.f);
+
+  const auto sTrace = half / Sqrt(trace + one);
+  const auto s11    = two * Sqrt(one + m11 - m22 - m33);
+  const auto s22    = two * Sqrt(one + m22 - m11 - m33);
+  const auto s33    = two * Sqrt(one + m33 - m11 - m22);
+
+  const auto isTrace = trace > zero;
+  const auto is11    = And(m11 > m22, m11 > m33);
+  const auto is22    = m22 > m33;
+
+  auto w = Select(is22, (m13 - m31) / s22, (m21 - m12) / s33);
+  auto x = Select(is22, (m12 + m21) / s22, (m13 + m31) / s33);
+  auto y = Select(is22, quarter * s22, (m23 + m32) / s33);
+  auto z = Select(is22, (m23 + m32) / s22, quarter * s33);
+
+  w = Select(is11, (m32 - m23) / s11, w);
+  x = Select(is11, quarter * s11, x);
+  y = Select(is11, (m12 + m21) / s11, y);
+  z = Select(is11, (m13 + m31) / s11, z);
+
+  w = Select(isTrace, quarter / sTrace, w);
+  x = Select(isTrace, (m32 - m23) * sTrace, x);
+  y = Select(isTrace, (m13 - m31) * sTrace, y);
+  z = Select(isTrace, (m21 - m12) * sTrace, z);
+
+  // A null scaling gives an identity rotation
+  const auto degenerated = Or(Or(sx == zero, sy == zero), sz == zero);
+  Select(degenerated, zero, x).store(rotations, 4);
+  Select(degenerated, zero, y).store(rotations + 1, 4);
+  Select(degenerated, zero, z).store(rotations + 2, 4);
+  Select(degenerated, one, w).store(rotations + 3, 4);
+}
+
+template <typename Lane>
+inline Lane AbsLanes(Lane a)
+{
+  return Select(a > Lane::Splat(0.f), a, -a);
+}
+
+template <typename Lane>
+inline void CullBoundingVolumeLanes(const float* volumes, size_t stride,
+                                    const float* planes, size_t planeCount,
+                                    uint8_t* visible)
+{
+  // Lane i reads the volume i of each contiguous component array
+  Lane v[MathKernels::CullVolumeComponents];
+  for (size_t k = 0; k < MathKernels::CullVolumeComponents; ++k) {
+    v[k] = Lane::Load(volumes + k * stride, 1);
+  }
+
+  const auto zero = Lane::Splat(0.f);
+  auto isVisible  = Lane::Splat(1.f);
+  for (size_t p = 0; p < planeCount; ++p) {
+    const auto* plane = planes + p * 4;
+    const auto nx = Lane::Splat(plane[0]), ny = Lane::Splat(plane[1]),
+               nz = Lane::Splat(plane[2]), d = Lane::Splat(plane[3]);
+
+    // Same as BoundingSphere::isInFrustum
+    const auto sphereDot = nx * v[MathKernels::SphereCenterX]
+                           + ny * v[MathKernels::SphereCenterY]
+                           + nz * v[MathKernels::SphereCenterZ] + d;
+    isVisible = Select(sphereDot <= -v[MathKernels::SphereRadius], zero,
+                       isVisible);
+
+    // The corner of the box the farthest along the normal is behind the plane
+    // when all the corners are, see BoundingBox::IsInFrustum
+    const auto centerDot = nx * v[MathKernels::BoxCenterX]
+                           + ny * v[MathKernels::BoxCenterY]
+                           + nz * v[MathKernels::BoxCenterZ] + d;
+    const auto extent
+      = AbsLanes(nx * v[MathKernels::BoxAxis0X] + ny * v[MathKernels::BoxAxis0Y]
+                 + nz * v[MathKernels::BoxAxis0Z])
+        + AbsLanes(nx * v[MathKernels::BoxAxis1X]
+                   + ny * v[MathKernels::BoxAxis1Y]
+                   + nz * v[MathKernels::BoxAxis1Z])
+        + AbsLanes(nx * v[MathKernels::BoxAxis2X]
+                   + ny * v[MathKernels::BoxAxis2Y]
+                   + nz * v[MathKernels::BoxAxis2Z]);
+    isVisible = Select(zero > centerDot + extent, zero, isVisible);
+  }
+
+  float lanes[Lane::Width];
+  isVisible.store(lanes, 1);
+  for (size_t i = 0; i < Lane::Width; ++i) {
+    visible[i] = lanes[i] != 0.f ? 1 : 0;
+  }
+}
+
+template <typename Lane>
+inline void UpdateParticleLanes(float* particles, size_t stride,
+                                float updateSpeed, const float* gravity)
+{
+  const auto component = [particles, stride](size_t k) {
+    return particles + k * stride;
+  };
+  const auto zero  = Lane::Splat(0.f);
+  const auto speed = Lane::Splat(updateSpeed);
+
+  // Step to death
+  const auto age      = Lane::Load(component(MathKernels::ParticleAge), 1);
+  const auto lifeTime = Lane::Load(component(MathKernels::ParticleLifeTime), 1);
+  const auto nextAge  = age + speed;
+  const auto dying    = nextAge > lifeTime;
+  const auto step     = Select(dying, lifeTime - age, speed);
+  Select(dying, lifeTime, nextAge)
+    .store(component(MathKernels::ParticleAge), 1);
+
+  for (size_t k = 0; k < 4; ++k) {
+    auto color
+      = Lane::Load(component(MathKernels::ParticleColorR + k), 1)
+        + Lane::Load(component(MathKernels::ParticleColorStepR + k), 1) * step;
+    if (k == 3) {
+      color = Select(zero > color, zero, color);
+    }
+    color.store(component(MathKernels::ParticleColorR + k), 1);
+  }
+
+  const auto angle
+    = Lane::Load(component(MathKernels::ParticleAngle), 1)
+      + Lane::Load(component(MathKernels::ParticleAngularSpeed), 1) * step;
+  angle.store(component(MathKernels::ParticleAngle), 1);
+
+  // The position moves by the direction before the gravity is applied
+  for (size_t k = 0; k < 3; ++k) {
+    const auto direction
+      = Lane::Load(component(MathKernels::ParticleDirectionX + k), 1);
+    const auto position
+      = Lane::Load(component(MathKernels::ParticlePositionX + k), 1)
+        + direction * step;
+    position.store(component(MathKernels::ParticlePositionX + k), 1);
+    (direction + Lane::Splat(gravity[k]) * step)
+      .store(component(MathKernels::ParticleDirectionX + k), 1);
+  }
+}
+
+/**
+ * Batch drivers, the matrices / vectors which do not fill a whole register are
+ * processed by the scalar kernels.
+ */
+template <typename Lane>
+void MultiplyMatrices(const float* left, const float* right, float* result,
+                      size_t count)
+{
+  const auto blocked = count / Lane::Width * Lane::Width;
+  for (size_t i = 0; i < blocked; i += Lane::Width) {
+    MultiplyMatrixLanes<Lane>(left + i * 16, right + i * 16, result + i * 16);
+  }
+  if (blocked < count) {
+    MathKernels::Scalar().multiplyMatrices(left + blocked * 16,
+                                           right + blocked * 16,
+                                           result + blocked * 16,
+                                           count - blocked);
+  }
+}
+
+template <typename Lane>
+void InvertMatrices(const float* matrices, float* result, size_t count)
+{
+  const auto blocked = count / Lane::Width * Lane::Width;
+  for (size_t i = 0; i < blocked; i += Lane::Width) {
+    InvertMatrixLanes<Lane>(matrices + i * 16, result + i * 16);
+  }
+  if (blocked < count) {
+    MathKernels::Scalar().invertMatrices(
+      matrices + blocked * 16, result + blocked * 16, count - blocked);
+  }
+}
+
+template <typename Lane>
+void TransformCoordinates(const float* vectors, const float* transformation,
+                          float* result, size_t count)
+{
+  const auto blocked = count / Lane::Width * Lane::Width;
+  for (size_t i = 0; i < blocked; i += Lane::Width) {
+    TransformCoordinatesLanes<Lane>(vectors + i * 3, transformation,
+                                    result + i * 3);
+  }
+  if (blocked < count) {
+    MathKernels::Scalar().transformCoordinates(
+      vectors + blocked * 3, transformation, result + blocked * 3,
+      count - blocked);
+  }
+}
+
+template <typename Lane>
+void ComposeMatrices(const float* scalings, const float* rotations,
+                     const float* translations, float* result, size_t count)
+{
+  const auto blocked = count / Lane::Width * Lane::Width;
+  for (size_t i = 0; i < blocked; i += Lane::Width) {
+    ComposeMatrixLanes<Lane>(scalings + i * 3, rotations + i * 4,
+                             translations + i * 3, result + i * 16);
+  }
+  if (blocked < count) {
+    MathKernels::Scalar().composeMatrices(
+      scalings + blocked * 3, rotations + blocked * 4,
+      translations + blocked * 3, result + blocked * 16, count - blocked);
+  }
+}
+
+template <typename Lane>
+void DecomposeMatrices(const float* matrices, float* scalings,
+                       float* rotations, float* translations, size_t count)
+{
+  const auto blocked = count / Lane::Width * Lane::Width;
+  for (size_t i = 0; i < blocked; i += Lane::Width) {
+    DecomposeMatrixLanes<Lane>(matrices + i * 16, scalings + i * 3,
+                               rotations + i * 4, translations + i * 3);
+  }
+  if (blocked < count) {
+    MathKernels::Scalar().decomposeMatrices(
+      matrices + blocked * 16, scalings + blocked * 3, rotations + blocked * 4,
+      translations + blocked * 3, count - blocked);
+  }
+}
+
+template <typename Lane>
+void CullBoundingVolumes(const float* volumes, size_t stride,
+                         const float* planes, size_t planeCount,
+                         uint8_t* visible, size_t count)
+{
+  const auto blocked = count / Lane::Width * Lane::Width;
+  for (size_t i = 0; i < blocked; i += Lane::Width) {
+    CullBoundingVolumeLanes<Lane>(volumes + i, stride, planes, planeCount,
+                                  visible + i);
+  }
+  if (blocked < count) {
+    MathKernels::Scalar().cullBoundingVolumes(volumes + blocked, stride,
+                                              planes, planeCount,
+                                              visible + blocked,
+                                              count - blocked);
+  }
+}
+
+template <typename Lane>
+void UpdateParticles(float* particles, size_t stride, float updateSpeed,
+                     const float* gravity, size_t count)
+{
+  const auto blocked = count / Lane::Width * Lane::Width;
+  for (size_t i = 0; i < blocked; i += Lane::Width) {
+    UpdateParticleLanes<Lane>(particles + i, stride, updateSpeed, gravity);
+  }
+  if (blocked < count) {
+    MathKernels::Scalar().updateParticles(particles + blocked, stride,
+                                          updateSpeed, gravity,
+                                          count - blocked);
+  }
+}
+
+} // end of namespace detail
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MATH_MATH_KERNELS_LANES_H
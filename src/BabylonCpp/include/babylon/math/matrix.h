@@ -2,17 +2,13 @@
 #define BABYLON_MATH_MATRIX_H
 
 #include <array>
+#include <atomic>
 #include <memory>
 #include <optional>
 
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_common.h>
 
-// SIMD
-#if BABYLONCPP_OPTION_ENABLE_SIMD == true
-#include <babylon/math/simd/simd_matrix.h>
-#endif
-
 namespace BABYLON {
 
 class Plane;
@@ -1036,6 +1032,9 @@ private:
                              bool isIdentity3x2      = false,
                              bool isIdentity3x2Dirty = true);
 
+  /** @hidden */
+  static int _NextUpdateFlag();
+
 public:
   /**
    * Gets the update flag of the matrix which is an unique number for the
@@ -1044,12 +1043,8 @@ public:
    */
   int updateFlag;
 
-#if BABYLONCPP_OPTION_ENABLE_SIMD == true
-  SIMD::SIMDMatrix simdMatrix;
-#endif
-
 private:
-  static int _updateFlagSeed;
+  static std::atomic<unsigned int> _updateFlagSeed;
   static Matrix _identityReadOnly;
   bool _isIdentity;
   bool _isIdentityDirty;
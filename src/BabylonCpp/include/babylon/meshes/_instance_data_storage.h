@@ -9,6 +9,7 @@
 
 namespace BABYLON {
 
+class AbstractMesh;
 struct _InstancesBatch;
 struct _VisibleInstances;
 class Buffer;
@@ -27,6 +28,10 @@ struct BABYLON_SHARED_EXPORT _InstanceDataStorage {
   unsigned int instancesBufferSize = 32 * 16 * 4;
   BufferPtr instancesBuffer        = nullptr;
   Float32Array instancesData;
+  // Mesh and world matrix update flag last written in each slot of
+  // instancesData, the matrices which did not change are not copied again
+  std::vector<const AbstractMesh*> instancesSlots;
+  Int32Array instancesSlotsUpdateFlags;
   size_t overridenInstanceCount;
 }; // end of struct _InstanceDataStorage
 
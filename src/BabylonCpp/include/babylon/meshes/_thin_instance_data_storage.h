@@ -0,0 +1,38 @@
+#ifndef BABYLON_MESHES_THIN_INSTANCE_DATA_STORAGE_H
+#define BABYLON_MESHES_THIN_INSTANCE_DATA_STORAGE_H
+
+#include <memory>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/math/vector3.h>
+
+namespace BABYLON {
+
+class Buffer;
+using BufferPtr = std::shared_ptr<Buffer>;
+
+/**
+ * @brief Hidden
+ */
+struct BABYLON_SHARED_EXPORT _ThinInstanceDataStorage {
+  // Number of thin instances drawn
+  size_t instancesCount = 0;
+  // World matrices of the thin instances, 16 floats per instance
+  Float32Array matrixData;
+  // GPU copy of matrixData and the number of floats it was created with
+  BufferPtr matrixBuffer  = nullptr;
+  size_t matrixBufferSize = 0;
+  // Range of the instances whose matrix changed since it was uploaded
+  size_t dirtyMatrixStart = 0;
+  size_t dirtyMatrixEnd   = 0;
+  // Whether the matrices are not expected to change
+  bool staticBuffer = false;
+  // Local bounding box corners of the mesh, before the bounding info is
+  // replaced by the one enclosing the thin instances
+  std::vector<Vector3> boundingVectors;
+}; // end of struct _ThinInstanceDataStorage
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESHES_THIN_INSTANCE_DATA_STORAGE_H
@@ -31,8 +31,10 @@ class BoundingInfo;
 class Camera;
 class Collider;
 struct IEdgesRenderer;
+class IntersectionInfo;
 class Light;
 class Material;
+class MeshBVH;
 struct MaterialDefines;
 class PickingInfo;
 struct PhysicsParams;
@@ -144,6 +146,26 @@ public:
    */
   bool _updateNonUniformScalingState(bool value) override;
 
+  /**
+   * @brief Hidden
+   * Returns true if the world matrix and the frustum test of the mesh can be
+   * computed on a worker thread.
+   */
+  bool _canBeEvaluatedConcurrently() override;
+
+  /**
+   * @brief Hidden
+   * Returns true if the frustum test of the mesh only tests its world bounding
+   * sphere and box, so that it can be batched with the other meshes.
+   */
+  virtual bool _hasStandardFrustumTest() const;
+
+  /**
+   * @brief Gets whether the mesh is drawn as thin instances, whose bounding
+   * info is in world space.
+   */
+  virtual bool hasThinInstances() const;
+
   /**
    * @brief Returns the string "AbstractMesh".
    * @returns "AbstractMesh"
@@ -236,12 +258,15 @@ public:
    * face
    * @param checkVerticesInsteadOfIndices indicates that we should check vertex
    * list directly instead of faces
+   * @param generateEdgesLinesInBackground indicates that the edges are
+   * computed on a worker thread and rendered once available
    * @returns the currentAbstractMesh
    * @see https://www.babylonjs-playground.com/#19O9TU#0
    */
-  AbstractMesh& enableEdgesRendering(float epsilon = 0.95f,
-                                     bool checkVerticesInsteadOfIndices
-                                     = false);
+  AbstractMesh&
+  enableEdgesRendering(float epsilon                     = 0.95f,
+                       bool checkVerticesInsteadOfIndices  = false,
+                       bool generateEdgesLinesInBackground = false);
 
   /**
    * @brief Returns the mesh itself by default. Implemented by child classes.
@@ -645,6 +670,16 @@ public:
    */
   virtual bool _generatePointsArray();
 
+  /**
+   * @brief Hidden
+   */
+  virtual MeshBVH* _getBVH();
+
+  /**
+   * @brief Hidden
+   */
+  virtual void _resetBVH();
+
   /**
    * @brief Checks if the passed Ray intersects with the mesh.
    * @param ray defines the ray to use
@@ -659,6 +694,15 @@ public:
   intersects(Ray& ray, bool fastCheck = true,
              const TrianglePickingPredicate& trianglePredicate = nullptr);
 
+  /**
+   * @brief Hidden
+   */
+  std::optional<IntersectionInfo>
+  _intersectSubMeshes(Ray& ray,
+                      const std::vector<SubMesh*>& candidateSubMeshes,
+                      const IndicesArray& indices, bool fastCheck,
+                      const TrianglePickingPredicate& trianglePredicate);
+
   /**
    * @brief Clones the current mesh.
    * @param name defines the mesh name
@@ -122,6 +122,25 @@ public:
    */
   GL::IGLBuffer* update(const Float32Array& data);
 
+  /**
+   * @brief Uploads the data of an updatable buffer after it has been modified
+   * in place through getData, without copying it.
+   * Hidden
+   */
+  GL::IGLBuffer* _updateFromData();
+
+  /**
+   * @brief Updates a range of an updatable buffer, only the range is uploaded.
+   * The CPU copy of the buffer data is kept when it has the size of the data.
+   * @param data defines the data of the whole buffer
+   * @param offset defines the offset of the range in floats, both in the data
+   * and in the buffer
+   * @param count defines the number of floats of the range
+   * Hidden
+   */
+  GL::IGLBuffer* _updateRange(const Float32Array& data, size_t offset,
+                              size_t count);
+
   /**
    * @brief Updates the data directly.
    * @param data the new data
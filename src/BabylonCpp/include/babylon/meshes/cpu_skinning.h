@@ -0,0 +1,89 @@
+#ifndef BABYLON_MESHES_CPU_SKINNING_H
+#define BABYLON_MESHES_CPU_SKINNING_H
+
+#include <cstdint>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Skins the vertices of a mesh on the CPU, used when the bones are not
+ * computed using shaders.
+ *
+ * The source positions and normals are stored as structure of arrays and the
+ * bone influences are decoded once, so that a frame only reads the bone
+ * matrices and writes the skinned vertices. The vertices are split across the
+ * workers of the default thread pool.
+ */
+class BABYLON_SHARED_EXPORT CPUSkinning {
+
+public:
+  CPUSkinning();
+  ~CPUSkinning();
+
+  /**
+   * @brief Stores the source geometry and the bone influences.
+   * @param positions defines the source positions (3 floats per vertex)
+   * @param normals defines the source normals (3 floats per vertex)
+   * @param matricesIndices defines the bone indices (4 per vertex)
+   * @param matricesWeights defines the bone weights (4 per vertex)
+   * @param matricesIndicesExtra defines the extra bone indices (4 per vertex,
+   * empty when there are at most 4 influencers per vertex)
+   * @param matricesWeightsExtra defines the extra bone weights (4 per vertex,
+   * empty when there are at most 4 influencers per vertex)
+   * @returns false if the sizes of the arrays do not match
+   */
+  bool initialize(const Float32Array& positions, const Float32Array& normals,
+                  const Float32Array& matricesIndices,
+                  const Float32Array& matricesWeights,
+                  const Float32Array& matricesIndicesExtra = {},
+                  const Float32Array& matricesWeightsExtra = {});
+
+  /**
+   * @brief Gets the number of skinned vertices.
+   */
+  size_t vertexCount() const;
+
+  /**
+   * @brief Gets the number of bone influencers per vertex (4 or 8).
+   */
+  size_t influencerCount() const;
+
+  /**
+   * @brief Skins the source vertices.
+   * @param boneMatrices defines the transform matrices of the bones
+   * @param positions defines where to write the skinned positions (3 floats
+   * per vertex)
+   * @param normals defines where to write the skinned normals (3 floats per
+   * vertex)
+   */
+  void apply(const Float32Array& boneMatrices, float* positions,
+             float* normals) const;
+
+private:
+  template <size_t InfluencerCount>
+  void _skinRange(const Float32Array& boneMatrices, size_t begin, size_t end,
+                  float* positions, float* normals) const;
+
+private:
+  size_t _vertexCount;
+  size_t _influencerCount;
+  // Source geometry
+  Float32Array _positionsX;
+  Float32Array _positionsY;
+  Float32Array _positionsZ;
+  Float32Array _normalsX;
+  Float32Array _normalsY;
+  Float32Array _normalsZ;
+  // Bone influences, _influencerCount values per vertex
+  std::vector<uint32_t> _boneIndices;
+  Float32Array _boneWeights;
+
+}; // end of class CPUSkinning
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESHES_CPU_SKINNING_H
@@ -2,7 +2,9 @@
 #define BABYLON_MESHES_GEOMETRY_H
 
 #include <functional>
+#include <future>
 #include <map>
+#include <mutex>
 #include <nlohmann/json_fwd.hpp>
 
 #include <babylon/babylon_api.h>
@@ -18,6 +20,7 @@ class Effect;
 class Engine;
 class Geometry;
 class Mesh;
+class MeshBVH;
 class Scene;
 class VertexBuffer;
 class VertexData;
@@ -141,6 +144,18 @@ public:
                                   const Float32Array& data, size_t offset,
                                   bool useBytes = false);
 
+  /**
+   * @brief Uploads a range of an updatable vertex buffer.
+   * @param kind defines the data kind (Position, normal, etc...)
+   * @param data defines the whole data of the vertex buffer
+   * @param offset defines the offset of the range in floats
+   * @param count defines the number of floats of the range
+   * Hidden
+   */
+  void _updateVerticesDataRange(const std::string& kind,
+                                const Float32Array& data, size_t offset,
+                                size_t count);
+
   /**
    * @brief Update a specific vertex buffer.
    * This function will create a new buffer if the current one is not updatable
@@ -304,6 +319,24 @@ public:
    */
   bool _generatePointsArray();
 
+  /**
+   * @brief Builds the bounding volume hierarchy of the triangles used by
+   * picking and collisions.
+   * @param inBackground defines whether the hierarchy is built on a worker
+   * thread, the triangles being tested linearly until it is ready
+   */
+  void buildBVH(bool inBackground = false);
+
+  /**
+   * @brief Hidden
+   */
+  MeshBVH* _getBVH();
+
+  /**
+   * @brief Hidden
+   */
+  void _resetBVH();
+
   /**
    * @brief Gets a value indicating if the geometry is disposed.
    * @returns true if the geometry was disposed
@@ -475,6 +508,19 @@ public:
   /** Hidden */
   std::vector<Vector3> _positions;
 
+  /**
+   * Gets or sets a boolean indicating that picking and collisions use a
+   * bounding volume hierarchy of the triangles when the geometry has at least
+   * BVHMinimumTriangleCount triangles (true by default)
+   */
+  bool useBVH;
+
+  /**
+   * Minimum number of triangles from which a bounding volume hierarchy is
+   * used
+   */
+  static size_t BVHMinimumTriangleCount;
+
   /**
    *  Gets or sets the Bias Vector to apply on the bounding elements
    * (box/sphere), the max extend is computed as v += v * bias.x + bias.y, the
@@ -507,6 +553,13 @@ private:
   std::optional<Vector2> _boundingBias;
   std::unique_ptr<GL::IGLBuffer> _indexBuffer;
   bool _indexBufferIsUpdatable;
+  std::unique_ptr<MeshBVH> _bvh;
+  // Hierarchy being built in the background and the build task
+  std::shared_ptr<std::unique_ptr<MeshBVH>> _pendingBVH;
+  std::future<void> _pendingBVHBuild;
+  bool _bvhBuilt;
+  // Batched picking queries the hierarchy from several threads
+  std::recursive_mutex _bvhMutex;
 
 }; // end of class Geometry
 
@@ -223,6 +223,16 @@ public:
    */
   bool _generatePointsArray() override;
 
+  /**
+   * @brief Hidden
+   */
+  MeshBVH* _getBVH() override;
+
+  /**
+   * @brief Hidden
+   */
+  void _resetBVH() override;
+
   /**
    * @brief Creates a new InstancedMesh from the current mesh.
    * @param name (string) : the cloned mesh name
@@ -2,6 +2,7 @@
 #define BABYLON_MESHES_MESH_H
 
 #include <babylon/babylon_api.h>
+#include <babylon/babylon_enums.h>
 #include <babylon/math/isize.h>
 #include <babylon/math/path3d.h>
 #include <babylon/meshes/abstract_mesh.h>
@@ -12,8 +13,10 @@ namespace BABYLON {
 struct _CreationDataStorage;
 struct _InstancesBatch;
 struct _InstanceDataStorage;
+struct _ThinInstanceDataStorage;
 struct _VisibleInstances;
 class Buffer;
+class CPUSkinning;
 class Effect;
 class Geometry;
 class GroundMesh;
@@ -24,6 +27,7 @@ class IParticleSystem;
 class LinesMesh;
 class Mesh;
 class MeshLODLevel;
+struct ISimplificationSettings;
 class MorphTargetManager;
 class PolyhedronOptions;
 class VertexBuffer;
@@ -602,6 +606,12 @@ public:
                              const _InstancesBatchPtr& batch,
                              const EffectPtr& effect, Engine* engine);
 
+  /**
+   * @brief Hidden
+   */
+  Mesh& _renderWithThinInstances(SubMesh* subMesh, unsigned int fillMode,
+                                 const EffectPtr& effect, Engine* engine);
+
   /**
    * @brief Hidden
    */
@@ -668,6 +678,16 @@ public:
    */
   Mesh& _checkDelayState();
 
+  /**
+   * @brief Hidden
+   */
+  bool _canBeEvaluatedConcurrently() override;
+
+  /**
+   * @brief Hidden
+   */
+  bool _hasStandardFrustumTest() const override;
+
   /**
    * @brief Returns `true` if the mesh is within the frustum defined by the
    * passed array of planes. A mesh is in the frustum if its bounding box
@@ -727,6 +747,16 @@ public:
    */
   bool _generatePointsArray() override;
 
+  /**
+   * @brief Hidden
+   */
+  MeshBVH* _getBVH() override;
+
+  /**
+   * @brief Hidden
+   */
+  void _resetBVH() override;
+
   /** Clone **/
 
   /**
@@ -864,6 +894,105 @@ public:
    */
   Mesh& synchronizeInstances();
 
+  /** Thin instances **/
+
+  /**
+   * @brief Gets whether the mesh is drawn as thin instances.
+   * Thin instances are drawn with a single instanced draw call. Unlike
+   * InstancedMesh objects they are not nodes of the scene: they are not
+   * culled, picked or animated individually. When the mesh has thin
+   * instances, the mesh itself is not drawn.
+   */
+  bool hasThinInstances() const override;
+
+  /**
+   * @brief Gets the number of thin instances drawn.
+   */
+  size_t thinInstanceCount() const;
+
+  /**
+   * @brief Sets the number of thin instances drawn. It can not exceed the
+   * number of matrices of the matrix buffer.
+   */
+  void setThinInstanceCount(size_t count);
+
+  /**
+   * @brief Sets the buffer of a thin instance attribute and the number of
+   * thin instances to the number of elements of the buffer.
+   * Only the "matrix" kind is supported. The matrices are the final world
+   * matrices of the instances: unlike in Babylon.js, the world matrix of the
+   * mesh is not applied to them.
+   * @param kind defines the kind of the buffer ("matrix")
+   * @param buffer defines the data, 16 floats per matrix
+   * @param stride defines the number of floats per instance (16 if 0)
+   * @param staticBuffer defines whether the buffer is not expected to change
+   */
+  void thinInstanceSetBuffer(const std::string& kind,
+                             const Float32Array& buffer,
+                             unsigned int stride = 0,
+                             bool staticBuffer   = false);
+
+  /**
+   * @brief Gets the matrix buffer of the thin instances. It can be updated in
+   * place, thinInstanceBufferUpdated("matrix") must then be called so that the
+   * new matrices are uploaded.
+   */
+  Float32Array& thinInstanceGetMatrixBuffer();
+
+  /**
+   * @brief Adds a thin instance.
+   * @param matrix defines the world matrix of the instance
+   * @param refresh defines whether the buffer is uploaded and the bounding
+   * info refreshed
+   * @returns the index of the new thin instance
+   */
+  size_t thinInstanceAdd(const Matrix& matrix, bool refresh = true);
+
+  /**
+   * @brief Sets the world matrix of a thin instance.
+   * @param index defines the index of the thin instance
+   * @param matrix defines the world matrix of the instance
+   * @param refresh defines whether the buffer is uploaded and the bounding
+   * info refreshed
+   */
+  void thinInstanceSetMatrixAt(size_t index, const Matrix& matrix,
+                               bool refresh = true);
+
+  /**
+   * @brief Notifies that the data of a thin instance buffer changed and must
+   * be uploaded before the next draw.
+   * @param kind defines the kind of the buffer ("matrix")
+   */
+  void thinInstanceBufferUpdated(const std::string& kind);
+
+  /**
+   * @brief Sets the bounding info of the mesh to the box enclosing all its
+   * thin instances, so that they are culled as a whole. The box is in world
+   * space, moving the mesh does not move it.
+   */
+  void thinInstanceRefreshBoundingInfo();
+
+  /**
+   * @brief Simplify the mesh according to the given array of settings.
+   * The decimation runs in the background, the simplified meshes are added as
+   * LOD levels of the mesh when it finishes.
+   * @see http://doc.babylonjs.com/how_to/in-browser_mesh_simplification
+   * @param settings a collection of simplification settings
+   * @param parallelProcessing should all levels calculate parallel or one
+   * after the other
+   * @param simplificationType the type of simplification to run
+   * @param successCallback optional success callback to be called after the
+   * simplification finished processing all settings
+   * @returns the current mesh
+   */
+  Mesh& simplify(const std::vector<ISimplificationSettings>& settings,
+                 bool parallelProcessing = true,
+                 SimplificationType simplificationType
+                 = SimplificationType::QUADRATIC,
+                 const std::function<void(Mesh* mesh, int submeshIndex)>&
+                   successCallback
+                 = nullptr);
+
   /**
    * @brief Optimization of the mesh's indices, in case a mesh has duplicated
    * vertices. The function will only reorder the indices and will not remove
@@ -1688,6 +1817,8 @@ private:
   // influences)
   void normalizeSkinWeightsAndExtra();
   Mesh& _queueLoad(Scene* scene);
+  // Drops the CPU skinning data when the bone influences change
+  void _invalidateCPUSkinning(const std::string& kind);
 
 public:
   /** Events **/
@@ -1832,6 +1963,7 @@ private:
   MorphTargetManagerPtr _morphTargetManager;
   std::vector<VertexBuffer*> _delayInfo;
   std::unique_ptr<_InstanceDataStorage> _instanceDataStorage;
+  std::unique_ptr<_ThinInstanceDataStorage> _thinInstanceDataStorage;
   MaterialPtr _effectiveMaterial;
   int _preActivateId;
   // Will be used by ribbons mainly
@@ -1840,6 +1972,8 @@ private:
   Float32Array _sourcePositions;
   // Will be used to save original normals when using software skinning
   Float32Array _sourceNormals;
+  // Source geometry and bone influences used by software skinning
+  std::unique_ptr<CPUSkinning> _cpuSkinning;
   // Will be used to save a source mesh reference, If any
   Mesh* _source;
   // For extrusion and tube
@@ -1,8 +1,14 @@
 #ifndef BABYLON_MESHES_SIMPLIFICATION_QUADRATIC_ERROR_SIMPLIFICATION_H
 #define BABYLON_MESHES_SIMPLIFICATION_QUADRATIC_ERROR_SIMPLIFICATION_H
 
+#include <vector>
+
 #include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/meshes/simplification/decimation_triangle.h>
+#include <babylon/meshes/simplification/decimation_vertex.h>
 #include <babylon/meshes/simplification/isimplifier.h>
+#include <babylon/meshes/simplification/reference.h>
 
 namespace BABYLON {
 
@@ -14,12 +20,111 @@ namespace BABYLON {
  * to babylon JS
  * @author RaananW
  * @see http://doc.babylonjs.com/how_to/in-browser_mesh_simplification
+ *
+ * The simplification is split in three steps so that the decimation can run
+ * on a worker thread: the geometry of the mesh is first copied, the decimation
+ * only works on this copy and the decimated mesh is finally created from the
+ * result.
  */
 class BABYLON_SHARED_EXPORT QuadraticErrorSimplification : public ISimplifier {
 
 public:
-  QuadraticErrorSimplification();
-  virtual ~QuadraticErrorSimplification();
+  /**
+   * @brief Creates a new simplifier for the given mesh.
+   * @param mesh defines the mesh to simplify
+   */
+  QuadraticErrorSimplification(Mesh* mesh);
+  ~QuadraticErrorSimplification() override;
+
+  /**
+   * @brief Simplification of a given mesh according to the given settings.
+   * @param settings The settings of the simplification, including quality and
+   * distance
+   * @param successCallback A callback that will be called after the mesh was
+   * simplified.
+   */
+  void simplify(const ISimplificationSettings& settings,
+                const std::function<void(const MeshPtr& simplifiedMesh)>&
+                  successCallback) override;
+
+  /**
+   * @brief Copies the geometry of the mesh to simplify.
+   * Hidden
+   */
+  void _readMeshData();
+
+  /**
+   * @brief Decimates the copied geometry. Only works on data owned by the
+   * simplifier and can therefore run on a worker thread.
+   * Hidden
+   */
+  void _decimate(const ISimplificationSettings& settings);
+
+  /**
+   * @brief Creates the decimated mesh from the result of the decimation. The
+   * mesh is added to the scene and must therefore be created on the thread
+   * owning the scene.
+   * Hidden
+   */
+  MeshPtr _createDecimatedMesh() const;
+
+private:
+  struct SubMeshData {
+    unsigned int materialIndex;
+    unsigned int verticesStart;
+    size_t verticesCount;
+    unsigned int indexStart;
+    size_t indexCount;
+  }; // end of struct SubMeshData
+
+  void _initWithSubMesh(const SubMeshData& subMesh, bool optimizeMesh);
+  void _init();
+  void _runDecimation(const ISimplificationSettings& settings);
+  void _reconstructSubMesh(const SubMeshData& subMesh);
+  bool _isFlipped(DecimationVertex* vertex1, DecimationVertex* vertex2,
+                  const Vector3& point, std::vector<bool>& deletedArray,
+                  std::vector<DecimationTriangle*>& delTr);
+  size_t _updateTriangles(DecimationVertex* origVertex,
+                          DecimationVertex* vertex,
+                          const std::vector<bool>& deletedArray,
+                          size_t deletedTriangles);
+  void _identifyBorder();
+  void _updateMesh(bool identifyBorders = false);
+  float _vertexError(const QuadraticMatrix& q, const Vector3& point) const;
+  float _calculateError(const DecimationVertex& vertex1,
+                        const DecimationVertex& vertex2,
+                        Vector3* pointResult = nullptr) const;
+
+public:
+  /**
+   * Exponent of the error threshold, higher values remove triangles faster
+   */
+  unsigned int aggressiveness;
+  /**
+   * Maximum number of decimation iterations
+   */
+  unsigned int decimationIterations;
+
+private:
+  Mesh* _mesh;
+  // Copy of the geometry of the mesh
+  Float32Array _positionData;
+  Float32Array _normalData;
+  Float32Array _uvs;
+  Float32Array _colorsData;
+  IndicesArray _indices;
+  std::vector<SubMeshData> _subMeshes;
+  // Decimation state of the sub-mesh being simplified
+  std::vector<DecimationVertex> _vertices;
+  std::vector<DecimationTriangle> _triangles;
+  std::vector<Reference> _references;
+  // Reconstructed geometry
+  Float32Array _newPositionData;
+  Float32Array _newNormalData;
+  Float32Array _newUVsData;
+  Float32Array _newColorsData;
+  IndicesArray _newIndicesArray;
+  std::vector<SubMeshData> _newSubMeshes;
 
 }; // end of class QuadraticErrorSimplification
 
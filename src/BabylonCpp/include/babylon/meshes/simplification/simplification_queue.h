@@ -1,18 +1,26 @@
 #ifndef BABYLON_MESHES_SIMPLIFICATION_SIMPLIFICATION_QUEUE_H
 #define BABYLON_MESHES_SIMPLIFICATION_SIMPLIFICATION_QUEUE_H
 
+#include <future>
+#include <memory>
 #include <queue>
+#include <vector>
 
 #include <babylon/babylon_api.h>
 #include <babylon/meshes/simplification/isimplification_task.h>
 
 namespace BABYLON {
 
-class ISimplifier;
+class QuadraticErrorSimplification;
 
 /**
  * @brief Queue used to order the simplification tasks.
  * @see http://doc.babylonjs.com/how_to/in-browser_mesh_simplification
+ *
+ * The decimation of a task runs on the default thread pool. The geometry of
+ * the mesh is copied before the decimation starts and the simplified meshes
+ * are added to the scene as LOD levels by _installCompletedSimplifications,
+ * called every frame from the scene thread.
  */
 class BABYLON_SHARED_EXPORT SimplificationQueue {
 
@@ -40,8 +48,17 @@ public:
    */
   void runSimplification(const ISimplificationTask& task);
 
+  /**
+   * @brief Installs the simplified meshes of the running task as LOD levels
+   * of the simplified mesh once all the decimations are done, then executes
+   * the next task.
+   * Hidden
+   */
+  void _installCompletedSimplifications();
+
 private:
-  ISimplifier* getSimplifier(const ISimplificationTask& task);
+  std::unique_ptr<QuadraticErrorSimplification>
+  getSimplifier(const ISimplificationTask& task);
 
 public:
   /**
@@ -50,7 +67,15 @@ public:
   bool running;
 
 private:
+  struct RunningSimplification {
+    ISimplificationSettings settings;
+    std::unique_ptr<QuadraticErrorSimplification> simplifier;
+  }; // end of struct RunningSimplification
+
   std::queue<ISimplificationTask> _simplificationQueue;
+  ISimplificationTask _runningTask;
+  std::vector<RunningSimplification> _runningSimplifications;
+  std::vector<std::future<void>> _decimations;
 
 }; // end of class SimplificationQueue
 
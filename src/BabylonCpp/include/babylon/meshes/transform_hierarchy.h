@@ -0,0 +1,83 @@
+#ifndef BABYLON_MESHES_TRANSFORM_HIERARCHY_H
+#define BABYLON_MESHES_TRANSFORM_HIERARCHY_H
+
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/misc/observer.h>
+
+namespace BABYLON {
+
+class AbstractMesh;
+class Node;
+class Scene;
+class TransformNode;
+
+/**
+ * @brief Flat view of the transform nodes (transform nodes and meshes) of a
+ * scene, stored in topological order: a parent always comes before its
+ * children.
+ *
+ * The world matrices are updated in a single linear pass. As the parents are
+ * visited first, every node only checks its own state and the update id of
+ * its parent instead of validating its whole parent chain, and only the dirty
+ * subtrees are recomputed.
+ */
+class BABYLON_SHARED_EXPORT TransformHierarchy {
+
+public:
+  TransformHierarchy(Scene* scene);
+  ~TransformHierarchy();
+
+  /**
+   * @brief Flags the node list as outdated, it will be rebuilt during the
+   * next update.
+   */
+  void markAsDirty();
+
+  /**
+   * @brief Updates the world matrices of all the nodes of the scene.
+   * @returns the number of recomputed world matrices
+   */
+  size_t update();
+
+  /**
+   * @brief Returns true if the world matrix of the node has been validated by
+   * the last update.
+   */
+  bool isUpToDate(const TransformNode* node) const;
+
+  /**
+   * @brief Returns the nodes in topological order.
+   */
+  const std::vector<TransformNode*>& nodes() const;
+
+private:
+  void _rebuild();
+
+private:
+  // Parent index of the roots
+  static constexpr int NO_PARENT = -1;
+  // Parent index of the nodes whose parent is not a transform node of the
+  // scene (camera, light, bone...)
+  static constexpr int EXTERNAL_PARENT = -2;
+
+  Scene* _scene;
+  bool _isDirty;
+  int _updateId;
+  std::vector<TransformNode*> _nodes;
+  // Parents at the time of the last rebuild, used to detect reparenting
+  std::vector<Node*> _parents;
+  std::vector<int> _parentIndices;
+  // Number of scene nodes at the time of the last rebuild
+  size_t _sceneNodeCount;
+  Observer<AbstractMesh>::Ptr _onNewMeshAddedObserver;
+  Observer<AbstractMesh>::Ptr _onMeshRemovedObserver;
+  Observer<TransformNode>::Ptr _onNewTransformNodeAddedObserver;
+  Observer<TransformNode>::Ptr _onTransformNodeRemovedObserver;
+
+}; // end of class TransformHierarchy
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESHES_TRANSFORM_HIERARCHY_H
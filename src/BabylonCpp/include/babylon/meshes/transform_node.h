@@ -81,6 +81,14 @@ public:
   virtual void setProperty(const std::vector<std::string>& targetPropertyPath,
                            const AnimationValue& value) override;
 
+  /**
+   * @brief Resolves an animated property into a setter writing directly into
+   * the transform (position, rotation, rotationQuaternion, scaling and their
+   * components).
+   */
+  AnimationPropertySetter
+  bindProperty(const std::vector<std::string>& targetPropertyPath) override;
+
   /**
    * @brief Gets a string identifying the name of the class.
    * @returns "TransformNode" string
@@ -305,6 +313,22 @@ public:
    */
   virtual bool _updateNonUniformScalingState(bool value);
 
+  /**
+   * @brief Hidden
+   * Returns true if the world matrix of the node can be computed on a worker
+   * thread, i.e. if its computation only reads and writes the node own state.
+   */
+  virtual bool _canBeEvaluatedConcurrently();
+
+  /**
+   * @brief Hidden
+   * Computes the world matrix of a node whose parent world matrix is already
+   * up to date for the current frame (the transform hierarchy visits the
+   * parents first). Only the local state and the parent update id are checked.
+   * @returns true if the world matrix has been recomputed
+   */
+  bool _computeWorldMatrixFromParent();
+
   /**
    * @brief Attach the current TransformNode to another TransformNode associated
    * with a bone.
@@ -673,6 +697,8 @@ public:
   Matrix _localMatrix;
   /** Hidden */
   int _indexInSceneTransformNodesArray;
+  /** Hidden (Update id of the scene transform hierarchy) */
+  int _transformHierarchyUpdateId;
 
   /**
    * Gets or set the node position (default is (0.0, 0.0, 0.0))
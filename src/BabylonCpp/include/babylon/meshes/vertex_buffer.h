@@ -267,6 +267,24 @@ public:
    */
   GL::IGLBuffer* update(const Float32Array& data);
 
+  /**
+   * @brief Uploads the data of the underlying updatable buffer after it has
+   * been modified in place through getData.
+   * Hidden
+   */
+  GL::IGLBuffer* _updateFromData();
+
+  /**
+   * @brief Updates a range of the underlying updatable buffer, only the range
+   * is uploaded.
+   * @param data defines the data of the whole buffer
+   * @param offset defines the offset of the range in floats
+   * @param count defines the number of floats of the range
+   * Hidden
+   */
+  GL::IGLBuffer* _updateRange(const Float32Array& data, size_t offset,
+                              size_t count);
+
   /**
    *@brief  Updates directly the underlying WebGLBuffer according to the passed
    *numeric array or Float32Array. Returns the directly updated WebGLBuffer.
@@ -0,0 +1,202 @@
+#ifndef BABYLON_MISC_PROFILER_H
+#define BABYLON_MISC_PROFILER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Named scope recorded by the profiler.
+ */
+struct BABYLON_SHARED_EXPORT ProfileEvent {
+  /** Index of the name of the scope in the profiler names */
+  uint32_t nameId = 0;
+  /** Index of the recording thread, in order of first use */
+  uint32_t threadId = 0;
+  /** Number of scopes of the thread enclosing this one */
+  uint32_t depth = 0;
+  /** Start time, in nanoseconds since the creation of the profiler */
+  uint64_t start = 0;
+  /** Duration, in nanoseconds */
+  uint64_t duration = 0;
+}; // end of struct ProfileEvent
+
+/**
+ * @brief Time spent in the scopes of a given name during a frame.
+ */
+struct BABYLON_SHARED_EXPORT ProfileSummary {
+  std::string name;
+  /** Number of scopes */
+  size_t count = 0;
+  /** Total duration of the scopes, in nanoseconds */
+  uint64_t totalTime = 0;
+  /** Total duration minus the duration of the nested scopes, in nanoseconds */
+  uint64_t selfTime = 0;
+}; // end of struct ProfileSummary
+
+/**
+ * @brief Scopes completed during a frame, on all the threads.
+ */
+struct BABYLON_SHARED_EXPORT ProfileFrame {
+  size_t id = 0;
+  /** Start and end times, in nanoseconds since the creation of the profiler */
+  uint64_t start = 0;
+  uint64_t end   = 0;
+  /** Events sorted by start time */
+  std::vector<ProfileEvent> events;
+  /** Summaries sorted by decreasing total time */
+  std::vector<ProfileSummary> summaries;
+  /** Number of events lost because a thread buffer was full */
+  size_t droppedEventCount = 0;
+}; // end of struct ProfileFrame
+
+/**
+ * @brief Hierarchical tracing profiler.
+ *
+ * Each thread records its scopes in its own ring buffer without locking, the
+ * buffers being drained once per frame by endFrame(). When the profiler is
+ * disabled, begin() only costs an atomic load.
+ *
+ * The recorded frames can be exported in the Chrome trace event format (to be
+ * opened in chrome://tracing or Perfetto) or in a compact binary format.
+ */
+class BABYLON_SHARED_EXPORT Profiler {
+
+public:
+  /** Maximum number of events buffered by a thread between two frames */
+  static constexpr size_t ThreadBufferCapacity = 1 << 14;
+
+public:
+  Profiler();
+  ~Profiler();
+
+  Profiler(const Profiler&) = delete;
+  Profiler& operator=(const Profiler&) = delete;
+
+  /**
+   * @brief Returns the process wide profiler used by
+   * Tools::StartPerformanceCounter and Tools::EndPerformanceCounter.
+   */
+  static Profiler& Default();
+
+  /**
+   * @brief Enables or disables the recording of the scopes.
+   */
+  void setEnabled(bool value);
+
+  /**
+   * @brief Returns true if the scopes are recorded.
+   */
+  bool isEnabled() const;
+
+  /**
+   * @brief Opens a scope on the calling thread.
+   * @param name defines the name of the scope
+   */
+  void begin(const std::string& name);
+
+  /**
+   * @brief Closes the innermost scope of the given name opened on the calling
+   * thread, does nothing if there is none.
+   * @param name defines the name of the scope
+   */
+  void end(const std::string& name);
+
+  /**
+   * @brief Collects the scopes completed on all the threads since the last
+   * frame and starts a new frame.
+   * @returns the collected frame, valid until the next call
+   */
+  const ProfileFrame& endFrame();
+
+  /**
+   * @brief Returns the last collected frames, from the oldest to the newest.
+   */
+  const std::deque<ProfileFrame>& frames() const;
+
+  /**
+   * @brief Returns the names of the scopes, indexed by name id.
+   */
+  std::vector<std::string> names() const;
+
+  /**
+   * @brief Removes the collected frames.
+   */
+  void clearFrames();
+
+  /**
+   * @brief Writes the collected frames in the Chrome trace event format.
+   * @param stream defines the output stream
+   */
+  void exportChromeTrace(std::ostream& stream) const;
+
+  /**
+   * @brief Writes the collected frames and the names of the scopes in a
+   * compact binary format: variable length integers, the start times being
+   * stored as differences.
+   * @param stream defines the output stream
+   */
+  void exportBinary(std::ostream& stream) const;
+
+  /**
+   * @brief Reads frames written by exportBinary.
+   * @param stream defines the input stream
+   * @param names defines the list receiving the names of the scopes
+   * @returns the frames, empty if the stream is not a valid profile
+   */
+  static std::vector<ProfileFrame>
+  ImportBinary(std::istream& stream, std::vector<std::string>& names);
+
+  /**
+   * @brief Computes the summaries of the events of a frame.
+   * @param events defines the events, sorted by start time
+   * @param names defines the names of the scopes, indexed by name id
+   * @returns the summaries sorted by decreasing total time
+   */
+  static std::vector<ProfileSummary>
+  Summarize(const std::vector<ProfileEvent>& events,
+            const std::vector<std::string>& names);
+
+private:
+  struct ThreadBuffer;
+
+  ThreadBuffer* _getThreadBuffer(bool create);
+  uint32_t _getNameId(ThreadBuffer& buffer, const std::string& name);
+  uint64_t _now() const;
+
+public:
+  /**
+   * Maximum number of frames kept for the exports, the last frame is always
+   * kept
+   */
+  size_t maxFrameCount;
+
+private:
+  // Identifier of the profiler in the thread local buffer lists
+  const uint64_t _id;
+  std::atomic<bool> _enabled;
+  const std::chrono::steady_clock::time_point _epoch;
+  mutable std::mutex _mutex;
+  std::vector<std::shared_ptr<ThreadBuffer>> _threadBuffers;
+  std::unordered_map<std::string, uint32_t> _nameIds;
+  std::vector<std::string> _names;
+  std::deque<ProfileFrame> _frames;
+  size_t _frameId;
+  uint64_t _frameStart;
+
+}; // end of class Profiler
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MISC_PROFILER_H
@@ -285,18 +285,23 @@ struct BABYLON_SHARED_EXPORT Tools {
    */
   static void DumpFramebuffer(int width, int height, Engine* engine);
 
-  static void StartPerformanceCounter(const std::string&)
-  {
-  }
-  static void StartPerformanceCounter(const std::string&, bool)
-  {
-  }
-  static void EndPerformanceCounter(const std::string&)
-  {
-  }
-  static void EndPerformanceCounter(const std::string&, bool)
-  {
-  }
+  /**
+   * @brief Starts a performance counter, recorded by the default profiler
+   * when it is enabled.
+   * @param counterName defines the name of the counter
+   * @param condition defines if the counter should be started
+   */
+  static void StartPerformanceCounter(const std::string& counterName,
+                                      bool condition = true);
+
+  /**
+   * @brief Ends a performance counter started by StartPerformanceCounter.
+   * @param counterName defines the name of the counter
+   * @param condition defines if the counter should be ended
+   */
+  static void EndPerformanceCounter(const std::string& counterName,
+                                    bool condition = true);
+
   static void ExitFullscreen()
   {
   }
@@ -0,0 +1,124 @@
+#ifndef BABYLON_PARTICLES_PARTICLE_STORAGE_H
+#define BABYLON_PARTICLES_PARTICLE_STORAGE_H
+
+#include <cstdint>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/math/math_kernels.h>
+
+namespace BABYLON {
+
+class Particle;
+class Vector3;
+
+/**
+ * @brief Particles stored as structures of arrays, one contiguous array per
+ * attribute, updated by the math kernels.
+ *
+ * The attributes updated by MathKernels::updateParticles come first, followed
+ * by the attributes only set at emission.
+ */
+class BABYLON_SHARED_EXPORT ParticleStorage {
+
+public:
+  /** Attributes of the particles, after the MathKernels::ParticleComponent */
+  enum Component : size_t {
+    Size = MathKernels::ParticleComponents,
+    ScaleX,
+    ScaleY,
+    InitialDirectionX,
+    InitialDirectionY,
+    InitialDirectionZ,
+    ComponentCount,
+  }; // end of enum Component
+
+  /** Number of particles from which the updates run on the thread pool */
+  static constexpr size_t ParallelUpdateThreshold = 1 << 14;
+
+public:
+  ParticleStorage();
+  ~ParticleStorage();
+
+  /**
+   * @brief Sets the maximum number of particles, keeping the stored ones that
+   * fit.
+   * @param capacity defines the maximum number of particles
+   */
+  void reserve(size_t capacity);
+
+  /**
+   * @brief Gets the maximum number of particles.
+   */
+  size_t capacity() const;
+
+  /**
+   * @brief Gets the number of particles.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Returns true if there is no particle.
+   */
+  bool empty() const;
+
+  /**
+   * @brief Removes all the particles.
+   */
+  void clear();
+
+  /**
+   * @brief Appends a particle, does nothing when the storage is full.
+   * @param particle defines the particle whose attributes are copied
+   */
+  void add(const Particle& particle);
+
+  /**
+   * @brief Copies the attributes of a stored particle.
+   * @param index defines the index of the particle
+   * @param particle defines the particle receiving the attributes
+   */
+  void get(size_t index, Particle& particle) const;
+
+  /**
+   * @brief Removes a particle by moving the last one in its place.
+   * @param index defines the index of the particle
+   */
+  void remove(size_t index);
+
+  /**
+   * @brief Gets the array of an attribute, indexed by particle.
+   * @param component defines the attribute, a MathKernels::ParticleComponent
+   * or a Component
+   */
+  float* component(size_t component);
+  const float* component(size_t component) const;
+
+  /**
+   * @brief Returns true if the particle keeps its emission direction, which
+   * is then rendered instead of its current direction.
+   * @param index defines the index of the particle
+   */
+  bool hasInitialDirection(size_t index) const;
+
+  /**
+   * @brief Advances all the particles, in parallel for large storages, and
+   * removes the ones which reached their life time.
+   * @param updateSpeed defines the age step
+   * @param gravity defines the gravity applied to the directions
+   * @returns the number of removed particles
+   */
+  size_t update(float updateSpeed, const Vector3& gravity);
+
+private:
+  Float32Array _components;
+  std::vector<uint8_t> _hasInitialDirection;
+  size_t _capacity;
+  size_t _size;
+
+}; // end of class ParticleStorage
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PARTICLES_PARTICLE_STORAGE_H
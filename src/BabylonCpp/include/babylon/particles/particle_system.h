@@ -8,6 +8,7 @@
 #include <babylon/misc/observer.h>
 #include <babylon/particles/base_particle_system.h>
 #include <babylon/particles/iparticle_system.h>
+#include <typeinfo>
 #include <unordered_map>
 
 namespace BABYLON {
@@ -16,6 +17,7 @@ class Buffer;
 class Effect;
 class Mesh;
 class Particle;
+class ParticleStorage;
 class Scene;
 class VertexBuffer;
 using EffectPtr       = std::shared_ptr<Effect>;
@@ -332,6 +334,12 @@ public:
    */
   size_t getCapacity() const override;
 
+  /**
+   * @brief Gets the number of particles active at the same time.
+   * @returns The number of active particles.
+   */
+  size_t getActiveCount() const;
+
   /**
    * @brief Gets whether there are still active particles in the system.
    * @returns True if it is alive, otherwise false.
@@ -398,6 +406,11 @@ public:
   static std::vector<std::string>
   _GetEffectCreationOptions(bool isAnimationSheetEnabled = false);
 
+  /**
+   * @brief Hidden
+   */
+  const Float32Array& _getVertexData() const;
+
   /**
    * @brief For internal use only.
    */
@@ -519,8 +532,13 @@ private:
   void _emitFromParticle(Particle* particle);
   // End of sub system methods
   void _update(int newParticles);
+  void _initializeParticle(Particle* particle);
+  bool _canUseParticleStorage();
+  void _syncParticleStorage(bool storageActive);
+  size_t _activeParticleCount() const;
   EffectPtr _getEffect(unsigned int blendMode);
   void _appendParticleVertices(unsigned int offset, Particle* particle);
+  void _appendStoredParticleVertices();
   size_t _render(unsigned int blendMode);
 
 public:
@@ -538,6 +556,15 @@ public:
    */
   std::function<void(std::vector<Particle*>& particles)> updateFunction;
 
+  /**
+   * Gets or sets whether the particles are stored as structures of arrays and
+   * advanced by the vectorized kernels, on the thread pool for large systems.
+   * Only applies while the system uses none of the gradients evaluated per
+   * particle, the noise texture, the sub-emitters, the animation sheet and the
+   * ramp gradients, and while updateFunction is the default one.
+   */
+  bool useParticleStorage;
+
   /**
    * This function can be defined to specify initial direction for every new
    * particle. It by default use the emitterType defined function
@@ -614,6 +641,11 @@ private:
   float _epsilon;
   size_t _capacity;
   std::vector<Particle*> _stockParticles;
+  std::unique_ptr<ParticleStorage> _particleStorage;
+  // Particle initialized before being copied into the storage
+  std::unique_ptr<Particle> _emittedParticle;
+  // Type of the default updateFunction, a custom one disables the storage
+  const std::type_info* _defaultUpdateFunctionType;
   int _newPartsExcess;
   Float32Array _vertexData;
   std::unique_ptr<Buffer> _vertexBuffer;
@@ -1,7 +1,9 @@
 #ifndef BABYLON_PARTICLES_SOLID_PARTICLE_SYSTEM_H
 #define BABYLON_PARTICLES_SOLID_PARTICLE_SYSTEM_H
 
+#include <array>
 #include <functional>
+#include <limits>
 
 #include <babylon/babylon_api.h>
 #include <babylon/core/structs.h>
@@ -58,6 +60,13 @@ struct SolidParticleSystemMeshBuilderOptions {
  */
 class BABYLON_SHARED_EXPORT SolidParticleSystem : public IDisposable {
 
+public:
+  /**
+   * Number of updated particles from which `setParticles()` computes the
+   * particle vertices on the thread pool
+   */
+  static constexpr size_t ParallelUpdateThreshold = 256;
+
 public:
   template <typename... Ts>
   static SolidParticleSystemPtr New(Ts&&... args)
@@ -123,6 +132,11 @@ public:
    * mesh according to the particle positions, rotations, colors, textures, etc.
    * This method calls `updateParticle()` for each particle of the SPS.
    * For an animated SPS, it is usually called within the render loop.
+   * The particle vertices are computed in parallel for large updates, unless
+   * `computeParticleVertex` is set. The uploaded vertices are the single span
+   * going from the first to the last particle updated since the last mesh
+   * update, the calls with `update` false included, so a call setting all the
+   * particles uploads the whole vertex buffers.
    * @param start The particle index in the particle array where to start to
    * compute the particle property values _(default 0)_
    * @param end The particle index in the particle array where to stop to
@@ -131,8 +145,10 @@ public:
    * the particle computations _(default true)_
    * @returns the SPS.
    */
-  SolidParticleSystem& setParticles(unsigned int start = 0,
-                                    unsigned int end = 0, bool update = true);
+  SolidParticleSystem&
+  setParticles(unsigned int start = 0,
+               unsigned int end   = std::numeric_limits<unsigned int>::max(),
+               bool update        = true);
 
   /**
    * @brief Disposes the SPS.
@@ -417,9 +433,8 @@ private:
    * @brief Adds a new particle object in the particles array.
    */
   SolidParticle* _addParticle(unsigned int idx, unsigned int idxpos,
-                              unsigned int idxind,
-                              std::unique_ptr<ModelShape>&& model, int shapeId,
-                              unsigned int idxInShape,
+                              unsigned int idxind, ModelShape* model,
+                              int shapeId, unsigned int idxInShape,
                               const BoundingInfo& bInfo);
 
   /**
@@ -428,6 +443,21 @@ private:
    */
   void _rebuildParticle(SolidParticle* particle);
 
+  /**
+   * @brief Writes the vertices of a particle whose transform is computed, and
+   * updates its bounding info if the particle intersections are computed.
+   * Particles writing distinct vertex ranges can be set concurrently.
+   */
+  void _setParticleVertices(SolidParticle* particle,
+                            const std::array<Vector3, 3>& camAxes,
+                            Vector3& minimum, Vector3& maximum);
+
+  /**
+   * @brief Uploads the dirty vertex range of a vertex data kind.
+   */
+  void _updateVerticesDataRange(const std::string& kind,
+                                const Float32Array& data, size_t stride);
+
 public:
   /**
    * The SPS array of Solid Particle objects. Just access each particle as with
@@ -541,6 +571,13 @@ private:
                     const DepthSortedParticle& p2)>
     _depthSortFunction;
   bool _needs32Bits;
+  // model shapes referenced by the particles
+  std::vector<std::unique_ptr<ModelShape>> _modelShapes;
+  // particles whose vertices are written by the current setParticles() call
+  std::vector<SolidParticle*> _updatedParticles;
+  // range of the vertices written since the last VBO update
+  size_t _dirtyVertexStart;
+  size_t _dirtyVertexEnd;
 
 }; // end of class SolidParticleSystem
 
@@ -15,6 +15,12 @@ struct BABYLON_SHARED_EXPORT IPhysicsEnabledObject : public AbstractMesh {
   virtual Scene* getScene() const                = 0;
   virtual bool hasBoundingInfo()                 = 0;
   virtual const std::string getClassName() const = 0;
+
+protected:
+  IPhysicsEnabledObject(const std::string& iName, Scene* scene)
+      : AbstractMesh(iName, scene)
+  {
+  }
 }; // end of struct IPhysicsEnabledObject
 
 } // end of namespace BABYLON
@@ -67,6 +67,10 @@ public:
    * Mesh-imposter type
    */
   static constexpr unsigned int MeshImpostor = 4;
+  /**
+   * Capsule-Impostor type (Native physics plugin only)
+   */
+  static constexpr unsigned int CapsuleImpostor = 6;
   /**
    * Cylinder-Imposter type
    */
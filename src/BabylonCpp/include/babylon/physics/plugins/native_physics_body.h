@@ -0,0 +1,48 @@
+#ifndef BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_BODY_H
+#define BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_BODY_H
+
+#include <babylon/babylon_api.h>
+#include <babylon/physics/iphysics_body.h>
+#include <babylon/physics/plugins/native_physics_world.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Physics body handle given to the impostors by the native physics
+ * plugin.
+ */
+class BABYLON_SHARED_EXPORT NativePhysicsBody : public IPhysicsBody {
+
+public:
+  NativePhysicsBody(NativePhysicsWorld& world, NativePhysicsWorld::BodyId id);
+  virtual ~NativePhysicsBody();
+
+  /**
+   * @brief Gets the id of the body in the world.
+   */
+  NativePhysicsWorld::BodyId id() const;
+
+  void setPosition(const Vector3& newPosition) override;
+  void setOrientation(const Quaternion& newRotation) override;
+  void setShapesDensity(float density) override;
+  void setupMass(int mass) override;
+  float mass() override;
+  void applyImpulse(const Vector3& position, const Vector3& force) override;
+  Vector3 angularVelocity() override;
+  void setAngularVelocity(const Vector3& velocity) override;
+  Vector3 linearVelocity() override;
+  void setLinearVelocity(const Vector3& velocity) override;
+  void sleep() override;
+  bool sleeping() override;
+  void awake() override;
+  void syncShapes() override;
+
+private:
+  NativePhysicsWorld& _world;
+  NativePhysicsWorld::BodyId _id;
+
+}; // end of class NativePhysicsBody
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_BODY_H
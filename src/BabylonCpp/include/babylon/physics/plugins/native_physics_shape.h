@@ -0,0 +1,218 @@
+#ifndef BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_SHAPE_H
+#define BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_SHAPE_H
+
+#include <array>
+#include <utility>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/math/quaternion.h>
+#include <babylon/math/vector3.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Planar face of a convex hull.
+ */
+struct BABYLON_SHARED_EXPORT NativePhysicsFace {
+  /** Outward normal of the face */
+  Vector3 normal;
+  /** Distance of the face plane to the origin along the normal */
+  float offset;
+  /** Indices of the face vertices, counter clockwise seen from outside */
+  std::vector<size_t> indices;
+}; // end of struct NativePhysicsFace
+
+/**
+ * @brief Contact point between two shapes.
+ */
+struct BABYLON_SHARED_EXPORT NativePhysicsContact {
+  /** World position, halfway between the two surfaces */
+  Vector3 point;
+  /** World normal, pointing from the first shape to the second one */
+  Vector3 normal;
+  /** Penetration depth along the normal */
+  float depth;
+}; // end of struct NativePhysicsContact
+
+/**
+ * @brief Convex collision shape of a native physics body, defined in the body
+ * local space.
+ *
+ * Spheres and capsules are stored as a core point or segment inflated by a
+ * radius, boxes and convex meshes as convex hulls with merged planar faces.
+ */
+class BABYLON_SHARED_EXPORT NativePhysicsShape {
+
+public:
+  enum class Type {
+    /** Core point inflated by the radius */
+    Sphere,
+    /** Core segment along the Y axis inflated by the radius */
+    Capsule,
+    /** Convex polyhedron */
+    ConvexHull,
+  }; // end of enum class Type
+
+public:
+  /**
+   * @brief Creates a sphere shape.
+   * @param radius defines the radius of the sphere
+   * @returns the sphere shape
+   */
+  static NativePhysicsShape Sphere(float radius);
+
+  /**
+   * @brief Creates a capsule shape aligned with the Y axis.
+   * @param radius defines the radius of the capsule
+   * @param halfHeight defines the half length of the core segment (the total
+   * height of the capsule is 2 * (halfHeight + radius))
+   * @returns the capsule shape
+   */
+  static NativePhysicsShape Capsule(float radius, float halfHeight);
+
+  /**
+   * @brief Creates a box shape.
+   * @param halfExtents defines the half size of the box along each axis
+   * @returns the box shape
+   */
+  static NativePhysicsShape Box(const Vector3& halfExtents);
+
+  /**
+   * @brief Creates the convex hull of a point cloud. Flat or degenerated point
+   * clouds are approximated by their (slightly thickened) bounding box.
+   * @param points defines the points to enclose
+   * @returns the convex hull shape
+   */
+  static NativePhysicsShape ConvexHull(const std::vector<Vector3>& points);
+
+  NativePhysicsShape();
+  ~NativePhysicsShape();
+
+  /**
+   * @brief Gets the type of the shape.
+   */
+  Type type() const;
+
+  /**
+   * @brief Gets the radius of a sphere or a capsule (0 for convex hulls).
+   */
+  float radius() const;
+
+  /**
+   * @brief Gets the half length of the core segment of a capsule.
+   */
+  float halfHeight() const;
+
+  /**
+   * @brief Gets the vertices of a convex hull.
+   */
+  const std::vector<Vector3>& vertices() const;
+
+  /**
+   * @brief Gets the faces of a convex hull.
+   */
+  const std::vector<NativePhysicsFace>& faces() const;
+
+  /**
+   * @brief Gets the edges of a convex hull, as pairs of vertex indices.
+   */
+  const std::vector<std::pair<size_t, size_t>>& edges() const;
+
+  /**
+   * @brief Gets the half size of the local bounding box of the shape.
+   */
+  Vector3 getHalfExtents() const;
+
+  /**
+   * @brief Computes the principal moments of inertia of the shape. Capsules
+   * and convex hulls are approximated by their bounding cylinder and box.
+   * @param mass defines the mass of the body
+   * @returns the diagonal of the inertia tensor
+   */
+  Vector3 computeInertia(float mass) const;
+
+  /**
+   * @brief Casts a ray against the shape, in the shape local space.
+   * @param origin defines the origin of the ray
+   * @param direction defines the normalized direction of the ray
+   * @param maxDistance defines the length of the ray
+   * @param distance defines the distance of the hit along the ray
+   * @param normal defines the normal of the shape at the hit point
+   * @returns true if the ray hits the shape
+   */
+  bool raycast(const Vector3& origin, const Vector3& direction,
+               float maxDistance, float& distance, Vector3& normal) const;
+
+private:
+  void _mergeCoplanarFaces(
+    const std::vector<std::array<size_t, 3>>& triangles);
+
+private:
+  Type _type;
+  float _radius;
+  float _halfHeight;
+  std::vector<Vector3> _vertices;
+  std::vector<NativePhysicsFace> _faces;
+  std::vector<std::pair<size_t, size_t>> _edges;
+
+}; // end of class NativePhysicsShape
+
+/**
+ * @brief Shape placed in the world, with the world space data used by the
+ * narrowphase.
+ */
+struct BABYLON_SHARED_EXPORT NativePhysicsShapeInstance {
+  /**
+   * @brief Places the shape in the world.
+   * @param shape defines the shape
+   * @param position defines the world position of the shape
+   * @param orientation defines the world orientation of the shape
+   */
+  void update(const NativePhysicsShape& shape, const Vector3& position,
+              const Quaternion& orientation);
+
+  /**
+   * @brief Computes the contact points between two shapes.
+   * @param a defines the first shape
+   * @param b defines the second shape
+   * @param contacts defines the list to which the contacts are appended
+   */
+  static void Collide(const NativePhysicsShapeInstance& a,
+                      const NativePhysicsShapeInstance& b,
+                      std::vector<NativePhysicsContact>& contacts);
+
+  /**
+   * @brief Rotates a vector by a quaternion. Unlike the math classes helpers,
+   * it does not use shared temporaries and can be called from worker threads.
+   * @param rotation defines the rotation to apply
+   * @param vector defines the vector to rotate
+   * @returns the rotated vector
+   */
+  static Vector3 Rotate(const Quaternion& rotation, const Vector3& vector);
+
+  /** The shape */
+  const NativePhysicsShape* shape = nullptr;
+  /** World position of the shape */
+  Vector3 position;
+  /** World orientation of the shape */
+  Quaternion orientation;
+  /** World core segment of spheres (both ends equal) and capsules */
+  Vector3 coreStart;
+  /** World core segment of spheres (both ends equal) and capsules */
+  Vector3 coreEnd;
+  /** World vertices of convex hulls */
+  std::vector<Vector3> vertices;
+  /** World face normals of convex hulls */
+  std::vector<Vector3> normals;
+  /** World face offsets of convex hulls */
+  std::vector<float> offsets;
+  /** World bounding box */
+  Vector3 minimum;
+  /** World bounding box */
+  Vector3 maximum;
+}; // end of struct NativePhysicsShapeInstance
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_SHAPE_H
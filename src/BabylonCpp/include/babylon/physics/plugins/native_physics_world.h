@@ -0,0 +1,245 @@
+#ifndef BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_WORLD_H
+#define BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_WORLD_H
+
+#include <limits>
+#include <map>
+#include <set>
+
+#include <babylon/babylon_api.h>
+#include <babylon/physics/plugins/native_physics_shape.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Rigid body simulation used by the native physics plugin.
+ *
+ * Each step runs a sweep and prune broadphase, the convex narrowphase of the
+ * shapes, then splits the bodies connected by contacts and joints into islands
+ * which are solved independently (on the default thread pool when there are
+ * several of them) with a warm started sequential impulse solver. Islands at
+ * rest are put to sleep.
+ */
+class BABYLON_SHARED_EXPORT NativePhysicsWorld {
+
+public:
+  using BodyId  = size_t;
+  using JointId = size_t;
+
+  static constexpr size_t InvalidId = std::numeric_limits<size_t>::max();
+
+public:
+  NativePhysicsWorld();
+  ~NativePhysicsWorld();
+
+  /**
+   * @brief Sets the gravity applied to the dynamic bodies.
+   */
+  void setGravity(const Vector3& gravity);
+
+  /**
+   * @brief Gets the gravity applied to the dynamic bodies.
+   */
+  const Vector3& gravity() const;
+
+  /**
+   * @brief Removes all the bodies and joints.
+   */
+  void clear();
+
+  /** Bodies **/
+
+  /**
+   * @brief Creates a body.
+   * @param shape defines the collision shape of the body
+   * @param mass defines the mass of the body, 0 for static bodies
+   * @param position defines the world position of the body
+   * @param orientation defines the world orientation of the body
+   * @returns the id of the body
+   */
+  BodyId createBody(const NativePhysicsShape& shape, float mass,
+                    const Vector3& position, const Quaternion& orientation);
+
+  /**
+   * @brief Removes a body and the joints attached to it.
+   */
+  void removeBody(BodyId body);
+
+  /**
+   * @brief Gets whether a body exists.
+   */
+  bool hasBody(BodyId body) const;
+
+  /**
+   * @brief Gets the number of bodies.
+   */
+  size_t bodyCount() const;
+
+  const NativePhysicsShape& shape(BodyId body) const;
+  const Vector3& position(BodyId body) const;
+  const Quaternion& orientation(BodyId body) const;
+  void setTransformation(BodyId body, const Vector3& position,
+                         const Quaternion& orientation);
+  const Vector3& linearVelocity(BodyId body) const;
+  void setLinearVelocity(BodyId body, const Vector3& velocity);
+  const Vector3& angularVelocity(BodyId body) const;
+  void setAngularVelocity(BodyId body, const Vector3& velocity);
+  float mass(BodyId body) const;
+  void setMass(BodyId body, float mass);
+  float friction(BodyId body) const;
+  void setFriction(BodyId body, float friction);
+  float restitution(BodyId body) const;
+  void setRestitution(BodyId body, float restitution);
+
+  /**
+   * @brief Applies an impulse at a world point of a body.
+   */
+  void applyImpulse(BodyId body, const Vector3& impulse, const Vector3& point);
+
+  /**
+   * @brief Applies a force at a world point of a body during the next step.
+   */
+  void applyForce(BodyId body, const Vector3& force, const Vector3& point);
+
+  bool isSleeping(BodyId body) const;
+  void sleep(BodyId body);
+  void wakeUp(BodyId body);
+
+  /** Joints **/
+
+  /**
+   * @brief Creates a joint keeping two body points together.
+   * @param bodyA defines the first body
+   * @param bodyB defines the second body
+   * @param pivotA defines the joint point in the local space of the first body
+   * @param pivotB defines the joint point in the local space of the second
+   * body
+   * @param collision defines whether the bodies still collide with each other
+   * @returns the id of the joint
+   */
+  JointId createBallAndSocketJoint(BodyId bodyA, BodyId bodyB,
+                                   const Vector3& pivotA, const Vector3& pivotB,
+                                   bool collision);
+
+  /**
+   * @brief Creates a joint only allowing the rotation around an axis. The
+   * joint is made of two ball and socket constraints along the axis.
+   * @param axisA defines the hinge axis in the local space of the first body
+   * @param axisB defines the hinge axis in the local space of the second body
+   * @returns the id of the joint
+   */
+  JointId createHingeJoint(BodyId bodyA, BodyId bodyB, const Vector3& pivotA,
+                           const Vector3& pivotB, const Vector3& axisA,
+                           const Vector3& axisB, bool collision);
+
+  /**
+   * @brief Creates a joint fixing the relative transformation of two bodies.
+   * The joint is made of three non aligned ball and socket constraints.
+   * @returns the id of the joint
+   */
+  JointId createLockJoint(BodyId bodyA, BodyId bodyB, const Vector3& pivotA,
+                          const Vector3& pivotB, bool collision);
+
+  /**
+   * @brief Creates a joint keeping the distance between two body points in a
+   * range.
+   * @returns the id of the joint
+   */
+  JointId createDistanceJoint(BodyId bodyA, BodyId bodyB,
+                              const Vector3& pivotA, const Vector3& pivotB,
+                              float minDistance, float maxDistance,
+                              bool collision);
+
+  /**
+   * @brief Updates the range of a distance joint.
+   */
+  void setDistanceJointLimits(JointId joint, float minDistance,
+                              float maxDistance);
+
+  /**
+   * @brief Removes a joint.
+   */
+  void removeJoint(JointId joint);
+
+  /** Simulation **/
+
+  /**
+   * @brief Advances the simulation.
+   * @param timeStep defines the duration of the step in seconds
+   */
+  void step(float timeStep);
+
+  /**
+   * @brief Casts a ray against the bodies.
+   * @param from defines the start of the ray
+   * @param to defines the end of the ray
+   * @param point defines the hit point
+   * @param normal defines the normal of the hit body at the hit point
+   * @returns the closest hit body, or InvalidId
+   */
+  BodyId raycast(const Vector3& from, const Vector3& to, Vector3& point,
+                 Vector3& normal) const;
+
+  /**
+   * @brief Gets the number of islands simulated during the last step.
+   */
+  size_t islandCount() const;
+
+  /**
+   * @brief Gets the number of contact points found during the last step.
+   */
+  size_t contactCount() const;
+
+public:
+  /**
+   * Number of velocity iterations of the solver (default is 10)
+   */
+  size_t solverIterations;
+
+  /**
+   * Whether the islands are solved on the worker threads of the default
+   * thread pool (default is true)
+   */
+  bool parallelIslands;
+
+  /**
+   * Whether the bodies at rest are put to sleep (default is true)
+   */
+  bool allowSleep;
+
+private:
+  struct Body;
+  struct Joint;
+  struct ContactPoint;
+  struct Manifold;
+  struct Island;
+
+  Body& _body(BodyId body);
+  const Body& _body(BodyId body) const;
+  JointId _addJoint(Joint&& joint);
+  void _updateMassProperties(Body& body);
+  void _findPairs();
+  void _collidePairs();
+  void _buildIslands();
+  void _solveIsland(Island& island, float timeStep);
+
+private:
+  Vector3 _gravity;
+  std::vector<Body> _bodies;
+  std::vector<BodyId> _freeBodies;
+  std::vector<Joint> _joints;
+  std::vector<JointId> _freeJoints;
+  // Body pairs which do not collide, joined by joints
+  std::multiset<std::pair<BodyId, BodyId>> _ignoredPairs;
+  std::vector<std::pair<BodyId, BodyId>> _pairs;
+  std::vector<Manifold> _manifolds;
+  std::map<std::pair<BodyId, BodyId>, size_t> _previousManifolds;
+  std::vector<Manifold> _previous;
+  std::vector<Island> _islands;
+  std::vector<size_t> _sortedBodies;
+  size_t _contactCount;
+
+}; // end of class NativePhysicsWorld
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_WORLD_H
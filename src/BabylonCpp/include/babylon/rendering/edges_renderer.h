@@ -1,11 +1,13 @@
 ﻿#ifndef BABYLON_RENDERING_EDGES_RENDERER_H
 #define BABYLON_RENDERING_EDGES_RENDERER_H
 
+#include <future>
 #include <unordered_map>
 
 #include <babylon/babylon_api.h>
 #include <babylon/math/vector3.h>
 #include <babylon/misc/observer.h>
+#include <babylon/rendering/face_adjacencies.h>
 #include <babylon/rendering/iedges_renderer.h>
 
 namespace BABYLON {
@@ -39,10 +41,13 @@ public:
    * vs indices
    * @param  generateEdgesLines - should generate Lines or only prepare
    * resources.
+   * @param  generateEdgesLinesInBackground - computes the adjacencies on a
+   * worker thread, the edges being rendered once they are available.
    */
   EdgesRenderer(const AbstractMeshPtr& source, float epsilon = 0.95f,
-                bool checkVerticesInsteadOfIndices = false,
-                bool generateEdgesLines            = true);
+                bool checkVerticesInsteadOfIndices  = false,
+                bool generateEdgesLines             = true,
+                bool generateEdgesLinesInBackground = false);
   ~EdgesRenderer() override;
 
   /**
@@ -69,14 +74,6 @@ public:
 
 protected:
   void _prepareResources();
-  int _processEdgeForAdjacencies(unsigned int pa, unsigned int pb,
-                                 unsigned int p0, unsigned int p1,
-                                 unsigned int p2);
-  int _processEdgeForAdjacenciesWithVertices(const Vector3& pa,
-                                             const Vector3& pb,
-                                             const Vector3& p0,
-                                             const Vector3& p1,
-                                             const Vector3& p2);
 
   /**
    * @brief Checks if the pair of p0 and p1 is en edge.
@@ -101,6 +98,29 @@ protected:
    */
   virtual void _generateEdgesLines();
 
+  /**
+   * @brief Generates lines edges from adjacencies computed on a worker thread.
+   */
+  void _generateEdgesLinesInBackground();
+
+  /**
+   * @brief Creates the lines of the edges between the faces.
+   */
+  void _createEdgesLines(const std::vector<FaceAdjacencies>& adjacencies,
+                         const std::vector<Vector3>& faceNormals);
+
+  /**
+   * @brief Creates the vertex and index buffers of the lines.
+   */
+  void _createEdgesBuffers();
+
+private:
+  /**
+   * @brief Creates the lines once the background generation is over.
+   * @returns true if no generation is running anymore
+   */
+  bool _completeBackgroundGeneration();
+
 public:
   /**
    * Define the size of the edges with an orthographic camera
@@ -127,6 +147,10 @@ protected:
 private:
   Observer<AbstractMesh>::Ptr _meshRebuildObserver;
   Observer<Node>::Ptr _meshDisposeObserver;
+  // Adjacencies computed by the background generation
+  std::future<void> _backgroundGeneration;
+  std::vector<FaceAdjacencies> _backgroundAdjacencies;
+  std::vector<Vector3> _backgroundFaceNormals;
 
 }; // end of class EdgesRenderer
 
@@ -0,0 +1,62 @@
+#ifndef BABYLON_RENDERING_FACE_ADJACENCIES_BUILDER_H
+#define BABYLON_RENDERING_FACE_ADJACENCIES_BUILDER_H
+
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/babylon_constants.h>
+#include <babylon/rendering/face_adjacencies.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Computes the face adjacencies used to generate the edges of a mesh.
+ *
+ * The edges of all the faces are keyed by their (sorted) vertex pair and
+ * sorted, so that the faces sharing an edge end up next to each other. This
+ * runs in O(F log F) instead of comparing every pair of faces.
+ */
+class BABYLON_SHARED_EXPORT FaceAdjacenciesBuilder {
+
+public:
+  /**
+   * @brief Computes the adjacencies of the faces of a mesh. Builder functions
+   * do not use shared state and can run on a worker thread.
+   * @param positions defines the vertex positions of the mesh
+   * @param indices defines the indices of the mesh faces
+   * @param checkVerticesInsteadOfIndices defines whether the faces sharing
+   * vertices at the same position (instead of the same indices) are adjacent
+   * @param epsilon defines the distance under which vertices are welded when
+   * checking vertices
+   * @returns for each face, its vertices and the index of the adjacent face
+   * on each of its edges (-1 when the edge has no adjacent face)
+   */
+  static std::vector<FaceAdjacencies>
+  Build(const Float32Array& positions, const IndicesArray& indices,
+        bool checkVerticesInsteadOfIndices, float epsilon = Math::Epsilon);
+
+  /**
+   * @brief Welds the vertices having the same position.
+   * @param positions defines the vertex positions
+   * @param epsilon defines the maximum difference per coordinate of the welded
+   * vertices
+   * @returns the index of the first vertex at the same position, for each
+   * vertex
+   */
+  static Uint32Array WeldVertices(const Float32Array& positions,
+                                  float epsilon = Math::Epsilon);
+
+  /**
+   * @brief Computes the normals of the faces.
+   * @param adjacencies defines the faces
+   * @returns the normalized normal of each face
+   */
+  static std::vector<Vector3>
+  ComputeFaceNormals(const std::vector<FaceAdjacencies>& adjacencies);
+
+}; // end of class FaceAdjacenciesBuilder
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_RENDERING_FACE_ADJACENCIES_BUILDER_H
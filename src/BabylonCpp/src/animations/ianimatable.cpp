@@ -58,6 +58,14 @@ void IAnimatable::setProperty(
 {
 }
 
+AnimationPropertySetter
+IAnimatable::bindProperty(const std::vector<std::string>& targetPropertyPath)
+{
+  return [this, targetPropertyPath](const AnimationValue& value) {
+    setProperty(targetPropertyPath, value);
+  };
+}
+
 AnimationValue IAnimatable::getProperty(const std::string& key,
                                         const Color3& color)
 {
@@ -143,75 +151,120 @@ AnimationValue IAnimatable::getProperty(const std::string& key,
 
 void IAnimatable::setProperty(const std::string& key, Color3& color,
                               float value)
+{
+  if (auto component = bindProperty(key, color)) {
+    *component = value;
+  }
+}
+
+void IAnimatable::setProperty(const std::string& key, Color4& color,
+                              float value)
+{
+  if (auto component = bindProperty(key, color)) {
+    *component = value;
+  }
+}
+
+void IAnimatable::setProperty(const std::string& key, Vector2& vector,
+                              float value)
+{
+  if (auto component = bindProperty(key, vector)) {
+    *component = value;
+  }
+}
+
+void IAnimatable::setProperty(const std::string& key, Vector3& vector,
+                              float value)
+{
+  if (auto component = bindProperty(key, vector)) {
+    *component = value;
+  }
+}
+
+void IAnimatable::setProperty(const std::string& key, Quaternion& quaternion,
+                              float value)
+{
+  if (auto component = bindProperty(key, quaternion)) {
+    *component = value;
+  }
+}
+
+float* IAnimatable::bindProperty(const std::string& key, Color3& color)
 {
   if (key == "r") {
-    color.r = value;
+    return &color.r;
   }
   else if (key == "g") {
-    color.g = value;
+    return &color.g;
   }
   else if (key == "b") {
-    color.b = value;
+    return &color.b;
   }
+
+  return nullptr;
 }
 
-void IAnimatable::setProperty(const std::string& key, Color4& color,
-                              float value)
+float* IAnimatable::bindProperty(const std::string& key, Color4& color)
 {
   if (key == "r") {
-    color.r = value;
+    return &color.r;
   }
   else if (key == "g") {
-    color.g = value;
+    return &color.g;
   }
   else if (key == "b") {
-    color.b = value;
+    return &color.b;
   }
   else if (key == "a") {
-    color.a = value;
+    return &color.a;
   }
+
+  return nullptr;
 }
 
-void IAnimatable::setProperty(const std::string& key, Vector2& vector,
-                              float value)
+float* IAnimatable::bindProperty(const std::string& key, Vector2& vector)
 {
   if (key == "x") {
-    vector.x = value;
+    return &vector.x;
   }
   else if (key == "y") {
-    vector.y = value;
+    return &vector.y;
   }
+
+  return nullptr;
 }
 
-void IAnimatable::setProperty(const std::string& key, Vector3& vector,
-                              float value)
+float* IAnimatable::bindProperty(const std::string& key, Vector3& vector)
 {
   if (key == "x") {
-    vector.x = value;
+    return &vector.x;
   }
   else if (key == "y") {
-    vector.y = value;
+    return &vector.y;
   }
   else if (key == "z") {
-    vector.z = value;
+    return &vector.z;
   }
+
+  return nullptr;
 }
 
-void IAnimatable::setProperty(const std::string& key, Quaternion& quaternion,
-                              float value)
+float* IAnimatable::bindProperty(const std::string& key, Quaternion& quaternion)
 {
   if (key == "x") {
-    quaternion.x = value;
+    return &quaternion.x;
   }
   else if (key == "y") {
-    quaternion.y = value;
+    return &quaternion.y;
   }
   else if (key == "z") {
-    quaternion.z = value;
+    return &quaternion.z;
   }
   else if (key == "w") {
-    quaternion.w = value;
+    return &quaternion.w;
   }
+
+  return nullptr;
 }
 
 } // end of namespace BABYLON
@@ -35,6 +35,13 @@ RuntimeAnimation::RuntimeAnimation(const IAnimatablePtr& iTarget,
     , _previousDelay{millisecond_t{0}}
     , _previousRatio{0.f}
 {
+  // The target path does not change, it is resolved once
+  const auto& targetPropertyPath = animation->targetPropertyPath;
+  if (!targetPropertyPath.empty()) {
+    _targetPath = targetPropertyPath.back();
+  }
+  _activeTarget = iTarget;
+
   // Cloning events locally
   const auto& events = animation->getEvents();
   if (!events.empty()) {
@@ -154,23 +161,10 @@ void RuntimeAnimation::_setValue(const IAnimatablePtr& iTarget,
                                  float iWeight, unsigned int targetIndex)
 {
   // Set value
-  std::string path           = "";
-  IAnimatablePtr destination = nullptr;
-
-  const auto& targetPropertyPath = _animation->targetPropertyPath;
-
-  if (targetPropertyPath.size() > 1) {
-    path        = targetPropertyPath.back();
-    destination = iTarget;
-  }
-  else {
-    path        = targetPropertyPath[0];
-    destination = iTarget;
+  if (_activeTarget != iTarget) {
+    _activeTarget = iTarget;
   }
-
-  _targetPath   = path;
-  _activeTarget = destination;
-  _weight       = iWeight;
+  _weight = iWeight;
 
   if (targetIndex >= _originalValue.size()) {
     _originalValue.resize(targetIndex + 1);
@@ -189,11 +183,27 @@ void RuntimeAnimation::_setValue(const IAnimatablePtr& iTarget,
   }
   else {
     if (_currentValue.has_value()) {
-      destination->setProperty(targetPropertyPath, _currentValue.value());
+      _applyValue(iTarget, *_currentValue);
     }
   }
 }
 
+void RuntimeAnimation::_applyValue(const IAnimatablePtr& iTarget,
+                                   const AnimationValue& value)
+{
+  const auto& targetPropertyPath = _animation->targetPropertyPath;
+  if (iTarget != _target) {
+    iTarget->setProperty(targetPropertyPath, value);
+    return;
+  }
+
+  // The property is looked up once, the following frames only call the setter
+  if (!_propertySetter) {
+    _propertySetter = _target->bindProperty(targetPropertyPath);
+  }
+  _propertySetter(value);
+}
+
 std::optional<unsigned int> RuntimeAnimation::_getCorrectLoopMode() const
 {
   return 0u;
@@ -285,7 +295,7 @@ bool RuntimeAnimation::animate(millisecond_t delay, float from, float to,
   else {
     // Get max value if required
     if (_animation->loopMode != Animation::ANIMATIONLOOPMODE_CYCLE()) {
-      std::string keyOffset = std::to_string(to) + std::to_string(from);
+      const auto keyOffset = std::make_pair(to, from);
       if (!_offsetsCache.count(keyOffset)) {
         AnimationValue fromValue
           = _interpolate(from, 0, Animation::ANIMATIONLOOPMODE_CYCLE());
@@ -3,13 +3,13 @@
 #include <babylon/animations/animation.h>
 #include <babylon/babylon_stl_util.h>
 #include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton_pose.h>
 #include <babylon/core/json_util.h>
 #include <babylon/core/logging.h>
 #include <babylon/engines/constants.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
 #include <babylon/materials/textures/raw_texture.h>
-#include <babylon/math/tmp.h>
 #include <babylon/meshes/abstract_mesh.h>
 
 namespace BABYLON {
@@ -17,6 +17,7 @@ namespace BABYLON {
 Skeleton::Skeleton(const std::string& iName, const std::string& iId,
                    Scene* scene)
     : needInitialSkinMatrix{false}
+    , useBatchedBoneEvaluation{false}
     , overrideMesh{nullptr}
     , name{iName}
     , id{iId}
@@ -336,7 +337,10 @@ void Skeleton::_unregisterMeshWithPoseMatrix(AbstractMesh* mesh)
 void Skeleton::_computeTransformMatrices(
   Float32Array& targetMatrix, const std::optional<Matrix>& initialSkinMatrix)
 {
-  onBeforeComputeObservable.notifyObservers(this);
+  if (useBatchedBoneEvaluation && _updatePoseHierarchy()) {
+    _computeTransformMatricesFromPose(targetMatrix, initialSkinMatrix);
+    return;
+  }
 
   unsigned int index = 0;
   for (const auto& bone : bones) {
@@ -371,7 +375,89 @@ void Skeleton::_computeTransformMatrices(
                         static_cast<unsigned int>(bones.size()) * 16);
 }
 
+bool Skeleton::_updatePoseHierarchy()
+{
+  auto hierarchyChanged = !_pose || _poseParents.size() != bones.size();
+  for (size_t i = 0; !hierarchyChanged && i < bones.size(); ++i) {
+    const auto& bone = bones[i];
+    hierarchyChanged
+      = bone->getParent() != _poseParents[i]
+        || bone->_index.value_or(static_cast<int>(i)) != _poseOutputIndices[i];
+  }
+
+  if (!hierarchyChanged) {
+    return true;
+  }
+
+  std::unordered_map<Bone*, int> boneIndices;
+  for (size_t i = 0; i < bones.size(); ++i) {
+    boneIndices[bones[i].get()] = static_cast<int>(i);
+  }
+
+  _poseParents.clear();
+  _poseOutputIndices.clear();
+  std::vector<int> parentIndices;
+  for (size_t i = 0; i < bones.size(); ++i) {
+    const auto& bone = bones[i];
+    _poseParents.emplace_back(bone->getParent());
+    _poseOutputIndices.emplace_back(
+      bone->_index.value_or(static_cast<int>(i)));
+    if (!bone->getParent()) {
+      parentIndices.emplace_back(-1);
+    }
+    else if (stl_util::contains(boneIndices, bone->getParent())) {
+      parentIndices.emplace_back(boneIndices[bone->getParent()]);
+    }
+    else {
+      // Parent bone from another skeleton
+      _pose = nullptr;
+      return false;
+    }
+  }
+
+  if (!_pose) {
+    _pose = std::make_unique<SkeletonPose>();
+  }
+  if (!_pose->setHierarchy(parentIndices, _poseOutputIndices)) {
+    _pose = nullptr;
+    return false;
+  }
+
+  return true;
+}
+
+void Skeleton::_computeTransformMatricesFromPose(
+  Float32Array& targetMatrix, const std::optional<Matrix>& initialSkinMatrix)
+{
+  for (size_t i = 0; i < bones.size(); ++i) {
+    auto& bone = bones[i];
+    ++bone->_childUpdateId;
+    _pose->setLocalMatrix(i, bone->getLocalMatrix().m().data());
+    _pose->setInverseBindMatrix(
+      i, bone->getInvertedAbsoluteTransform().m().data());
+  }
+
+  _pose->evaluate(initialSkinMatrix, targetMatrix);
+
+  for (size_t i = 0; i < bones.size(); ++i) {
+    _pose->getWorldMatrixToRef(i, bones[i]->getWorldMatrix());
+  }
+
+  _identity.copyToArray(targetMatrix,
+                        static_cast<unsigned int>(bones.size()) * 16);
+}
+
 void Skeleton::prepare()
+{
+  if (!_beginPrepare()) {
+    return;
+  }
+
+  _computeBoneMatrices();
+  _endPrepare();
+}
+
+bool Skeleton::_beginPrepare()
 {
   // Update the local matrix of bones with linked transform nodes.
   if (_numBonesWithLinkedTransformNode > 0) {
@@ -386,32 +472,16 @@ void Skeleton::prepare()
   }
 
   if (!_isDirty) {
-    return;
+    return false;
   }
 
   if (needInitialSkinMatrix) {
     for (auto& mesh : _meshesWithPoseMatrix) {
-
-      auto poseMatrix = mesh->getPoseMatrix();
-
       if (mesh->_bonesTransformMatrices.size() != 16 * (bones.size() + 1)) {
         mesh->_bonesTransformMatrices.resize(16 * (bones.size() + 1));
       }
 
-      if (_synchronizedWithMesh != mesh) {
-        _synchronizedWithMesh = mesh;
-        // Prepare bones
-        for (auto& bone : bones) {
-          if (!bone->getParent()) {
-            auto& tmpMatrix = Tmp::MatrixArray[0];
-            auto& matrix    = bone->getBaseMatrix();
-            matrix.multiplyToRef(poseMatrix, tmpMatrix);
-            bone->_updateDifferenceMatrix(tmpMatrix);
-          }
-        }
-      }
-
-      _computeTransformMatrices(mesh->_bonesTransformMatrices, poseMatrix);
+      onBeforeComputeObservable.notifyObservers(this);
     }
   }
   else {
@@ -430,12 +500,58 @@ void Skeleton::prepare()
       }
     }
 
+    onBeforeComputeObservable.notifyObservers(this);
+  }
+
+  return true;
+}
+
+void Skeleton::_computeBoneMatrices()
+{
+  if (needInitialSkinMatrix) {
+    for (auto& mesh : _meshesWithPoseMatrix) {
+
+      auto poseMatrix = mesh->getPoseMatrix();
+
+      if (_synchronizedWithMesh != mesh) {
+        _synchronizedWithMesh = mesh;
+        // Prepare bones, the temporary matrix is not shared with other threads
+        Matrix tmpMatrix;
+        for (auto& bone : bones) {
+          if (!bone->getParent()) {
+            auto& matrix = bone->getBaseMatrix();
+            matrix.multiplyToRef(poseMatrix, tmpMatrix);
+            bone->_updateDifferenceMatrix(tmpMatrix);
+          }
+        }
+      }
+
+      _computeTransformMatrices(mesh->_bonesTransformMatrices, poseMatrix);
+    }
+  }
+  else {
     _computeTransformMatrices(_transformMatrices);
+  }
+}
 
-    if (isUsingTextureForMatrices && _transformMatrixTexture) {
-      _transformMatrixTexture->update(_transformMatrices);
+void Skeleton::_getParentSkeletons(
+  std::vector<Skeleton*>& parentSkeletons) const
+{
+  for (const auto& bone : bones) {
+    auto parentBone = bone->getParent();
+    if (parentBone && parentBone->getSkeleton() != this
+        && !stl_util::contains(parentSkeletons, parentBone->getSkeleton())) {
+      parentSkeletons.emplace_back(parentBone->getSkeleton());
     }
   }
+}
+
+void Skeleton::_endPrepare()
+{
+  if (!needInitialSkinMatrix && isUsingTextureForMatrices
+      && _transformMatrixTexture) {
+    _transformMatrixTexture->update(_transformMatrices);
+  }
 
   _isDirty = false;
 
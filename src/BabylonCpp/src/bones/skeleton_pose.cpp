@@ -0,0 +1,161 @@
+#include <babylon/bones/skeleton_pose.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include <babylon/math/math_kernels.h>
+#include <babylon/math/matrix.h>
+
+namespace BABYLON {
+
+SkeletonPose::SkeletonPose() = default;
+
+SkeletonPose::~SkeletonPose() = default;
+
+bool SkeletonPose::setHierarchy(const std::vector<int>& parentIndices,
+                                const std::vector<int>& outputIndices)
+{
+  const auto count = parentIndices.size();
+
+  _slots.clear();
+  _levelOffsets.clear();
+  _parentSlots.clear();
+  _outputIndices.clear();
+
+  // Depth of each bone in the hierarchy
+  std::vector<int> depths(count, -1);
+  std::vector<size_t> chain;
+  for (size_t i = 0; i < count; ++i) {
+    chain.clear();
+    auto current = static_cast<int>(i);
+    while (current >= 0 && depths[static_cast<size_t>(current)] < 0) {
+      if (chain.size() == count) {
+        return false;
+      }
+      chain.emplace_back(static_cast<size_t>(current));
+      current = parentIndices[static_cast<size_t>(current)];
+      if (current >= static_cast<int>(count)) {
+        return false;
+      }
+    }
+    auto depth = current < 0 ? -1 : depths[static_cast<size_t>(current)];
+    for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
+      depths[*it] = ++depth;
+    }
+  }
+
+  // Parent first order, stable per level
+  size_t levelCount = 0;
+  for (auto depth : depths) {
+    levelCount = std::max(levelCount, static_cast<size_t>(depth) + 1);
+  }
+  _levelOffsets.assign(levelCount + 1, 0);
+  for (auto depth : depths) {
+    ++_levelOffsets[static_cast<size_t>(depth) + 1];
+  }
+  for (size_t level = 1; level <= levelCount; ++level) {
+    _levelOffsets[level] += _levelOffsets[level - 1];
+  }
+
+  auto next = _levelOffsets;
+  _slots.resize(count);
+  for (size_t i = 0; i < count; ++i) {
+    _slots[i] = next[static_cast<size_t>(depths[i])]++;
+  }
+
+  _parentSlots.assign(count, 0);
+  _outputIndices.assign(count, -1);
+  for (size_t i = 0; i < count; ++i) {
+    const auto slot = _slots[i];
+    if (parentIndices[i] >= 0) {
+      _parentSlots[slot] = _slots[static_cast<size_t>(parentIndices[i])];
+    }
+    _outputIndices[slot]
+      = i < outputIndices.size() ? outputIndices[i] : static_cast<int>(i);
+  }
+
+  _locals.assign(count * 16, 0.f);
+  _worlds.assign(count * 16, 0.f);
+  _inverseBinds.assign(count * 16, 0.f);
+  _transforms.assign(count * 16, 0.f);
+  _parentWorlds.clear();
+
+  return true;
+}
+
+size_t SkeletonPose::boneCount() const
+{
+  return _slots.size();
+}
+
+void SkeletonPose::setLocalMatrix(size_t bone, const float* matrix)
+{
+  std::memcpy(_locals.data() + _slots[bone] * 16, matrix, 16 * sizeof(float));
+}
+
+void SkeletonPose::setInverseBindMatrix(size_t bone, const float* matrix)
+{
+  std::memcpy(_inverseBinds.data() + _slots[bone] * 16, matrix,
+              16 * sizeof(float));
+}
+
+void SkeletonPose::getWorldMatrixToRef(size_t bone, Matrix& result) const
+{
+  Matrix::FromArrayToRef(_worlds, static_cast<unsigned int>(_slots[bone] * 16),
+                         result);
+}
+
+void SkeletonPose::evaluate(const std::optional<Matrix>& initialSkinMatrix,
+                            Float32Array& transformMatrices)
+{
+  const auto count = _slots.size();
+  if (count == 0) {
+    return;
+  }
+
+  const auto& kernels = MathKernels::Get();
+
+  // Root bones
+  const auto rootCount = _levelOffsets[1];
+  if (initialSkinMatrix.has_value()) {
+    _parentWorlds.resize(rootCount * 16);
+    const auto* skin = initialSkinMatrix->m().data();
+    for (size_t slot = 0; slot < rootCount; ++slot) {
+      std::memcpy(_parentWorlds.data() + slot * 16, skin, 16 * sizeof(float));
+    }
+    kernels.multiplyMatrices(_locals.data(), _parentWorlds.data(),
+                             _worlds.data(), rootCount);
+  }
+  else {
+    std::memcpy(_worlds.data(), _locals.data(), rootCount * 16 * sizeof(float));
+  }
+
+  // Children, one level at a time as their parents belong to the previous ones
+  for (size_t level = 1; level + 1 < _levelOffsets.size(); ++level) {
+    const auto begin = _levelOffsets[level];
+    const auto end   = _levelOffsets[level + 1];
+    _parentWorlds.resize((end - begin) * 16);
+    for (size_t slot = begin; slot < end; ++slot) {
+      std::memcpy(_parentWorlds.data() + (slot - begin) * 16,
+                  _worlds.data() + _parentSlots[slot] * 16,
+                  16 * sizeof(float));
+    }
+    kernels.multiplyMatrices(_locals.data() + begin * 16, _parentWorlds.data(),
+                             _worlds.data() + begin * 16, end - begin);
+  }
+
+  // Transform matrices
+  kernels.multiplyMatrices(_inverseBinds.data(), _worlds.data(),
+                           _transforms.data(), count);
+  for (size_t slot = 0; slot < count; ++slot) {
+    const auto index = _outputIndices[slot];
+    if (index < 0
+        || transformMatrices.size() < (static_cast<size_t>(index) + 1) * 16) {
+      continue;
+    }
+    std::memcpy(transformMatrices.data() + static_cast<size_t>(index) * 16,
+                _transforms.data() + slot * 16, 16 * sizeof(float));
+  }
+}
+
+} // end of namespace BABYLON
@@ -236,10 +236,10 @@ bool TargetCamera::_decideIfNeedsToMove()
 void TargetCamera::_updatePosition()
 {
   if (parent()) {
-    parent()->getWorldMatrix().invertToRef(Tmp::MatrixArray[0]);
-    Vector3::TransformNormalToRef(*cameraDirection, Tmp::MatrixArray[0],
-                                  Tmp::Vector3Array[0]);
-    position().addInPlace(Tmp::Vector3Array[0]);
+    parent()->getWorldMatrix().invertToRef(Tmp::MatrixArray()[0]);
+    Vector3::TransformNormalToRef(*cameraDirection, Tmp::MatrixArray()[0],
+                                  Tmp::Vector3Array()[0]);
+    position().addInPlace(Tmp::Vector3Array()[0]);
     return;
   }
   position().addInPlace(*cameraDirection);
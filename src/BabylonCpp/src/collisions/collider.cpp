@@ -183,13 +183,16 @@ void Collider::_testTriangle(size_t faceIndex,
   auto embeddedInPlane = false;
 
   if (faceIndex >= trianglePlaneArray.size()) {
-    for (size_t i = trianglePlaneArray.size(); i <= faceIndex; ++i) {
-      trianglePlaneArray.emplace_back(Plane(0.f, 0.f, 0.f, 0.f));
-    }
-    trianglePlaneArray[faceIndex].copyFromPoints(p1, p2, p3);
+    trianglePlaneArray.resize(faceIndex + 1, Plane(0.f, 0.f, 0.f, 0.f));
   }
 
+  // Planes are computed on first use as the triangles are not always tested
+  // in order
   auto& trianglePlane = trianglePlaneArray[faceIndex];
+  if (trianglePlane.normal.x == 0.f && trianglePlane.normal.y == 0.f
+      && trianglePlane.normal.z == 0.f) {
+    trianglePlane.copyFromPoints(p1, p2, p3);
+  }
 
   if ((!hasMaterial)
       && !trianglePlane.isFrontFacingTo(_normalizedVelocity, 0)) {
@@ -378,7 +381,7 @@ void Collider::_testTriangle(size_t faceIndex,
 }
 
 void Collider::_collide(std::vector<Plane>& trianglePlaneArray,
-                        const std::vector<Vector3> pts,
+                        const std::vector<Vector3>& pts,
                         const IndicesArray& indices, size_t indexStart,
                         size_t indexEnd, unsigned int decal, bool hasMaterial)
 {
@@ -391,6 +394,31 @@ void Collider::_collide(std::vector<Plane>& trianglePlaneArray,
   }
 }
 
+void Collider::_collide(std::vector<Plane>& trianglePlaneArray,
+                        const std::vector<Vector3>& pts,
+                        const IndicesArray& indices,
+                        const std::vector<size_t>& triangleIndexStarts,
+                        unsigned int decal, bool hasMaterial)
+{
+  for (const auto i : triangleIndexStarts) {
+    const auto& p1 = pts[indices[i] - decal];
+    const auto& p2 = pts[indices[i + 1] - decal];
+    const auto& p3 = pts[indices[i + 2] - decal];
+
+    _testTriangle(i, trianglePlaneArray, p3, p2, p1, hasMaterial);
+  }
+}
+
+void Collider::_getSweptBoundsToRef(Vector3& minimum, Vector3& maximum) const
+{
+  // The collider is a unit sphere moving along the velocity
+  _basePoint.addToRef(_velocity, maximum);
+  minimum.copyFrom(Vector3::Minimize(_basePoint, maximum));
+  maximum.maximizeInPlace(_basePoint);
+  minimum.subtractFromFloatsToRef(1.f, 1.f, 1.f, minimum);
+  maximum.addInPlaceFromFloats(1.f, 1.f, 1.f);
+}
+
 void Collider::_getResponse(Vector3& pos, Vector3& vel)
 {
   pos.addToRef(vel, _destinationPoint);
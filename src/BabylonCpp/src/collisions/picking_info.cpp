@@ -148,13 +148,13 @@ std::optional<Vector3> PickingInfo::getNormal(bool useWorldCoordinates,
     auto wm = pickedMesh->getWorldMatrix();
 
     if (pickedMesh->nonUniformScaling()) {
-      Tmp::MatrixArray[0].copyFrom(wm);
-      wm = Tmp::MatrixArray[0];
+      Tmp::MatrixArray()[0].copyFrom(wm);
+      wm = Tmp::MatrixArray()[0];
       wm.setTranslationFromFloats(0.f, 0.f, 0.f);
       wm.invert();
-      wm.transposeToRef(Tmp::MatrixArray[1]);
+      wm.transposeToRef(Tmp::MatrixArray()[1]);
 
-      wm = Tmp::MatrixArray[1];
+      wm = Tmp::MatrixArray()[1];
     }
 
     result = Vector3::TransformNormal(result, wm);
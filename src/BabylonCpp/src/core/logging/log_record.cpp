@@ -0,0 +1,65 @@
+#include <babylon/core/logging/log_record.h>
+
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+
+#include <babylon/core/time.h>
+
+namespace BABYLON {
+
+LogRecordWriter::LogRecordWriter(const LogCallSite& callSite,
+                                 uint32_t suppressedCount)
+    : _stream{this}
+{
+  _record.callSite        = &callSite;
+  _record.timestamp       = Time::systemTimepointNow();
+  _record.threadId        = std::this_thread::get_id();
+  _record.suppressedCount = suppressedCount;
+  setp(_record.text, _record.text + LogRecord::TextCapacity);
+}
+
+LogRecordWriter::~LogRecordWriter() = default;
+
+std::ostream& LogRecordWriter::context()
+{
+  return _stream;
+}
+
+LogRecordWriter::int_type LogRecordWriter::overflow(int_type /*ch*/)
+{
+  // The text is truncated
+  return traits_type::eof();
+}
+
+void LogRecordWriter::_beginMessage()
+{
+  _record.contextLength = static_cast<uint16_t>(pptr() - pbase());
+  _stream.clear();
+}
+
+void LogRecordWriter::writef(const char* printf_like_message, ...)
+{
+  _beginMessage();
+
+  const auto available = static_cast<size_t>(epptr() - pptr());
+  va_list arglist;
+  va_start(arglist, printf_like_message);
+  const int nbrcharacters
+    = vsnprintf(pptr(), available, printf_like_message, arglist);
+  va_end(arglist);
+
+  // The last available character is used by the terminating null character
+  if (nbrcharacters > 0 && available > 0) {
+    pbump(static_cast<int>(std::min(available - 1, size_t(nbrcharacters))));
+  }
+}
+
+const LogRecord& LogRecordWriter::record()
+{
+  _record.messageLength
+    = static_cast<uint16_t>(pptr() - pbase() - _record.contextLength);
+  return _record;
+}
+
+} // end of namespace BABYLON
@@ -1,9 +1,18 @@
 #include <babylon/core/logging/logger.h>
 
+#include <chrono>
+#include <cstring>
+
 #include <babylon/core/logging/log_message.h>
 
 namespace BABYLON {
 
+struct Logger::Slot {
+  // Position of the record in the queue, plus one once written
+  std::atomic<size_t> sequence;
+  LogRecord record;
+}; // end of struct Logger::Slot
+
 LogMessageHandler::LogMessageHandler()
     : _minLevel{LogLevels::LEVEL_QUIET}, _maxLevel{LogLevels::LEVEL_TRACE}
 {
@@ -22,17 +31,40 @@ void LogMessageHandler::handle(const LogMessage& logMessage)
   if (_logMessageListeners.find(logMessage.level())
       != _logMessageListeners.end()) {
     for (auto& logMsgListener : _logMessageListeners[logMessage.level()]) {
-      (*logMsgListener)(LogMessage(logMessage));
+      (*logMsgListener)(logMessage);
     }
   }
 }
 
 Logger::Logger()
+    : _asynchronous{true}
+    , _maxMessagesPerSecond{100}
+    , _slots{std::make_unique<Slot[]>(QueueCapacity)}
+    , _enqueuePosition{0}
+    , _dequeuePosition{0}
+    , _dispatchedPosition{0}
+    , _flushPosition{0}
+    , _droppedCount{0}
+    , _stopped{false}
 {
+  for (size_t i = 0; i < QueueCapacity; ++i) {
+    _slots[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  _thread = std::thread(&Logger::_run, this);
 }
 
 Logger::~Logger()
 {
+  // Dispatching the queued records before shutting down
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _stopped = true;
+  }
+  _condition.notify_one();
+  if (_thread.joinable()) {
+    _thread.join();
+  }
+
   // Cleanly shutting down log message handler
   _impl._logMessageListeners.clear();
 }
@@ -51,7 +83,211 @@ LogMessage Logger::CreateMessage(unsigned int level, std::string context,
 
 void Logger::log(const LogMessage& msg)
 {
-  _impl.handle(msg);
+  _dispatch(msg);
+}
+
+bool Logger::admit(LogCallSite& callSite, uint32_t& suppressedCount)
+{
+  suppressedCount  = 0;
+  const auto limit = _maxMessagesPerSecond.load(std::memory_order_relaxed);
+  if (limit == 0) {
+    return true;
+  }
+
+  const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch())
+                        .count();
+  auto windowStart = callSite.windowStart.load(std::memory_order_relaxed);
+  if (now - windowStart >= 1000000000
+      && callSite.windowStart.compare_exchange_strong(
+        windowStart, now, std::memory_order_relaxed)) {
+    callSite.windowCount.store(0, std::memory_order_relaxed);
+  }
+
+  if (callSite.windowCount.fetch_add(1, std::memory_order_relaxed) < limit) {
+    suppressedCount
+      = callSite.suppressedCount.exchange(0, std::memory_order_relaxed);
+    return true;
+  }
+
+  callSite.suppressedCount.fetch_add(1, std::memory_order_relaxed);
+  return false;
+}
+
+void Logger::post(const LogRecord& record)
+{
+  if (!_asynchronous.load(std::memory_order_relaxed)
+      || _stopped.load(std::memory_order_acquire)) {
+    _dispatch(record);
+    return;
+  }
+
+  if (!_push(record)) {
+    _droppedCount.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  _condition.notify_one();
+}
+
+void Logger::flush()
+{
+  // A listener cannot wait for itself
+  if (std::this_thread::get_id() == _thread.get_id()) {
+    return;
+  }
+
+  // Waits for every record which claimed a queue position before this call,
+  // including the ones other threads are still writing
+  const auto position = _enqueuePosition.load();
+  auto flushPosition  = _flushPosition.load();
+  while (flushPosition < position
+         && !_flushPosition.compare_exchange_weak(flushPosition, position)) {
+  }
+  std::unique_lock<std::mutex> lock{_mutex};
+  _condition.notify_one();
+  _flushedCondition.wait(lock, [this, position]() {
+    return _stopped || _dispatchedPosition.load() >= position;
+  });
+}
+
+bool Logger::isAsynchronous() const
+{
+  return _asynchronous.load(std::memory_order_relaxed);
+}
+
+void Logger::setAsynchronous(bool value)
+{
+  if (!value) {
+    flush();
+  }
+  _asynchronous.store(value, std::memory_order_relaxed);
+}
+
+unsigned int Logger::maxMessagesPerSecond() const
+{
+  return _maxMessagesPerSecond.load(std::memory_order_relaxed);
+}
+
+void Logger::setMaxMessagesPerSecond(unsigned int value)
+{
+  _maxMessagesPerSecond.store(value, std::memory_order_relaxed);
+}
+
+bool Logger::_push(const LogRecord& record)
+{
+  auto position = _enqueuePosition.load(std::memory_order_relaxed);
+  Slot* slot    = nullptr;
+  while (true) {
+    slot = &_slots[position & (QueueCapacity - 1)];
+    const auto sequence = slot->sequence.load(std::memory_order_acquire);
+    const auto difference
+      = static_cast<std::ptrdiff_t>(sequence - position);
+    if (difference == 0) {
+      if (_enqueuePosition.compare_exchange_weak(position, position + 1,
+                                                 std::memory_order_relaxed)) {
+        break;
+      }
+    }
+    else if (difference < 0) {
+      // The queue is full
+      return false;
+    }
+    else {
+      position = _enqueuePosition.load(std::memory_order_relaxed);
+    }
+  }
+
+  // Only the used part of the text is copied
+  slot->record.callSite        = record.callSite;
+  slot->record.timestamp       = record.timestamp;
+  slot->record.threadId        = record.threadId;
+  slot->record.suppressedCount = record.suppressedCount;
+  slot->record.contextLength   = record.contextLength;
+  slot->record.messageLength   = record.messageLength;
+  std::memcpy(slot->record.text, record.text,
+              size_t(record.contextLength) + record.messageLength);
+  slot->sequence.store(position + 1, std::memory_order_release);
+  return true;
+}
+
+bool Logger::_pop(LogRecord& record)
+{
+  auto& slot = _slots[_dequeuePosition & (QueueCapacity - 1)];
+  if (slot.sequence.load(std::memory_order_acquire) != _dequeuePosition + 1) {
+    return false;
+  }
+
+  record = slot.record;
+  slot.sequence.store(_dequeuePosition + QueueCapacity,
+                      std::memory_order_release);
+  ++_dequeuePosition;
+  return true;
+}
+
+void Logger::_run()
+{
+  LogRecord record;
+  while (true) {
+    while (_pop(record)) {
+      _dispatch(record);
+      _dispatchedPosition.store(_dequeuePosition);
+      // Wakes the flushing threads without waiting for the queue to be empty
+      if (_dequeuePosition == _flushPosition.load()) {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _flushedCondition.notify_all();
+      }
+    }
+
+    const auto droppedCount
+      = _droppedCount.exchange(0, std::memory_order_relaxed);
+    if (droppedCount > 0 && takes(LogLevels::LEVEL_WARN)) {
+      LogMessage logMessage{LogLevels::LEVEL_WARN, "Logger"};
+      logMessage.write(droppedCount, "messages dropped, the queue was full");
+      _dispatch(logMessage);
+    }
+
+    std::unique_lock<std::mutex> lock{_mutex};
+    _flushedCondition.notify_all();
+    if (_stopped) {
+      break;
+    }
+    // The producers do not take the lock, a notification can be missed
+    _condition.wait_for(lock, std::chrono::milliseconds(10));
+  }
+
+  // Records posted while stopping
+  while (_pop(record)) {
+    _dispatch(record);
+    _dispatchedPosition.store(_dequeuePosition);
+  }
+}
+
+void Logger::_dispatch(const LogRecord& record)
+{
+  const auto& callSite = *record.callSite;
+  LogMessage logMessage{callSite.level,
+                        std::string(record.text, record.contextLength)};
+  logMessage.setTimestamp(record.timestamp);
+  std::ostringstream ss;
+  ss << std::hex << record.threadId;
+  logMessage.setThreadId(ss.str());
+  logMessage.setFile(callSite.file);
+  logMessage.setLineNumber(callSite.lineNumber);
+  logMessage.setFunction(callSite.function);
+  logMessage.setPrettyFunction(callSite.prettyFunction);
+  logMessage.writeMessages(std::string(record.text + record.contextLength,
+                                       record.messageLength));
+  if (record.suppressedCount > 0) {
+    logMessage.writeMessages(" (");
+    logMessage.write(record.suppressedCount, "similar messages suppressed)");
+  }
+  _dispatch(logMessage);
+}
+
+void Logger::_dispatch(const LogMessage& logMessage)
+{
+  std::lock_guard<std::recursive_mutex> lock{_listenersMutex};
+  _impl.handle(logMessage);
 }
 
 bool Logger::takes(unsigned int level)
@@ -62,6 +298,7 @@ bool Logger::takes(unsigned int level)
 bool Logger::isSubscribed(unsigned int level,
                           LogMessageListener& logMsgListener)
 {
+  std::lock_guard<std::recursive_mutex> lock{_listenersMutex};
   bool subscribed = false;
   if (_impl._logMessageListeners.find(level)
       != _impl._logMessageListeners.end()) {
@@ -75,6 +312,7 @@ bool Logger::isSubscribed(unsigned int level,
 
 void Logger::registerLogMessageListener(LogMessageListener& logMsgListener)
 {
+  std::lock_guard<std::recursive_mutex> lock{_listenersMutex};
   for (auto& keyVal : _impl._logMessageListeners) {
     auto& _logMsgListenersLvl = _impl._logMessageListeners[keyVal.first];
     auto it = std::find(_logMsgListenersLvl.begin(), _logMsgListenersLvl.end(),
@@ -89,6 +327,7 @@ void Logger::registerLogMessageListener(LogMessageListener& logMsgListener)
 void Logger::unregisterLogMessageListener(
   const LogMessageListener& logMsgListener)
 {
+  std::lock_guard<std::recursive_mutex> lock{_listenersMutex};
   for (const auto& keyVal : _impl._logMessageListeners) {
     auto& _logMsgListenersLvl = _impl._logMessageListeners[keyVal.first];
     auto it = std::find(_logMsgListenersLvl.begin(), _logMsgListenersLvl.end(),
@@ -102,6 +341,7 @@ void Logger::unregisterLogMessageListener(
 void Logger::registerLogMessageListener(unsigned int level,
                                         LogMessageListener& logMsgListener)
 {
+  std::lock_guard<std::recursive_mutex> lock{_listenersMutex};
   if (_impl.takes(level)) {
     if (_impl._logMessageListeners.find(level)
         != _impl._logMessageListeners.end()) {
@@ -119,6 +359,7 @@ void Logger::registerLogMessageListener(unsigned int level,
 void Logger::unregisterLogMessageListener(
   unsigned int level, const LogMessageListener& logMsgListener)
 {
+  std::lock_guard<std::recursive_mutex> lock{_listenersMutex};
   if (_impl.takes(level)) {
     if (_impl._logMessageListeners.find(level)
         != _impl._logMessageListeners.end()) {
@@ -0,0 +1,163 @@
+#include <babylon/core/thread_pool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+namespace BABYLON {
+
+namespace {
+
+// Pool owning the current thread, if any
+thread_local const ThreadPool* _currentPool = nullptr;
+
+} // end of anonymous namespace
+
+ThreadPool::ThreadPool(size_t threadCount) : _stopping{false}
+{
+  if (threadCount == 0) {
+    const auto hardwareThreads = std::thread::hardware_concurrency();
+    threadCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+  }
+
+  _workers.reserve(threadCount);
+  for (size_t i = 0; i < threadCount; ++i) {
+    _workers.emplace_back([this]() { _workerLoop(); });
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stopping = true;
+  }
+  _condition.notify_all();
+
+  for (auto& worker : _workers) {
+    worker.join();
+  }
+}
+
+ThreadPool& ThreadPool::Default()
+{
+  static ThreadPool pool;
+  return pool;
+}
+
+size_t ThreadPool::threadCount() const
+{
+  return _workers.size();
+}
+
+bool ThreadPool::isWorkerThread() const
+{
+  return _currentPool == this;
+}
+
+std::future<void> ThreadPool::enqueue(Task task)
+{
+  auto packagedTask
+    = std::make_shared<std::packaged_task<void()>>(std::move(task));
+  auto future = packagedTask->get_future();
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _tasks.emplace_back([packagedTask]() { (*packagedTask)(); });
+  }
+  _condition.notify_one();
+
+  return future;
+}
+
+void ThreadPool::parallelFor(size_t count, size_t grainSize,
+                             const RangeTask& task)
+{
+  if (count == 0) {
+    return;
+  }
+
+  grainSize             = std::max(grainSize, size_t(1));
+  const auto chunkCount = (count + grainSize - 1) / grainSize;
+  if (chunkCount == 1 || _workers.empty()) {
+    task(0, count);
+    return;
+  }
+
+  // State shared with the helpers, which may outlive this call when they are
+  // dequeued after every chunk has already been processed
+  struct ParallelForState {
+    std::atomic<size_t> nextChunk{0};
+    std::atomic<size_t> completedChunks{0};
+    std::exception_ptr exception;
+    std::mutex mutex;
+    std::condition_variable done;
+  };
+  auto state = std::make_shared<ParallelForState>();
+
+  const auto processChunks = [state, count, grainSize, chunkCount, &task]() {
+    size_t chunk;
+    while ((chunk = state->nextChunk.fetch_add(1)) < chunkCount) {
+      const auto begin = chunk * grainSize;
+      const auto end   = std::min(begin + grainSize, count);
+      try {
+        task(begin, end);
+      }
+      catch (...) {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (!state->exception) {
+          state->exception = std::current_exception();
+        }
+      }
+      if (state->completedChunks.fetch_add(1) + 1 == chunkCount) {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->done.notify_all();
+      }
+    }
+  };
+
+  // The task reference stays valid for the helpers as they only touch it
+  // while there are chunks left, i.e. before this call returns
+  const auto helperCount = std::min(_workers.size(), chunkCount - 1);
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (size_t i = 0; i < helperCount; ++i) {
+      _tasks.emplace_back(processChunks);
+    }
+  }
+  _condition.notify_all();
+
+  processChunks();
+
+  {
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->done.wait(lock, [&state, chunkCount]() {
+      return state->completedChunks == chunkCount;
+    });
+  }
+
+  if (state->exception) {
+    std::rethrow_exception(state->exception);
+  }
+}
+
+void ThreadPool::_workerLoop()
+{
+  _currentPool = this;
+
+  for (;;) {
+    Task task;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _condition.wait(lock, [this]() { return _stopping || !_tasks.empty(); });
+      if (_stopping && _tasks.empty()) {
+        return;
+      }
+      task = std::move(_tasks.front());
+      _tasks.pop_front();
+    }
+    task();
+  }
+}
+
+} // end of namespace BABYLON
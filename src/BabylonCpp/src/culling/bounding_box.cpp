@@ -6,8 +6,12 @@
 
 namespace BABYLON {
 
-std::array<Vector3, 3> BoundingBox::TmpVector3{Vector3::Zero(), Vector3::Zero(),
-                                               Vector3::Zero()};
+std::array<Vector3, 3>& BoundingBox::TmpVector3()
+{
+  thread_local std::array<Vector3, 3> tmpVector3{
+    {Vector3::Zero(), Vector3::Zero(), Vector3::Zero()}};
+  return tmpVector3;
+}
 
 BoundingBox::BoundingBox(const Vector3& min, const Vector3& max,
                          const std::optional<Matrix>& worldMatrix)
@@ -128,7 +132,7 @@ BoundingBox::~BoundingBox()
 
 BoundingBox& BoundingBox::scale(float factor)
 {
-  auto& tmpVectors = BoundingBox::TmpVector3;
+  auto& tmpVectors = BoundingBox::TmpVector3();
   auto& diff       = maximum.subtractToRef(minimum, tmpVectors[0]);
   const auto len   = diff.length();
   diff.normalizeFromLength(len);
@@ -264,7 +268,7 @@ bool BoundingBox::IntersectsSphere(const Vector3& minPoint,
                                    const Vector3& sphereCenter,
                                    float sphereRadius)
 {
-  auto& vector = BoundingBox::TmpVector3[0];
+  auto& vector = BoundingBox::TmpVector3()[0];
   Vector3::ClampToRef(sphereCenter, minPoint, maxPoint, vector);
   const auto num = Vector3::DistanceSquared(sphereCenter, vector);
   return (num <= (sphereRadius * sphereRadius));
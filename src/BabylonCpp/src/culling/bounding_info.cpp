@@ -7,8 +7,12 @@
 
 namespace BABYLON {
 
-std::array<Vector3, 2> BoundingInfo::TmpVector3{Vector3::Zero(),
-                                                Vector3::Zero()};
+std::array<Vector3, 2>& BoundingInfo::TmpVector3()
+{
+  thread_local std::array<Vector3, 2> tmpVector3{
+    {Vector3::Zero(), Vector3::Zero()}};
+  return tmpVector3;
+}
 
 BoundingInfo::BoundingInfo(const Vector3& iMinimum, const Vector3& iMaximum,
                            const std::optional<Matrix>& worldMatrix)
@@ -107,9 +111,9 @@ BoundingInfo& BoundingInfo::centerOn(const Vector3& center,
                                      const Vector3& extend)
 {
   auto& minimum
-    = BoundingInfo::TmpVector3[0].copyFrom(center).subtractInPlace(extend);
+    = BoundingInfo::TmpVector3()[0].copyFrom(center).subtractInPlace(extend);
   auto& maximum
-    = BoundingInfo::TmpVector3[1].copyFrom(center).addInPlace(extend);
+    = BoundingInfo::TmpVector3()[1].copyFrom(center).addInPlace(extend);
 
   boundingBox.reConstruct(minimum, maximum, boundingBox.getWorldMatrix());
   boundingSphere.reConstruct(minimum, maximum, boundingBox.getWorldMatrix());
@@ -158,7 +162,7 @@ bool BoundingInfo::isInFrustum(const std::array<Plane, 6>& frustumPlanes,
 float BoundingInfo::diagonalLength() const
 {
   const auto& diag = boundingBox.maximumWorld.subtractToRef(
-    boundingBox.minimumWorld, BoundingInfo::TmpVector3[0]);
+    boundingBox.minimumWorld, BoundingInfo::TmpVector3()[0]);
   return diag.length();
 }
 
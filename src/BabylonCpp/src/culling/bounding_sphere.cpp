@@ -7,8 +7,12 @@
 
 namespace BABYLON {
 
-std::array<Vector3, 3> BoundingSphere::TmpVector3{
-  Vector3::Zero(), Vector3::Zero(), Vector3::Zero()};
+std::array<Vector3, 3>& BoundingSphere::TmpVector3()
+{
+  thread_local std::array<Vector3, 3> tmpVector3{
+    {Vector3::Zero(), Vector3::Zero(), Vector3::Zero()}};
+  return tmpVector3;
+}
 
 BoundingSphere::BoundingSphere(const Vector3& min, const Vector3& max,
                                const std::optional<Matrix>& worldMatrix)
@@ -96,7 +100,7 @@ void BoundingSphere::reConstruct(const Vector3& min, Vector3 max,
 BoundingSphere& BoundingSphere::scale(float factor)
 {
   const auto newRadius   = radius * factor;
-  auto& tmpVectors       = BoundingSphere::TmpVector3;
+  auto& tmpVectors       = BoundingSphere::TmpVector3();
   auto& tempRadiusVector = tmpVectors[0].setAll(newRadius);
   auto& min = center.subtractToRef(tempRadiusVector, tmpVectors[1]);
   auto& max = center.addToRef(tempRadiusVector, tmpVectors[2]);
@@ -116,7 +120,7 @@ void BoundingSphere::_update(const Matrix& worldMatrix)
   auto _worldMatrix = worldMatrix;
   if (!_worldMatrix.isIdentity()) {
     Vector3::TransformCoordinatesToRef(center, worldMatrix, centerWorld);
-    auto& tempVector = BoundingSphere::TmpVector3[0];
+    auto& tempVector = BoundingSphere::TmpVector3()[0];
     Vector3::TransformNormalFromFloatsToRef(1.f, 1.f, 1.f, worldMatrix,
                                             tempVector);
     radiusWorld
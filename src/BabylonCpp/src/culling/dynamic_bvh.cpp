@@ -0,0 +1,426 @@
+#include <babylon/culling/dynamic_bvh.h>
+
+#include <algorithm>
+
+#include <babylon/math/plane.h>
+
+namespace BABYLON {
+
+namespace {
+
+float halfArea(const Vector3& minimum, const Vector3& maximum)
+{
+  const auto dx = maximum.x - minimum.x;
+  const auto dy = maximum.y - minimum.y;
+  const auto dz = maximum.z - minimum.z;
+  return dx * dy + dy * dz + dz * dx;
+}
+
+// Half area of the union of two boxes
+float unionHalfArea(const Vector3& minimumA, const Vector3& maximumA,
+                    const Vector3& minimumB, const Vector3& maximumB)
+{
+  return halfArea(Vector3::Minimize(minimumA, minimumB),
+                  Vector3::Maximize(maximumA, maximumB));
+}
+
+bool contains(const Vector3& minimumA, const Vector3& maximumA,
+              const Vector3& minimumB, const Vector3& maximumB)
+{
+  return minimumA.x <= minimumB.x && minimumA.y <= minimumB.y
+         && minimumA.z <= minimumB.z && maximumB.x <= maximumA.x
+         && maximumB.y <= maximumA.y && maximumB.z <= maximumA.z;
+}
+
+} // end of anonymous namespace
+
+DynamicBVH::DynamicBVH(float iMargin)
+    : margin{iMargin}, _root{NullNode}, _freeList{NullNode}, _proxyCount{0}
+{
+}
+
+DynamicBVH::~DynamicBVH() = default;
+
+int DynamicBVH::_allocateNode()
+{
+  if (_freeList == NullNode) {
+    _nodes.emplace_back();
+    _nodes.back().parent = NullNode;
+    _freeList            = static_cast<int>(_nodes.size()) - 1;
+  }
+
+  const auto nodeId = _freeList;
+  auto& node        = _nodes[nodeId];
+  _freeList         = node.parent;
+  node.parent       = NullNode;
+  node.child1       = NullNode;
+  node.child2       = NullNode;
+  node.height       = 0;
+  node.data         = 0;
+  return nodeId;
+}
+
+void DynamicBVH::_freeNode(int nodeId)
+{
+  auto& node  = _nodes[nodeId];
+  node.parent = _freeList;
+  node.height = -1;
+  _freeList   = nodeId;
+}
+
+int DynamicBVH::createProxy(const Vector3& minimum, const Vector3& maximum,
+                            size_t data)
+{
+  const auto proxyId = _allocateNode();
+  auto& node         = _nodes[proxyId];
+  const auto size    = maximum.subtract(minimum);
+  const auto extension
+    = std::max(size.x, std::max(size.y, size.z)) * margin * 0.5f;
+  node.minimum = minimum.subtract(Vector3(extension, extension, extension));
+  node.maximum = maximum.add(Vector3(extension, extension, extension));
+  node.data    = data;
+
+  _insertLeaf(proxyId);
+  ++_proxyCount;
+
+  return proxyId;
+}
+
+void DynamicBVH::destroyProxy(int proxyId)
+{
+  _removeLeaf(proxyId);
+  _freeNode(proxyId);
+  --_proxyCount;
+}
+
+bool DynamicBVH::moveProxy(int proxyId, const Vector3& minimum,
+                           const Vector3& maximum)
+{
+  auto& node = _nodes[proxyId];
+  if (contains(node.minimum, node.maximum, minimum, maximum)) {
+    return false;
+  }
+
+  _removeLeaf(proxyId);
+
+  const auto size = maximum.subtract(minimum);
+  const auto extension
+    = std::max(size.x, std::max(size.y, size.z)) * margin * 0.5f;
+  node.minimum = minimum.subtract(Vector3(extension, extension, extension));
+  node.maximum = maximum.add(Vector3(extension, extension, extension));
+
+  _insertLeaf(proxyId);
+  return true;
+}
+
+bool DynamicBVH::fitsProxy(int proxyId, const Vector3& minimum,
+                           const Vector3& maximum) const
+{
+  const auto& node = _nodes[proxyId];
+  return contains(node.minimum, node.maximum, minimum, maximum);
+}
+
+size_t DynamicBVH::getData(int proxyId) const
+{
+  return _nodes[proxyId].data;
+}
+
+size_t DynamicBVH::proxyCount() const
+{
+  return _proxyCount;
+}
+
+int DynamicBVH::height() const
+{
+  return _root == NullNode ? 0 : _nodes[_root].height;
+}
+
+void DynamicBVH::_insertLeaf(int leaf)
+{
+  if (_root == NullNode) {
+    _root               = leaf;
+    _nodes[leaf].parent = NullNode;
+    return;
+  }
+
+  // Find the sibling whose union with the leaf costs the least, the cost of a
+  // union being its area plus the area increase of its ancestors
+  const auto leafMinimum = _nodes[leaf].minimum;
+  const auto leafMaximum = _nodes[leaf].maximum;
+  auto index             = _root;
+  while (!_nodes[index].isLeaf()) {
+    const auto& node = _nodes[index];
+    const auto area  = halfArea(node.minimum, node.maximum);
+    const auto combinedArea
+      = unionHalfArea(node.minimum, node.maximum, leafMinimum, leafMaximum);
+    const auto cost            = 2.f * combinedArea;
+    const auto inheritanceCost = 2.f * (combinedArea - area);
+
+    const auto childCost = [&](int childId) {
+      const auto& child = _nodes[childId];
+      const auto unionArea
+        = unionHalfArea(child.minimum, child.maximum, leafMinimum, leafMaximum);
+      const auto areaIncrease
+        = child.isLeaf() ? unionArea :
+                           unionArea - halfArea(child.minimum, child.maximum);
+      return areaIncrease + inheritanceCost;
+    };
+    const auto cost1 = childCost(node.child1);
+    const auto cost2 = childCost(node.child2);
+
+    if (cost < cost1 && cost < cost2) {
+      break;
+    }
+    index = cost1 < cost2 ? node.child1 : node.child2;
+  }
+
+  // Create a new parent for the sibling and the leaf
+  const auto sibling      = index;
+  const auto newParent    = _allocateNode();
+  const auto oldParent    = _nodes[sibling].parent;
+  auto& parentNode        = _nodes[newParent];
+  const auto& siblingNode = _nodes[sibling];
+  parentNode.parent       = oldParent;
+  parentNode.minimum      = Vector3::Minimize(leafMinimum, siblingNode.minimum);
+  parentNode.maximum      = Vector3::Maximize(leafMaximum, siblingNode.maximum);
+  parentNode.height       = siblingNode.height + 1;
+  parentNode.child1       = sibling;
+  parentNode.child2       = leaf;
+  _nodes[sibling].parent  = newParent;
+  _nodes[leaf].parent     = newParent;
+
+  if (oldParent != NullNode) {
+    if (_nodes[oldParent].child1 == sibling) {
+      _nodes[oldParent].child1 = newParent;
+    }
+    else {
+      _nodes[oldParent].child2 = newParent;
+    }
+  }
+  else {
+    _root = newParent;
+  }
+
+  _refit(_nodes[leaf].parent);
+}
+
+void DynamicBVH::_removeLeaf(int leaf)
+{
+  if (leaf == _root) {
+    _root = NullNode;
+    return;
+  }
+
+  const auto parent      = _nodes[leaf].parent;
+  const auto grandParent = _nodes[parent].parent;
+  const auto sibling     = _nodes[parent].child1 == leaf ?
+                             _nodes[parent].child2 :
+                             _nodes[parent].child1;
+
+  // The sibling takes the place of the parent
+  _nodes[sibling].parent = grandParent;
+  if (grandParent != NullNode) {
+    if (_nodes[grandParent].child1 == parent) {
+      _nodes[grandParent].child1 = sibling;
+    }
+    else {
+      _nodes[grandParent].child2 = sibling;
+    }
+    _freeNode(parent);
+    _refit(grandParent);
+  }
+  else {
+    _root = sibling;
+    _freeNode(parent);
+  }
+}
+
+void DynamicBVH::_refit(int nodeId)
+{
+  // Walk back up the tree, rebalancing and fixing the bounds and heights
+  while (nodeId != NullNode) {
+    nodeId             = _balance(nodeId);
+    auto& node         = _nodes[nodeId];
+    const auto& child1 = _nodes[node.child1];
+    const auto& child2 = _nodes[node.child2];
+    node.height        = 1 + std::max(child1.height, child2.height);
+    node.minimum       = Vector3::Minimize(child1.minimum, child2.minimum);
+    node.maximum       = Vector3::Maximize(child1.maximum, child2.maximum);
+    nodeId             = node.parent;
+  }
+}
+
+int DynamicBVH::_balance(int iA)
+{
+  auto& A = _nodes[iA];
+  if (A.isLeaf() || A.height < 2) {
+    return iA;
+  }
+
+  const auto iB      = A.child1;
+  const auto iC      = A.child2;
+  auto& B            = _nodes[iB];
+  auto& C            = _nodes[iC];
+  const auto balance = C.height - B.height;
+
+  // Rotate C up
+  if (balance > 1) {
+    const auto iF = C.child1;
+    const auto iG = C.child2;
+    auto& F       = _nodes[iF];
+    auto& G       = _nodes[iG];
+
+    C.child1 = iA;
+    C.parent = A.parent;
+    A.parent = iC;
+
+    if (C.parent != NullNode) {
+      if (_nodes[C.parent].child1 == iA) {
+        _nodes[C.parent].child1 = iC;
+      }
+      else {
+        _nodes[C.parent].child2 = iC;
+      }
+    }
+    else {
+      _root = iC;
+    }
+
+    if (F.height > G.height) {
+      C.child2  = iF;
+      A.child2  = iG;
+      G.parent  = iA;
+      A.minimum = Vector3::Minimize(B.minimum, G.minimum);
+      A.maximum = Vector3::Maximize(B.maximum, G.maximum);
+      C.minimum = Vector3::Minimize(A.minimum, F.minimum);
+      C.maximum = Vector3::Maximize(A.maximum, F.maximum);
+      A.height  = 1 + std::max(B.height, G.height);
+      C.height  = 1 + std::max(A.height, F.height);
+    }
+    else {
+      C.child2  = iG;
+      A.child2  = iF;
+      F.parent  = iA;
+      A.minimum = Vector3::Minimize(B.minimum, F.minimum);
+      A.maximum = Vector3::Maximize(B.maximum, F.maximum);
+      C.minimum = Vector3::Minimize(A.minimum, G.minimum);
+      C.maximum = Vector3::Maximize(A.maximum, G.maximum);
+      A.height  = 1 + std::max(B.height, F.height);
+      C.height  = 1 + std::max(A.height, G.height);
+    }
+
+    return iC;
+  }
+
+  // Rotate B up
+  if (balance < -1) {
+    const auto iD = B.child1;
+    const auto iE = B.child2;
+    auto& D       = _nodes[iD];
+    auto& E       = _nodes[iE];
+
+    B.child1 = iA;
+    B.parent = A.parent;
+    A.parent = iB;
+
+    if (B.parent != NullNode) {
+      if (_nodes[B.parent].child1 == iA) {
+        _nodes[B.parent].child1 = iB;
+      }
+      else {
+        _nodes[B.parent].child2 = iB;
+      }
+    }
+    else {
+      _root = iB;
+    }
+
+    if (D.height > E.height) {
+      B.child2  = iD;
+      A.child1  = iE;
+      E.parent  = iA;
+      A.minimum = Vector3::Minimize(C.minimum, E.minimum);
+      A.maximum = Vector3::Maximize(C.maximum, E.maximum);
+      B.minimum = Vector3::Minimize(A.minimum, D.minimum);
+      B.maximum = Vector3::Maximize(A.maximum, D.maximum);
+      A.height  = 1 + std::max(C.height, E.height);
+      B.height  = 1 + std::max(A.height, D.height);
+    }
+    else {
+      B.child2  = iE;
+      A.child1  = iD;
+      D.parent  = iA;
+      A.minimum = Vector3::Minimize(C.minimum, D.minimum);
+      A.maximum = Vector3::Maximize(C.maximum, D.maximum);
+      B.minimum = Vector3::Minimize(A.minimum, E.minimum);
+      B.maximum = Vector3::Maximize(A.maximum, E.maximum);
+      A.height  = 1 + std::max(C.height, D.height);
+      B.height  = 1 + std::max(A.height, E.height);
+    }
+
+    return iB;
+  }
+
+  return iA;
+}
+
+void DynamicBVH::select(const std::array<Plane, 6>& frustumPlanes,
+                        std::vector<size_t>& selection) const
+{
+  if (_root == NullNode) {
+    return;
+  }
+
+  // The nodes are pushed with a flag telling whether they are known to be
+  // entirely in the frustum, in which case their leaves are selected without
+  // further tests
+  _stack.clear();
+  _stack.emplace_back(_root, false);
+  while (!_stack.empty()) {
+    const auto [nodeId, isInside] = _stack.back();
+    _stack.pop_back();
+    const auto& node = _nodes[nodeId];
+
+    auto isCompletelyInside = isInside;
+    if (!isInside) {
+      isCompletelyInside = true;
+      auto isOutside     = false;
+      for (const auto& plane : frustumPlanes) {
+        // Corners of the box the farthest along and against the plane normal
+        const Vector3 positive(plane.normal.x >= 0.f ? node.maximum.x :
+                                                       node.minimum.x,
+                               plane.normal.y >= 0.f ? node.maximum.y :
+                                                       node.minimum.y,
+                               plane.normal.z >= 0.f ? node.maximum.z :
+                                                       node.minimum.z);
+        if (plane.dotCoordinate(positive) < 0.f) {
+          isOutside = true;
+          break;
+        }
+        const Vector3 negative(plane.normal.x >= 0.f ? node.minimum.x :
+                                                       node.maximum.x,
+                               plane.normal.y >= 0.f ? node.minimum.y :
+                                                       node.maximum.y,
+                               plane.normal.z >= 0.f ? node.minimum.z :
+                                                       node.maximum.z);
+        if (plane.dotCoordinate(negative) < 0.f) {
+          isCompletelyInside = false;
+        }
+      }
+      if (isOutside) {
+        continue;
+      }
+    }
+
+    if (node.isLeaf()) {
+      selection.emplace_back(node.data);
+      continue;
+    }
+
+    // Push the second child first so that the leaves come out in tree order
+    _stack.emplace_back(node.child2, isCompletelyInside);
+    _stack.emplace_back(node.child1, isCompletelyInside);
+  }
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,176 @@
+#include <babylon/culling/dynamic_bvh_mesh_candidate_provider.h>
+
+#include <algorithm>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/culling/bounding_info.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/abstract_mesh.h>
+
+namespace BABYLON {
+
+namespace {
+constexpr size_t ENTRIES_GRAIN_SIZE = 256;
+} // end of anonymous namespace
+
+DynamicBVHMeshCandidateProvider::DynamicBVHMeshCandidateProvider(Scene* scene,
+                                                                 float margin)
+    : _scene{scene}, _bvh{margin}
+{
+  for (const auto& mesh : _scene->meshes) {
+    _addMesh(mesh.get());
+  }
+
+  _onNewMeshAddedObserver = _scene->onNewMeshAddedObservable.add(
+    [this](AbstractMesh* mesh, EventState& /*es*/) { _addMesh(mesh); });
+  _onMeshRemovedObserver = _scene->onMeshRemovedObservable.add(
+    [this](AbstractMesh* mesh, EventState& /*es*/) { _removeMesh(mesh); });
+
+  _scene->setActiveMeshCandidateProvider(this);
+}
+
+DynamicBVHMeshCandidateProvider::~DynamicBVHMeshCandidateProvider()
+{
+  _scene->onNewMeshAddedObservable.remove(_onNewMeshAddedObserver);
+  _scene->onMeshRemovedObservable.remove(_onMeshRemovedObserver);
+
+  if (_scene->getActiveMeshCandidateProvider() == this) {
+    _scene->setActiveMeshCandidateProvider(nullptr);
+  }
+}
+
+bool DynamicBVHMeshCandidateProvider::checksIsEnabled() const
+{
+  return false;
+}
+
+const DynamicBVH& DynamicBVHMeshCandidateProvider::bvh() const
+{
+  return _bvh;
+}
+
+void DynamicBVHMeshCandidateProvider::_addMesh(AbstractMesh* mesh)
+{
+  // The mesh is inserted in the hierarchy during the next selection, once its
+  // world bounding box is known
+  _entries.emplace_back(
+    Entry{mesh, DynamicBVH::NullNode, EntryUpdate::Move, false});
+}
+
+void DynamicBVHMeshCandidateProvider::_removeMesh(AbstractMesh* mesh)
+{
+  auto it = std::find_if(
+    _entries.begin(), _entries.end(),
+    [mesh](const Entry& entry) { return entry.mesh == mesh; });
+  if (it == _entries.end()) {
+    return;
+  }
+
+  if (it->proxyId != DynamicBVH::NullNode) {
+    _bvh.destroyProxy(it->proxyId);
+  }
+  *it = _entries.back();
+  _entries.pop_back();
+}
+
+void DynamicBVHMeshCandidateProvider::_evaluateEntry(
+  Entry& entry, bool computeWorldMatrix) const
+{
+  auto mesh = entry.mesh;
+  if (computeWorldMatrix) {
+    mesh->computeWorldMatrix();
+  }
+
+  // Meshes selected regardless of their bounding box
+  const auto& boundingInfo = mesh->getBoundingInfo();
+  if (!boundingInfo || mesh->alwaysSelectAsActiveMesh
+      || mesh->infiniteDistance()) {
+    entry.update = EntryUpdate::Unbounded;
+    return;
+  }
+
+  // The tree is only modified when the box leaves its enlarged bounds
+  const auto& boundingBox = boundingInfo->boundingBox;
+  entry.update
+    = entry.proxyId != DynamicBVH::NullNode
+          && _bvh.fitsProxy(entry.proxyId, boundingBox.minimumWorld,
+                            boundingBox.maximumWorld) ?
+        EntryUpdate::None :
+        EntryUpdate::Move;
+}
+
+std::vector<AbstractMesh*>
+DynamicBVHMeshCandidateProvider::getMeshes(Scene* scene)
+{
+  std::vector<AbstractMesh*> candidates;
+
+  // Without the transform hierarchy, the world matrices of the meshes outside
+  // of the frustum would not be updated anymore
+  const auto computeWorldMatrices = !scene->useTransformHierarchy;
+
+  // Same data-parallel phase as the one of the scene, the meshes whose world
+  // matrix depends on other nodes are evaluated on the calling thread
+  if (scene->parallelActiveMeshesEvaluation
+      && _entries.size() >= scene->parallelActiveMeshesEvaluationThreshold) {
+    for (auto& entry : _entries) {
+      entry.concurrent = entry.mesh->_canBeEvaluatedConcurrently();
+    }
+    ThreadPool::Default().parallelFor(
+      _entries.size(), ENTRIES_GRAIN_SIZE,
+      [this, computeWorldMatrices](size_t begin, size_t end) {
+        for (auto index = begin; index < end; ++index) {
+          if (_entries[index].concurrent) {
+            _evaluateEntry(_entries[index], computeWorldMatrices);
+          }
+        }
+      });
+    for (auto& entry : _entries) {
+      if (!entry.concurrent) {
+        _evaluateEntry(entry, computeWorldMatrices);
+      }
+    }
+  }
+  else {
+    for (auto& entry : _entries) {
+      _evaluateEntry(entry, computeWorldMatrices);
+    }
+  }
+
+  for (auto& entry : _entries) {
+    auto mesh = entry.mesh;
+    if (entry.update == EntryUpdate::None) {
+      continue;
+    }
+
+    if (entry.update == EntryUpdate::Unbounded) {
+      if (entry.proxyId != DynamicBVH::NullNode) {
+        _bvh.destroyProxy(entry.proxyId);
+        entry.proxyId = DynamicBVH::NullNode;
+      }
+      candidates.emplace_back(mesh);
+      continue;
+    }
+
+    const auto& boundingBox = mesh->getBoundingInfo()->boundingBox;
+    if (entry.proxyId == DynamicBVH::NullNode) {
+      entry.proxyId
+        = _bvh.createProxy(boundingBox.minimumWorld, boundingBox.maximumWorld,
+                           reinterpret_cast<size_t>(mesh));
+    }
+    else {
+      _bvh.moveProxy(entry.proxyId, boundingBox.minimumWorld,
+                     boundingBox.maximumWorld);
+    }
+  }
+
+  _selection.clear();
+  _bvh.select(scene->frustumPlanes(), _selection);
+  candidates.reserve(candidates.size() + _selection.size());
+  for (const auto data : _selection) {
+    candidates.emplace_back(reinterpret_cast<AbstractMesh*>(data));
+  }
+
+  return candidates;
+}
+
+} // end of namespace BABYLON
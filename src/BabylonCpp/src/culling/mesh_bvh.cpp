@@ -0,0 +1,474 @@
+#include <babylon/culling/mesh_bvh.h>
+
+#include <algorithm>
+#include <limits>
+
+#include <babylon/culling/ray.h>
+
+namespace BABYLON {
+
+namespace {
+
+struct Box {
+  std::array<float, 3> minimum{{std::numeric_limits<float>::max(),
+                                std::numeric_limits<float>::max(),
+                                std::numeric_limits<float>::max()}};
+  std::array<float, 3> maximum{{std::numeric_limits<float>::lowest(),
+                                std::numeric_limits<float>::lowest(),
+                                std::numeric_limits<float>::lowest()}};
+
+  void extend(const std::array<float, 3>& point)
+  {
+    for (size_t axis = 0; axis < 3; ++axis) {
+      minimum[axis] = std::min(minimum[axis], point[axis]);
+      maximum[axis] = std::max(maximum[axis], point[axis]);
+    }
+  }
+
+  void extend(const Box& other)
+  {
+    extend(other.minimum);
+    extend(other.maximum);
+  }
+
+  bool isEmpty() const
+  {
+    return minimum[0] > maximum[0];
+  }
+
+  float halfArea() const
+  {
+    if (isEmpty()) {
+      return 0.f;
+    }
+    const auto dx = maximum[0] - minimum[0];
+    const auto dy = maximum[1] - minimum[1];
+    const auto dz = maximum[2] - minimum[2];
+    return dx * dy + dy * dz + dz * dx;
+  }
+}; // end of struct Box
+
+struct BuildTask {
+  size_t begin;
+  size_t end;
+  // Index of the parent whose second child this task creates, if any
+  size_t parent;
+}; // end of struct BuildTask
+
+constexpr size_t NoParent = std::numeric_limits<size_t>::max();
+
+std::array<float, 3> toArray(const Vector3& v)
+{
+  return {{v.x, v.y, v.z}};
+}
+
+bool overlaps(const std::array<float, 3>& minA,
+              const std::array<float, 3>& maxA,
+              const std::array<float, 3>& minB,
+              const std::array<float, 3>& maxB)
+{
+  return minA[0] <= maxB[0] && maxA[0] >= minB[0] && minA[1] <= maxB[1]
+         && maxA[1] >= minB[1] && minA[2] <= maxB[2] && maxA[2] >= minB[2];
+}
+
+// Returns the entry distance of the ray in the box, or a negative value when
+// the box is missed or entered farther than the maximum distance
+float intersectsNode(const MeshBVH::Node& node,
+                     const std::array<float, 3>& origin,
+                     const std::array<float, 3>& direction,
+                     const std::array<float, 3>& inverseDirection,
+                     float maxDistance)
+{
+  auto tNear = 0.f;
+  auto tFar  = maxDistance;
+  for (size_t axis = 0; axis < 3; ++axis) {
+    if (direction[axis] == 0.f) {
+      if (origin[axis] < node.minimum[axis]
+          || origin[axis] > node.maximum[axis]) {
+        return -1.f;
+      }
+      continue;
+    }
+    auto t0 = (node.minimum[axis] - origin[axis]) * inverseDirection[axis];
+    auto t1 = (node.maximum[axis] - origin[axis]) * inverseDirection[axis];
+    if (t0 > t1) {
+      std::swap(t0, t1);
+    }
+    tNear = std::max(tNear, t0);
+    tFar  = std::min(tFar, t1);
+  }
+  // Tolerance for the rounding of the slab distances, triangles lying in the
+  // faces of their box must not be missed
+  const auto epsilon = 1e-5f * std::max(1.f, std::abs(tFar));
+  return tNear <= tFar + epsilon ? tNear : -1.f;
+}
+
+// Builds the nodes top-down, splitting the primitives at the cheapest bin
+// boundary according to the surface area heuristic
+void build(const std::vector<Box>& primitiveBounds,
+           std::vector<MeshBVH::Node>& nodes,
+           std::vector<uint32_t>& primitives)
+{
+  const auto primitiveCount = primitiveBounds.size();
+  if (primitiveCount == 0) {
+    return;
+  }
+
+  std::vector<std::array<float, 3>> centroids(primitiveCount);
+  primitives.resize(primitiveCount);
+  for (size_t i = 0; i < primitiveCount; ++i) {
+    const auto& bounds = primitiveBounds[i];
+    for (size_t axis = 0; axis < 3; ++axis) {
+      centroids[i][axis]
+        = (bounds.minimum[axis] + bounds.maximum[axis]) * 0.5f;
+    }
+    primitives[i] = static_cast<uint32_t>(i);
+  }
+
+  nodes.reserve(2 * primitiveCount / MeshBVH::MaxLeafPrimitives + 1);
+
+  std::vector<BuildTask> tasks{{0, primitiveCount, NoParent}};
+  while (!tasks.empty()) {
+    const auto task = tasks.back();
+    tasks.pop_back();
+
+    const auto nodeIndex = nodes.size();
+    if (task.parent != NoParent) {
+      nodes[task.parent].offset = static_cast<uint32_t>(nodeIndex);
+    }
+
+    Box bounds, centroidBounds;
+    for (auto i = task.begin; i < task.end; ++i) {
+      bounds.extend(primitiveBounds[primitives[i]]);
+      centroidBounds.extend(centroids[primitives[i]]);
+    }
+
+    nodes.emplace_back();
+    auto& node   = nodes.back();
+    node.minimum = bounds.minimum;
+    node.maximum = bounds.maximum;
+    node.offset  = static_cast<uint32_t>(task.begin);
+    node.count   = 0;
+    node.axis    = 0;
+
+    const auto count = task.end - task.begin;
+    if (count <= MeshBVH::MaxLeafPrimitives) {
+      node.count = static_cast<uint16_t>(count);
+      continue;
+    }
+
+    // Find the cheapest split among the bin boundaries of the three axes
+    auto bestCost   = std::numeric_limits<float>::max();
+    size_t bestAxis = 3, bestBin = 0;
+    for (size_t axis = 0; axis < 3; ++axis) {
+      const auto extent
+        = centroidBounds.maximum[axis] - centroidBounds.minimum[axis];
+      if (extent <= 0.f) {
+        continue;
+      }
+      const auto scale = MeshBVH::BinCount / extent;
+
+      std::array<Box, MeshBVH::BinCount> bins;
+      std::array<size_t, MeshBVH::BinCount> binCounts{};
+      for (auto i = task.begin; i < task.end; ++i) {
+        const auto primitive = primitives[i];
+        const auto bin       = std::min(
+          MeshBVH::BinCount - 1,
+          static_cast<size_t>((centroids[primitive][axis]
+                               - centroidBounds.minimum[axis])
+                              * scale));
+        bins[bin].extend(primitiveBounds[primitive]);
+        ++binCounts[bin];
+      }
+
+      // Sweep from the right to get the cost of the right side of each split
+      std::array<float, MeshBVH::BinCount> rightCosts{};
+      Box rightBounds;
+      size_t rightCount = 0;
+      for (size_t bin = MeshBVH::BinCount - 1; bin > 0; --bin) {
+        rightBounds.extend(bins[bin]);
+        rightCount += binCounts[bin];
+        rightCosts[bin] = rightBounds.halfArea() * rightCount;
+      }
+
+      Box leftBounds;
+      size_t leftCount = 0;
+      for (size_t bin = 0; bin < MeshBVH::BinCount - 1; ++bin) {
+        leftBounds.extend(bins[bin]);
+        leftCount += binCounts[bin];
+        const auto cost
+          = leftBounds.halfArea() * leftCount + rightCosts[bin + 1];
+        if (leftCount > 0 && leftCount < count && cost < bestCost) {
+          bestCost = cost;
+          bestAxis = axis;
+          bestBin  = bin;
+        }
+      }
+    }
+
+    auto middle = task.begin;
+    if (bestAxis < 3) {
+      const auto minimum = centroidBounds.minimum[bestAxis];
+      const auto scale
+        = MeshBVH::BinCount / (centroidBounds.maximum[bestAxis] - minimum);
+      middle = static_cast<size_t>(
+        std::partition(primitives.begin() + task.begin,
+                       primitives.begin() + task.end,
+                       [&](uint32_t primitive) {
+                         const auto bin = std::min(
+                           MeshBVH::BinCount - 1,
+                           static_cast<size_t>(
+                             (centroids[primitive][bestAxis] - minimum)
+                             * scale));
+                         return bin <= bestBin;
+                       })
+        - primitives.begin());
+      node.axis = static_cast<uint16_t>(bestAxis);
+    }
+
+    // All the centroids are in the same bin: split the range in half
+    if (middle == task.begin || middle == task.end) {
+      if (count <= std::numeric_limits<uint16_t>::max()
+          && centroidBounds.minimum == centroidBounds.maximum) {
+        node.count = static_cast<uint16_t>(count);
+        continue;
+      }
+      middle = task.begin + count / 2;
+    }
+
+    // The first child is built next so it directly follows its parent
+    tasks.push_back({middle, task.end, nodeIndex});
+    tasks.push_back({task.begin, middle, NoParent});
+  }
+
+  nodes.shrink_to_fit();
+}
+
+} // end of anonymous namespace
+
+MeshBVH::MeshBVH(const std::vector<Vector3>& positions,
+                 const IndicesArray& indices)
+{
+  std::vector<Box> triangleBounds(indices.size() / 3);
+  for (size_t i = 0; i < triangleBounds.size(); ++i) {
+    for (size_t j = 0; j < 3; ++j) {
+      triangleBounds[i].extend(toArray(positions[indices[i * 3 + j]]));
+    }
+  }
+  build(triangleBounds, _nodes, _primitives);
+}
+
+MeshBVH::MeshBVH(const std::vector<MinMax>& bounds)
+{
+  std::vector<Box> primitiveBounds(bounds.size());
+  for (size_t i = 0; i < bounds.size(); ++i) {
+    primitiveBounds[i].extend(toArray(bounds[i].min));
+    primitiveBounds[i].extend(toArray(bounds[i].max));
+  }
+  build(primitiveBounds, _nodes, _primitives);
+}
+
+MeshBVH::~MeshBVH() = default;
+
+size_t MeshBVH::primitiveCount() const
+{
+  return _primitives.size();
+}
+
+const std::vector<MeshBVH::Node>& MeshBVH::nodes() const
+{
+  return _nodes;
+}
+
+std::optional<IntersectionInfo>
+MeshBVH::intersectsRay(Ray& ray, const std::vector<Vector3>& positions,
+                       const IndicesArray& indices, size_t indexStart,
+                       size_t indexCount, bool fastCheck,
+                       const TrianglePredicate& trianglePredicate) const
+{
+  std::optional<IntersectionInfo> intersectInfo = std::nullopt;
+  if (_nodes.empty()) {
+    return intersectInfo;
+  }
+
+  const auto origin    = toArray(ray.origin);
+  const auto direction = toArray(ray.direction);
+  std::array<float, 3> inverseDirection{};
+  for (size_t axis = 0; axis < 3; ++axis) {
+    inverseDirection[axis]
+      = direction[axis] != 0.f ? 1.f / direction[axis] : 0.f;
+  }
+
+  const auto indexEnd  = std::min(indexStart + indexCount, indices.size());
+  auto closestDistance = ray.length;
+  size_t closestIndex  = 0;
+
+  std::vector<uint32_t> stack;
+  stack.reserve(64);
+  stack.emplace_back(0);
+  while (!stack.empty()) {
+    const auto nodeIndex = stack.back();
+    const auto& node     = _nodes[nodeIndex];
+    stack.pop_back();
+
+    const auto entry = intersectsNode(node, origin, direction,
+                                      inverseDirection, closestDistance);
+    if (entry < 0.f) {
+      continue;
+    }
+
+    if (node.count == 0) {
+      // Visit the child closest to the ray origin first
+      if (direction[node.axis] < 0.f) {
+        stack.emplace_back(nodeIndex + 1);
+        stack.emplace_back(node.offset);
+      }
+      else {
+        stack.emplace_back(node.offset);
+        stack.emplace_back(nodeIndex + 1);
+      }
+      continue;
+    }
+
+    for (size_t i = node.offset; i < node.offset + node.count; ++i) {
+      const size_t index = _primitives[i] * 3;
+      if (index < indexStart || index + 2 >= indexEnd) {
+        continue;
+      }
+
+      const auto& p0 = positions[indices[index]];
+      const auto& p1 = positions[indices[index + 1]];
+      const auto& p2 = positions[indices[index + 2]];
+
+      if (trianglePredicate && !trianglePredicate(p0, p1, p2, ray)) {
+        continue;
+      }
+
+      const auto currentIntersectInfo = ray.intersectsTriangle(p0, p1, p2);
+      if (!currentIntersectInfo || currentIntersectInfo->distance < 0.f) {
+        continue;
+      }
+
+      // Ties are resolved as the linear test does, by keeping the triangle
+      // appearing first in the index buffer
+      const auto distance = currentIntersectInfo->distance;
+      if (!intersectInfo || distance < closestDistance
+          || (distance == closestDistance && index < closestIndex)) {
+        intersectInfo         = currentIntersectInfo;
+        intersectInfo->faceId = index / 3;
+        closestDistance       = distance;
+        closestIndex          = index;
+
+        if (fastCheck) {
+          return intersectInfo;
+        }
+      }
+    }
+  }
+
+  return intersectInfo;
+}
+
+void MeshBVH::forEachRayCandidate(
+  const Ray& ray, const std::function<float(size_t primitive)>& callback) const
+{
+  if (_nodes.empty()) {
+    return;
+  }
+
+  const auto origin    = toArray(ray.origin);
+  const auto direction = toArray(ray.direction);
+  std::array<float, 3> inverseDirection{};
+  for (size_t axis = 0; axis < 3; ++axis) {
+    inverseDirection[axis]
+      = direction[axis] != 0.f ? 1.f / direction[axis] : 0.f;
+  }
+
+  auto maxDistance = ray.length;
+  std::vector<uint32_t> stack{0};
+  stack.reserve(64);
+  while (!stack.empty()) {
+    const auto nodeIndex = stack.back();
+    const auto& node     = _nodes[nodeIndex];
+    stack.pop_back();
+
+    if (intersectsNode(node, origin, direction, inverseDirection, maxDistance)
+        < 0.f) {
+      continue;
+    }
+
+    if (node.count == 0) {
+      if (direction[node.axis] < 0.f) {
+        stack.emplace_back(nodeIndex + 1);
+        stack.emplace_back(node.offset);
+      }
+      else {
+        stack.emplace_back(node.offset);
+        stack.emplace_back(nodeIndex + 1);
+      }
+      continue;
+    }
+
+    for (size_t i = node.offset; i < node.offset + node.count; ++i) {
+      maxDistance = std::min(maxDistance, callback(_primitives[i]));
+      if (maxDistance < 0.f) {
+        return;
+      }
+    }
+  }
+}
+
+void MeshBVH::intersectsBox(const Vector3& minimum, const Vector3& maximum,
+                            const std::vector<Vector3>& positions,
+                            const IndicesArray& indices, size_t indexStart,
+                            size_t indexCount,
+                            std::vector<size_t>& triangles) const
+{
+  if (_nodes.empty()) {
+    return;
+  }
+
+  const auto boxMinimum = toArray(minimum);
+  const auto boxMaximum = toArray(maximum);
+  const auto indexEnd   = std::min(indexStart + indexCount, indices.size());
+  const auto firstFound = triangles.size();
+
+  std::vector<uint32_t> stack{0};
+  stack.reserve(64);
+  while (!stack.empty()) {
+    const auto nodeIndex = stack.back();
+    const auto& node     = _nodes[nodeIndex];
+    stack.pop_back();
+
+    if (!overlaps(node.minimum, node.maximum, boxMinimum, boxMaximum)) {
+      continue;
+    }
+
+    if (node.count == 0) {
+      stack.emplace_back(node.offset);
+      stack.emplace_back(nodeIndex + 1);
+      continue;
+    }
+
+    for (size_t i = node.offset; i < node.offset + node.count; ++i) {
+      const size_t index = _primitives[i] * 3;
+      if (index < indexStart || index + 2 >= indexEnd) {
+        continue;
+      }
+
+      Box bounds;
+      for (size_t j = 0; j < 3; ++j) {
+        bounds.extend(toArray(positions[indices[index + j]]));
+      }
+      if (overlaps(bounds.minimum, bounds.maximum, boxMinimum, boxMaximum)) {
+        triangles.emplace_back(index);
+      }
+    }
+  }
+
+  // Keep the order of the index buffer, as a linear test would
+  std::sort(triangles.begin() + static_cast<std::ptrdiff_t>(firstFound),
+            triangles.end());
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,153 @@
+#include <babylon/culling/packed_frustum_culler.h>
+
+#include <algorithm>
+#include <limits>
+
+#include <babylon/culling/bounding_info.h>
+#include <babylon/math/math_kernels.h>
+#include <babylon/math/plane.h>
+
+namespace BABYLON {
+
+PackedFrustumCuller::PackedFrustumCuller() : _stride{0}, _count{0}
+{
+}
+
+PackedFrustumCuller::~PackedFrustumCuller() = default;
+
+void PackedFrustumCuller::reset(size_t capacity)
+{
+  _count = 0;
+
+  const auto blockCount = (capacity + BlockSize - 1) / BlockSize;
+  if (blockCount * BlockSize > _stride) {
+    _stride = blockCount * BlockSize;
+    _volumes.resize(_stride * MathKernels::CullVolumeComponents);
+    _blockMinimums.resize(blockCount);
+    _blockMaximums.resize(blockCount);
+    _blockCullingPlanes.resize(blockCount, 0);
+  }
+}
+
+size_t PackedFrustumCuller::add(const BoundingInfo& boundingInfo)
+{
+  const auto index   = _count++;
+  const auto& sphere = boundingInfo.boundingSphere;
+  const auto& box    = boundingInfo.boundingBox;
+
+  // The box is described by its center and its three half axes, which give
+  // the same corners as BoundingBox::vectorsWorld
+  const auto& corners = box.vectorsWorld;
+  const auto center   = corners[0].add(corners[1]).scale(0.5f);
+  const auto axis0    = corners[2].subtract(corners[0]).scale(0.5f);
+  const auto axis1    = corners[3].subtract(corners[0]).scale(0.5f);
+  const auto axis2    = corners[4].subtract(corners[0]).scale(0.5f);
+
+  auto* volume = _volumes.data() + index;
+  const auto set
+    = [volume, this](MathKernels::BoundingVolumeComponent component,
+                     float value) { volume[component * _stride] = value; };
+  set(MathKernels::SphereCenterX, sphere.centerWorld.x);
+  set(MathKernels::SphereCenterY, sphere.centerWorld.y);
+  set(MathKernels::SphereCenterZ, sphere.centerWorld.z);
+  set(MathKernels::SphereRadius, sphere.radiusWorld);
+  set(MathKernels::BoxCenterX, center.x);
+  set(MathKernels::BoxCenterY, center.y);
+  set(MathKernels::BoxCenterZ, center.z);
+  set(MathKernels::BoxAxis0X, axis0.x);
+  set(MathKernels::BoxAxis0Y, axis0.y);
+  set(MathKernels::BoxAxis0Z, axis0.z);
+  set(MathKernels::BoxAxis1X, axis1.x);
+  set(MathKernels::BoxAxis1Y, axis1.y);
+  set(MathKernels::BoxAxis1Z, axis1.z);
+  set(MathKernels::BoxAxis2X, axis2.x);
+  set(MathKernels::BoxAxis2Y, axis2.y);
+  set(MathKernels::BoxAxis2Z, axis2.z);
+
+  // Bounds of the block
+  const auto block = index / BlockSize;
+  if (index % BlockSize == 0) {
+    _blockMinimums[block].copyFrom(box.minimumWorld);
+    _blockMaximums[block].copyFrom(box.maximumWorld);
+  }
+  else {
+    _blockMinimums[block].minimizeInPlace(box.minimumWorld);
+    _blockMaximums[block].maximizeInPlace(box.maximumWorld);
+  }
+
+  return index;
+}
+
+size_t PackedFrustumCuller::size() const
+{
+  return _count;
+}
+
+void PackedFrustumCuller::cull(const std::array<Plane, 6>& frustumPlanes,
+                               std::vector<uint8_t>& visible)
+{
+  visible.assign(_count, 0);
+
+  const auto& kernels = MathKernels::Get();
+  std::array<float, 24> crossingPlanes;
+  for (size_t begin = 0; begin < _count; begin += BlockSize) {
+    const auto block    = begin / BlockSize;
+    const auto count    = std::min(BlockSize, _count - begin);
+    const auto& minimum = _blockMinimums[block];
+    const auto& maximum = _blockMaximums[block];
+
+    // Farthest corners of the block along and against the plane normal
+    const auto farthestDot = [&minimum, &maximum](const Plane& plane) {
+      return plane.dotCoordinate(
+        Vector3(plane.normal.x >= 0.f ? maximum.x : minimum.x,
+                plane.normal.y >= 0.f ? maximum.y : minimum.y,
+                plane.normal.z >= 0.f ? maximum.z : minimum.z));
+    };
+    const auto nearestDot = [&minimum, &maximum](const Plane& plane) {
+      return plane.dotCoordinate(
+        Vector3(plane.normal.x >= 0.f ? minimum.x : maximum.x,
+                plane.normal.y >= 0.f ? minimum.y : maximum.y,
+                plane.normal.z >= 0.f ? minimum.z : maximum.z));
+    };
+
+    // Plane coherency: the block is likely to be culled by the same plane
+    auto& cullingPlane = _blockCullingPlanes[block];
+    if (farthestDot(frustumPlanes[cullingPlane]) < 0.f) {
+      continue;
+    }
+
+    auto isCulled             = false;
+    size_t crossingPlaneCount = 0;
+    for (size_t p = 0; p < frustumPlanes.size(); ++p) {
+      const auto& plane = frustumPlanes[p];
+      if (farthestDot(plane) < 0.f) {
+        cullingPlane = static_cast<uint8_t>(p);
+        isCulled     = true;
+        break;
+      }
+      if (nearestDot(plane) < 0.f) {
+        auto* crossingPlane = crossingPlanes.data() + crossingPlaneCount * 4;
+        crossingPlane[0]    = plane.normal.x;
+        crossingPlane[1]    = plane.normal.y;
+        crossingPlane[2]    = plane.normal.z;
+        crossingPlane[3]    = plane.d;
+        ++crossingPlaneCount;
+      }
+    }
+    if (isCulled) {
+      continue;
+    }
+
+    // A block entirely in the frustum keeps all its volumes
+    if (crossingPlaneCount == 0) {
+      std::fill_n(visible.begin() + begin, count, uint8_t{1});
+      continue;
+    }
+
+    kernels.cullBoundingVolumes(_volumes.data() + begin, _stride,
+                                crossingPlanes.data(), crossingPlaneCount,
+                                visible.data() + begin, count);
+  }
+}
+
+} // end of namespace BABYLON
@@ -11,9 +11,13 @@
 
 namespace BABYLON {
 
-std::array<Vector3, 6> Ray::TmpVector3{Vector3::Zero(), Vector3::Zero(),
-                                       Vector3::Zero(), Vector3::Zero(),
-                                       Vector3::Zero(), Vector3::Zero()};
+std::array<Vector3, 6>& Ray::TmpVector3()
+{
+  thread_local std::array<Vector3, 6> tmpVector3{
+    {Vector3::Zero(), Vector3::Zero(), Vector3::Zero(), Vector3::Zero(),
+     Vector3::Zero(), Vector3::Zero()}};
+  return tmpVector3;
+}
 
 const float Ray::smallnum = 0.00000001f;
 const float Ray::rayl     = 10e8f;
@@ -84,10 +88,10 @@ std::ostream& operator<<(std::ostream& os, const Ray& ray)
 bool Ray::intersectsBoxMinMax(const Vector3& minimum, const Vector3& maximum,
                               float intersectionTreshold) const
 {
-  const auto& newMinimum = Ray::TmpVector3[0].copyFromFloats(
+  const auto& newMinimum = Ray::TmpVector3()[0].copyFromFloats(
     minimum.x - intersectionTreshold, minimum.y - intersectionTreshold,
     minimum.z - intersectionTreshold);
-  const auto& newMaximum = Ray::TmpVector3[1].copyFromFloats(
+  const auto& newMaximum = Ray::TmpVector3()[1].copyFromFloats(
     maximum.x + intersectionTreshold, maximum.y + intersectionTreshold,
     maximum.z + intersectionTreshold);
   auto d        = 0.f;
@@ -208,11 +212,11 @@ std::optional<IntersectionInfo> Ray::intersectsTriangle(const Vector3& vertex0,
                                                         const Vector3& vertex1,
                                                         const Vector3& vertex2)
 {
-  auto& edge1 = Ray::TmpVector3[0];
-  auto& edge2 = Ray::TmpVector3[1];
-  auto& pvec  = Ray::TmpVector3[2];
-  auto& tvec  = Ray::TmpVector3[3];
-  auto& qvec  = Ray::TmpVector3[4];
+  auto& edge1 = Ray::TmpVector3()[0];
+  auto& edge2 = Ray::TmpVector3()[1];
+  auto& pvec  = Ray::TmpVector3()[2];
+  auto& tvec  = Ray::TmpVector3()[3];
+  auto& qvec  = Ray::TmpVector3()[4];
 
   vertex1.subtractToRef(vertex0, edge1);
   vertex2.subtractToRef(vertex0, edge2);
@@ -275,7 +279,7 @@ std::optional<float> Ray::intersectsPlane(const Plane& plane)
 
 PickingInfo Ray::intersectsMesh(AbstractMesh* mesh, bool fastCheck)
 {
-  auto& tm = Tmp::MatrixArray[0];
+  auto& tm = Tmp::MatrixArray()[0];
 
   mesh->getWorldMatrix().invertToRef(tm);
 
@@ -332,10 +336,10 @@ float Ray::intersectionSegment(const Vector3& sega, const Vector3& segb,
                                float threshold) const
 {
   const auto& o = origin;
-  auto& u       = Tmp::Vector3Array[0];
-  auto& rsegb   = Tmp::Vector3Array[1];
-  auto& v       = Tmp::Vector3Array[2];
-  auto& w       = Tmp::Vector3Array[3];
+  auto& u       = Tmp::Vector3Array()[0];
+  auto& rsegb   = Tmp::Vector3Array()[1];
+  auto& v       = Tmp::Vector3Array()[2];
+  auto& w       = Tmp::Vector3Array()[3];
 
   segb.subtractToRef(sega, u);
 
@@ -408,12 +412,12 @@ float Ray::intersectionSegment(const Vector3& sega, const Vector3& segb,
   tc = (std::abs(tN) < Ray::smallnum ? 0.f : tN / tD);
 
   // get the difference of the two closest points
-  auto& qtc = Tmp::Vector3Array[4];
+  auto& qtc = Tmp::Vector3Array()[4];
   v.scaleToRef(tc, qtc);
-  auto& qsc = Tmp::Vector3Array[5];
+  auto& qsc = Tmp::Vector3Array()[5];
   u.scaleToRef(sc, qsc);
   qsc.addInPlace(w);
-  auto& dP = Tmp::Vector3Array[6];
+  auto& dP = Tmp::Vector3Array()[6];
   qsc.subtractToRef(qtc, dP); // = S1(sc) - S2(tc)
 
   const auto isIntersected
@@ -491,18 +495,18 @@ void Ray::unprojectRayToRef(float sourceX, float sourceY, float viewportWidth,
                             float viewportHeight, Matrix& world,
                             const Matrix& view, const Matrix& projection)
 {
-  auto& matrix = Tmp::MatrixArray[0];
+  auto& matrix = Tmp::MatrixArray()[0];
   world.multiplyToRef(view, matrix);
   matrix.multiplyToRef(projection, matrix);
   matrix.invert();
-  auto& nearScreenSource = Tmp::Vector3Array[0];
+  auto& nearScreenSource = Tmp::Vector3Array()[0];
   nearScreenSource.x     = sourceX / viewportWidth * 2.f - 1.f;
   nearScreenSource.y     = -(sourceY / viewportHeight * 2.f - 1.f);
   nearScreenSource.z     = -1.f;
-  auto& farScreenSource  = Tmp::Vector3Array[1].copyFromFloats(
+  auto& farScreenSource  = Tmp::Vector3Array()[1].copyFromFloats(
     nearScreenSource.x, nearScreenSource.y, 1.f);
-  auto& nearVec3 = Tmp::Vector3Array[2];
-  auto& farVec3  = Tmp::Vector3Array[3];
+  auto& nearVec3 = Tmp::Vector3Array()[2];
+  auto& farVec3  = Tmp::Vector3Array()[3];
   Vector3::_UnprojectFromInvertedMatrixToRef(nearScreenSource, matrix,
                                              nearVec3);
   Vector3::_UnprojectFromInvertedMatrixToRef(farScreenSource, matrix, farVec3);
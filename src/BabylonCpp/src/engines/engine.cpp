@@ -22,6 +22,7 @@
 #include <babylon/materials/effect_creation_options.h>
 #include <babylon/materials/effect_fallbacks.h>
 #include <babylon/materials/material.h>
+#include <babylon/materials/material_defines.h>
 #include <babylon/materials/textures/dummy_internal_texture_tracker.h>
 #include <babylon/materials/textures/iinternal_texture_loader.h>
 #include <babylon/materials/textures/iinternal_texture_tracker.h>
@@ -1929,6 +1930,13 @@ void Engine::_releaseEffect(Effect* effect)
   if (hasEffect) {
     _deleteProgram(effect->getProgram());
     _compiledEffects.erase(effect->_key);
+    for (auto it = _compiledEffectsByDefines.begin();
+         it != _compiledEffectsByDefines.end();) {
+      stl_util::remove_if(it->second, [effect](const auto& item) {
+        return item.effect.get() == effect;
+      });
+      it = it->second.empty() ? _compiledEffectsByDefines.erase(it) : ++it;
+    }
   }
 }
 
@@ -1950,22 +1958,70 @@ EffectPtr Engine::createEffect(
   const std::string& baseName, EffectCreationOptions& options, Engine* engine,
   const std::function<void(const EffectPtr& effect)>& onCompiled)
 {
+  // Effects created from material defines are looked up with the hash of the
+  // defines, the defines string is only built when a new effect is needed
+  const auto useDefinesHash
+    = options.materialDefines != nullptr && options.defines.empty();
+  uint64_t definesHash            = 0;
+  uint32_t imageProcessingBitMask = 0;
+  if (useDefinesHash) {
+    const uint64_t baseNameHash = std::hash<std::string>{}(baseName);
+    definesHash                 = options.materialDefines->hash()
+                  ^ (baseNameHash * 0x9e3779b97f4a7c15ull);
+    // The stored copies of the defines lose their image processing defines
+    imageProcessingBitMask = options.materialDefines->imageProcessingBitMask();
+    auto it                = _compiledEffectsByDefines.find(definesHash);
+    if (it != _compiledEffectsByDefines.end()) {
+      for (const auto& item : it->second) {
+        if (item.baseName == baseName
+            && item.imageProcessingBitMask == imageProcessingBitMask
+            && item.defines->_hasSameBaseDefines(*options.materialDefines)) {
+          if (onCompiled && item.effect->isReady()) {
+            onCompiled(item.effect);
+          }
+          return item.effect;
+        }
+      }
+    }
+    options.defines = options.materialDefines->toString();
+  }
+
   std::string name = baseName + "+" + baseName + "@" + options.defines;
+  EffectPtr effect = nullptr;
   if (stl_util::contains(_compiledEffects, name)) {
-    auto compiledEffect = _compiledEffects[name];
-    if (onCompiled && compiledEffect->isReady()) {
-      onCompiled(compiledEffect);
+    effect = _compiledEffects[name];
+    if (onCompiled && effect->isReady()) {
+      onCompiled(effect);
+    }
+  }
+  else {
+    effect                 = Effect::New(baseName, options, engine);
+    effect->_key           = name;
+    _compiledEffects[name] = effect;
+
+    // Only the new effects are indexed, the hash lookup of the existing ones
+    // failed because they were not created from material defines
+    if (useDefinesHash) {
+      _compiledEffectsByDefines[definesHash].emplace_back(
+        CompiledEffectDefines{
+          baseName,
+          std::make_shared<MaterialDefines>(*options.materialDefines),
+          imageProcessingBitMask, effect});
     }
-    return compiledEffect;
   }
-
-  auto effect            = Effect::New(baseName, options, engine);
-  effect->_key           = name;
-  _compiledEffects[name] = effect;
 
   return effect;
 }
 
+size_t Engine::_getCompiledEffectsByDefinesCount() const
+{
+  size_t count = 0;
+  for (const auto& item : _compiledEffectsByDefines) {
+    count += item.second.size();
+  }
+  return count;
+}
+
 EffectPtr
 Engine::createEffect(std::unordered_map<std::string, std::string>& baseName,
                      EffectCreationOptions& options, Engine* engine)
@@ -5563,6 +5619,7 @@ void Engine::releaseEffects()
   }
 
   _compiledEffects.clear();
+  _compiledEffectsByDefines.clear();
 }
 
 // Dispose
@@ -0,0 +1,55 @@
+#include <babylon/engines/headless/headless_canvas.h>
+
+#include <babylon/engines/headless/recording_gl_rendering_context.h>
+
+namespace BABYLON {
+
+HeadlessCanvas::HeadlessCanvas(int iWidth, int iHeight) : ICanvas{}
+{
+  auto recordingContext = std::make_unique<GL::RecordingGLRenderingContext>();
+  _recordingContext     = recordingContext.get();
+  _renderingContext     = std::move(recordingContext);
+  setFrameSize(iWidth, iHeight);
+}
+
+HeadlessCanvas::~HeadlessCanvas()
+{
+}
+
+bool HeadlessCanvas::initializeContext3d()
+{
+  if (!_initialized) {
+    _initialized = _renderingContext->initialize();
+  }
+
+  return _initialized;
+}
+
+ClientRect& HeadlessCanvas::getBoundingClientRect()
+{
+  return _boundingClientRect;
+}
+
+bool HeadlessCanvas::onlyRenderBoundingClientRect() const
+{
+  return false;
+}
+
+ICanvasRenderingContext2D* HeadlessCanvas::getContext2d()
+{
+  return nullptr;
+}
+
+GL::IGLRenderingContext*
+HeadlessCanvas::getContext3d(const EngineOptions& /*options*/)
+{
+  initializeContext3d();
+  return _renderingContext.get();
+}
+
+GL::RecordingGLRenderingContext* HeadlessCanvas::recordingContext()
+{
+  return _recordingContext;
+}
+
+} // end of namespace BABYLON
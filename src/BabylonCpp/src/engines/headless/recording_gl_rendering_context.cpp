@@ -0,0 +1,1517 @@
+#include <babylon/engines/headless/recording_gl_rendering_context.h>
+
+#include <babylon/babylon_stl_util.h>
+#include <babylon/core/string.h>
+#include <babylon/interfaces/icanvas.h>
+
+namespace BABYLON {
+namespace GL {
+
+namespace {
+
+template <typename T>
+double _handleOf(const T* object)
+{
+  return object ? static_cast<double>(object->value) : 0.0;
+}
+
+template <typename T>
+double _handleOf(const std::unique_ptr<T>& object)
+{
+  return _handleOf(object.get());
+}
+
+template <typename T>
+size_t _byteLength(const std::vector<T>& data)
+{
+  return data.size() * sizeof(T);
+}
+
+} // end of anonymous namespace
+
+RecordingGLRenderingContext::RecordingGLRenderingContext()
+    : recordCalls{true}, compileSucceeds{true}, _handleCounter{0}
+{
+  drawingBufferWidth        = 0;
+  drawingBufferHeight       = 0;
+  RASTERIZER_DISCARD        = GL::RASTERIZER_DISCARD;
+  TEXTURE_3D                = GL::TEXTURE_3D;
+  TEXTURE_2D_ARRAY          = GL::TEXTURE_2D_ARRAY;
+  TEXTURE_WRAP_R            = GL::TEXTURE_WRAP_R;
+  TRANSFORM_FEEDBACK        = GL::TRANSFORM_FEEDBACK;
+  INTERLEAVED_ATTRIBS       = GL::INTERLEAVED_ATTRIBS;
+  TRANSFORM_FEEDBACK_BUFFER = GL::TRANSFORM_FEEDBACK_BUFFER;
+
+  _scissorBox = {{0, 0, 0}};
+
+  _shaderPrecisionFormat.rangeMin  = 127;
+  _shaderPrecisionFormat.rangeMax  = 127;
+  _shaderPrecisionFormat.precision = 23;
+
+  _pixelStore[GL::UNPACK_ALIGNMENT] = 4;
+  _pixelStore[GL::PACK_ALIGNMENT]   = 4;
+}
+
+RecordingGLRenderingContext::~RecordingGLRenderingContext()
+{
+}
+
+const GLCallStatistics& RecordingGLRenderingContext::statistics() const
+{
+  return _statistics;
+}
+
+void RecordingGLRenderingContext::resetStatistics()
+{
+  _statistics = GLCallStatistics();
+}
+
+const std::vector<GLCallRecord>& RecordingGLRenderingContext::calls() const
+{
+  return _calls;
+}
+
+void RecordingGLRenderingContext::clearCalls()
+{
+  _calls.clear();
+}
+
+void RecordingGLRenderingContext::resetHandles()
+{
+  _handleCounter = 0;
+}
+
+size_t RecordingGLRenderingContext::countCalls(const std::string& name) const
+{
+  return static_cast<size_t>(std::count_if(
+    _calls.begin(), _calls.end(),
+    [&name](const GLCallRecord& call) { return name == call.name; }));
+}
+
+GLuint RecordingGLRenderingContext::_nextHandle()
+{
+  ++_statistics.objectsCreated;
+  return ++_handleCounter;
+}
+
+void RecordingGLRenderingContext::_record(
+  const char* name, std::initializer_list<double> arguments)
+{
+  ++_statistics.totalCalls;
+  if (recordCalls) {
+    _calls.emplace_back(GLCallRecord{name, arguments});
+  }
+}
+
+void RecordingGLRenderingContext::_recordStateChange(
+  const char* name, std::initializer_list<double> arguments)
+{
+  ++_statistics.stateChanges;
+  _record(name, arguments);
+}
+
+void RecordingGLRenderingContext::_recordDraw(
+  const char* name, GLsizei count, GLsizei instanceCount,
+  std::initializer_list<double> arguments)
+{
+  ++_statistics.drawCalls;
+  if (instanceCount > 0) {
+    ++_statistics.instancedDrawCalls;
+  }
+  _statistics.drawnVertices += static_cast<size_t>(std::max(count, 0));
+  _statistics.drawnInstances
+    += static_cast<size_t>(instanceCount > 0 ? instanceCount : 1);
+  _record(name, arguments);
+}
+
+void RecordingGLRenderingContext::_recordUniform(const char* name,
+                                                 IGLUniformLocation* location,
+                                                 size_t valueCount)
+{
+  ++_statistics.uniformUploads;
+  _record(name, {location ? static_cast<double>(location->value) : -1.0,
+                 static_cast<double>(valueCount)});
+}
+
+void RecordingGLRenderingContext::_recordBufferUpload(const char* name,
+                                                      GLenum target,
+                                                      size_t byteLength)
+{
+  ++_statistics.bufferUploads;
+  _statistics.bufferBytesUploaded += byteLength;
+  _record(name, {static_cast<double>(target), static_cast<double>(byteLength)});
+}
+
+void RecordingGLRenderingContext::_recordBufferSubData(GLenum target,
+                                                       GLintptr offset,
+                                                       size_t byteLength)
+{
+  ++_statistics.bufferUploads;
+  _statistics.bufferBytesUploaded += byteLength;
+  _record("bufferSubData",
+          {static_cast<double>(target), static_cast<double>(byteLength),
+           static_cast<double>(offset)});
+}
+
+void RecordingGLRenderingContext::_recordTextureUpload(const char* name,
+                                                       GLenum target,
+                                                       size_t byteLength)
+{
+  _statistics.textureBytesUploaded += byteLength;
+  _record(name, {static_cast<double>(target), static_cast<double>(byteLength)});
+}
+
+bool RecordingGLRenderingContext::initialize(bool /*enableGLDebugging*/)
+{
+  _record("initialize");
+  return true;
+}
+
+void RecordingGLRenderingContext::backupGLState()
+{
+  _record("backupGLState");
+}
+
+void RecordingGLRenderingContext::restoreGLState()
+{
+  _record("restoreGLState");
+}
+
+GLenum RecordingGLRenderingContext::operator[](const std::string& name)
+{
+  const auto indexOf = [&name](const std::string& prefix) -> int {
+    if (name.size() <= prefix.size()
+        || !String::startsWith(name, prefix)) {
+      return -1;
+    }
+    const auto suffix = name.substr(prefix.size());
+    if (!std::all_of(suffix.begin(), suffix.end(), ::isdigit)) {
+      return -1;
+    }
+    return std::stoi(suffix);
+  };
+
+  if (name == "TEXTURE") {
+    return GL::TEXTURE;
+  }
+  auto index = indexOf("TEXTURE");
+  if (index >= 0 && index < 32) {
+    return GL::TEXTURE0 + static_cast<GLenum>(index);
+  }
+  index = indexOf("COLOR_ATTACHMENT");
+  if (index >= 0 && index < 32) {
+    return GL::COLOR_ATTACHMENT0 + static_cast<GLenum>(index);
+  }
+
+  return 0;
+}
+
+void RecordingGLRenderingContext::activeTexture(GLenum texture)
+{
+  _recordStateChange("activeTexture", {static_cast<double>(texture)});
+}
+
+void RecordingGLRenderingContext::attachShader(
+  const std::unique_ptr<IGLProgram>& program,
+  const std::unique_ptr<IGLShader>& shader)
+{
+  _record("attachShader", {_handleOf(program), _handleOf(shader)});
+}
+
+void RecordingGLRenderingContext::beginQuery(
+  GLenum target, const std::unique_ptr<IGLQuery>& query)
+{
+  _record("beginQuery", {static_cast<double>(target), _handleOf(query)});
+}
+
+void RecordingGLRenderingContext::beginTransformFeedback(GLenum primitiveMode)
+{
+  _record("beginTransformFeedback", {static_cast<double>(primitiveMode)});
+}
+
+void RecordingGLRenderingContext::bindAttribLocation(IGLProgram* program,
+                                                     GLuint index,
+                                                     const std::string& name)
+{
+  if (program) {
+    _attribLocations[program->value][name] = static_cast<GLint>(index);
+  }
+  _record("bindAttribLocation",
+          {_handleOf(program), static_cast<double>(index)});
+}
+
+void RecordingGLRenderingContext::bindBuffer(GLenum target, IGLBuffer* buffer)
+{
+  ++_statistics.bufferBinds;
+  _recordStateChange("bindBuffer",
+                     {static_cast<double>(target), _handleOf(buffer)});
+}
+
+void RecordingGLRenderingContext::bindFramebuffer(GLenum target,
+                                                  IGLFramebuffer* framebuffer)
+{
+  ++_statistics.framebufferBinds;
+  _recordStateChange("bindFramebuffer",
+                     {static_cast<double>(target), _handleOf(framebuffer)});
+}
+
+void RecordingGLRenderingContext::bindBufferBase(GLenum target, GLuint index,
+                                                 IGLBuffer* buffer)
+{
+  ++_statistics.bufferBinds;
+  _recordStateChange("bindBufferBase",
+                     {static_cast<double>(target), static_cast<double>(index),
+                      _handleOf(buffer)});
+}
+
+void RecordingGLRenderingContext::bindRenderbuffer(
+  GLenum target, const std::unique_ptr<IGLRenderbuffer>& renderbuffer)
+{
+  _recordStateChange("bindRenderbuffer",
+                     {static_cast<double>(target), _handleOf(renderbuffer)});
+}
+
+void RecordingGLRenderingContext::bindTexture(GLenum target,
+                                              IGLTexture* texture)
+{
+  ++_statistics.textureBinds;
+  _recordStateChange("bindTexture",
+                     {static_cast<double>(target), _handleOf(texture)});
+}
+
+void RecordingGLRenderingContext::bindTransformFeedback(
+  GLenum target, IGLTransformFeedback* transformFeedback)
+{
+  _recordStateChange("bindTransformFeedback", {static_cast<double>(target),
+                                               _handleOf(transformFeedback)});
+}
+
+void RecordingGLRenderingContext::blendColor(GLclampf red, GLclampf green,
+                                             GLclampf blue, GLclampf alpha)
+{
+  _recordStateChange("blendColor", {red, green, blue, alpha});
+}
+
+void RecordingGLRenderingContext::blendEquation(GLenum mode)
+{
+  _recordStateChange("blendEquation", {static_cast<double>(mode)});
+}
+
+void RecordingGLRenderingContext::blendEquationSeparate(GLenum modeRGB,
+                                                        GLenum modeAlpha)
+{
+  _recordStateChange("blendEquationSeparate", {static_cast<double>(modeRGB),
+                                               static_cast<double>(modeAlpha)});
+}
+
+void RecordingGLRenderingContext::blendFunc(GLenum sfactor, GLenum dfactor)
+{
+  _recordStateChange("blendFunc", {static_cast<double>(sfactor),
+                                   static_cast<double>(dfactor)});
+}
+
+void RecordingGLRenderingContext::blendFuncSeparate(GLenum srcRGB,
+                                                    GLenum dstRGB,
+                                                    GLenum srcAlpha,
+                                                    GLenum dstAlpha)
+{
+  _recordStateChange("blendFuncSeparate",
+                     {static_cast<double>(srcRGB), static_cast<double>(dstRGB),
+                      static_cast<double>(srcAlpha),
+                      static_cast<double>(dstAlpha)});
+}
+
+void RecordingGLRenderingContext::blitFramebuffer(
+  GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0,
+  GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+  _record("blitFramebuffer",
+          {static_cast<double>(srcX0), static_cast<double>(srcY0),
+           static_cast<double>(srcX1), static_cast<double>(srcY1),
+           static_cast<double>(dstX0), static_cast<double>(dstY0),
+           static_cast<double>(dstX1), static_cast<double>(dstY1),
+           static_cast<double>(mask), static_cast<double>(filter)});
+}
+
+void RecordingGLRenderingContext::bufferData(GLenum target, GLsizeiptr size,
+                                             GLenum usage)
+{
+  // Allocation only, no data is transferred
+  ++_statistics.bufferUploads;
+  _record("bufferData", {static_cast<double>(target), static_cast<double>(size),
+                         static_cast<double>(usage)});
+}
+
+void RecordingGLRenderingContext::bufferData(GLenum target,
+                                             const Float32Array& data,
+                                             GLenum /*usage*/)
+{
+  _recordBufferUpload("bufferData", target, _byteLength(data));
+}
+
+void RecordingGLRenderingContext::bufferData(GLenum target,
+                                             const Int32Array& data,
+                                             GLenum /*usage*/)
+{
+  _recordBufferUpload("bufferData", target, _byteLength(data));
+}
+
+void RecordingGLRenderingContext::bufferData(GLenum target,
+                                             const Uint16Array& data,
+                                             GLenum /*usage*/)
+{
+  _recordBufferUpload("bufferData", target, _byteLength(data));
+}
+
+void RecordingGLRenderingContext::bufferData(GLenum target,
+                                             const Uint32Array& data,
+                                             GLenum /*usage*/)
+{
+  _recordBufferUpload("bufferData", target, _byteLength(data));
+}
+
+void RecordingGLRenderingContext::bufferSubData(GLenum target,
+                                                GLintptr offset,
+                                                const Uint8Array& data)
+{
+  _recordBufferSubData(target, offset, _byteLength(data));
+}
+
+void RecordingGLRenderingContext::bufferSubData(GLenum target,
+                                                GLintptr offset,
+                                                const Float32Array& data)
+{
+  _recordBufferSubData(target, offset, _byteLength(data));
+}
+
+void RecordingGLRenderingContext::bufferSubData(GLenum target,
+                                                GLintptr offset,
+                                                Int32Array& data)
+{
+  _recordBufferSubData(target, offset, _byteLength(data));
+}
+
+void RecordingGLRenderingContext::bindVertexArray(
+  GL::IGLVertexArrayObject* vao)
+{
+  _recordStateChange("bindVertexArray", {_handleOf(vao)});
+}
+
+GLenum RecordingGLRenderingContext::checkFramebufferStatus(GLenum target)
+{
+  _record("checkFramebufferStatus", {static_cast<double>(target)});
+  return GL::FRAMEBUFFER_COMPLETE;
+}
+
+void RecordingGLRenderingContext::clear(GLbitfield mask)
+{
+  _record("clear", {static_cast<double>(mask)});
+}
+
+void RecordingGLRenderingContext::clearBufferfv(
+  GLenum buffer, GLint drawbuffer, const std::vector<GLfloat>& values,
+  GLint /*srcOffset*/)
+{
+  _record("clearBufferfv",
+          {static_cast<double>(buffer), static_cast<double>(drawbuffer),
+           static_cast<double>(values.size())});
+}
+
+void RecordingGLRenderingContext::clearBufferiv(
+  GLenum buffer, GLint drawbuffer, const std::vector<GLint>& values,
+  GLint /*srcOffset*/)
+{
+  _record("clearBufferiv",
+          {static_cast<double>(buffer), static_cast<double>(drawbuffer),
+           static_cast<double>(values.size())});
+}
+
+void RecordingGLRenderingContext::clearBufferuiv(
+  GLenum buffer, GLint drawbuffer, const std::vector<GLuint>& values,
+  GLint /*srcOffset*/)
+{
+  _record("clearBufferuiv",
+          {static_cast<double>(buffer), static_cast<double>(drawbuffer),
+           static_cast<double>(values.size())});
+}
+
+void RecordingGLRenderingContext::clearBufferfi(GLenum buffer,
+                                                GLint drawbuffer,
+                                                GLfloat depth, GLint stencil)
+{
+  _record("clearBufferfi",
+          {static_cast<double>(buffer), static_cast<double>(drawbuffer), depth,
+           static_cast<double>(stencil)});
+}
+
+void RecordingGLRenderingContext::clearColor(GLclampf red, GLclampf green,
+                                             GLclampf blue, GLclampf alpha)
+{
+  _recordStateChange("clearColor", {red, green, blue, alpha});
+}
+
+void RecordingGLRenderingContext::clearDepth(GLclampf depth)
+{
+  _recordStateChange("clearDepth", {depth});
+}
+
+void RecordingGLRenderingContext::clearStencil(GLint stencil)
+{
+  _recordStateChange("clearStencil", {static_cast<double>(stencil)});
+}
+
+void RecordingGLRenderingContext::colorMask(GLboolean red, GLboolean green,
+                                            GLboolean blue, GLboolean alpha)
+{
+  _recordStateChange("colorMask", {static_cast<double>(red),
+                                   static_cast<double>(green),
+                                   static_cast<double>(blue),
+                                   static_cast<double>(alpha)});
+}
+
+void RecordingGLRenderingContext::compileShader(
+  const std::unique_ptr<IGLShader>& shader)
+{
+  ++_statistics.shaderCompilations;
+  _record("compileShader", {_handleOf(shader)});
+}
+
+void RecordingGLRenderingContext::compressedTexImage2D(
+  GLenum target, GLint /*level*/, GLenum /*internalformat*/,
+  GLsizei /*width*/, GLsizei /*height*/, GLint /*border*/,
+  const Uint8Array& pixels)
+{
+  _recordTextureUpload("compressedTexImage2D", target, _byteLength(pixels));
+}
+
+void RecordingGLRenderingContext::compressedTexSubImage2D(
+  GLenum target, GLint /*level*/, GLint /*xoffset*/, GLint /*yoffset*/,
+  GLsizei /*width*/, GLsizei /*height*/, GLenum /*format*/, GLsizeiptr size)
+{
+  _recordTextureUpload("compressedTexSubImage2D", target,
+                       static_cast<size_t>(std::max<GLsizeiptr>(size, 0)));
+}
+
+void RecordingGLRenderingContext::copyTexImage2D(
+  GLenum target, GLint level, GLenum internalformat, GLint x, GLint y,
+  GLsizei width, GLsizei height, GLint border)
+{
+  _record("copyTexImage2D",
+          {static_cast<double>(target), static_cast<double>(level),
+           static_cast<double>(internalformat), static_cast<double>(x),
+           static_cast<double>(y), static_cast<double>(width),
+           static_cast<double>(height), static_cast<double>(border)});
+}
+
+void RecordingGLRenderingContext::copyTexSubImage2D(
+  GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y,
+  GLint width, GLint height)
+{
+  _record("copyTexSubImage2D",
+          {static_cast<double>(target), static_cast<double>(level),
+           static_cast<double>(xoffset), static_cast<double>(yoffset),
+           static_cast<double>(x), static_cast<double>(y),
+           static_cast<double>(width), static_cast<double>(height)});
+}
+
+std::unique_ptr<IGLBuffer> RecordingGLRenderingContext::createBuffer()
+{
+  auto buffer = std::make_unique<IGLBuffer>(_nextHandle());
+  _record("createBuffer", {_handleOf(buffer)});
+  return buffer;
+}
+
+std::unique_ptr<IGLFramebuffer> RecordingGLRenderingContext::createFramebuffer()
+{
+  auto framebuffer = std::make_unique<IGLFramebuffer>(_nextHandle());
+  _record("createFramebuffer", {_handleOf(framebuffer)});
+  return framebuffer;
+}
+
+std::unique_ptr<IGLProgram> RecordingGLRenderingContext::createProgram()
+{
+  auto program = std::make_unique<IGLProgram>(_nextHandle());
+  _record("createProgram", {_handleOf(program)});
+  return program;
+}
+
+std::unique_ptr<IGLQuery> RecordingGLRenderingContext::createQuery()
+{
+  auto query = std::make_unique<IGLQuery>(_nextHandle());
+  _record("createQuery", {_handleOf(query)});
+  return query;
+}
+
+std::unique_ptr<IGLRenderbuffer>
+RecordingGLRenderingContext::createRenderbuffer()
+{
+  auto renderbuffer = std::make_unique<IGLRenderbuffer>(_nextHandle());
+  _record("createRenderbuffer", {_handleOf(renderbuffer)});
+  return renderbuffer;
+}
+
+std::unique_ptr<IGLShader>
+RecordingGLRenderingContext::createShader(GLenum type)
+{
+  auto shader = std::make_unique<IGLShader>(_nextHandle());
+  _record("createShader", {static_cast<double>(type), _handleOf(shader)});
+  return shader;
+}
+
+std::unique_ptr<IGLTexture> RecordingGLRenderingContext::createTexture()
+{
+  auto texture = std::make_unique<IGLTexture>(_nextHandle());
+  _record("createTexture", {_handleOf(texture)});
+  return texture;
+}
+
+std::unique_ptr<IGLTransformFeedback>
+RecordingGLRenderingContext::createTransformFeedback()
+{
+  auto transformFeedback
+    = std::make_unique<IGLTransformFeedback>(_nextHandle());
+  _record("createTransformFeedback", {_handleOf(transformFeedback)});
+  return transformFeedback;
+}
+
+std::unique_ptr<IGLVertexArrayObject>
+RecordingGLRenderingContext::createVertexArray()
+{
+  auto vao = std::make_unique<IGLVertexArrayObject>(_nextHandle());
+  _record("createVertexArray", {_handleOf(vao)});
+  return vao;
+}
+
+void RecordingGLRenderingContext::cullFace(GLenum mode)
+{
+  _recordStateChange("cullFace", {static_cast<double>(mode)});
+}
+
+void RecordingGLRenderingContext::deleteBuffer(IGLBuffer* buffer)
+{
+  ++_statistics.objectsDeleted;
+  _record("deleteBuffer", {_handleOf(buffer)});
+}
+
+void RecordingGLRenderingContext::deleteFramebuffer(
+  IGLFramebuffer* framebuffer)
+{
+  ++_statistics.objectsDeleted;
+  _record("deleteFramebuffer", {_handleOf(framebuffer)});
+}
+
+void RecordingGLRenderingContext::deleteProgram(IGLProgram* program)
+{
+  ++_statistics.objectsDeleted;
+  if (program) {
+    _attribLocations.erase(program->value);
+    _uniformLocations.erase(program->value);
+  }
+  _record("deleteProgram", {_handleOf(program)});
+}
+
+void RecordingGLRenderingContext::deleteQuery(
+  const std::unique_ptr<IGLQuery>& query)
+{
+  ++_statistics.objectsDeleted;
+  _record("deleteQuery", {_handleOf(query)});
+}
+
+void RecordingGLRenderingContext::deleteRenderbuffer(
+  IGLRenderbuffer* renderbuffer)
+{
+  ++_statistics.objectsDeleted;
+  _record("deleteRenderbuffer", {_handleOf(renderbuffer)});
+}
+
+void RecordingGLRenderingContext::deleteShader(
+  const std::unique_ptr<IGLShader>& shader)
+{
+  ++_statistics.objectsDeleted;
+  if (shader) {
+    _shaderSources.erase(shader->value);
+  }
+  _record("deleteShader", {_handleOf(shader)});
+}
+
+void RecordingGLRenderingContext::deleteTexture(IGLTexture* texture)
+{
+  ++_statistics.objectsDeleted;
+  _record("deleteTexture", {_handleOf(texture)});
+}
+
+void RecordingGLRenderingContext::deleteTransformFeedback(
+  IGLTransformFeedback* transformFeedback)
+{
+  ++_statistics.objectsDeleted;
+  _record("deleteTransformFeedback", {_handleOf(transformFeedback)});
+}
+
+void RecordingGLRenderingContext::deleteVertexArray(IGLVertexArrayObject* vao)
+{
+  ++_statistics.objectsDeleted;
+  _record("deleteVertexArray", {_handleOf(vao)});
+}
+
+void RecordingGLRenderingContext::depthFunc(GLenum func)
+{
+  _recordStateChange("depthFunc", {static_cast<double>(func)});
+}
+
+void RecordingGLRenderingContext::depthMask(GLboolean flag)
+{
+  _recordStateChange("depthMask", {static_cast<double>(flag)});
+}
+
+void RecordingGLRenderingContext::depthRange(GLclampf zNear, GLclampf zFar)
+{
+  _recordStateChange("depthRange", {zNear, zFar});
+}
+
+void RecordingGLRenderingContext::detachShader(IGLProgram* program,
+                                               IGLShader* shader)
+{
+  _record("detachShader", {_handleOf(program), _handleOf(shader)});
+}
+
+void RecordingGLRenderingContext::disable(GLenum cap)
+{
+  _enabledCaps.erase(cap);
+  _recordStateChange("disable", {static_cast<double>(cap)});
+}
+
+void RecordingGLRenderingContext::disableVertexAttribArray(GLuint index)
+{
+  _recordStateChange("disableVertexAttribArray", {static_cast<double>(index)});
+}
+
+void RecordingGLRenderingContext::drawArrays(GLenum mode, GLint first,
+                                             GLint count)
+{
+  _recordDraw("drawArrays", count, 0,
+              {static_cast<double>(mode), static_cast<double>(first),
+               static_cast<double>(count)});
+}
+
+void RecordingGLRenderingContext::drawArraysInstanced(GLenum mode, GLint first,
+                                                      GLsizei count,
+                                                      GLsizei instanceCount)
+{
+  _recordDraw("drawArraysInstanced", count, instanceCount,
+              {static_cast<double>(mode), static_cast<double>(first),
+               static_cast<double>(count), static_cast<double>(instanceCount)});
+}
+
+void RecordingGLRenderingContext::drawBuffers(
+  const std::vector<GLenum>& buffers)
+{
+  _recordStateChange("drawBuffers", {static_cast<double>(buffers.size())});
+}
+
+void RecordingGLRenderingContext::drawElements(GLenum mode, GLsizei count,
+                                               GLenum type, GLintptr offset)
+{
+  _recordDraw("drawElements", count, 0,
+              {static_cast<double>(mode), static_cast<double>(count),
+               static_cast<double>(type), static_cast<double>(offset)});
+}
+
+void RecordingGLRenderingContext::drawElementsInstanced(GLenum mode,
+                                                        GLsizei count,
+                                                        GLenum type,
+                                                        GLintptr offset,
+                                                        GLsizei instanceCount)
+{
+  _recordDraw("drawElementsInstanced", count, instanceCount,
+              {static_cast<double>(mode), static_cast<double>(count),
+               static_cast<double>(type), static_cast<double>(offset),
+               static_cast<double>(instanceCount)});
+}
+
+void RecordingGLRenderingContext::enable(GLenum cap)
+{
+  _enabledCaps.insert(cap);
+  _recordStateChange("enable", {static_cast<double>(cap)});
+}
+
+void RecordingGLRenderingContext::enableVertexAttribArray(GLuint index)
+{
+  _recordStateChange("enableVertexAttribArray", {static_cast<double>(index)});
+}
+
+void RecordingGLRenderingContext::endQuery(GLenum target)
+{
+  _record("endQuery", {static_cast<double>(target)});
+}
+
+void RecordingGLRenderingContext::endTransformFeedback()
+{
+  _record("endTransformFeedback");
+}
+
+void RecordingGLRenderingContext::finish()
+{
+  _record("finish");
+}
+
+void RecordingGLRenderingContext::flush()
+{
+  _record("flush");
+}
+
+void RecordingGLRenderingContext::framebufferRenderbuffer(
+  GLenum target, GLenum attachment, GLenum renderbuffertarget,
+  const std::unique_ptr<IGLRenderbuffer>& renderbuffer)
+{
+  _record("framebufferRenderbuffer",
+          {static_cast<double>(target), static_cast<double>(attachment),
+           static_cast<double>(renderbuffertarget), _handleOf(renderbuffer)});
+}
+
+void RecordingGLRenderingContext::framebufferTexture2D(GLenum target,
+                                                       GLenum attachment,
+                                                       GLenum textarget,
+                                                       IGLTexture* texture,
+                                                       GLint level)
+{
+  _record("framebufferTexture2D",
+          {static_cast<double>(target), static_cast<double>(attachment),
+           static_cast<double>(textarget), _handleOf(texture),
+           static_cast<double>(level)});
+}
+
+void RecordingGLRenderingContext::framebufferTextureMultiviewOVR(
+  GLenum target, GLenum attachment, IGLTexture* texture, GLint level,
+  GLint baseViewIndex, GLint numViews)
+{
+  _record("framebufferTextureMultiviewOVR",
+          {static_cast<double>(target), static_cast<double>(attachment),
+           _handleOf(texture), static_cast<double>(level),
+           static_cast<double>(baseViewIndex), static_cast<double>(numViews)});
+}
+
+void RecordingGLRenderingContext::frontFace(GLenum mode)
+{
+  _recordStateChange("frontFace", {static_cast<double>(mode)});
+}
+
+void RecordingGLRenderingContext::generateMipmap(GLenum target)
+{
+  _record("generateMipmap", {static_cast<double>(target)});
+}
+
+std::vector<IGLShader*>
+RecordingGLRenderingContext::getAttachedShaders(IGLProgram* program)
+{
+  _record("getAttachedShaders", {_handleOf(program)});
+  return {};
+}
+
+GLint RecordingGLRenderingContext::getAttribLocation(IGLProgram* program,
+                                                     const std::string& name)
+{
+  _record("getAttribLocation", {_handleOf(program)});
+  if (!program) {
+    return -1;
+  }
+
+  // Attributes get consecutive locations in order of first query
+  auto& locations = _attribLocations[program->value];
+  if (!stl_util::contains(locations, name)) {
+    const auto location = static_cast<GLint>(locations.size());
+    locations[name]     = location;
+  }
+
+  return locations[name];
+}
+
+GLboolean RecordingGLRenderingContext::hasExtension(
+  const std::string& /*extension*/)
+{
+  _record("hasExtension");
+  return false;
+}
+
+std::array<int, 3> RecordingGLRenderingContext::getScissorBoxParameter()
+{
+  _record("getScissorBoxParameter");
+  return _scissorBox;
+}
+
+GLint RecordingGLRenderingContext::getParameteri(GLenum pname)
+{
+  _record("getParameteri", {static_cast<double>(pname)});
+  switch (pname) {
+    case GL::MAX_TEXTURE_IMAGE_UNITS:
+    case GL::MAX_VERTEX_TEXTURE_IMAGE_UNITS:
+    case GL::MAX_VERTEX_ATTRIBS:
+    case GL::MAX_TEXTURE_MAX_ANISOTROPY_EXT:
+      return 16;
+    case GL::MAX_COMBINED_TEXTURE_IMAGE_UNITS:
+      return 32;
+    case GL::MAX_TEXTURE_SIZE:
+    case GL::MAX_CUBE_MAP_TEXTURE_SIZE:
+    case GL::MAX_RENDERBUFFER_SIZE:
+      return 16384;
+    case GL::MAX_VARYING_VECTORS:
+      return 30;
+    case GL::MAX_FRAGMENT_UNIFORM_VECTORS:
+    case GL::MAX_VERTEX_UNIFORM_VECTORS:
+      return 1024;
+    case GL::MAX_SAMPLES:
+      return 4;
+    case GL::SCISSOR_TEST:
+      return stl_util::contains(_enabledCaps, pname) ? 1 : 0;
+    default:
+      break;
+  }
+
+  return stl_util::contains(_pixelStore, pname) ? _pixelStore[pname] : 0;
+}
+
+GLfloat RecordingGLRenderingContext::getParameterf(GLenum pname)
+{
+  _record("getParameterf", {static_cast<double>(pname)});
+  return 0.f;
+}
+
+GLboolean RecordingGLRenderingContext::getQueryParameterb(
+  const std::unique_ptr<IGLQuery>& query, GLenum pname)
+{
+  _record("getQueryParameterb", {_handleOf(query), static_cast<double>(pname)});
+  return true;
+}
+
+GLuint RecordingGLRenderingContext::getQueryParameteri(
+  const std::unique_ptr<IGLQuery>& query, GLenum pname)
+{
+  _record("getQueryParameteri", {_handleOf(query), static_cast<double>(pname)});
+  return 0;
+}
+
+std::string RecordingGLRenderingContext::getString(GLenum pname)
+{
+  _record("getString", {static_cast<double>(pname)});
+  switch (pname) {
+    case GL::VENDOR:
+      return "BabylonCpp";
+    case GL::RENDERER:
+      return "BabylonCpp Recording GL Rendering Context";
+    case GL::VERSION:
+      return "3.3 (headless)";
+    default:
+      break;
+  }
+
+  return "";
+}
+
+GLint RecordingGLRenderingContext::getTexParameteri(GLenum pname)
+{
+  _record("getTexParameteri", {static_cast<double>(pname)});
+  return 0;
+}
+
+GLfloat RecordingGLRenderingContext::getTexParameterf(GLenum pname)
+{
+  _record("getTexParameterf", {static_cast<double>(pname)});
+  return 0.f;
+}
+
+GLenum RecordingGLRenderingContext::getError()
+{
+  _record("getError");
+  return 0;
+}
+
+const char* RecordingGLRenderingContext::getErrorString(GLenum /*err*/)
+{
+  _record("getErrorString");
+  return "";
+}
+
+GLint RecordingGLRenderingContext::getProgramParameter(IGLProgram* program,
+                                                       GLenum pname)
+{
+  _record("getProgramParameter",
+          {_handleOf(program), static_cast<double>(pname)});
+  return compileSucceeds ? 1 : 0;
+}
+
+std::string RecordingGLRenderingContext::getProgramInfoLog(
+  const std::unique_ptr<IGLProgram>& program)
+{
+  _record("getProgramInfoLog", {_handleOf(program)});
+  return "";
+}
+
+any RecordingGLRenderingContext::getRenderbufferParameter(GLenum target,
+                                                          GLenum pname)
+{
+  _record("getRenderbufferParameter",
+          {static_cast<double>(target), static_cast<double>(pname)});
+  return nullptr;
+}
+
+std::string RecordingGLRenderingContext::getShaderInfoLog(
+  const std::unique_ptr<IGLShader>& shader)
+{
+  _record("getShaderInfoLog", {_handleOf(shader)});
+  return "";
+}
+
+GLint RecordingGLRenderingContext::getShaderParameter(
+  const std::unique_ptr<IGLShader>& shader, GLenum pname)
+{
+  _record("getShaderParameter",
+          {_handleOf(shader), static_cast<double>(pname)});
+  return compileSucceeds ? 1 : 0;
+}
+
+IGLShaderPrecisionFormat* RecordingGLRenderingContext::getShaderPrecisionFormat(
+  GLenum shadertype, GLenum precisiontype)
+{
+  _record("getShaderPrecisionFormat",
+          {static_cast<double>(shadertype),
+           static_cast<double>(precisiontype)});
+  return &_shaderPrecisionFormat;
+}
+
+std::string RecordingGLRenderingContext::getShaderSource(IGLShader* shader)
+{
+  _record("getShaderSource", {_handleOf(shader)});
+  if (shader && stl_util::contains(_shaderSources, shader->value)) {
+    return _shaderSources[shader->value];
+  }
+  return "";
+}
+
+GLuint RecordingGLRenderingContext::getUniformBlockIndex(
+  IGLProgram* program, const std::string& /*uniformBlockName*/)
+{
+  _record("getUniformBlockIndex", {_handleOf(program)});
+  return 0;
+}
+
+std::unique_ptr<IGLUniformLocation>
+RecordingGLRenderingContext::getUniformLocation(IGLProgram* program,
+                                                const std::string& name)
+{
+  _record("getUniformLocation", {_handleOf(program)});
+  if (!program) {
+    return nullptr;
+  }
+
+  // Uniforms get consecutive locations in order of first query
+  auto& locations = _uniformLocations[program->value];
+  if (!stl_util::contains(locations, name)) {
+    const auto location = static_cast<GLint>(locations.size());
+    locations[name]     = location;
+  }
+
+  return std::make_unique<IGLUniformLocation>(locations[name]);
+}
+
+void RecordingGLRenderingContext::hint(GLenum target, GLenum mode)
+{
+  _record("hint", {static_cast<double>(target), static_cast<double>(mode)});
+}
+
+GLboolean RecordingGLRenderingContext::isBuffer(IGLBuffer* buffer)
+{
+  _record("isBuffer", {_handleOf(buffer)});
+  return buffer != nullptr;
+}
+
+GLboolean RecordingGLRenderingContext::isEnabled(GLenum cap)
+{
+  _record("isEnabled", {static_cast<double>(cap)});
+  return stl_util::contains(_enabledCaps, cap);
+}
+
+GLboolean
+RecordingGLRenderingContext::isFramebuffer(IGLFramebuffer* framebuffer)
+{
+  _record("isFramebuffer", {_handleOf(framebuffer)});
+  return framebuffer != nullptr;
+}
+
+GLboolean RecordingGLRenderingContext::isProgram(
+  const std::unique_ptr<IGLProgram>& program)
+{
+  _record("isProgram", {_handleOf(program)});
+  return program != nullptr;
+}
+
+GLboolean
+RecordingGLRenderingContext::isRenderbuffer(IGLRenderbuffer* renderbuffer)
+{
+  _record("isRenderbuffer", {_handleOf(renderbuffer)});
+  return renderbuffer != nullptr;
+}
+
+GLboolean RecordingGLRenderingContext::isShader(IGLShader* shader)
+{
+  _record("isShader", {_handleOf(shader)});
+  return shader != nullptr;
+}
+
+GLboolean RecordingGLRenderingContext::isTexture(IGLTexture* texture)
+{
+  _record("isTexture", {_handleOf(texture)});
+  return texture != nullptr;
+}
+
+void RecordingGLRenderingContext::lineWidth(GLfloat width)
+{
+  _recordStateChange("lineWidth", {width});
+}
+
+bool RecordingGLRenderingContext::linkProgram(
+  const std::unique_ptr<IGLProgram>& program)
+{
+  ++_statistics.programLinks;
+  _record("linkProgram", {_handleOf(program)});
+  return compileSucceeds;
+}
+
+void RecordingGLRenderingContext::pixelStorei(GLenum pname, GLint param)
+{
+  _pixelStore[pname] = param;
+  _recordStateChange("pixelStorei",
+                     {static_cast<double>(pname), static_cast<double>(param)});
+}
+
+void RecordingGLRenderingContext::polygonOffset(GLfloat factor, GLfloat units)
+{
+  _recordStateChange("polygonOffset", {factor, units});
+}
+
+void RecordingGLRenderingContext::readBuffer(GLenum src)
+{
+  _recordStateChange("readBuffer", {static_cast<double>(src)});
+}
+
+void RecordingGLRenderingContext::readPixels(GLint x, GLint y, GLsizei width,
+                                             GLsizei height, GLenum format,
+                                             GLenum type, Float32Array& pixels)
+{
+  std::fill(pixels.begin(), pixels.end(), 0.f);
+  _record("readPixels",
+          {static_cast<double>(x), static_cast<double>(y),
+           static_cast<double>(width), static_cast<double>(height),
+           static_cast<double>(format), static_cast<double>(type)});
+}
+
+void RecordingGLRenderingContext::readPixels(GLint x, GLint y, GLsizei width,
+                                             GLsizei height, GLenum format,
+                                             GLenum type, Uint8Array& pixels)
+{
+  std::fill(pixels.begin(), pixels.end(), static_cast<uint8_t>(0));
+  _record("readPixels",
+          {static_cast<double>(x), static_cast<double>(y),
+           static_cast<double>(width), static_cast<double>(height),
+           static_cast<double>(format), static_cast<double>(type)});
+}
+
+void RecordingGLRenderingContext::renderbufferStorage(GLenum target,
+                                                      GLenum internalformat,
+                                                      GLsizei width,
+                                                      GLsizei height)
+{
+  _record("renderbufferStorage",
+          {static_cast<double>(target), static_cast<double>(internalformat),
+           static_cast<double>(width), static_cast<double>(height)});
+}
+
+void RecordingGLRenderingContext::renderbufferStorageMultisample(
+  GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width,
+  GLsizei height)
+{
+  _record("renderbufferStorageMultisample",
+          {static_cast<double>(target), static_cast<double>(samples),
+           static_cast<double>(internalFormat), static_cast<double>(width),
+           static_cast<double>(height)});
+}
+
+void RecordingGLRenderingContext::sampleCoverage(GLclampf value,
+                                                 GLboolean invert)
+{
+  _recordStateChange("sampleCoverage", {value, static_cast<double>(invert)});
+}
+
+void RecordingGLRenderingContext::scissor(GLint x, GLint y, GLsizei width,
+                                          GLsizei height)
+{
+  _scissorBox = {{x, y, width}};
+  _recordStateChange("scissor",
+                     {static_cast<double>(x), static_cast<double>(y),
+                      static_cast<double>(width), static_cast<double>(height)});
+}
+
+void RecordingGLRenderingContext::shaderSource(
+  const std::unique_ptr<IGLShader>& shader, const std::string& source)
+{
+  if (shader) {
+    _shaderSources[shader->value] = source;
+  }
+  _record("shaderSource",
+          {_handleOf(shader), static_cast<double>(source.size())});
+}
+
+void RecordingGLRenderingContext::stencilFunc(GLenum func, GLint ref,
+                                              GLuint mask)
+{
+  _recordStateChange("stencilFunc",
+                     {static_cast<double>(func), static_cast<double>(ref),
+                      static_cast<double>(mask)});
+}
+
+void RecordingGLRenderingContext::stencilFuncSeparate(GLenum face, GLenum func,
+                                                      GLint ref, GLuint mask)
+{
+  _recordStateChange("stencilFuncSeparate",
+                     {static_cast<double>(face), static_cast<double>(func),
+                      static_cast<double>(ref), static_cast<double>(mask)});
+}
+
+void RecordingGLRenderingContext::stencilMask(GLuint mask)
+{
+  _recordStateChange("stencilMask", {static_cast<double>(mask)});
+}
+
+void RecordingGLRenderingContext::stencilMaskSeparate(GLenum face, GLuint mask)
+{
+  _recordStateChange("stencilMaskSeparate",
+                     {static_cast<double>(face), static_cast<double>(mask)});
+}
+
+void RecordingGLRenderingContext::stencilOp(GLenum fail, GLenum zfail,
+                                            GLenum zpass)
+{
+  _recordStateChange("stencilOp",
+                     {static_cast<double>(fail), static_cast<double>(zfail),
+                      static_cast<double>(zpass)});
+}
+
+void RecordingGLRenderingContext::stencilOpSeparate(GLenum face, GLenum fail,
+                                                    GLenum zfail, GLenum zpass)
+{
+  _recordStateChange("stencilOpSeparate",
+                     {static_cast<double>(face), static_cast<double>(fail),
+                      static_cast<double>(zfail), static_cast<double>(zpass)});
+}
+
+void RecordingGLRenderingContext::texImage2D(
+  GLenum target, GLint /*level*/, GLint /*internalformat*/, GLsizei /*width*/,
+  GLsizei /*height*/, GLint /*border*/, GLenum /*format*/, GLenum /*type*/,
+  const Uint8Array& pixels)
+{
+  _recordTextureUpload("texImage2D", target, _byteLength(pixels));
+}
+
+void RecordingGLRenderingContext::texImage2D(GLenum target, GLint /*level*/,
+                                             GLint /*internalformat*/,
+                                             GLenum /*format*/,
+                                             GLenum /*type*/, ICanvas* pixels)
+{
+  const auto byteLength
+    = pixels ? static_cast<size_t>(pixels->width * pixels->height * 4) : 0;
+  _recordTextureUpload("texImage2D", target, byteLength);
+}
+
+void RecordingGLRenderingContext::texImage2D(
+  GLenum target, GLint /*level*/, GLint /*internalformat*/, GLsizei width,
+  GLsizei height, GLsizei /*border*/, GLenum /*format*/, GLenum /*type*/,
+  ICanvas* pixels)
+{
+  const auto byteLength
+    = pixels ? static_cast<size_t>(width * height * 4) : 0;
+  _recordTextureUpload("texImage2D", target, byteLength);
+}
+
+void RecordingGLRenderingContext::texImage3D(
+  GLenum target, GLint /*level*/, GLint /*internalformat*/, GLsizei /*width*/,
+  GLsizei /*height*/, GLsizei /*depth*/, GLint /*border*/, GLenum /*format*/,
+  GLenum /*type*/, const Uint8Array& pixels)
+{
+  _recordTextureUpload("texImage3D", target, _byteLength(pixels));
+}
+
+void RecordingGLRenderingContext::texParameterf(GLenum target, GLenum pname,
+                                                GLfloat param)
+{
+  _recordStateChange("texParameterf",
+                     {static_cast<double>(target), static_cast<double>(pname),
+                      param});
+}
+
+void RecordingGLRenderingContext::texParameteri(GLenum target, GLenum pname,
+                                                GLint param)
+{
+  _recordStateChange("texParameteri",
+                     {static_cast<double>(target), static_cast<double>(pname),
+                      static_cast<double>(param)});
+}
+
+void RecordingGLRenderingContext::texStorage3D(GLenum target, GLint levels,
+                                               GLenum internalformat,
+                                               GLsizei width, GLsizei height,
+                                               GLsizei depth)
+{
+  _record("texStorage3D",
+          {static_cast<double>(target), static_cast<double>(levels),
+           static_cast<double>(internalformat), static_cast<double>(width),
+           static_cast<double>(height), static_cast<double>(depth)});
+}
+
+void RecordingGLRenderingContext::texSubImage2D(
+  GLenum target, GLint /*level*/, GLint /*xoffset*/, GLint /*yoffset*/,
+  GLsizei width, GLsizei height, GLenum /*format*/, GLenum /*type*/,
+  any pixels)
+{
+  const auto byteLength
+    = pixels ? static_cast<size_t>(width * height * 4) : 0;
+  _recordTextureUpload("texSubImage2D", target, byteLength);
+}
+
+void RecordingGLRenderingContext::transformFeedbackVaryings(
+  IGLProgram* program, const std::vector<std::string>& varyings,
+  GLenum bufferMode)
+{
+  _record("transformFeedbackVaryings",
+          {_handleOf(program), static_cast<double>(varyings.size()),
+           static_cast<double>(bufferMode)});
+}
+
+void RecordingGLRenderingContext::uniform1f(IGLUniformLocation* location,
+                                            GLfloat /*v0*/)
+{
+  _recordUniform("uniform1f", location, 1);
+}
+
+void RecordingGLRenderingContext::uniform1fv(GL::IGLUniformLocation* location,
+                                             const Float32Array& array)
+{
+  _recordUniform("uniform1fv", location, array.size());
+}
+
+void RecordingGLRenderingContext::uniform1i(IGLUniformLocation* location,
+                                            GLint /*v0*/)
+{
+  _recordUniform("uniform1i", location, 1);
+}
+
+void RecordingGLRenderingContext::uniform1iv(IGLUniformLocation* location,
+                                             const Int32Array& v)
+{
+  _recordUniform("uniform1iv", location, v.size());
+}
+
+void RecordingGLRenderingContext::uniform2f(IGLUniformLocation* location,
+                                            GLfloat /*v0*/, GLfloat /*v1*/)
+{
+  _recordUniform("uniform2f", location, 2);
+}
+
+void RecordingGLRenderingContext::uniform2fv(IGLUniformLocation* location,
+                                             const Float32Array& v)
+{
+  _recordUniform("uniform2fv", location, v.size());
+}
+
+void RecordingGLRenderingContext::uniform2i(IGLUniformLocation* location,
+                                            GLint /*v0*/, GLint /*v1*/)
+{
+  _recordUniform("uniform2i", location, 2);
+}
+
+void RecordingGLRenderingContext::uniform2iv(IGLUniformLocation* location,
+                                             const Int32Array& v)
+{
+  _recordUniform("uniform2iv", location, v.size());
+}
+
+void RecordingGLRenderingContext::uniform3f(IGLUniformLocation* location,
+                                            GLfloat /*v0*/, GLfloat /*v1*/,
+                                            GLfloat /*v2*/)
+{
+  _recordUniform("uniform3f", location, 3);
+}
+
+void RecordingGLRenderingContext::uniform3fv(IGLUniformLocation* location,
+                                             const Float32Array& v)
+{
+  _recordUniform("uniform3fv", location, v.size());
+}
+
+void RecordingGLRenderingContext::uniform3i(IGLUniformLocation* location,
+                                            GLint /*v0*/, GLint /*v1*/,
+                                            GLint /*v2*/)
+{
+  _recordUniform("uniform3i", location, 3);
+}
+
+void RecordingGLRenderingContext::uniform3iv(IGLUniformLocation* location,
+                                             const Int32Array& v)
+{
+  _recordUniform("uniform3iv", location, v.size());
+}
+
+void RecordingGLRenderingContext::uniform4f(IGLUniformLocation* location,
+                                            GLfloat /*v0*/, GLfloat /*v1*/,
+                                            GLfloat /*v2*/, GLfloat /*v3*/)
+{
+  _recordUniform("uniform4f", location, 4);
+}
+
+void RecordingGLRenderingContext::uniform4fv(IGLUniformLocation* location,
+                                             const Float32Array& v)
+{
+  _recordUniform("uniform4fv", location, v.size());
+}
+
+void RecordingGLRenderingContext::uniform4i(IGLUniformLocation* location,
+                                            GLint /*v0*/, GLint /*v1*/,
+                                            GLint /*v2*/, GLint /*v3*/)
+{
+  _recordUniform("uniform4i", location, 4);
+}
+
+void RecordingGLRenderingContext::uniform4iv(IGLUniformLocation* location,
+                                             const Int32Array& v)
+{
+  _recordUniform("uniform4iv", location, v.size());
+}
+
+void RecordingGLRenderingContext::uniformBlockBinding(
+  IGLProgram* program, GLuint uniformBlockIndex, GLuint uniformBlockBinding)
+{
+  _recordStateChange("uniformBlockBinding",
+                     {_handleOf(program),
+                      static_cast<double>(uniformBlockIndex),
+                      static_cast<double>(uniformBlockBinding)});
+}
+
+void RecordingGLRenderingContext::uniformMatrix2fv(
+  IGLUniformLocation* location, GLboolean /*transpose*/,
+  const Float32Array& value)
+{
+  _recordUniform("uniformMatrix2fv", location, value.size());
+}
+
+void RecordingGLRenderingContext::uniformMatrix3fv(
+  IGLUniformLocation* location, GLboolean /*transpose*/,
+  const Float32Array& value)
+{
+  _recordUniform("uniformMatrix3fv", location, value.size());
+}
+
+void RecordingGLRenderingContext::uniformMatrix4fv(
+  IGLUniformLocation* location, GLboolean /*transpose*/,
+  const Float32Array& value)
+{
+  _recordUniform("uniformMatrix4fv", location, value.size());
+}
+
+void RecordingGLRenderingContext::uniformMatrix4fv(
+  IGLUniformLocation* location, GLboolean /*transpose*/,
+  const std::array<float, 16>& value)
+{
+  _recordUniform("uniformMatrix4fv", location, value.size());
+}
+
+void RecordingGLRenderingContext::useProgram(IGLProgram* program)
+{
+  ++_statistics.programBinds;
+  _recordStateChange("useProgram", {_handleOf(program)});
+}
+
+void RecordingGLRenderingContext::validateProgram(IGLProgram* program)
+{
+  _record("validateProgram", {_handleOf(program)});
+}
+
+void RecordingGLRenderingContext::vertexAttrib1f(GLuint index, GLfloat v0)
+{
+  _record("vertexAttrib1f", {static_cast<double>(index), v0});
+}
+
+void RecordingGLRenderingContext::vertexAttrib1fv(GLuint indx,
+                                                  Float32Array& values)
+{
+  _record("vertexAttrib1fv",
+          {static_cast<double>(indx), static_cast<double>(values.size())});
+}
+
+void RecordingGLRenderingContext::vertexAttrib2f(GLuint index, GLfloat v0,
+                                                 GLfloat v1)
+{
+  _record("vertexAttrib2f", {static_cast<double>(index), v0, v1});
+}
+
+void RecordingGLRenderingContext::vertexAttrib2fv(GLuint index,
+                                                  Float32Array& values)
+{
+  _record("vertexAttrib2fv",
+          {static_cast<double>(index), static_cast<double>(values.size())});
+}
+
+void RecordingGLRenderingContext::vertexAttrib3f(GLuint index, GLfloat v0,
+                                                 GLfloat v1, GLfloat v2)
+{
+  _record("vertexAttrib3f", {static_cast<double>(index), v0, v1, v2});
+}
+
+void RecordingGLRenderingContext::vertexAttrib3fv(GLuint index,
+                                                  Float32Array& values)
+{
+  _record("vertexAttrib3fv",
+          {static_cast<double>(index), static_cast<double>(values.size())});
+}
+
+void RecordingGLRenderingContext::vertexAttrib4f(GLuint index, GLfloat v0,
+                                                 GLfloat v1, GLfloat v2,
+                                                 GLfloat v3)
+{
+  _record("vertexAttrib4f", {static_cast<double>(index), v0, v1, v2, v3});
+}
+
+void RecordingGLRenderingContext::vertexAttrib4fv(GLuint index,
+                                                  Float32Array& values)
+{
+  _record("vertexAttrib4fv",
+          {static_cast<double>(index), static_cast<double>(values.size())});
+}
+
+void RecordingGLRenderingContext::vertexAttribDivisor(GLuint index,
+                                                      GLuint divisor)
+{
+  _recordStateChange("vertexAttribDivisor", {static_cast<double>(index),
+                                             static_cast<double>(divisor)});
+}
+
+void RecordingGLRenderingContext::vertexAttribPointer(GLuint index, GLint size,
+                                                      GLenum type,
+                                                      GLboolean normalized,
+                                                      GLint stride,
+                                                      GLintptr offset)
+{
+  _recordStateChange("vertexAttribPointer",
+                     {static_cast<double>(index), static_cast<double>(size),
+                      static_cast<double>(type),
+                      static_cast<double>(normalized),
+                      static_cast<double>(stride),
+                      static_cast<double>(offset)});
+}
+
+void RecordingGLRenderingContext::viewport(GLint x, GLint y, GLsizei width,
+                                           GLsizei height)
+{
+  _recordStateChange("viewport",
+                     {static_cast<double>(x), static_cast<double>(y),
+                      static_cast<double>(width), static_cast<double>(height)});
+}
+
+} // end of namespace GL
+} // end of namespace BABYLON
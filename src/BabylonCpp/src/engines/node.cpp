@@ -306,6 +306,11 @@ void Node::_markSyncedWithParent()
   }
 }
 
+bool Node::_isSyncedWithParentUpdate() const
+{
+  return !_parentNode || _parentUpdateId == _parentNode->_childUpdateId;
+}
+
 bool Node::isSynchronizedWithParent() const
 {
   if (!_parentNode) {
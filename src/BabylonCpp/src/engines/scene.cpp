@@ -19,13 +19,17 @@
 #include <babylon/collisions/collision_coordinator.h>
 #include <babylon/collisions/icollision_coordinator.h>
 #include <babylon/core/logging.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/culling/bounding_box.h>
 #include <babylon/culling/bounding_info.h>
+#include <babylon/culling/mesh_bvh.h>
 #include <babylon/culling/octrees/octree_scene_component.h>
+#include <babylon/culling/packed_frustum_culler.h>
 #include <babylon/culling/ray.h>
 #include <babylon/debug/debug_layer.h>
 #include <babylon/engines/constants.h>
 #include <babylon/engines/engine.h>
+#include <babylon/engines/iactive_mesh_candidate_provider.h>
 #include <babylon/engines/iscene_component.h>
 #include <babylon/engines/iscene_serializable_component.h>
 #include <babylon/events/keyboard_event_types.h>
@@ -62,6 +66,7 @@
 #include <babylon/meshes/mesh_simplification_scene_component.h>
 #include <babylon/meshes/simplification/simplification_queue.h>
 #include <babylon/meshes/sub_mesh.h>
+#include <babylon/meshes/transform_hierarchy.h>
 #include <babylon/meshes/vertex_buffer.h>
 #include <babylon/misc/tools.h>
 #include <babylon/morph/morph_target_manager.h>
@@ -84,6 +89,42 @@
 
 namespace BABYLON {
 
+namespace {
+
+// States of the active mesh candidates evaluated in parallel
+constexpr uint8_t ACTIVEMESH_CANDIDATE_PENDING   = 1;
+constexpr uint8_t ACTIVEMESH_CANDIDATE_EVALUATED = 2;
+constexpr uint8_t ACTIVEMESH_CANDIDATE_SELECTED  = 4;
+
+// Number of candidates evaluated per worker task
+constexpr size_t ACTIVEMESH_CANDIDATES_GRAIN_SIZE = 256;
+
+// Number of skeletons prepared per worker task
+constexpr size_t ACTIVE_SKELETONS_GRAIN_SIZE = 1;
+
+// Number of rays of a picking batch traced per worker task
+constexpr size_t PICK_BATCH_GRAIN_SIZE = 64;
+
+// Mesh of a picking batch and its data, prepared before tracing the rays
+struct PickBatchCandidate {
+  AbstractMesh* mesh;
+  Matrix world;
+  Matrix inverseWorld;
+  IndicesArray indices;
+  std::vector<SubMesh*> subMeshes;
+}; // end of struct PickBatchCandidate
+
+bool _isSelectedAsActiveMesh(AbstractMesh* mesh, Camera* camera,
+                             const std::array<Plane, 6>& frustumPlanes)
+{
+  return mesh->isVisible && mesh->visibility > 0
+         && (mesh->alwaysSelectAsActiveMesh
+             || ((mesh->layerMask & camera->layerMask) != 0
+                 && mesh->isInFrustum(frustumPlanes)));
+}
+
+} // end of anonymous namespace
+
 size_t Scene::_uniqueIdCounter = 0;
 
 microseconds_t Scene::MinDeltaTime = std::chrono::milliseconds(1);
@@ -179,6 +220,12 @@ Scene::Scene(Engine* engine, const std::optional<SceneOptions>& options)
     , _cachedEffect{nullptr}
     , _cachedVisibility{0.f}
     , dispatchAllSubMeshesOfActiveMeshes{false}
+    , parallelActiveMeshesEvaluation{false}
+    , parallelActiveMeshesEvaluationThreshold{1024}
+    , packedFrustumCulling{false}
+    , packedFrustumCullingThreshold{256}
+    , parallelSkeletonsEvaluation{false}
+    , useTransformHierarchy{false}
     , _forcedViewPosition{nullptr}
     , _isAlternateRenderingEnabled{this,
                                    &Scene::get_isAlternateRenderingEnabled}
@@ -2142,9 +2189,9 @@ AnimationValue Scene::_processLateAnimationBindingsForMatrices(
   Matrix& holderOriginalValue)
 {
   auto normalizer         = 1.f;
-  auto& finalPosition     = Tmp::Vector3Array[0];
-  auto& finalScaling      = Tmp::Vector3Array[1];
-  auto& finalQuaternion   = Tmp::QuaternionArray[0];
+  auto& finalPosition     = Tmp::Vector3Array()[0];
+  auto& finalScaling      = Tmp::Vector3Array()[1];
+  auto& finalQuaternion   = Tmp::QuaternionArray()[0];
   auto startIndex         = 0u;
   auto& originalAnimation = holderAnimations[0];
   auto& originalValue     = holderOriginalValue;
@@ -2176,9 +2223,9 @@ AnimationValue Scene::_processLateAnimationBindingsForMatrices(
        ++animIndex) {
     auto& runtimeAnimation  = holderAnimations[animIndex];
     auto iScale             = runtimeAnimation->weight / normalizer;
-    auto& currentPosition   = Tmp::Vector3Array[2];
-    auto& currentScaling    = Tmp::Vector3Array[3];
-    auto& currentQuaternion = Tmp::QuaternionArray[1];
+    auto& currentPosition   = Tmp::Vector3Array()[2];
+    auto& currentScaling    = Tmp::Vector3Array()[3];
+    auto& currentQuaternion = Tmp::QuaternionArray()[1];
 
     (*runtimeAnimation->currentValue())
       .get<Matrix>()
@@ -2327,9 +2374,9 @@ void Scene::setTransformMatrix(Matrix& view, Matrix& projection)
   /*if (activeCamera && activeCamera->_alternateCamera) {
     auto& otherCamera = activeCamera->_alternateCamera;
     otherCamera->getViewMatrix().multiplyToRef(
-      otherCamera->getProjectionMatrix(), Tmp::MatrixArray[0]);
+      otherCamera->getProjectionMatrix(), Tmp::MatrixArray()[0]);
     // Replace right plane by second camera right plane
-    Frustum::GetRightPlaneToRef(Tmp::MatrixArray[0], _frustumPlanes[3]);
+    Frustum::GetRightPlaneToRef(Tmp::MatrixArray()[0], _frustumPlanes[3]);
   }*/
 
   if (_sceneUbo->useUbo()) {
@@ -2981,12 +3028,16 @@ bool Scene::removeGeometry(Geometry* geometry)
     index = static_cast<size_t>(it - geometries.begin());
   }
 
+  // the scene may hold the last reference to the removed geometry
+  auto removedGeometry = geometries[index];
+  if (!geometriesById.empty()) {
+    geometriesById.erase(geometry->id);
+  }
   if (index != geometries.size() - 1) {
     auto lastGeometry = geometries.back();
     geometries[index] = lastGeometry;
     if (!geometriesById.empty()) {
       geometriesById[lastGeometry->id] = index;
-      geometriesById.erase(geometry->id);
     }
   }
 
@@ -3391,28 +3442,80 @@ void Scene::_evaluateActiveMeshes()
   _processedMaterials.clear();
   _activeParticleSystems.clear();
   _activeSkeletons.clear();
+  _activeSkeletonsSet.clear();
   _softwareSkinnedMeshes.clear();
+  _softwareSkinnedMeshesSet.clear();
 
   for (const auto& step : _beforeEvaluateActiveMeshStage) {
     step.action();
   }
 
+  // Update the world matrices of the dirty subtrees in a single pass
+  TransformHierarchy* transformHierarchy = nullptr;
+  if (useTransformHierarchy) {
+    if (!_transformHierarchy) {
+      _transformHierarchy = std::make_unique<TransformHierarchy>(this);
+    }
+    transformHierarchy = _transformHierarchy.get();
+    transformHierarchy->update();
+  }
+
   // Determine mesh candidates
-  auto _meshes = getActiveMeshCandidates();
+  auto checkIsEnabled = true;
+  std::vector<AbstractMesh*> _meshes;
+  if (_activeMeshCandidateProvider) {
+    _meshes        = _activeMeshCandidateProvider->getMeshes(this);
+    checkIsEnabled = !_activeMeshCandidateProvider->checksIsEnabled();
+  }
+  else {
+    _meshes = getActiveMeshCandidates();
+  }
+
+  // World matrices and frustum tests computed ahead on the worker threads
+  const auto parallelEvaluation
+    = parallelActiveMeshesEvaluation
+      && _meshes.size() >= parallelActiveMeshesEvaluationThreshold;
+  if (parallelEvaluation) {
+    _evaluateActiveMeshCandidatesInParallel(_meshes, transformHierarchy);
+  }
+
+  // Or frustum tests batched over the packed bounding volumes
+  const auto packedEvaluation
+    = !parallelEvaluation && packedFrustumCulling
+      && _meshes.size() >= packedFrustumCullingThreshold;
+  if (packedEvaluation) {
+    _evaluateActiveMeshCandidatesPacked(_meshes, transformHierarchy,
+                                        checkIsEnabled);
+  }
 
   // Check each mesh
-  for (auto& mesh : _meshes) {
-    if (mesh->isBlocked()) {
-      continue;
+  for (size_t index = 0; index < _meshes.size(); ++index) {
+    auto& mesh = _meshes[index];
+
+    uint8_t state = 0;
+    if (parallelEvaluation || packedEvaluation) {
+      state = _activeMeshCandidateStates[index];
+      if (!(state & ACTIVEMESH_CANDIDATE_PENDING)) {
+        continue;
+      }
     }
+    else {
+      if (mesh->isBlocked()) {
+        continue;
+      }
 
-    _totalVertices.addCount(mesh->getTotalVertices(), false);
+      _totalVertices.addCount(mesh->getTotalVertices(), false);
 
-    if (!mesh->isReady() || !mesh->isEnabled()) {
-      continue;
+      if (!mesh->isReady() || (checkIsEnabled && !mesh->isEnabled())) {
+        continue;
+      }
     }
 
-    mesh->computeWorldMatrix();
+    const auto evaluated = (state & ACTIVEMESH_CANDIDATE_EVALUATED) != 0;
+    if (!evaluated
+        && !(transformHierarchy && transformHierarchy->isUpToDate(mesh))) {
+      mesh->computeWorldMatrix();
+    }
 
     // Intersections
     if (mesh->actionManager
@@ -3434,10 +3537,11 @@ void Scene::_evaluateActiveMeshes()
 
     mesh->_preActivate();
 
-    if (mesh->isVisible && mesh->visibility > 0
-        && (mesh->alwaysSelectAsActiveMesh
-            || ((mesh->layerMask & activeCamera->layerMask) != 0
-                && mesh->isInFrustum(_frustumPlanes)))) {
+    const auto isSelected
+      = evaluated ?
+          (state & ACTIVEMESH_CANDIDATE_SELECTED) != 0 :
+          _isSelectedAsActiveMesh(mesh, activeCamera.get(), _frustumPlanes);
+    if (isSelected) {
       _activeMeshes.emplace_back(mesh);
       activeCamera->_activeMeshes.emplace_back(_activeMeshes.back());
 
@@ -3450,6 +3554,10 @@ void Scene::_evaluateActiveMeshes()
     }
   }
 
+  if (_skeletonsEnabled && parallelSkeletonsEvaluation) {
+    _prepareActiveSkeletonsInParallel();
+  }
+
   onAfterActiveMeshesEvaluationObservable.notifyObservers(this);
 
   // Particle systems
@@ -3471,21 +3579,196 @@ void Scene::_evaluateActiveMeshes()
   }
 }
 
+void Scene::_evaluateActiveMeshCandidatesInParallel(
+  std::vector<AbstractMesh*>& meshes, TransformHierarchy* transformHierarchy)
+{
+  _activeMeshCandidateStates.assign(meshes.size(), 0);
+
+  // Readiness checks may compile effects: they stay on the calling thread
+  for (size_t index = 0; index < meshes.size(); ++index) {
+    auto& mesh = meshes[index];
+    if (mesh->isBlocked()) {
+      continue;
+    }
+
+    _totalVertices.addCount(mesh->getTotalVertices(), false);
+
+    if (!mesh->isReady() || !mesh->isEnabled()) {
+      continue;
+    }
+
+    _activeMeshCandidateStates[index] = ACTIVEMESH_CANDIDATE_PENDING;
+  }
+
+  // Data-parallel phase, limited to the meshes whose world matrix and frustum
+  // test only touch their own state. The others are evaluated by the serial
+  // merge in _evaluateActiveMeshes
+  auto camera = activeCamera.get();
+  ThreadPool::Default().parallelFor(
+    meshes.size(), ACTIVEMESH_CANDIDATES_GRAIN_SIZE,
+    [this, &meshes, camera, transformHierarchy](size_t begin, size_t end) {
+      for (auto index = begin; index < end; ++index) {
+        auto& state = _activeMeshCandidateStates[index];
+        auto& mesh  = meshes[index];
+        if (state != ACTIVEMESH_CANDIDATE_PENDING
+            || !mesh->_canBeEvaluatedConcurrently()) {
+          continue;
+        }
+
+        if (!(transformHierarchy && transformHierarchy->isUpToDate(mesh))) {
+          mesh->computeWorldMatrix();
+        }
+        state |= ACTIVEMESH_CANDIDATE_EVALUATED;
+        if (_isSelectedAsActiveMesh(mesh, camera, _frustumPlanes)) {
+          state |= ACTIVEMESH_CANDIDATE_SELECTED;
+        }
+      }
+    });
+}
+
+void Scene::_evaluateActiveMeshCandidatesPacked(
+  std::vector<AbstractMesh*>& meshes, TransformHierarchy* transformHierarchy,
+  bool checkIsEnabled)
+{
+  _activeMeshCandidateStates.assign(meshes.size(), 0);
+  if (!_packedFrustumCuller) {
+    _packedFrustumCuller = std::make_unique<PackedFrustumCuller>();
+  }
+  _packedFrustumCuller->reset(meshes.size());
+  _packedCandidateIndices.clear();
+
+  auto camera = activeCamera.get();
+  for (size_t index = 0; index < meshes.size(); ++index) {
+    auto& mesh = meshes[index];
+    if (mesh->isBlocked()) {
+      continue;
+    }
+
+    _totalVertices.addCount(mesh->getTotalVertices(), false);
+
+    if (!mesh->isReady() || (checkIsEnabled && !mesh->isEnabled())) {
+      continue;
+    }
+
+    auto& state = _activeMeshCandidateStates[index];
+    state       = ACTIVEMESH_CANDIDATE_PENDING | ACTIVEMESH_CANDIDATE_EVALUATED;
+    if (!(transformHierarchy && transformHierarchy->isUpToDate(mesh))) {
+      mesh->computeWorldMatrix();
+    }
+
+    // Same tests as _isSelectedAsActiveMesh, the frustum test being deferred
+    if (!mesh->isVisible || mesh->visibility <= 0) {
+      continue;
+    }
+    if (mesh->alwaysSelectAsActiveMesh) {
+      state |= ACTIVEMESH_CANDIDATE_SELECTED;
+      continue;
+    }
+    if ((mesh->layerMask & camera->layerMask) == 0) {
+      continue;
+    }
+
+    const auto& boundingInfo = mesh->getBoundingInfo();
+    if (boundingInfo && mesh->_hasStandardFrustumTest()) {
+      _packedFrustumCuller->add(*boundingInfo);
+      _packedCandidateIndices.emplace_back(index);
+    }
+    else if (mesh->isInFrustum(_frustumPlanes)) {
+      state |= ACTIVEMESH_CANDIDATE_SELECTED;
+    }
+  }
+
+  _packedFrustumCuller->cull(_frustumPlanes, _packedCandidateVisibilities);
+  for (size_t i = 0; i < _packedCandidateIndices.size(); ++i) {
+    if (_packedCandidateVisibilities[i]) {
+      _activeMeshCandidateStates[_packedCandidateIndices[i]]
+        |= ACTIVEMESH_CANDIDATE_SELECTED;
+    }
+  }
+}
+
+void Scene::_prepareActiveSkeletonsInParallel()
+{
+  // Linked transform nodes, matrices storage and observers stay on the calling
+  // thread
+  std::vector<Skeleton*> skeletons;
+  for (const auto& skeleton : _activeSkeletons) {
+    if (skeleton->_beginPrepare()) {
+      skeletons.emplace_back(skeleton.get());
+    }
+  }
+
+  // The bones parented to the bones of another skeleton read their world
+  // matrices: the skeletons are computed one dependency level at a time
+  std::unordered_map<Skeleton*, size_t> levels;
+  for (auto skeleton : skeletons) {
+    levels[skeleton] = 0;
+  }
+  std::vector<std::vector<Skeleton*>> parentSkeletons(skeletons.size());
+  auto hasDependencies = false;
+  for (size_t i = 0; i < skeletons.size(); ++i) {
+    skeletons[i]->_getParentSkeletons(parentSkeletons[i]);
+    stl_util::erase_if(parentSkeletons[i], [&levels](Skeleton* skeleton) {
+      return !stl_util::contains(levels, skeleton);
+    });
+    hasDependencies = hasDependencies || !parentSkeletons[i].empty();
+  }
+
+  size_t levelCount = 1;
+  // A skeleton is at most at the level of the number of skeletons, even when
+  // the bones form a cycle
+  for (size_t pass = 0; hasDependencies && pass < skeletons.size(); ++pass) {
+    auto changed = false;
+    for (size_t i = 0; i < skeletons.size(); ++i) {
+      auto& level = levels[skeletons[i]];
+      for (auto parentSkeleton : parentSkeletons[i]) {
+        if (levels[parentSkeleton] + 1 > level) {
+          level      = levels[parentSkeleton] + 1;
+          levelCount = std::max(levelCount, level + 1);
+          changed    = true;
+        }
+      }
+    }
+    if (!changed) {
+      break;
+    }
+  }
+
+  std::vector<std::vector<Skeleton*>> skeletonsPerLevel(levelCount);
+  for (auto skeleton : skeletons) {
+    skeletonsPerLevel[std::min(levels[skeleton], levelCount - 1)].emplace_back(
+      skeleton);
+  }
+
+  for (const auto& levelSkeletons : skeletonsPerLevel) {
+    ThreadPool::Default().parallelFor(
+      levelSkeletons.size(), ACTIVE_SKELETONS_GRAIN_SIZE,
+      [&levelSkeletons](size_t begin, size_t end) {
+        for (auto index = begin; index < end; ++index) {
+          levelSkeletons[index]->_computeBoneMatrices();
+        }
+      });
+  }
+
+  for (auto& skeleton : skeletons) {
+    skeleton->_endPrepare();
+  }
+}
+
 void Scene::_activeMesh(AbstractMesh* sourceMesh, AbstractMesh* mesh)
 {
   if (_skeletonsEnabled && mesh->skeleton()) {
-    if (std::find(_activeSkeletons.begin(), _activeSkeletons.end(),
-                  mesh->skeleton())
-        == _activeSkeletons.end()) {
+    if (_activeSkeletonsSet.insert(mesh->skeleton().get()).second) {
       _activeSkeletons.emplace_back(mesh->skeleton());
-      mesh->skeleton()->prepare();
+      // Deferred to _prepareActiveSkeletonsInParallel
+      if (!parallelSkeletonsEvaluation) {
+        mesh->skeleton()->prepare();
+      }
     }
 
     if (!mesh->computeBonesUsingShaders()) {
       if (auto _mesh = static_cast<Mesh*>(mesh)) {
-        if (std::find(_softwareSkinnedMeshes.begin(),
-                      _softwareSkinnedMeshes.end(), _mesh)
-            == _softwareSkinnedMeshes.end()) {
+        if (_softwareSkinnedMeshesSet.insert(_mesh).second) {
           _softwareSkinnedMeshes.emplace_back(_mesh);
         }
       }
@@ -4094,7 +4377,10 @@ void Scene::dispose()
   _processedMaterials.clear();
   _activeParticleSystems.clear();
   _activeSkeletons.clear();
+  _activeSkeletonsSet.clear();
   _softwareSkinnedMeshes.clear();
+  _softwareSkinnedMeshesSet.clear();
+  _transformHierarchy.reset();
   _renderTargets.clear();
   _registeredForLateAnimationBindings.clear();
   _meshesForIntersections.clear();
@@ -4640,6 +4926,107 @@ std::optional<PickingInfo> Scene::pickWithRay(
   return result;
 }
 
+std::vector<RayHit> Scene::pickBatch(
+  const std::vector<Ray>& rays,
+  const std::function<bool(const AbstractMeshPtr& mesh)>& predicate,
+  bool fastCheck,
+  const std::function<bool(const Vector3& p0, const Vector3& p1,
+                           const Vector3& p2, const Ray& ray)>&
+    trianglePredicate)
+{
+  std::vector<RayHit> hits(rays.size());
+
+  // Gather the pickable meshes once for the whole batch. The data computed
+  // lazily by the meshes is prepared here, the worker threads only read it.
+  std::vector<PickBatchCandidate> candidates;
+  std::vector<MinMax> bounds;
+  for (const auto& mesh : meshes) {
+    if (predicate) {
+      if (!predicate(mesh)) {
+        continue;
+      }
+    }
+    else if (!mesh->isEnabled() || !mesh->isVisible || !mesh->isPickable) {
+      continue;
+    }
+
+    const auto& boundingInfo = mesh->getBoundingInfo();
+    if (mesh->subMeshes.empty() || !boundingInfo
+        || !mesh->_generatePointsArray()) {
+      continue;
+    }
+    mesh->_getBVH();
+
+    PickBatchCandidate candidate;
+    candidate.mesh  = mesh.get();
+    candidate.world = mesh->getWorldMatrix();
+    candidate.world.invertToRef(candidate.inverseWorld);
+    candidate.indices = mesh->getIndices();
+    for (const auto& subMesh : mesh->subMeshes) {
+      subMesh->getMaterial();
+      candidate.subMeshes.emplace_back(subMesh.get());
+    }
+    candidates.emplace_back(std::move(candidate));
+
+    const auto& boundingBox = boundingInfo->boundingBox;
+    bounds.push_back({boundingBox.minimumWorld, boundingBox.maximumWorld});
+  }
+
+  if (candidates.empty()) {
+    return hits;
+  }
+
+  const MeshBVH meshesBVH(bounds);
+
+  ThreadPool::Default().parallelFor(
+    rays.size(), PICK_BATCH_GRAIN_SIZE, [&](size_t begin, size_t end) {
+      auto localRay = Ray::Zero();
+      for (auto i = begin; i < end; ++i) {
+        const auto& ray            = rays[i];
+        auto& hit                  = hits[i];
+        const auto directionLength = ray.direction.length();
+
+        // Meshes are visited from the nearest, the farther ones being skipped
+        // once a closer hit is found
+        meshesBVH.forEachRayCandidate(ray, [&](size_t index) -> float {
+          const auto& meshBounds = bounds[index];
+          if (!ray.intersectsBoxMinMax(meshBounds.min, meshBounds.max)) {
+            return ray.length;
+          }
+
+          auto& candidate = candidates[index];
+          Ray::TransformToRef(ray, candidate.inverseWorld, localRay);
+          const auto intersectInfo = candidate.mesh->_intersectSubMeshes(
+            localRay, candidate.subMeshes, candidate.indices, fastCheck,
+            trianglePredicate);
+          if (!intersectInfo) {
+            return ray.length;
+          }
+
+          const auto distance
+            = Vector3::TransformNormal(
+                localRay.direction.scale(intersectInfo->distance),
+                candidate.world)
+                .length();
+          if (hit.hit() && distance >= hit.distance) {
+            return ray.length;
+          }
+
+          hit.mesh      = candidate.mesh;
+          hit.faceId    = intersectInfo->faceId;
+          hit.subMeshId = intersectInfo->subMeshId;
+          hit.distance  = distance;
+          hit.bu        = intersectInfo->bu.value_or(0.f);
+          hit.bv        = intersectInfo->bv.value_or(0.f);
+
+          return fastCheck ? -1.f : distance / directionLength;
+        });
+      }
+    });
+
+  return hits;
+}
+
 std::vector<std::optional<PickingInfo>>
 Scene::multiPick(int x, int y,
                  const std::function<bool(AbstractMesh* mesh)>& predicate,
@@ -5045,9 +5432,9 @@ void Scene::_updateMultiviewUbo(std::optional<Matrix> viewR,
   }
 
   if (viewR && projectionR) {
-    viewR->multiplyToRef(*projectionR, Tmp::MatrixArray[0]);
+    viewR->multiplyToRef(*projectionR, Tmp::MatrixArray()[0]);
     Frustum::GetRightPlaneToRef(
-      Tmp::MatrixArray[0],
+      Tmp::MatrixArray()[0],
       _frustumPlanes[3]); // Replace right plane by second camera right plane
   }
 
@@ -67,6 +67,10 @@ SceneInstrumentation::SceneInstrumentation(Scene* iScene)
     , drawCallsCounter{this, &SceneInstrumentation::get_drawCallsCounter}
     , textureCollisionsCounter{this, &SceneInstrumentation::
                                        get_textureCollisionsCounter}
+    , captureProfile{this, &SceneInstrumentation::get_captureProfile,
+                     &SceneInstrumentation::set_captureProfile}
+    , frameProfileSummaries{this,
+                            &SceneInstrumentation::get_frameProfileSummaries}
     , _captureActiveMeshesEvaluationTime{false}
     , _captureRenderTargetsRenderTime{false}
     , _captureFrameTime{false}
@@ -77,6 +81,7 @@ SceneInstrumentation::SceneInstrumentation(Scene* iScene)
     , _capturePhysicsTime{false}
     , _captureAnimationsTime{false}
     , _captureCameraRenderTime{false}
+    , _captureProfile{false}
     , _onBeforeActiveMeshesEvaluationObserver{nullptr}
     , _onAfterActiveMeshesEvaluationObserver{nullptr}
     , _onBeforeRenderTargetsRenderObserver{nullptr}
@@ -146,6 +151,10 @@ SceneInstrumentation::SceneInstrumentation(Scene* iScene)
       if (_captureInterFrameTime) {
         _interFrameTime.beginMonitoring();
       }
+
+      if (_captureProfile) {
+        _frameProfileSummaries = Profiler::Default().endFrame().summaries;
+      }
     });
 }
 
@@ -521,6 +530,28 @@ PerfCounter& SceneInstrumentation::get_textureCollisionsCounter()
   return scene->getEngine()->_textureCollisions;
 }
 
+bool SceneInstrumentation::get_captureProfile() const
+{
+  return _captureProfile;
+}
+
+void SceneInstrumentation::set_captureProfile(bool value)
+{
+  if (value == _captureProfile) {
+    return;
+  }
+
+  _captureProfile = value;
+  _frameProfileSummaries.clear();
+
+  Profiler::Default().setEnabled(value);
+}
+
+std::vector<ProfileSummary>& SceneInstrumentation::get_frameProfileSummaries()
+{
+  return _frameProfileSummaries;
+}
+
 void SceneInstrumentation::dispose(bool /*doNotRecurse*/,
                                    bool /*disposeMaterialAndTextures*/)
 {
@@ -583,6 +614,8 @@ void SceneInstrumentation::dispose(bool /*doNotRecurse*/,
   scene->onAfterCameraRenderObservable.remove(_onAfterCameraRenderObserver);
   _onAfterCameraRenderObserver = nullptr;
 
+  set_captureProfile(false);
+
   scene = nullptr;
 }
 
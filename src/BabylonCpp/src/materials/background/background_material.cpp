@@ -923,15 +923,12 @@ bool BackgroundMaterial::isReadyForSubMesh(AbstractMesh* mesh,
       bindSceneUniformBuffer(effect, getScene()->getSceneUniformBuffer());
     };
 
-    auto join = defines.toString();
-
     EffectCreationOptions options;
     options.attributes            = std::move(attribs);
     options.uniformsNames         = std::move(uniforms);
     options.uniformBuffersNames   = std::move(uniformBuffers);
     options.samplers              = std::move(samplers);
     options.materialDefines       = &defines;
-    options.defines               = std::move(join);
     options.fallbacks             = std::move(fallbacks);
     options.onCompiled            = iOnCompiled;
     options.onError               = onError;
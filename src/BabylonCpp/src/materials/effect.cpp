@@ -1,5 +1,7 @@
 #include <babylon/materials/effect.h>
 
+#include <algorithm>
+#include <mutex>
 #include <sstream>
 
 #include <babylon/babylon_stl_util.h>
@@ -31,6 +33,24 @@ std::unordered_map<std::string, std::string>& Effect::IncludesShadersStore()
   return EffectIncludesShadersStore().shaders();
 }
 
+namespace {
+
+/**
+ * @brief Process wide registry of the uniform ids.
+ */
+struct UniformIdRegistry {
+  std::mutex mutex;
+  std::unordered_map<std::string, size_t> ids;
+};
+
+UniformIdRegistry& GetUniformIdRegistry()
+{
+  static UniformIdRegistry registry;
+  return registry;
+}
+
+} // end of anonymous namespace
+
 std::size_t Effect::_uniqueIdSeed = 0;
 std::unordered_map<unsigned int, GL::IGLBuffer*> Effect::_baseCache{};
 
@@ -57,6 +77,7 @@ Effect::Effect(const std::string& baseName, EffectCreationOptions& options,
     , _transformFeedbackVaryings{options.transformFeedbackVaryings}
 {
   stl_util::concat(_uniformsNames, options.samplers);
+  _initializeUniformIndices();
 
   if (!options.uniformBuffersNames.empty()) {
     for (unsigned int i = 0; i < options.uniformBuffersNames.size(); ++i) {
@@ -131,6 +152,7 @@ Effect::Effect(const std::unordered_map<std::string, std::string>& baseName,
     , _transformFeedbackVaryings{options.transformFeedbackVaryings}
 {
   stl_util::concat(_uniformsNames, options.samplers);
+  _initializeUniformIndices();
 
   if (!options.uniformBuffersNames.empty()) {
     for (unsigned int i = 0; i < options.uniformBuffersNames.size(); ++i) {
@@ -262,9 +284,48 @@ size_t Effect::getAttributesCount()
   return _attributes.size();
 }
 
+UniformId Effect::GetUniformId(const std::string& uniformName)
+{
+  auto& registry = GetUniformIdRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+
+  auto it = registry.ids.find(uniformName);
+  if (it != registry.ids.end()) {
+    return UniformId{it->second};
+  }
+
+  const UniformId uniformId{registry.ids.size()};
+  registry.ids[uniformName] = uniformId.value;
+
+  return uniformId;
+}
+
+void Effect::_initializeUniformIndices()
+{
+  _uniformIndices.clear();
+  _uniformIndicesById.clear();
+
+  for (size_t index = 0; index < _uniformsNames.size(); ++index) {
+    const auto& uniformName = _uniformsNames[index];
+    if (stl_util::contains(_uniformIndices, uniformName)) {
+      continue;
+    }
+
+    const auto id = Effect::GetUniformId(uniformName).value;
+    if (id >= _uniformIndicesById.size()) {
+      _uniformIndicesById.resize(id + 1, -1);
+    }
+    _uniformIndicesById[id]      = static_cast<int>(index);
+    _uniformIndices[uniformName] = static_cast<int>(index);
+  }
+
+  _uniformLocations.assign(_uniformsNames.size(), nullptr);
+  _uniformValueCache.assign(_uniformsNames.size(), UniformValueCache{});
+}
+
 int Effect::getUniformIndex(const std::string& uniformName)
 {
-  return stl_util::index_of(_uniformsNames, uniformName);
+  return _getUniformIndex(uniformName);
 }
 
 GL::IGLUniformLocation* Effect::getUniform(const std::string& uniformName)
@@ -648,17 +709,19 @@ void Effect::_rebuildProgram(
 
   _vertexSourceCodeOverride   = vertexSourceCode;
   _fragmentSourceCodeOverride = fragmentSourceCode;
-  onError = [&](const Effect* /*effect*/, const std::string& error) {
+  // The callbacks are kept by the effect, they must not reference the
+  // arguments
+  onError = [iOnError](const Effect* /*effect*/, const std::string& error) {
     if (iOnError) {
       iOnError(error);
     }
   };
-  this->onCompiled = [&](const Effect* /*effect*/) {
+  this->onCompiled = [this, iOnCompiled](const Effect* /*effect*/) {
     for (auto& scene : getEngine()->scenes) {
       scene->markAllMaterialsAsDirty(Material::TextureDirtyFlag);
     }
 
-    if (onCompiled) {
+    if (iOnCompiled) {
       iOnCompiled(_program.get());
     }
   };
@@ -677,7 +740,8 @@ void Effect::_prepareEffect()
   auto attributesNames = _attributesNames;
   auto& _defines       = defines;
   auto& fallbacks      = _fallbacks;
-  _valueCache.clear();
+  std::fill(_uniformValueCache.begin(), _uniformValueCache.end(),
+            UniformValueCache{});
 
   auto& previousProgram = _program;
 
@@ -719,6 +783,9 @@ void Effect::_prepareEffect()
 
     _uniforms   = engine->getUniforms(_program.get(), _uniformsNames);
     _attributes = engine->getAttributes(_program.get(), attributesNames);
+    for (size_t index = 0; index < _uniformsNames.size(); ++index) {
+      _uniformLocations[index] = getUniform(_uniformsNames[index]);
+    }
 
     for (unsigned int index = 0; index < _samplers.size(); ++index) {
       auto sampler = getUniform(_samplers[index]);
@@ -765,7 +832,7 @@ void Effect::_prepareEffect()
       onErrorObservable.notifyObservers(this);
     }
 
-    if (!fallbacks && fallbacks->isMoreFallbacks()) {
+    if (fallbacks && fallbacks->isMoreFallbacks()) {
       BABYLON_LOG_ERROR("Effect", "Trying next fallback.")
       defines = fallbacks->reduce(defines, this);
       _prepareEffect();
@@ -839,97 +906,65 @@ void Effect::setTextureFromPostProcessOutput(const std::string& channel,
     stl_util::index_of(_samplers, channel), postProcess);
 }
 
-bool Effect::_cacheMatrix(const std::string& uniformName, const Matrix& matrix)
+int Effect::_getUniformIndex(const std::string& uniformName) const
 {
-  auto flag = matrix.updateFlag;
-  if (stl_util::contains(_valueCache, uniformName)
-      && !_valueCache[uniformName].empty()
-      && static_cast<int>(_valueCache[uniformName][0]) == flag) {
-    return false;
-  }
-
-  if (_valueCache[uniformName].empty()) {
-    _valueCache[uniformName].emplace_back(static_cast<float>(flag));
-  }
-  else {
-    _valueCache[uniformName][0] = static_cast<float>(flag);
-  }
-
-  return true;
+  auto it = _uniformIndices.find(uniformName);
+  return (it != _uniformIndices.end()) ? it->second : -1;
 }
 
-bool Effect::_cacheFloat2(const std::string& uniformName, float x, float y)
+int Effect::_getUniformIndex(UniformId uniformId) const
 {
-  if (!stl_util::contains(_valueCache, uniformName)) {
-    _valueCache[uniformName] = {x, y};
-    return true;
-  }
+  return (uniformId.value < _uniformIndicesById.size()) ?
+           _uniformIndicesById[uniformId.value] :
+           -1;
+}
 
-  bool changed = false;
-  auto& cache  = _valueCache[uniformName];
-  if (!stl_util::almost_equal(cache[0], x)) {
-    cache[0] = x;
-    changed  = true;
-  }
-  if (!stl_util::almost_equal(cache[1], y)) {
-    cache[1] = y;
-    changed  = true;
+void Effect::_invalidateCachedValue(int index)
+{
+  if (index >= 0) {
+    _uniformValueCache[static_cast<size_t>(index)].isValid = false;
   }
-
-  return changed;
 }
 
-bool Effect::_cacheFloat3(const std::string& uniformName, float x, float y,
-                          float z)
+bool Effect::_cacheMatrix(int index, const Matrix& matrix)
 {
-  if (!stl_util::contains(_valueCache, uniformName)) {
-    _valueCache[uniformName] = {x, y, z};
-    return true;
+  if (index < 0) {
+    return false;
   }
 
-  bool changed = false;
-  auto& cache  = _valueCache[uniformName];
-  if (!stl_util::almost_equal(cache[0], x)) {
-    cache[0] = x;
-    changed  = true;
-  }
-  if (!stl_util::almost_equal(cache[1], y)) {
-    cache[1] = y;
-    changed  = true;
-  }
-  if (!stl_util::almost_equal(cache[2], z)) {
-    cache[2] = z;
-    changed  = true;
+  auto& cache = _uniformValueCache[static_cast<size_t>(index)];
+  auto flag   = matrix.updateFlag;
+  if (cache.isValid && cache.updateFlag == flag) {
+    return false;
   }
 
-  return changed;
+  cache.isValid    = true;
+  cache.updateFlag = flag;
+
+  return true;
 }
 
-bool Effect::_cacheFloat4(const std::string& uniformName, float x, float y,
-                          float z, float w)
+bool Effect::_cacheFloats(int index, std::initializer_list<float> values)
 {
-  if (!stl_util::contains(_valueCache, uniformName)) {
-    _valueCache[uniformName] = {x, y, z, w};
+  if (index < 0) {
+    return false;
+  }
+
+  auto& cache = _uniformValueCache[static_cast<size_t>(index)];
+  if (!cache.isValid) {
+    std::copy(values.begin(), values.end(), cache.values.begin());
+    cache.isValid = true;
     return true;
   }
 
   bool changed = false;
-  auto& cache  = _valueCache[uniformName];
-  if (!stl_util::almost_equal(cache[0], x)) {
-    cache[0] = x;
-    changed  = true;
-  }
-  if (!stl_util::almost_equal(cache[1], y)) {
-    cache[1] = y;
-    changed  = true;
-  }
-  if (!stl_util::almost_equal(cache[2], z)) {
-    cache[2] = z;
-    changed  = true;
-  }
-  if (!stl_util::almost_equal(cache[3], w)) {
-    cache[3] = w;
-    changed  = true;
+  size_t i     = 0;
+  for (auto value : values) {
+    if (!stl_util::almost_equal(cache.values[i], value)) {
+      cache.values[i] = value;
+      changed         = true;
+    }
+    ++i;
   }
 
   return changed;
@@ -958,25 +993,29 @@ void Effect::bindUniformBlock(const std::string& blockName, unsigned index)
   _engine->bindUniformBlock(_program.get(), blockName, index);
 }
 
-Effect& Effect::setInt(const std::string& uniformName, int value)
+Effect& Effect::_setInt(int index, int value)
 {
-  Float32Array _value{static_cast<float>(value)};
-  if (stl_util::contains(_valueCache, uniformName)
-      && (_valueCache[uniformName] == _value)) {
-    return *this;
+  if (_cacheFloats(index, {static_cast<float>(value)})) {
+    _engine->setInt(_uniformLocations[static_cast<size_t>(index)], value);
   }
 
-  _valueCache[uniformName] = _value;
+  return *this;
+}
 
-  _engine->setInt(getUniform(uniformName), value);
+Effect& Effect::setInt(const std::string& uniformName, int value)
+{
+  return _setInt(_getUniformIndex(uniformName), value);
+}
 
-  return *this;
+Effect& Effect::setInt(UniformId uniformId, int value)
+{
+  return _setInt(_getUniformIndex(uniformId), value);
 }
 
 Effect& Effect::setIntArray(const std::string& uniformName,
                             const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
+  _invalidateCachedValue(_getUniformIndex(uniformName));
   _engine->setIntArray(getUniform(uniformName), array);
 
   return *this;
@@ -985,7 +1024,7 @@ Effect& Effect::setIntArray(const std::string& uniformName,
 Effect& Effect::setIntArray2(const std::string& uniformName,
                              const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
+  _invalidateCachedValue(_getUniformIndex(uniformName));
   _engine->setIntArray2(getUniform(uniformName), array);
 
   return *this;
@@ -994,7 +1033,7 @@ Effect& Effect::setIntArray2(const std::string& uniformName,
 Effect& Effect::setIntArray3(const std::string& uniformName,
                              const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
+  _invalidateCachedValue(_getUniformIndex(uniformName));
   _engine->setIntArray3(getUniform(uniformName), array);
 
   return *this;
@@ -1003,7 +1042,7 @@ Effect& Effect::setIntArray3(const std::string& uniformName,
 Effect& Effect::setIntArray4(const std::string& uniformName,
                              const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
+  _invalidateCachedValue(_getUniformIndex(uniformName));
   _engine->setIntArray4(getUniform(uniformName), array);
 
   return *this;
@@ -1012,7 +1051,7 @@ Effect& Effect::setIntArray4(const std::string& uniformName,
 Effect& Effect::setFloatArray(const std::string& uniformName,
                               const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
+  _invalidateCachedValue(_getUniformIndex(uniformName));
   _engine->setFloatArray(getUniform(uniformName), array);
 
   return *this;
@@ -1021,7 +1060,7 @@ Effect& Effect::setFloatArray(const std::string& uniformName,
 Effect& Effect::setFloatArray2(const std::string& uniformName,
                                const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
+  _invalidateCachedValue(_getUniformIndex(uniformName));
   _engine->setFloatArray2(getUniform(uniformName), array);
 
   return *this;
@@ -1030,7 +1069,7 @@ Effect& Effect::setFloatArray2(const std::string& uniformName,
 Effect& Effect::setFloatArray3(const std::string& uniformName,
                                const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
+  _invalidateCachedValue(_getUniformIndex(uniformName));
   _engine->setFloatArray3(getUniform(uniformName), array);
 
   return *this;
@@ -1039,7 +1078,7 @@ Effect& Effect::setFloatArray3(const std::string& uniformName,
 Effect& Effect::setFloatArray4(const std::string& uniformName,
                                const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
+  _invalidateCachedValue(_getUniformIndex(uniformName));
   _engine->setFloatArray4(getUniform(uniformName), array);
 
   return *this;
@@ -1047,7 +1086,7 @@ Effect& Effect::setFloatArray4(const std::string& uniformName,
 
 Effect& Effect::setArray(const std::string& uniformName, Float32Array array)
 {
-  _valueCache.erase(uniformName);
+  _invalidateCachedValue(_getUniformIndex(uniformName));
   _engine->setArray(getUniform(uniformName), array);
 
   return *this;
@@ -1055,7 +1094,7 @@ Effect& Effect::setArray(const std::string& uniformName, Float32Array array)
 
 Effect& Effect::setArray2(const std::string& uniformName, Float32Array array)
 {
-  _valueCache.erase(uniformName);
+  _invalidateCachedValue(_getUniformIndex(uniformName));
   _engine->setArray2(getUniform(uniformName), array);
 
   return *this;
@@ -1063,7 +1102,7 @@ Effect& Effect::setArray2(const std::string& uniformName, Float32Array array)
 
 Effect& Effect::setArray3(const std::string& uniformName, Float32Array array)
 {
-  _valueCache.erase(uniformName);
+  _invalidateCachedValue(_getUniformIndex(uniformName));
   _engine->setArray3(getUniform(uniformName), array);
 
   return *this;
@@ -1071,29 +1110,50 @@ Effect& Effect::setArray3(const std::string& uniformName, Float32Array array)
 
 Effect& Effect::setArray4(const std::string& uniformName, Float32Array array)
 {
-  _valueCache.erase(uniformName);
+  _invalidateCachedValue(_getUniformIndex(uniformName));
   _engine->setArray4(getUniform(uniformName), array);
 
   return *this;
 }
 
-Effect& Effect::setMatrices(const std::string& uniformName,
-                            Float32Array matrices)
+Effect& Effect::_setMatrices(int index, const Float32Array& matrices)
 {
-  if (matrices.empty()) {
+  if (index < 0 || matrices.empty()) {
     return *this;
   }
 
-  _valueCache.erase(uniformName);
-  _engine->setMatrices(getUniform(uniformName), matrices);
+  _invalidateCachedValue(index);
+  _engine->setMatrices(_uniformLocations[static_cast<size_t>(index)],
+                       matrices);
 
   return *this;
 }
 
+Effect& Effect::setMatrices(const std::string& uniformName,
+                            Float32Array matrices)
+{
+  return _setMatrices(_getUniformIndex(uniformName), matrices);
+}
+
+Effect& Effect::setMatrices(UniformId uniformId, const Float32Array& matrices)
+{
+  return _setMatrices(_getUniformIndex(uniformId), matrices);
+}
+
 Effect& Effect::setMatrix(const std::string& uniformName, const Matrix& matrix)
 {
-  if (_cacheMatrix(uniformName, matrix)) {
-    _engine->setMatrix(getUniform(uniformName), matrix);
+  return _setMatrix(_getUniformIndex(uniformName), matrix);
+}
+
+Effect& Effect::setMatrix(UniformId uniformId, const Matrix& matrix)
+{
+  return _setMatrix(_getUniformIndex(uniformId), matrix);
+}
+
+Effect& Effect::_setMatrix(int index, const Matrix& matrix)
+{
+  if (_cacheMatrix(index, matrix)) {
+    _engine->setMatrix(_uniformLocations[static_cast<size_t>(index)], matrix);
   }
 
   return *this;
@@ -1102,7 +1162,7 @@ Effect& Effect::setMatrix(const std::string& uniformName, const Matrix& matrix)
 Effect& Effect::setMatrix3x3(const std::string& uniformName,
                              const Float32Array& matrix)
 {
-  _valueCache.erase(uniformName);
+  _invalidateCachedValue(_getUniformIndex(uniformName));
   _engine->setMatrix3x3(getUniform(uniformName), matrix);
 
   return *this;
@@ -1111,46 +1171,52 @@ Effect& Effect::setMatrix3x3(const std::string& uniformName,
 Effect& Effect::setMatrix2x2(const std::string& uniformName,
                              const Float32Array& matrix)
 {
-  _valueCache.erase(uniformName);
+  _invalidateCachedValue(_getUniformIndex(uniformName));
   _engine->setMatrix2x2(getUniform(uniformName), matrix);
 
   return *this;
 }
 
-Effect& Effect::setFloat(const std::string& uniformName, float value)
+Effect& Effect::_setFloat(int index, float value)
 {
-  if (stl_util::contains(_valueCache, uniformName)
-      && stl_util::almost_equal(_valueCache[uniformName][0], value)) {
-    return *this;
+  if (_cacheFloats(index, {value})) {
+    _engine->setFloat(_uniformLocations[static_cast<size_t>(index)], value);
   }
 
-  _valueCache[uniformName] = {value};
+  return *this;
+}
 
-  _engine->setFloat(getUniform(uniformName), value);
+Effect& Effect::setFloat(const std::string& uniformName, float value)
+{
+  return _setFloat(_getUniformIndex(uniformName), value);
+}
 
-  return *this;
+Effect& Effect::setFloat(UniformId uniformId, float value)
+{
+  return _setFloat(_getUniformIndex(uniformId), value);
 }
 
 Effect& Effect::setBool(const std::string& uniformName, bool _bool)
 {
-  if (stl_util::contains(_valueCache, uniformName)
-      && stl_util::almost_equal(_valueCache[uniformName][0],
-                                _bool ? 1.f : 0.f)) {
-    return *this;
+  const auto index = _getUniformIndex(uniformName);
+  if (_cacheFloats(index, {_bool ? 1.f : 0.f})) {
+    _engine->setBool(_uniformLocations[static_cast<size_t>(index)],
+                     _bool ? 1 : 0);
   }
 
-  _valueCache[uniformName] = {_bool ? 1.f : 0.f};
-
-  _engine->setBool(getUniform(uniformName), _bool ? 1 : 0);
-
   return *this;
 }
 
 Effect& Effect::setVector2(const std::string& uniformName,
                            const Vector2& vector2)
 {
-  if (_cacheFloat2(uniformName, vector2.x, vector2.y)) {
-    _engine->setFloat2(getUniform(uniformName), vector2.x, vector2.y);
+  return _setFloat2(_getUniformIndex(uniformName), vector2.x, vector2.y);
+}
+
+Effect& Effect::_setFloat2(int index, float x, float y)
+{
+  if (_cacheFloats(index, {x, y})) {
+    _engine->setFloat2(_uniformLocations[static_cast<size_t>(index)], x, y);
   }
 
   return *this;
@@ -1158,19 +1224,32 @@ Effect& Effect::setVector2(const std::string& uniformName,
 
 Effect& Effect::setFloat2(const std::string& uniformName, float x, float y)
 {
-  if (_cacheFloat2(uniformName, x, y)) {
-    _engine->setFloat2(getUniform(uniformName), x, y);
-  }
+  return _setFloat2(_getUniformIndex(uniformName), x, y);
+}
 
-  return *this;
+Effect& Effect::setFloat2(UniformId uniformId, float x, float y)
+{
+  return _setFloat2(_getUniformIndex(uniformId), x, y);
 }
 
 Effect& Effect::setVector3(const std::string& uniformName,
                            const Vector3& vector3)
 {
-  if (_cacheFloat3(uniformName, vector3.x, vector3.y, vector3.z)) {
-    _engine->setFloat3(getUniform(uniformName), vector3.x, vector3.y,
-                       vector3.z);
+  return _setFloat3(_getUniformIndex(uniformName), vector3.x, vector3.y,
+                    vector3.z);
+}
+
+Effect& Effect::setVector3(UniformId uniformId, const Vector3& vector3)
+{
+  return _setFloat3(_getUniformIndex(uniformId), vector3.x, vector3.y,
+                    vector3.z);
+}
+
+Effect& Effect::_setFloat3(int index, float x, float y, float z)
+{
+  if (_cacheFloats(index, {x, y, z})) {
+    _engine->setFloat3(_uniformLocations[static_cast<size_t>(index)], x, y,
+                       z);
   }
 
   return *this;
@@ -1179,19 +1258,32 @@ Effect& Effect::setVector3(const std::string& uniformName,
 Effect& Effect::setFloat3(const std::string& uniformName, float x, float y,
                           float z)
 {
-  if (_cacheFloat3(uniformName, x, y, z)) {
-    _engine->setFloat3(getUniform(uniformName), x, y, z);
-  }
+  return _setFloat3(_getUniformIndex(uniformName), x, y, z);
+}
 
-  return *this;
+Effect& Effect::setFloat3(UniformId uniformId, float x, float y, float z)
+{
+  return _setFloat3(_getUniformIndex(uniformId), x, y, z);
 }
 
 Effect& Effect::setVector4(const std::string& uniformName,
                            const Vector4& vector4)
 {
-  if (_cacheFloat4(uniformName, vector4.x, vector4.y, vector4.z, vector4.w)) {
-    _engine->setFloat4(getUniform(uniformName), vector4.x, vector4.y, vector4.z,
-                       vector4.w);
+  return _setFloat4(_getUniformIndex(uniformName), vector4.x, vector4.y,
+                    vector4.z, vector4.w);
+}
+
+Effect& Effect::setVector4(UniformId uniformId, const Vector4& vector4)
+{
+  return _setFloat4(_getUniformIndex(uniformId), vector4.x, vector4.y,
+                    vector4.z, vector4.w);
+}
+
+Effect& Effect::_setFloat4(int index, float x, float y, float z, float w)
+{
+  if (_cacheFloats(index, {x, y, z, w})) {
+    _engine->setFloat4(_uniformLocations[static_cast<size_t>(index)], x, y, z,
+                       w);
   }
 
   return *this;
@@ -1200,40 +1292,45 @@ Effect& Effect::setVector4(const std::string& uniformName,
 Effect& Effect::setFloat4(const std::string& uniformName, float x, float y,
                           float z, float w)
 {
-  if (_cacheFloat4(uniformName, x, y, z, w)) {
-    _engine->setFloat4(getUniform(uniformName), x, y, z, w);
-  }
+  return _setFloat4(_getUniformIndex(uniformName), x, y, z, w);
+}
 
-  return *this;
+Effect& Effect::setFloat4(UniformId uniformId, float x, float y, float z,
+                          float w)
+{
+  return _setFloat4(_getUniformIndex(uniformId), x, y, z, w);
 }
 
 Effect& Effect::setColor3(const std::string& uniformName, const Color3& color3)
 {
-  if (_cacheFloat3(uniformName, color3.r, color3.g, color3.b)) {
-    _engine->setColor3(getUniform(uniformName), color3);
-  }
+  return _setFloat3(_getUniformIndex(uniformName), color3.r, color3.g,
+                    color3.b);
+}
 
-  return *this;
+Effect& Effect::setColor3(UniformId uniformId, const Color3& color3)
+{
+  return _setFloat3(_getUniformIndex(uniformId), color3.r, color3.g, color3.b);
 }
 
 Effect& Effect::setColor4(const std::string& uniformName, const Color3& color3,
                           float alpha)
 {
-  if (_cacheFloat4(uniformName, color3.r, color3.g, color3.b, alpha)) {
-    _engine->setColor4(getUniform(uniformName), color3, alpha);
-  }
+  return _setFloat4(_getUniformIndex(uniformName), color3.r, color3.g,
+                    color3.b, alpha);
+}
 
-  return *this;
+Effect& Effect::setColor4(UniformId uniformId, const Color3& color3,
+                          float alpha)
+{
+  return _setFloat4(_getUniformIndex(uniformId), color3.r, color3.g, color3.b,
+                    alpha);
 }
 
 Effect& Effect::setDirectColor4(const std::string& uniformName,
                                 const Color4& color4)
 {
-  if (_cacheFloat4(uniformName, color4.r, color4.g, color4.b, color4.a)) {
-    _engine->setDirectColor4(getUniform(uniformName), color4);
-  }
-
-  return *this;
+  return _setFloat4(_getUniformIndex(uniformName), color4.r, color4.g,
+                    color4.b, color4.a);
 }
 
 void Effect::dispose()
@@ -64,4 +64,18 @@ std::string IImageProcessingConfigurationDefines::convertToString() const
   return oss.str();
 }
 
+uint32_t IImageProcessingConfigurationDefines::toBitMask() const
+{
+  uint32_t bitMask = 0;
+  for (auto value :
+       {IMAGEPROCESSING, VIGNETTE, VIGNETTEBLENDMODEMULTIPLY,
+        VIGNETTEBLENDMODEOPAQUE, TONEMAPPING, TONEMAPPING_ACES, CONTRAST,
+        EXPOSURE, COLORCURVES, COLORGRADING, COLORGRADING3D, FROMLINEARSPACE,
+        SAMPLER3DGREENDEPTH, SAMPLER3DBGRMAP, IMAGEPROCESSINGPOSTPROCESS}) {
+    bitMask = (bitMask << 1) | (value ? 1u : 0u);
+  }
+
+  return bitMask;
+}
+
 } // end of namespace BABYLON
@@ -444,7 +444,8 @@ void Material::bindSceneUniformBuffer(Effect* effect, UniformBuffer* sceneUbo)
 void Material::bindView(Effect* effect)
 {
   if (!_useUBO) {
-    effect->setMatrix("view", getScene()->getViewMatrix());
+    static const auto viewId = Effect::GetUniformId("view");
+    effect->setMatrix(viewId, getScene()->getViewMatrix());
   }
   else {
     bindSceneUniformBuffer(effect, getScene()->getSceneUniformBuffer());
@@ -454,7 +455,8 @@ void Material::bindView(Effect* effect)
 void Material::bindViewProjection(const EffectPtr& effect)
 {
   if (!_useUBO) {
-    effect->setMatrix("viewProjection", getScene()->getTransformMatrix());
+    static const auto viewProjectionId = Effect::GetUniformId("viewProjection");
+    effect->setMatrix(viewProjectionId, getScene()->getTransformMatrix());
   }
   else {
     bindSceneUniformBuffer(effect.get(), getScene()->getSceneUniformBuffer());
@@ -0,0 +1,281 @@
+#include <babylon/materials/material_define_flags.h>
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace BABYLON {
+
+namespace {
+
+constexpr size_t BITS_PER_WORD = 64;
+
+/**
+ * @brief Process wide schema of the define names.
+ */
+struct DefineSchema {
+  std::shared_mutex mutex;
+  std::unordered_map<std::string, size_t> indices;
+  // Names by index, a deque keeps the references stable while it grows
+  std::deque<std::string> names;
+};
+
+DefineSchema& GetDefineSchema()
+{
+  static DefineSchema schema;
+  return schema;
+}
+
+bool FindDefineIndex(const std::string& define, size_t& index)
+{
+  auto& schema = GetDefineSchema();
+  std::shared_lock<std::shared_mutex> lock(schema.mutex);
+  auto it = schema.indices.find(define);
+  if (it == schema.indices.end()) {
+    return false;
+  }
+  index = it->second;
+  return true;
+}
+
+bool TestBit(const std::vector<uint64_t>& words, size_t index)
+{
+  const auto word = index / BITS_PER_WORD;
+  return word < words.size()
+         && (words[word] >> (index % BITS_PER_WORD)) & uint64_t(1);
+}
+
+uint64_t WordAt(const std::vector<uint64_t>& words, size_t word)
+{
+  return word < words.size() ? words[word] : 0;
+}
+
+} // end of anonymous namespace
+
+MaterialDefineFlags::Reference::Reference(MaterialDefineFlags& flags,
+                                          size_t index)
+    : _flags{flags}, _index{index}
+{
+}
+
+MaterialDefineFlags::Reference::operator bool() const
+{
+  return _flags.get(_index);
+}
+
+MaterialDefineFlags::Reference& MaterialDefineFlags::Reference::
+operator=(bool value)
+{
+  _flags.set(_index, value);
+  return *this;
+}
+
+MaterialDefineFlags::Reference& MaterialDefineFlags::Reference::
+operator=(const Reference& other)
+{
+  return operator=(static_cast<bool>(other));
+}
+
+MaterialDefineFlags::MaterialDefineFlags()
+    : _size{0}, _hash{0}, _isHashValid{false}
+{
+}
+
+MaterialDefineFlags::MaterialDefineFlags(
+  std::initializer_list<std::pair<std::string, bool>> defines)
+    : MaterialDefineFlags()
+{
+  *this = defines;
+}
+
+MaterialDefineFlags& MaterialDefineFlags::
+operator=(std::initializer_list<std::pair<std::string, bool>> defines)
+{
+  _declared.clear();
+  _values.clear();
+  _size        = 0;
+  _isHashValid = false;
+
+  for (const auto& define : defines) {
+    set(MaterialDefineFlags::IndexOf(define.first), define.second);
+  }
+
+  return *this;
+}
+
+MaterialDefineFlags::~MaterialDefineFlags()
+{
+}
+
+size_t MaterialDefineFlags::IndexOf(const std::string& define)
+{
+  size_t index = 0;
+  if (FindDefineIndex(define, index)) {
+    return index;
+  }
+
+  auto& schema = GetDefineSchema();
+  std::unique_lock<std::shared_mutex> lock(schema.mutex);
+  auto it = schema.indices.find(define);
+  if (it != schema.indices.end()) {
+    return it->second;
+  }
+
+  index                  = schema.names.size();
+  schema.indices[define] = index;
+  schema.names.emplace_back(define);
+
+  return index;
+}
+
+const std::string& MaterialDefineFlags::NameOf(size_t index)
+{
+  auto& schema = GetDefineSchema();
+  std::shared_lock<std::shared_mutex> lock(schema.mutex);
+  return schema.names.at(index);
+}
+
+MaterialDefineFlags::Reference MaterialDefineFlags::
+operator[](const std::string& define)
+{
+  return operator[](MaterialDefineFlags::IndexOf(define));
+}
+
+MaterialDefineFlags::Reference MaterialDefineFlags::operator[](size_t index)
+{
+  _declare(index);
+  return Reference(*this, index);
+}
+
+bool MaterialDefineFlags::operator==(const MaterialDefineFlags& rhs) const
+{
+  if (_size != rhs._size) {
+    return false;
+  }
+
+  const auto wordCount = std::max(_declared.size(), rhs._declared.size());
+  for (size_t word = 0; word < wordCount; ++word) {
+    if (WordAt(_declared, word) != WordAt(rhs._declared, word)
+        || WordAt(_values, word) != WordAt(rhs._values, word)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool MaterialDefineFlags::operator!=(const MaterialDefineFlags& rhs) const
+{
+  return !(operator==(rhs));
+}
+
+bool MaterialDefineFlags::contains(const std::string& define) const
+{
+  size_t index = 0;
+  return FindDefineIndex(define, index) && TestBit(_declared, index);
+}
+
+bool MaterialDefineFlags::get(const std::string& define) const
+{
+  size_t index = 0;
+  return FindDefineIndex(define, index) && TestBit(_values, index);
+}
+
+bool MaterialDefineFlags::get(size_t index) const
+{
+  return TestBit(_values, index);
+}
+
+void MaterialDefineFlags::set(size_t index, bool value)
+{
+  _declare(index);
+
+  const auto mask = uint64_t(1) << (index % BITS_PER_WORD);
+  auto& word      = _values[index / BITS_PER_WORD];
+  if (((word & mask) != 0) != value) {
+    word ^= mask;
+    _isHashValid = false;
+  }
+}
+
+size_t MaterialDefineFlags::size() const
+{
+  return _size;
+}
+
+bool MaterialDefineFlags::hasSameValues(const MaterialDefineFlags& other) const
+{
+  if (hash() != other.hash()) {
+    return false;
+  }
+
+  const auto wordCount = std::max(_values.size(), other._values.size());
+  for (size_t word = 0; word < wordCount; ++word) {
+    if (WordAt(_values, word) != WordAt(other._values, word)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+uint64_t MaterialDefineFlags::hash() const
+{
+  if (!_isHashValid) {
+    // FNV-1a over the value words, ignoring the trailing empty words so that
+    // equal sets of enabled defines always give the same hash
+    auto wordCount = _values.size();
+    while (wordCount > 0 && _values[wordCount - 1] == 0) {
+      --wordCount;
+    }
+
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t word = 0; word < wordCount; ++word) {
+      hash ^= _values[word];
+      hash *= 1099511628211ull;
+    }
+
+    _hash        = hash;
+    _isHashValid = true;
+  }
+
+  return _hash;
+}
+
+void MaterialDefineFlags::forEach(
+  const std::function<void(const std::string& define, bool value)>& callback)
+  const
+{
+  for (size_t word = 0; word < _declared.size(); ++word) {
+    auto bits = _declared[word];
+    while (bits != 0) {
+      size_t bit = 0;
+      while (((bits >> bit) & uint64_t(1)) == 0) {
+        ++bit;
+      }
+      bits &= ~(uint64_t(1) << bit);
+
+      const auto index = word * BITS_PER_WORD + bit;
+      callback(MaterialDefineFlags::NameOf(index), TestBit(_values, index));
+    }
+  }
+}
+
+void MaterialDefineFlags::_declare(size_t index)
+{
+  const auto word = index / BITS_PER_WORD;
+  if (word >= _declared.size()) {
+    _declared.resize(word + 1, 0);
+    _values.resize(word + 1, 0);
+  }
+
+  const auto mask = uint64_t(1) << (index % BITS_PER_WORD);
+  if ((_declared[word] & mask) == 0) {
+    _declared[word] |= mask;
+    ++_size;
+  }
+}
+
+} // end of namespace BABYLON
@@ -1,6 +1,8 @@
 #include <babylon/materials/material_defines.h>
 
-#include <babylon/babylon_stl_util.h>
+#include <sstream>
+
+#include <babylon/materials/iimage_processing_configuration_defines.h>
 
 namespace BABYLON {
 
@@ -114,7 +116,7 @@ MaterialDefines::~MaterialDefines()
 
 bool MaterialDefines::operator[](const std::string& define) const
 {
-  return stl_util::contains(boolDef, define) && boolDef.at(define);
+  return boolDef.get(define);
 }
 
 bool MaterialDefines::operator==(const MaterialDefines& rhs) const
@@ -130,11 +132,11 @@ bool MaterialDefines::operator!=(const MaterialDefines& rhs) const
 std::ostream& operator<<(std::ostream& os,
                          const MaterialDefines& materialDefines)
 {
-  for (const auto& item : materialDefines.boolDef) {
-    if (item.second) {
-      os << "#define " << item.first << "\n";
+  materialDefines.boolDef.forEach([&os](const std::string& define, bool value) {
+    if (value) {
+      os << "#define " << define << "\n";
     }
-  }
+  });
 
   for (const auto& item : materialDefines.intDef) {
     os << "#define " << item.first << " " << item.second << "\n";
@@ -252,6 +254,53 @@ bool MaterialDefines::isEqual(const MaterialDefines& other) const
   return true;
 }
 
+bool MaterialDefines::hasSameDefines(const MaterialDefines& other) const
+{
+  return _hasSameBaseDefines(other)
+         && (imageProcessingBitMask() == other.imageProcessingBitMask());
+}
+
+bool MaterialDefines::_hasSameBaseDefines(const MaterialDefines& other) const
+{
+  return boolDef.hasSameValues(other.boolDef) && (intDef == other.intDef)
+         && (floatDef == other.floatDef) && (stringDef == other.stringDef);
+}
+
+uint32_t MaterialDefines::imageProcessingBitMask() const
+{
+  // The image processing defines are members of the derived defines, not part
+  // of boolDef
+  const auto imageProcessingDefines
+    = dynamic_cast<const IImageProcessingConfigurationDefines*>(this);
+  return imageProcessingDefines ? imageProcessingDefines->toBitMask() : 0;
+}
+
+uint64_t MaterialDefines::hash() const
+{
+  // The value defines are few, they are combined with an order independent
+  // sum as the iteration order of the maps is unspecified
+  uint64_t valuesHash = 0;
+  for (const auto& item : intDef) {
+    valuesHash += std::hash<std::string>{}(item.first) * 31
+                  + std::hash<unsigned int>{}(item.second);
+  }
+  for (const auto& item : floatDef) {
+    valuesHash += std::hash<std::string>{}(item.first) * 37
+                  + std::hash<float>{}(item.second);
+  }
+  for (const auto& item : stringDef) {
+    valuesHash += std::hash<std::string>{}(item.first) * 41
+                  + std::hash<std::string>{}(item.second);
+  }
+
+  valuesHash += std::hash<uint32_t>{}(imageProcessingBitMask()) * 43;
+
+  const auto flagsHash = boolDef.hash();
+  return flagsHash
+         ^ (valuesHash + 0x9e3779b97f4a7c15ull + (flagsHash << 6)
+            + (flagsHash >> 2));
+}
+
 void MaterialDefines::cloneTo(MaterialDefines& other)
 {
   other._isDirty                 = _isDirty;
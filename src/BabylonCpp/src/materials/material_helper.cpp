@@ -30,15 +30,17 @@ Color3 MaterialHelper::_tempFogColor = Color3::Black();
 
 void MaterialHelper::BindEyePosition(const EffectPtr& effect, Scene* scene)
 {
+  static const auto eyePositionId = Effect::GetUniformId("vEyePosition");
+
   if (scene->_forcedViewPosition) {
-    effect->setVector3("vEyePosition", *scene->_forcedViewPosition.get());
+    effect->setVector3(eyePositionId, *scene->_forcedViewPosition.get());
     return;
   }
   const auto& globalPosition = scene->activeCamera->globalPosition();
 
-  effect->setVector3("vEyePosition", scene->_mirroredCameraPosition ?
-                                       *scene->_mirroredCameraPosition.get() :
-                                       globalPosition);
+  effect->setVector3(eyePositionId, scene->_mirroredCameraPosition ?
+                                      *scene->_mirroredCameraPosition.get() :
+                                      globalPosition);
 }
 
 void MaterialHelper::PrepareDefinesForMergedUV(const BaseTexturePtr& texture,
@@ -268,7 +270,7 @@ bool MaterialHelper::PrepareDefinesForLights(Scene* scene, AbstractMesh* mesh,
 
       auto lightIndexStr = std::to_string(lightIndex);
 
-      if (!stl_util::contains(defines.boolDef, "LIGHT" + lightIndexStr)) {
+      if (!defines.boolDef.contains("LIGHT" + lightIndexStr)) {
         needRebuild = true;
       }
 
@@ -353,7 +355,7 @@ bool MaterialHelper::PrepareDefinesForLights(Scene* scene, AbstractMesh* mesh,
   for (unsigned int index = lightIndex; index < maxSimultaneousLights;
        ++index) {
     auto indexStr = std::to_string(index);
-    if (stl_util::contains(defines.boolDef, "LIGHT" + indexStr)) {
+    if (defines.boolDef.contains("LIGHT" + indexStr)) {
       defines.boolDef["LIGHT" + indexStr]               = false;
       defines.boolDef["HEMILIGHT" + indexStr]           = false;
       defines.boolDef["POINTLIGHT" + indexStr]          = false;
@@ -372,7 +374,7 @@ bool MaterialHelper::PrepareDefinesForLights(Scene* scene, AbstractMesh* mesh,
 
   auto caps = scene->getEngine()->getCaps();
 
-  if (!stl_util::contains(defines.boolDef, "SHADOWFLOAT")) {
+  if (!defines.boolDef.contains("SHADOWFLOAT")) {
     needRebuild = true;
   }
 
@@ -401,7 +403,7 @@ void MaterialHelper::PrepareUniformsAndSamplersList(
        ++lightIndex) {
     const auto lightIndexStr = std::to_string(lightIndex);
 
-    if (!stl_util::contains(defines.boolDef, "LIGHT" + lightIndexStr)) {
+    if (!defines.boolDef.contains("LIGHT" + lightIndexStr)) {
       break;
     }
 
@@ -425,8 +427,7 @@ void MaterialHelper::PrepareUniformsAndSamplersList(
     samplersList.emplace_back("shadowSampler" + lightIndexStr);
     samplersList.emplace_back("depthSampler" + lightIndexStr);
 
-    if (stl_util::contains(defines.boolDef,
-                           "PROJECTEDLIGHTTEXTURE" + lightIndexStr)
+    if (defines.boolDef.contains("PROJECTEDLIGHTTEXTURE" + lightIndexStr)
         && defines["PROJECTEDLIGHTTEXTURE" + lightIndexStr]) {
       samplersList.emplace_back("projectionLightSampler" + lightIndexStr);
       uniformsList.emplace_back("textureProjectionMatrix" + lightIndexStr);
@@ -497,7 +498,7 @@ unsigned int MaterialHelper::HandleFallbacksForShadows(
        ++lightIndex) {
     const std::string lightIndexStr = std::to_string(lightIndex);
 
-    if (!stl_util::contains(defines.boolDef, "LIGHT" + lightIndexStr)) {
+    if (!defines.boolDef.contains("LIGHT" + lightIndexStr)) {
       break;
     }
 
@@ -641,14 +642,14 @@ void MaterialHelper::BindLights(Scene* scene, AbstractMesh* mesh,
 
     MaterialHelper::BindLightProperties(*light, effect, i);
 
-    light->diffuse.scaleToRef(scaledIntensity, Tmp::Color3Array[0]);
+    light->diffuse.scaleToRef(scaledIntensity, Tmp::Color3Array()[0]);
     light->_uniformBuffer->updateColor4(
-      "vLightDiffuse", Tmp::Color3Array[0],
+      "vLightDiffuse", Tmp::Color3Array()[0],
       usePhysicalLightFalloff ? light->radius() : light->range, iAsString);
     if (defines["SPECULARTERM"]) {
-      light->specular.scaleToRef(scaledIntensity, Tmp::Color3Array[1]);
-      light->_uniformBuffer->updateColor3("vLightSpecular", Tmp::Color3Array[1],
-                                          iAsString);
+      light->specular.scaleToRef(scaledIntensity, Tmp::Color3Array()[1]);
+      light->_uniformBuffer->updateColor3(
+        "vLightSpecular", Tmp::Color3Array()[1], iAsString);
     }
 
     // Shadows
@@ -665,16 +666,18 @@ void MaterialHelper::BindFogParameters(Scene* scene, AbstractMesh* mesh,
 {
   if (scene->fogEnabled() && mesh->applyFog()
       && scene->fogMode() != Scene::FOGMODE_NONE) {
-    effect->setFloat4("vFogInfos", static_cast<float>(scene->fogMode()),
+    static const auto fogInfosId = Effect::GetUniformId("vFogInfos");
+    static const auto fogColorId = Effect::GetUniformId("vFogColor");
+    effect->setFloat4(fogInfosId, static_cast<float>(scene->fogMode()),
                       scene->fogStart, scene->fogEnd, scene->fogDensity);
     // Convert fog color to linear space if used in a linear space computed
     // shader.
     if (linearSpace) {
       scene->fogColor.toLinearSpaceToRef(MaterialHelper::_tempFogColor);
-      effect->setColor3("vFogColor", MaterialHelper::_tempFogColor);
+      effect->setColor3(fogColorId, MaterialHelper::_tempFogColor);
     }
     else {
-      effect->setColor3("vFogColor", scene->fogColor);
+      effect->setColor3(fogColorId, scene->fogColor);
     }
   }
 }
@@ -705,7 +708,8 @@ void MaterialHelper::BindBonesParameters(AbstractMesh* mesh,
       const auto& matrices = skeleton->getTransformMatrices(mesh);
 
       if (!matrices.empty()) {
-        effect->setMatrices("mBones", matrices);
+        static const auto bonesId = Effect::GetUniformId("mBones");
+        effect->setMatrices(bonesId, matrices);
       }
     }
   }
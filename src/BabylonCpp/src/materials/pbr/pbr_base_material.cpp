@@ -692,15 +692,12 @@ EffectPtr PBRBaseMaterial::_prepareEffect(
                                          samplers, defines);
   }
 
-  auto join = defines.toString();
-
   EffectCreationOptions options;
   options.attributes            = std::move(attribs);
   options.uniformsNames         = std::move(uniforms);
   options.uniformBuffersNames   = std::move(uniformBuffers);
   options.samplers              = std::move(samplers);
   options.materialDefines       = &defines;
-  options.defines               = std::move(join);
   options.fallbacks             = std::move(fallbacks);
   options.onCompiled            = iOnCompiled;
   options.onError               = iOnError;
@@ -1332,9 +1329,9 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh,
 
       // Colors
       if (defines["METALLICWORKFLOW"]) {
-        Tmp::Color3Array[0].r = !_metallic.has_value() ? 1.f : *_metallic;
-        Tmp::Color3Array[0].g = !_roughness.has_value() ? 1.f : *_roughness;
-        ubo.updateColor4("vReflectivityColor", Tmp::Color3Array[0], 0, "");
+        Tmp::Color3Array()[0].r = !_metallic.has_value() ? 1.f : *_metallic;
+        Tmp::Color3Array()[0].g = !_roughness.has_value() ? 1.f : *_roughness;
+        ubo.updateColor4("vReflectivityColor", Tmp::Color3Array()[0], 0, "");
       }
       else {
         ubo.updateColor4("vReflectivityColor", _reflectivityColor,
@@ -1446,11 +1443,14 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh,
                             scene->activeCamera->globalPosition());
     auto invertNormal = (scene->useRightHandedSystem()
                          == (scene->_mirroredCameraPosition != nullptr));
-    effect->setFloat4("vEyePosition", eyePosition.x, eyePosition.y,
+    static const auto eyePositionId  = Effect::GetUniformId("vEyePosition");
+    static const auto ambientColorId = Effect::GetUniformId("vAmbientColor");
+    static const auto debugModeId    = Effect::GetUniformId("vDebugMode");
+    effect->setFloat4(eyePositionId, eyePosition.x, eyePosition.y,
                       eyePosition.z, invertNormal ? -1.f : 1.f);
-    effect->setColor3("vAmbientColor", _globalAmbientColor);
+    effect->setColor3(ambientColorId, _globalAmbientColor);
 
-    effect->setFloat2("vDebugMode", debugLimit, debugFactor);
+    effect->setFloat2(debugModeId, debugLimit, debugFactor);
   }
 
   if (mustRebind || !isFrozen()) {
@@ -49,12 +49,14 @@ bool PushMaterial::isReady(AbstractMesh* mesh, bool useInstances)
 
 void PushMaterial::bindOnlyWorldMatrix(Matrix& world)
 {
-  _activeEffect->setMatrix("world", world);
+  static const auto worldId = Effect::GetUniformId("world");
+  _activeEffect->setMatrix(worldId, world);
 }
 
 void PushMaterial::bindOnlyNormalMatrix(Matrix& normalMatrix)
 {
-  _activeEffect->setMatrix("normalMatrix", normalMatrix);
+  static const auto normalMatrixId = Effect::GetUniformId("normalMatrix");
+  _activeEffect->setMatrix(normalMatrixId, normalMatrix);
 }
 
 void PushMaterial::bind(Matrix& world, Mesh* mesh)
@@ -885,7 +885,6 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh,
     MaterialHelper::PrepareAttributesForMorphTargets(attribs, mesh, defines);
 
     std::string shaderName{"default"};
-    const auto join = defines.toString();
     std::vector<std::string> uniforms{"world",
                                       "view",
                                       "viewProjection",
@@ -958,7 +957,6 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh,
     options.uniformBuffersNames   = std::move(uniformBuffers);
     options.samplers              = std::move(samplers);
     options.materialDefines       = &defines;
-    options.defines               = std::move(join);
     options.fallbacks             = std::move(fallbacks);
     options.onCompiled            = onCompiled;
     options.onError               = onError;
@@ -1169,7 +1167,9 @@ void StandardMaterial::bindForSubMesh(Matrix& world, Mesh* mesh,
           MaterialHelper::BindTextureMatrix(*_diffuseTexture, ubo, "diffuse");
 
           if (_diffuseTexture->hasAlpha()) {
-            effect->setFloat("alphaCutOff", alphaCutOff);
+            static const auto alphaCutOffId
+              = Effect::GetUniformId("alphaCutOff");
+            effect->setFloat(alphaCutOffId, alphaCutOff);
           }
         }
 
@@ -1345,7 +1345,8 @@ void StandardMaterial::bindForSubMesh(Matrix& world, Mesh* mesh,
     scene->ambientColor.multiplyToRef(ambientColor, _globalAmbientColor);
 
     MaterialHelper::BindEyePosition(effect, scene);
-    effect->setColor3("vAmbientColor", _globalAmbientColor);
+    static const auto ambientColorId = Effect::GetUniformId("vAmbientColor");
+    effect->setColor3(ambientColorId, _globalAmbientColor);
   }
 
   if (mustRebind || !isFrozen()) {
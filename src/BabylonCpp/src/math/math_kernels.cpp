@@ -0,0 +1,110 @@
+#include <babylon/math/math_kernels.h>
+
+#include <initializer_list>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace BABYLON {
+
+namespace {
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+
+bool HostSupportsSSE4()
+{
+  int info[4];
+  __cpuid(info, 1);
+  return (info[2] & (1 << 19)) != 0;
+}
+
+bool HostSupportsAVX2()
+{
+  int info[4];
+  __cpuid(info, 1);
+  // AVX enabled by the CPU and the registers saved by the OS (XSAVE)
+  const auto osxsave = (info[2] & (1 << 27)) != 0;
+  const auto avx     = (info[2] & (1 << 28)) != 0;
+  if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) {
+    return false;
+  }
+  __cpuidex(info, 7, 0);
+  return (info[1] & (1 << 5)) != 0;
+}
+
+#elif (defined(__GNUC__) || defined(__clang__))                                \
+  && (defined(__x86_64__) || defined(__i386__))
+
+bool HostSupportsSSE4()
+{
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("sse4.1");
+}
+
+bool HostSupportsAVX2()
+{
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2");
+}
+
+#else
+
+bool HostSupportsSSE4()
+{
+  return false;
+}
+
+bool HostSupportsAVX2()
+{
+  return false;
+}
+
+#endif
+
+bool HostSupportsNEON()
+{
+#if defined(__aarch64__) || defined(_M_ARM64)
+  return true;
+#else
+  return false;
+#endif
+}
+
+} // end of anonymous namespace
+
+const MathKernels& MathKernels::Get()
+{
+  static const MathKernels& kernels = *Get(DetectInstructionSet());
+  return kernels;
+}
+
+const MathKernels* MathKernels::Get(SIMDInstructionSet instructionSet)
+{
+  switch (instructionSet) {
+    case SIMDInstructionSet::SSE4:
+      return HostSupportsSSE4() ? _SSE4Kernels() : nullptr;
+    case SIMDInstructionSet::AVX2:
+      return HostSupportsAVX2() ? _AVX2Kernels() : nullptr;
+    case SIMDInstructionSet::NEON:
+      return HostSupportsNEON() ? _NEONKernels() : nullptr;
+    case SIMDInstructionSet::Scalar:
+    default:
+      return &Scalar();
+  }
+}
+
+SIMDInstructionSet MathKernels::DetectInstructionSet()
+{
+  for (auto instructionSet :
+       {SIMDInstructionSet::AVX2, SIMDInstructionSet::SSE4,
+        SIMDInstructionSet::NEON}) {
+    if (Get(instructionSet)) {
+      return instructionSet;
+    }
+  }
+  return SIMDInstructionSet::Scalar;
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,186 @@
+#include <babylon/math/math_kernels.h>
+
+// This translation unit is compiled with AVX2 enabled, it must not define or
+// instantiate any code shared with the rest of the library
+#if defined(__AVX2__)
+#define BABYLON_MATH_KERNELS_AVX2 1
+#endif
+
+#if BABYLON_MATH_KERNELS_AVX2
+
+#include <immintrin.h>
+
+#include <babylon/math/math_kernels_lanes.h>
+
+namespace BABYLON {
+
+namespace {
+
+struct AVX2Mask {
+  __m256 v;
+}; // end of struct AVX2Mask
+
+/**
+ * @brief 8 lanes stored in an AVX register.
+ */
+struct AVX2Lane {
+  using Mask                    = AVX2Mask;
+  static constexpr size_t Width = 8;
+
+  static AVX2Lane Load(const float* data, size_t stride)
+  {
+    if (stride == 1) {
+      return {_mm256_loadu_ps(data)};
+    }
+    const auto s = static_cast<int>(stride);
+    return {_mm256_i32gather_ps(
+      data, _mm256_setr_epi32(0, s, 2 * s, 3 * s, 4 * s, 5 * s, 6 * s, 7 * s),
+      4)};
+  }
+
+  static AVX2Lane Splat(float value)
+  {
+    return {_mm256_set1_ps(value)};
+  }
+
+  void store(float* data, size_t stride) const
+  {
+    if (stride == 1) {
+      _mm256_storeu_ps(data, v);
+      return;
+    }
+    alignas(32) float lanes[8];
+    _mm256_store_ps(lanes, v);
+    for (size_t i = 0; i < 8; ++i) {
+      data[i * stride] = lanes[i];
+    }
+  }
+
+  __m256 v;
+}; // end of struct AVX2Lane
+
+inline AVX2Lane operator+(AVX2Lane a, AVX2Lane b)
+{
+  return {_mm256_add_ps(a.v, b.v)};
+}
+
+inline AVX2Lane operator-(AVX2Lane a, AVX2Lane b)
+{
+  return {_mm256_sub_ps(a.v, b.v)};
+}
+
+inline AVX2Lane operator-(AVX2Lane a)
+{
+  return {_mm256_xor_ps(a.v, _mm256_set1_ps(-0.f))};
+}
+
+inline AVX2Lane operator*(AVX2Lane a, AVX2Lane b)
+{
+  return {_mm256_mul_ps(a.v, b.v)};
+}
+
+inline AVX2Lane operator/(AVX2Lane a, AVX2Lane b)
+{
+  return {_mm256_div_ps(a.v, b.v)};
+}
+
+inline AVX2Mask operator>(AVX2Lane a, AVX2Lane b)
+{
+  return {_mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ)};
+}
+
+inline AVX2Mask operator<=(AVX2Lane a, AVX2Lane b)
+{
+  return {_mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ)};
+}
+
+inline AVX2Mask operator==(AVX2Lane a, AVX2Lane b)
+{
+  return {_mm256_cmp_ps(a.v, b.v, _CMP_EQ_OQ)};
+}
+
+inline AVX2Mask And(AVX2Mask a, AVX2Mask b)
+{
+  return {_mm256_and_ps(a.v, b.v)};
+}
+
+inline AVX2Mask Or(AVX2Mask a, AVX2Mask b)
+{
+  return {_mm256_or_ps(a.v, b.v)};
+}
+
+inline AVX2Lane Select(AVX2Mask mask, AVX2Lane a, AVX2Lane b)
+{
+  return {_mm256_blendv_ps(b.v, a.v, mask.v)};
+}
+
+inline AVX2Lane Sqrt(AVX2Lane a)
+{
+  return {_mm256_sqrt_ps(a.v)};
+}
+
+/**
+ * @brief Multiplies the matrices one by one, two rows of the result at a time:
+ * each half of a register holds a row of the left matrix and the right matrix
+ * rows are duplicated in both halves.
+ */
+void MultiplyMatrices(const float* left, const float* right, float* result,
+                      size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    const auto* l = left + i * 16;
+    const auto* r = right + i * 16;
+    const auto r0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(r));
+    const auto r1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(r + 4));
+    const auto r2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(r + 8));
+    const auto r3
+      = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(r + 12));
+
+    __m256 rows[2];
+    for (size_t half = 0; half < 2; ++half) {
+      const auto lr = _mm256_loadu_ps(l + half * 8);
+      auto sum      = _mm256_mul_ps(_mm256_permute_ps(lr, 0x00), r0);
+      sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_permute_ps(lr, 0x55), r1));
+      sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_permute_ps(lr, 0xAA), r2));
+      rows[half]
+        = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_permute_ps(lr, 0xFF), r3));
+    }
+
+    auto* res = result + i * 16;
+    _mm256_storeu_ps(res, rows[0]);
+    _mm256_storeu_ps(res + 8, rows[1]);
+  }
+}
+
+const MathKernels avx2Kernels{
+  SIMDInstructionSet::AVX2,                //
+  &MultiplyMatrices,                       //
+  &detail::InvertMatrices<AVX2Lane>,       //
+  &detail::TransformCoordinates<AVX2Lane>, //
+  &detail::ComposeMatrices<AVX2Lane>,      //
+  &detail::DecomposeMatrices<AVX2Lane>,    //
+  &detail::CullBoundingVolumes<AVX2Lane>,  //
+  &detail::UpdateParticles<AVX2Lane>,      //
+};
+
+} // end of anonymous namespace
+
+const MathKernels* MathKernels::_AVX2Kernels()
+{
+  return &avx2Kernels;
+}
+
+} // end of namespace BABYLON
+
+#else
+
+namespace BABYLON {
+
+const MathKernels* MathKernels::_AVX2Kernels()
+{
+  return nullptr;
+}
+
+} // end of namespace BABYLON
+
+#endif
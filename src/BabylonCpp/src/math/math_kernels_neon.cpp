@@ -0,0 +1,184 @@
+#include <babylon/math/math_kernels.h>
+
+// NEON is part of the AArch64 base instruction set, the vector division and
+// square root used by the kernels are not available on 32-bit ARM
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define BABYLON_MATH_KERNELS_NEON 1
+#endif
+
+#if BABYLON_MATH_KERNELS_NEON
+
+#include <arm_neon.h>
+
+#include <babylon/math/math_kernels_lanes.h>
+
+namespace BABYLON {
+
+namespace {
+
+struct NEONMask {
+  uint32x4_t v;
+}; // end of struct NEONMask
+
+/**
+ * @brief 4 lanes stored in a NEON register.
+ */
+struct NEONLane {
+  using Mask                    = NEONMask;
+  static constexpr size_t Width = 4;
+
+  static NEONLane Load(const float* data, size_t stride)
+  {
+    if (stride == 1) {
+      return {vld1q_f32(data)};
+    }
+    const float lanes[4]
+      = {data[0], data[stride], data[2 * stride], data[3 * stride]};
+    return {vld1q_f32(lanes)};
+  }
+
+  static NEONLane Splat(float value)
+  {
+    return {vdupq_n_f32(value)};
+  }
+
+  void store(float* data, size_t stride) const
+  {
+    if (stride == 1) {
+      vst1q_f32(data, v);
+      return;
+    }
+    float lanes[4];
+    vst1q_f32(lanes, v);
+    data[0]          = lanes[0];
+    data[stride]     = lanes[1];
+    data[2 * stride] = lanes[2];
+    data[3 * stride] = lanes[3];
+  }
+
+  float32x4_t v;
+}; // end of struct NEONLane
+
+inline NEONLane operator+(NEONLane a, NEONLane b)
+{
+  return {vaddq_f32(a.v, b.v)};
+}
+
+inline NEONLane operator-(NEONLane a, NEONLane b)
+{
+  return {vsubq_f32(a.v, b.v)};
+}
+
+inline NEONLane operator-(NEONLane a)
+{
+  return {vnegq_f32(a.v)};
+}
+
+inline NEONLane operator*(NEONLane a, NEONLane b)
+{
+  return {vmulq_f32(a.v, b.v)};
+}
+
+inline NEONLane operator/(NEONLane a, NEONLane b)
+{
+  return {vdivq_f32(a.v, b.v)};
+}
+
+inline NEONMask operator>(NEONLane a, NEONLane b)
+{
+  return {vcgtq_f32(a.v, b.v)};
+}
+
+inline NEONMask operator<=(NEONLane a, NEONLane b)
+{
+  return {vcleq_f32(a.v, b.v)};
+}
+
+inline NEONMask operator==(NEONLane a, NEONLane b)
+{
+  return {vceqq_f32(a.v, b.v)};
+}
+
+inline NEONMask And(NEONMask a, NEONMask b)
+{
+  return {vandq_u32(a.v, b.v)};
+}
+
+inline NEONMask Or(NEONMask a, NEONMask b)
+{
+  return {vorrq_u32(a.v, b.v)};
+}
+
+inline NEONLane Select(NEONMask mask, NEONLane a, NEONLane b)
+{
+  return {vbslq_f32(mask.v, a.v, b.v)};
+}
+
+inline NEONLane Sqrt(NEONLane a)
+{
+  return {vsqrtq_f32(a.v)};
+}
+
+/**
+ * @brief Multiplies the matrices one by one, each row of the result being the
+ * right matrix rows weighted by the row of the left matrix.
+ */
+void MultiplyMatrices(const float* left, const float* right, float* result,
+                      size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    const auto* l = left + i * 16;
+    const auto* r = right + i * 16;
+    const auto r0 = vld1q_f32(r);
+    const auto r1 = vld1q_f32(r + 4);
+    const auto r2 = vld1q_f32(r + 8);
+    const auto r3 = vld1q_f32(r + 12);
+
+    float32x4_t rows[4];
+    for (size_t row = 0; row < 4; ++row) {
+      const auto* lr = l + row * 4;
+      auto sum       = vmulq_n_f32(r0, lr[0]);
+      sum            = vaddq_f32(sum, vmulq_n_f32(r1, lr[1]));
+      sum            = vaddq_f32(sum, vmulq_n_f32(r2, lr[2]));
+      rows[row]      = vaddq_f32(sum, vmulq_n_f32(r3, lr[3]));
+    }
+
+    auto* res = result + i * 16;
+    for (size_t row = 0; row < 4; ++row) {
+      vst1q_f32(res + row * 4, rows[row]);
+    }
+  }
+}
+
+const MathKernels neonKernels{
+  SIMDInstructionSet::NEON,                //
+  &MultiplyMatrices,                       //
+  &detail::InvertMatrices<NEONLane>,       //
+  &detail::TransformCoordinates<NEONLane>, //
+  &detail::ComposeMatrices<NEONLane>,      //
+  &detail::DecomposeMatrices<NEONLane>,    //
+  &detail::CullBoundingVolumes<NEONLane>,  //
+  &detail::UpdateParticles<NEONLane>,      //
+};
+
+} // end of anonymous namespace
+
+const MathKernels* MathKernels::_NEONKernels()
+{
+  return &neonKernels;
+}
+
+} // end of namespace BABYLON
+
+#else
+
+namespace BABYLON {
+
+const MathKernels* MathKernels::_NEONKernels()
+{
+  return nullptr;
+}
+
+} // end of namespace BABYLON
+
+#endif
@@ -0,0 +1,118 @@
+#include <babylon/math/math_kernels.h>
+
+#include <cmath>
+
+#include <babylon/math/math_kernels_lanes.h>
+
+namespace BABYLON {
+
+namespace {
+
+struct ScalarMask {
+  bool v;
+}; // end of struct ScalarMask
+
+/**
+ * @brief Single lane, the portable implementation of the kernels.
+ */
+struct ScalarLane {
+  using Mask                    = ScalarMask;
+  static constexpr size_t Width = 1;
+
+  static ScalarLane Load(const float* data, size_t /*stride*/)
+  {
+    return {*data};
+  }
+
+  static ScalarLane Splat(float value)
+  {
+    return {value};
+  }
+
+  void store(float* data, size_t /*stride*/) const
+  {
+    *data = v;
+  }
+
+  float v;
+}; // end of struct ScalarLane
+
+inline ScalarLane operator+(ScalarLane a, ScalarLane b)
+{
+  return {a.v + b.v};
+}
+
+inline ScalarLane operator-(ScalarLane a, ScalarLane b)
+{
+  return {a.v - b.v};
+}
+
+inline ScalarLane operator-(ScalarLane a)
+{
+  return {-a.v};
+}
+
+inline ScalarLane operator*(ScalarLane a, ScalarLane b)
+{
+  return {a.v * b.v};
+}
+
+inline ScalarLane operator/(ScalarLane a, ScalarLane b)
+{
+  return {a.v / b.v};
+}
+
+inline ScalarMask operator>(ScalarLane a, ScalarLane b)
+{
+  return {a.v > b.v};
+}
+
+inline ScalarMask operator<=(ScalarLane a, ScalarLane b)
+{
+  return {a.v <= b.v};
+}
+
+inline ScalarMask operator==(ScalarLane a, ScalarLane b)
+{
+  return {a.v == b.v};
+}
+
+inline ScalarMask And(ScalarMask a, ScalarMask b)
+{
+  return {a.v && b.v};
+}
+
+inline ScalarMask Or(ScalarMask a, ScalarMask b)
+{
+  return {a.v || b.v};
+}
+
+inline ScalarLane Select(ScalarMask mask, ScalarLane a, ScalarLane b)
+{
+  return mask.v ? a : b;
+}
+
+inline ScalarLane Sqrt(ScalarLane a)
+{
+  return {std::sqrt(a.v)};
+}
+
+const MathKernels scalarKernels{
+  SIMDInstructionSet::Scalar,                //
+  &detail::MultiplyMatrices<ScalarLane>,     //
+  &detail::InvertMatrices<ScalarLane>,       //
+  &detail::TransformCoordinates<ScalarLane>, //
+  &detail::ComposeMatrices<ScalarLane>,      //
+  &detail::DecomposeMatrices<ScalarLane>,    //
+  &detail::CullBoundingVolumes<ScalarLane>,  //
+  &detail::UpdateParticles<ScalarLane>,      //
+};
+
+} // end of anonymous namespace
+
+const MathKernels& MathKernels::Scalar()
+{
+  return scalarKernels;
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,184 @@
+#include <babylon/math/math_kernels.h>
+
+// This translation unit is compiled with SSE 4.1 enabled, it must not define
+// or instantiate any code shared with the rest of the library
+#if defined(__SSE4_1__)                                                        \
+  || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
+#define BABYLON_MATH_KERNELS_SSE4 1
+#endif
+
+#if BABYLON_MATH_KERNELS_SSE4
+
+#include <smmintrin.h>
+
+#include <babylon/math/math_kernels_lanes.h>
+
+namespace BABYLON {
+
+namespace {
+
+struct SSE4Mask {
+  __m128 v;
+}; // end of struct SSE4Mask
+
+/**
+ * @brief 4 lanes stored in a SSE register.
+ */
+struct SSE4Lane {
+  using Mask                    = SSE4Mask;
+  static constexpr size_t Width = 4;
+
+  static SSE4Lane Load(const float* data, size_t stride)
+  {
+    if (stride == 1) {
+      return {_mm_loadu_ps(data)};
+    }
+    return {_mm_setr_ps(data[0], data[stride], data[2 * stride],
+                        data[3 * stride])};
+  }
+
+  static SSE4Lane Splat(float value)
+  {
+    return {_mm_set1_ps(value)};
+  }
+
+  void store(float* data, size_t stride) const
+  {
+    if (stride == 1) {
+      _mm_storeu_ps(data, v);
+      return;
+    }
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, v);
+    data[0]          = lanes[0];
+    data[stride]     = lanes[1];
+    data[2 * stride] = lanes[2];
+    data[3 * stride] = lanes[3];
+  }
+
+  __m128 v;
+}; // end of struct SSE4Lane
+
+inline SSE4Lane operator+(SSE4Lane a, SSE4Lane b)
+{
+  return {_mm_add_ps(a.v, b.v)};
+}
+
+inline SSE4Lane operator-(SSE4Lane a, SSE4Lane b)
+{
+  return {_mm_sub_ps(a.v, b.v)};
+}
+
+inline SSE4Lane operator-(SSE4Lane a)
+{
+  return {_mm_xor_ps(a.v, _mm_set1_ps(-0.f))};
+}
+
+inline SSE4Lane operator*(SSE4Lane a, SSE4Lane b)
+{
+  return {_mm_mul_ps(a.v, b.v)};
+}
+
+inline SSE4Lane operator/(SSE4Lane a, SSE4Lane b)
+{
+  return {_mm_div_ps(a.v, b.v)};
+}
+
+inline SSE4Mask operator>(SSE4Lane a, SSE4Lane b)
+{
+  return {_mm_cmpgt_ps(a.v, b.v)};
+}
+
+inline SSE4Mask operator<=(SSE4Lane a, SSE4Lane b)
+{
+  return {_mm_cmple_ps(a.v, b.v)};
+}
+
+inline SSE4Mask operator==(SSE4Lane a, SSE4Lane b)
+{
+  return {_mm_cmpeq_ps(a.v, b.v)};
+}
+
+inline SSE4Mask And(SSE4Mask a, SSE4Mask b)
+{
+  return {_mm_and_ps(a.v, b.v)};
+}
+
+inline SSE4Mask Or(SSE4Mask a, SSE4Mask b)
+{
+  return {_mm_or_ps(a.v, b.v)};
+}
+
+inline SSE4Lane Select(SSE4Mask mask, SSE4Lane a, SSE4Lane b)
+{
+  return {_mm_blendv_ps(b.v, a.v, mask.v)};
+}
+
+inline SSE4Lane Sqrt(SSE4Lane a)
+{
+  return {_mm_sqrt_ps(a.v)};
+}
+
+/**
+ * @brief Multiplies the matrices one by one, each row of the result being the
+ * right matrix rows weighted by the row of the left matrix.
+ */
+void MultiplyMatrices(const float* left, const float* right, float* result,
+                      size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    const auto* l = left + i * 16;
+    const auto* r = right + i * 16;
+    const auto r0 = _mm_loadu_ps(r);
+    const auto r1 = _mm_loadu_ps(r + 4);
+    const auto r2 = _mm_loadu_ps(r + 8);
+    const auto r3 = _mm_loadu_ps(r + 12);
+
+    __m128 rows[4];
+    for (size_t row = 0; row < 4; ++row) {
+      const auto* lr = l + row * 4;
+      auto sum       = _mm_mul_ps(_mm_set1_ps(lr[0]), r0);
+      sum            = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(lr[1]), r1));
+      sum            = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(lr[2]), r2));
+      rows[row]      = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(lr[3]), r3));
+    }
+
+    auto* res = result + i * 16;
+    for (size_t row = 0; row < 4; ++row) {
+      _mm_storeu_ps(res + row * 4, rows[row]);
+    }
+  }
+}
+
+const MathKernels sse4Kernels{
+  SIMDInstructionSet::SSE4,                //
+  &MultiplyMatrices,                       //
+  &detail::InvertMatrices<SSE4Lane>,       //
+  &detail::TransformCoordinates<SSE4Lane>, //
+  &detail::ComposeMatrices<SSE4Lane>,      //
+  &detail::DecomposeMatrices<SSE4Lane>,    //
+  &detail::CullBoundingVolumes<SSE4Lane>,  //
+  &detail::UpdateParticles<SSE4Lane>,      //
+};
+
+} // end of anonymous namespace
+
+const MathKernels* MathKernels::_SSE4Kernels()
+{
+  return &sse4Kernels;
+}
+
+} // end of namespace BABYLON
+
+#else
+
+namespace BABYLON {
+
+const MathKernels* MathKernels::_SSE4Kernels()
+{
+  return nullptr;
+}
+
+} // end of namespace BABYLON
+
+#endif
@@ -6,12 +6,26 @@
 
 namespace BABYLON {
 
-std::array<Vector3, 6> MathTmp::Vector3Array{
-  {Vector3::Zero(), Vector3::Zero(), Vector3::Zero(), Vector3::Zero(),
-   Vector3::Zero(), Vector3::Zero()}};
-std::array<Matrix, 2> MathTmp::MatrixArray{
-  {Matrix::Identity(), Matrix::Identity()}};
-std::array<Quaternion, 3> MathTmp::QuaternionArray{
-  {Quaternion::Zero(), Quaternion::Zero(), Quaternion::Zero()}};
+std::array<Vector3, 6>& MathTmp::Vector3Array()
+{
+  thread_local std::array<Vector3, 6> vector3Array{
+    {Vector3::Zero(), Vector3::Zero(), Vector3::Zero(), Vector3::Zero(),
+     Vector3::Zero(), Vector3::Zero()}};
+  return vector3Array;
+}
+
+std::array<Matrix, 2>& MathTmp::MatrixArray()
+{
+  thread_local std::array<Matrix, 2> matrixArray{
+    {Matrix::Identity(), Matrix::Identity()}};
+  return matrixArray;
+}
+
+std::array<Quaternion, 3>& MathTmp::QuaternionArray()
+{
+  thread_local std::array<Quaternion, 3> quaternionArray{
+    {Quaternion::Zero(), Quaternion::Zero(), Quaternion::Zero()}};
+  return quaternionArray;
+}
 
 } // end of namespace BABYLON
@@ -3,6 +3,7 @@
 #include <babylon/babylon_stl_util.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/cameras/vr/vr_fov.h>
+#include <babylon/math/math_kernels.h>
 #include <babylon/math/math_tmp.h>
 #include <babylon/math/plane.h>
 #include <babylon/math/quaternion.h>
@@ -13,7 +14,7 @@
 
 namespace BABYLON {
 
-int Matrix::_updateFlagSeed      = 0;
+std::atomic<unsigned int> Matrix::_updateFlagSeed{0};
 Matrix Matrix::_identityReadOnly = Matrix::Identity();
 
 Matrix::Matrix()
@@ -100,11 +101,17 @@ const std::array<float, 16>& Matrix::m() const
   return _m;
 }
 
+int Matrix::_NextUpdateFlag()
+{
+  // The seed is shared by the matrices updated on the worker threads, it wraps
+  // around without overflow and the flags stay positive
+  constexpr unsigned int maxFlag = std::numeric_limits<int>::max();
+  return static_cast<int>(Matrix::_updateFlagSeed.fetch_add(1) % maxFlag);
+}
+
 void Matrix::_markAsUpdated()
 {
-  updateFlag = (Matrix::_updateFlagSeed < std::numeric_limits<int>::max()) ?
-                 Matrix::_updateFlagSeed++ :
-                 0;
+  updateFlag          = Matrix::_NextUpdateFlag();
   _isIdentity         = false;
   _isIdentity3x2      = false;
   _isIdentityDirty    = true;
@@ -114,7 +121,7 @@ void Matrix::_markAsUpdated()
 void Matrix::_updateIdentityStatus(bool isIdentity, bool isIdentityDirty,
                                    bool isIdentity3x2, bool isIdentity3x2Dirty)
 {
-  updateFlag          = Matrix::_updateFlagSeed++;
+  updateFlag          = Matrix::_NextUpdateFlag();
   _isIdentity         = isIdentity;
   _isIdentity3x2      = isIdentity || isIdentity3x2;
   _isIdentityDirty    = _isIdentity ? false : isIdentityDirty;
@@ -275,9 +282,6 @@ Matrix& Matrix::addToSelf(const Matrix& other)
 
 Matrix& Matrix::invertToRef(Matrix& other)
 {
-#if BABYLONCPP_OPTION_ENABLE_SIMD == true
-  simdMatrix.invertToRefSIMD(other);
-#else
   if (_isIdentity == true) {
     Matrix::IdentityToRef(other);
     return *this;
@@ -350,7 +354,6 @@ Matrix& Matrix::invertToRef(Matrix& other)
                           cofact_03 * detInv, cofact_13 * detInv,
                           cofact_23 * detInv, cofact_33 * detInv, //
                           other);
-#endif
   return *this;
 }
 
@@ -498,43 +501,8 @@ const Matrix& Matrix::multiplyToArray(const Matrix& other,
                                       std::array<float, 16>& result,
                                       unsigned int offset) const
 {
-#if BABYLONCPP_OPTION_ENABLE_SIMD == true
-  simdMatrix.multiplyToArraySIMD(other, result, offset);
-#else
-  const auto& m      = _m;
-  const auto& otherM = other.m();
-  const auto tm0 = m[0], tm1 = m[1], tm2 = m[2], tm3 = m[3];
-  const auto tm4 = m[4], tm5 = m[5], tm6 = m[6], tm7 = m[7];
-  const auto tm8 = m[8], tm9 = m[9], tm10 = m[10], tm11 = m[11];
-  const auto tm12 = m[12], tm13 = m[13], tm14 = m[14], tm15 = m[15];
-
-  const auto om0 = otherM[0], om1 = otherM[1], om2 = otherM[2], om3 = otherM[3];
-  const auto om4 = otherM[4], om5 = otherM[5], om6 = otherM[6], om7 = otherM[7];
-  const auto om8 = otherM[8], om9 = otherM[9], om10 = otherM[10],
-             om11 = otherM[11];
-  const auto om12 = otherM[12], om13 = otherM[13], om14 = otherM[14],
-             om15 = otherM[15];
-
-  result[offset]     = tm0 * om0 + tm1 * om4 + tm2 * om8 + tm3 * om12;
-  result[offset + 1] = tm0 * om1 + tm1 * om5 + tm2 * om9 + tm3 * om13;
-  result[offset + 2] = tm0 * om2 + tm1 * om6 + tm2 * om10 + tm3 * om14;
-  result[offset + 3] = tm0 * om3 + tm1 * om7 + tm2 * om11 + tm3 * om15;
-
-  result[offset + 4] = tm4 * om0 + tm5 * om4 + tm6 * om8 + tm7 * om12;
-  result[offset + 5] = tm4 * om1 + tm5 * om5 + tm6 * om9 + tm7 * om13;
-  result[offset + 6] = tm4 * om2 + tm5 * om6 + tm6 * om10 + tm7 * om14;
-  result[offset + 7] = tm4 * om3 + tm5 * om7 + tm6 * om11 + tm7 * om15;
-
-  result[offset + 8]  = tm8 * om0 + tm9 * om4 + tm10 * om8 + tm11 * om12;
-  result[offset + 9]  = tm8 * om1 + tm9 * om5 + tm10 * om9 + tm11 * om13;
-  result[offset + 10] = tm8 * om2 + tm9 * om6 + tm10 * om10 + tm11 * om14;
-  result[offset + 11] = tm8 * om3 + tm9 * om7 + tm10 * om11 + tm11 * om15;
-
-  result[offset + 12] = tm12 * om0 + tm13 * om4 + tm14 * om8 + tm15 * om12;
-  result[offset + 13] = tm12 * om1 + tm13 * om5 + tm14 * om9 + tm15 * om13;
-  result[offset + 14] = tm12 * om2 + tm13 * om6 + tm14 * om10 + tm15 * om14;
-  result[offset + 15] = tm12 * om3 + tm13 * om7 + tm14 * om11 + tm15 * om15;
-#endif
+  MathKernels::Get().multiplyMatrices(_m.data(), other.m().data(),
+                                      result.data() + offset, 1);
 
   return *this;
 }
@@ -546,43 +514,8 @@ const Matrix& Matrix::multiplyToArray(const Matrix& other, Float32Array& result,
     return *this;
   }
 
-#if BABYLONCPP_OPTION_ENABLE_SIMD == true
-  simdMatrix.multiplyToArraySIMD(other, result, offset);
-#else
-  const auto& m       = _m;
-  const auto& otherM  = other.m();
-  const auto tm0 = m[0], tm1 = m[1], tm2 = m[2], tm3 = m[3];
-  const auto tm4 = m[4], tm5 = m[5], tm6 = m[6], tm7 = m[7];
-  const auto tm8 = m[8], tm9 = m[9], tm10 = m[10], tm11 = m[11];
-  const auto tm12 = m[12], tm13 = m[13], tm14 = m[14], tm15 = m[15];
-
-  const auto om0 = otherM[0], om1 = otherM[1], om2 = otherM[2], om3 = otherM[3];
-  const auto om4 = otherM[4], om5 = otherM[5], om6 = otherM[6], om7 = otherM[7];
-  const auto om8 = otherM[8], om9 = otherM[9], om10 = otherM[10],
-             om11 = otherM[11];
-  const auto om12 = otherM[12], om13 = otherM[13], om14 = otherM[14],
-             om15 = otherM[15];
-
-  result[offset]     = tm0 * om0 + tm1 * om4 + tm2 * om8 + tm3 * om12;
-  result[offset + 1] = tm0 * om1 + tm1 * om5 + tm2 * om9 + tm3 * om13;
-  result[offset + 2] = tm0 * om2 + tm1 * om6 + tm2 * om10 + tm3 * om14;
-  result[offset + 3] = tm0 * om3 + tm1 * om7 + tm2 * om11 + tm3 * om15;
-
-  result[offset + 4] = tm4 * om0 + tm5 * om4 + tm6 * om8 + tm7 * om12;
-  result[offset + 5] = tm4 * om1 + tm5 * om5 + tm6 * om9 + tm7 * om13;
-  result[offset + 6] = tm4 * om2 + tm5 * om6 + tm6 * om10 + tm7 * om14;
-  result[offset + 7] = tm4 * om3 + tm5 * om7 + tm6 * om11 + tm7 * om15;
-
-  result[offset + 8]  = tm8 * om0 + tm9 * om4 + tm10 * om8 + tm11 * om12;
-  result[offset + 9]  = tm8 * om1 + tm9 * om5 + tm10 * om9 + tm11 * om13;
-  result[offset + 10] = tm8 * om2 + tm9 * om6 + tm10 * om10 + tm11 * om14;
-  result[offset + 11] = tm8 * om3 + tm9 * om7 + tm10 * om11 + tm11 * om15;
-
-  result[offset + 12] = tm12 * om0 + tm13 * om4 + tm14 * om8 + tm15 * om12;
-  result[offset + 13] = tm12 * om1 + tm13 * om5 + tm14 * om9 + tm15 * om13;
-  result[offset + 14] = tm12 * om2 + tm13 * om6 + tm14 * om10 + tm15 * om14;
-  result[offset + 15] = tm12 * om3 + tm13 * om7 + tm14 * om11 + tm15 * om15;
-#endif
+  MathKernels::Get().multiplyMatrices(_m.data(), other.m().data(),
+                                      result.data() + offset, 1);
 
   return *this;
 }
@@ -639,7 +572,7 @@ bool Matrix::decompose(std::optional<Vector3> scale,
     translation->copyFromFloats(m[12], m[13], m[14]);
   }
 
-  scale    = scale ? scale : MathTmp::Vector3Array[0];
+  scale    = scale ? scale : MathTmp::Vector3Array()[0];
   scale->x = std::sqrt(m[0] * m[0] + m[1] * m[1] + m[2] * m[2]);
   scale->y = std::sqrt(m[4] * m[4] + m[5] * m[5] + m[6] * m[6]);
   scale->z = std::sqrt(m[8] * m[8] + m[9] * m[9] + m[10] * m[10]);
@@ -661,9 +594,9 @@ bool Matrix::decompose(std::optional<Vector3> scale,
                             m[4] * sy, m[5] * sy, m[6] * sy, 0.0,  //
                             m[8] * sz, m[9] * sz, m[10] * sz, 0.0, //
                             0.f, 0.f, 0.f, 1.f,                    //
-                            MathTmp::MatrixArray[0]);
+                            MathTmp::MatrixArray()[0]);
 
-    Quaternion::FromRotationMatrixToRef(MathTmp::MatrixArray[0], *rotation);
+    Quaternion::FromRotationMatrixToRef(MathTmp::MatrixArray()[0], *rotation);
   }
 
   return true;
@@ -743,7 +676,7 @@ const Matrix& Matrix::scaleAndAddToRef(float iscale, Matrix& result) const
 
 void Matrix::toNormalMatrix(Matrix& ref)
 {
-  auto& tmp = MathTmp::MatrixArray[0];
+  auto& tmp = MathTmp::MatrixArray()[0];
   invertToRef(tmp);
   tmp.transposeToRef(ref);
   const auto& m = ref._m;
@@ -763,7 +696,7 @@ Matrix Matrix::getRotationMatrix() const
 
 const Matrix& Matrix::getRotationMatrixToRef(Matrix& result) const
 {
-  auto& scale = MathTmp::Vector3Array[0];
+  auto& scale = MathTmp::Vector3Array()[0];
   if (!decompose(scale, std::nullopt, std::nullopt)) {
     Matrix::IdentityToRef(result);
     return *this;
@@ -1158,8 +1091,8 @@ void Matrix::RotationYawPitchRollToRef(float yaw, float pitch, float roll,
                                        Matrix& result)
 {
   Quaternion::RotationYawPitchRollToRef(yaw, pitch, roll,
-                                        MathTmp::QuaternionArray[0]);
-  MathTmp::QuaternionArray[0].toRotationMatrix(result);
+                                        MathTmp::QuaternionArray()[0]);
+  MathTmp::QuaternionArray()[0].toRotationMatrix(result);
 }
 
 Matrix Matrix::Scaling(float x, float y, float z)
@@ -1228,22 +1161,22 @@ Matrix Matrix::DecomposeLerp(Matrix& startValue, Matrix& endValue,
 void Matrix::DecomposeLerpToRef(Matrix& startValue, Matrix& endValue,
                                 float gradient, Matrix& result)
 {
-  auto& startScale       = MathTmp::Vector3Array[0];
-  auto& startRotation    = MathTmp::QuaternionArray[0];
-  auto& startTranslation = MathTmp::Vector3Array[1];
+  auto& startScale       = MathTmp::Vector3Array()[0];
+  auto& startRotation    = MathTmp::QuaternionArray()[0];
+  auto& startTranslation = MathTmp::Vector3Array()[1];
   startValue.decompose(startScale, startRotation, startTranslation);
 
-  auto& endScale       = MathTmp::Vector3Array[2];
-  auto& endRotation    = MathTmp::QuaternionArray[1];
-  auto& endTranslation = MathTmp::Vector3Array[3];
+  auto& endScale       = MathTmp::Vector3Array()[2];
+  auto& endRotation    = MathTmp::QuaternionArray()[1];
+  auto& endTranslation = MathTmp::Vector3Array()[3];
   endValue.decompose(endScale, endRotation, endTranslation);
 
-  auto& resultScale = MathTmp::Vector3Array[4];
+  auto& resultScale = MathTmp::Vector3Array()[4];
   Vector3::LerpToRef(startScale, endScale, gradient, resultScale);
-  auto& resultRotation = MathTmp::QuaternionArray[2];
+  auto& resultRotation = MathTmp::QuaternionArray()[2];
   Quaternion::SlerpToRef(startRotation, endRotation, gradient, resultRotation);
 
-  auto& resultTranslation = MathTmp::Vector3Array[5];
+  auto& resultTranslation = MathTmp::Vector3Array()[5];
   Vector3::LerpToRef(startTranslation, endTranslation, gradient,
                      resultTranslation);
 
@@ -1260,12 +1193,9 @@ Matrix Matrix::LookAtLH(const Vector3& eye, Vector3& target, const Vector3& up)
 void Matrix::LookAtLHToRef(const Vector3& eye, const Vector3& target,
                            const Vector3& up, Matrix& result)
 {
-#if BABYLONCPP_OPTION_ENABLE_SIMD == true
-  SIMD::SIMDMatrix::LookAtLHToRefSIMD(eye, target, up, result);
-#else
-  auto& xAxis         = MathTmp::Vector3Array[0];
-  auto& yAxis         = MathTmp::Vector3Array[1];
-  auto& zAxis         = MathTmp::Vector3Array[2];
+  auto& xAxis         = MathTmp::Vector3Array()[0];
+  auto& yAxis         = MathTmp::Vector3Array()[1];
+  auto& zAxis         = MathTmp::Vector3Array()[2];
 
   // Z axis
   target.subtractToRef(eye, zAxis);
@@ -1296,7 +1226,6 @@ void Matrix::LookAtLHToRef(const Vector3& eye, const Vector3& target,
                           xAxis.z, yAxis.z, zAxis.z, 0.f, //
                           ex, ey, ez, 1.f,                //
                           result);
-#endif
 }
 
 Matrix Matrix::LookAtRH(const Vector3& eye, Vector3& target, const Vector3& up)
@@ -1310,9 +1239,9 @@ Matrix Matrix::LookAtRH(const Vector3& eye, Vector3& target, const Vector3& up)
 void Matrix::LookAtRHToRef(const Vector3& eye, const Vector3& target,
                            const Vector3& up, Matrix& result)
 {
-  auto& xAxis = MathTmp::Vector3Array[0];
-  auto& yAxis = MathTmp::Vector3Array[1];
-  auto& zAxis = MathTmp::Vector3Array[2];
+  auto& xAxis = MathTmp::Vector3Array()[0];
+  auto& yAxis = MathTmp::Vector3Array()[1];
+  auto& zAxis = MathTmp::Vector3Array()[2];
 
   // Z axis
   eye.subtractToRef(target, zAxis);
@@ -1548,7 +1477,7 @@ Matrix Matrix::GetFinalMatrix(const Viewport& viewport, Matrix& world,
                          0.f, 0.f, zmax - zmin, 0.f, //
                          cx + cw / 2.f, ch / 2.f + cy, zmin, 1.f);
 
-  auto& matrix = MathTmp::MatrixArray[0];
+  auto& matrix = MathTmp::MatrixArray()[0];
   world.multiplyToRef(view, matrix);
   matrix.multiplyToRef(projection, matrix);
   return matrix.multiply(viewportMatrix);
@@ -110,7 +110,7 @@ Plane& Plane::normalize()
 
 Plane Plane::transform(const Matrix& transformation) const
 {
-  auto& transposedMatrix = MathTmp::MatrixArray[0];
+  auto& transposedMatrix = MathTmp::MatrixArray()[0];
   Matrix::TransposeToRef(transformation, transposedMatrix);
   const auto& m = transposedMatrix.m();
   const auto x  = normal.x;
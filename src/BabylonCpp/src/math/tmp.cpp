@@ -10,25 +10,59 @@
 
 namespace BABYLON {
 
-std::array<Color3, 3> Tmp::Color3Array{
-  {Color3::Black(), Color3::Black(), Color3::Black()}};
-std::array<Color4, 3> Tmp::Color4Array{{Color4(0.f, 0.f, 0.f, 0.f),
-                                        Color4(0.f, 0.f, 0.f, 0.f),
-                                        Color4(0.f, 0.f, 0.f, 0.f)}};
-std::array<Vector2, 3> Tmp::Vector2Array{
-  {Vector2::Zero(), Vector2::Zero(), Vector2::Zero()}};
-std::array<Vector3, 13> Tmp::Vector3Array{
-  {Vector3::Zero(), Vector3::Zero(), Vector3::Zero(), Vector3::Zero(),
-   Vector3::Zero(), Vector3::Zero(), Vector3::Zero(), Vector3::Zero(),
-   Vector3::Zero(), Vector3::Zero(), Vector3::Zero(), Vector3::Zero(),
-   Vector3::Zero()}};
-std::array<Vector4, 3> Tmp::Vector4Array{
-  {Vector4::Zero(), Vector4::Zero(), Vector4::Zero()}};
-std::array<Quaternion, 2> Tmp::QuaternionArray{
-  {Quaternion::Zero(), Quaternion::Zero()}};
-std::array<Matrix, 8> Tmp::MatrixArray{
-  {Matrix::Identity(), Matrix::Identity(), Matrix::Identity(),
-   Matrix::Identity(), Matrix::Identity(), Matrix::Identity(),
-   Matrix::Identity(), Matrix::Identity()}};
+std::array<Color3, 3>& Tmp::Color3Array()
+{
+  thread_local std::array<Color3, 3> color3Array{
+    {Color3::Black(), Color3::Black(), Color3::Black()}};
+  return color3Array;
+}
+
+std::array<Color4, 3>& Tmp::Color4Array()
+{
+  thread_local std::array<Color4, 3> color4Array{
+    {Color4(0.f, 0.f, 0.f, 0.f), Color4(0.f, 0.f, 0.f, 0.f),
+     Color4(0.f, 0.f, 0.f, 0.f)}};
+  return color4Array;
+}
+
+std::array<Vector2, 3>& Tmp::Vector2Array()
+{
+  thread_local std::array<Vector2, 3> vector2Array{
+    {Vector2::Zero(), Vector2::Zero(), Vector2::Zero()}};
+  return vector2Array;
+}
+
+std::array<Vector3, 13>& Tmp::Vector3Array()
+{
+  thread_local std::array<Vector3, 13> vector3Array{
+    {Vector3::Zero(), Vector3::Zero(), Vector3::Zero(), Vector3::Zero(),
+     Vector3::Zero(), Vector3::Zero(), Vector3::Zero(), Vector3::Zero(),
+     Vector3::Zero(), Vector3::Zero(), Vector3::Zero(), Vector3::Zero(),
+     Vector3::Zero()}};
+  return vector3Array;
+}
+
+std::array<Vector4, 3>& Tmp::Vector4Array()
+{
+  thread_local std::array<Vector4, 3> vector4Array{
+    {Vector4::Zero(), Vector4::Zero(), Vector4::Zero()}};
+  return vector4Array;
+}
+
+std::array<Quaternion, 2>& Tmp::QuaternionArray()
+{
+  thread_local std::array<Quaternion, 2> quaternionArray{
+    {Quaternion::Zero(), Quaternion::Zero()}};
+  return quaternionArray;
+}
+
+std::array<Matrix, 8>& Tmp::MatrixArray()
+{
+  thread_local std::array<Matrix, 8> matrixArray{
+    {Matrix::Identity(), Matrix::Identity(), Matrix::Identity(),
+     Matrix::Identity(), Matrix::Identity(), Matrix::Identity(),
+     Matrix::Identity(), Matrix::Identity()}};
+  return matrixArray;
+}
 
 } // end of namespace BABYLON
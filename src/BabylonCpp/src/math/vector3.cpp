@@ -9,11 +9,6 @@
 #include <babylon/math/vector3.h>
 #include <babylon/math/viewport.h>
 
-// SIMD
-#if BABYLONCPP_OPTION_ENABLE_SIMD == true
-#include <babylon/math/simd/simd_vector3.h>
-#endif
-
 namespace BABYLON {
 
 const Vector3 Vector3::_UpReadOnly = Vector3::Up();
@@ -527,18 +522,18 @@ Vector3& Vector3::reorderInPlace(std::string order)
 Vector3& Vector3::rotateByQuaternionToRef(const Quaternion& quaternion,
                                           Vector3& result)
 {
-  quaternion.toRotationMatrix(MathTmp::MatrixArray[0]);
-  Vector3::TransformCoordinatesToRef(*this, MathTmp::MatrixArray[0], result);
+  quaternion.toRotationMatrix(MathTmp::MatrixArray()[0]);
+  Vector3::TransformCoordinatesToRef(*this, MathTmp::MatrixArray()[0], result);
   return result;
 }
 
 Vector3& Vector3::rotateByQuaternionAroundPointToRef(
   const Quaternion& quaternion, const Vector3& point, Vector3& result)
 {
-  subtractToRef(point, MathTmp::Vector3Array[0]);
-  MathTmp::Vector3Array[0].rotateByQuaternionToRef(quaternion,
-                                                   MathTmp::Vector3Array[0]);
-  point.addToRef(MathTmp::Vector3Array[0], result);
+  subtractToRef(point, MathTmp::Vector3Array()[0]);
+  MathTmp::Vector3Array()[0].rotateByQuaternionToRef(quaternion,
+                                                   MathTmp::Vector3Array()[0]);
+  point.addToRef(MathTmp::Vector3Array()[0], result);
   return result;
 }
 
@@ -609,10 +604,10 @@ float Vector3::GetAngleBetweenVectors(const Vector3& vector0,
                                       const Vector3& vector1,
                                       const Vector3& normal)
 {
-  const auto v0  = vector0.normalizeToRef(MathTmp::Vector3Array[1]);
-  const auto v1  = vector1.normalizeToRef(MathTmp::Vector3Array[2]);
+  const auto v0  = vector0.normalizeToRef(MathTmp::Vector3Array()[1]);
+  const auto v1  = vector1.normalizeToRef(MathTmp::Vector3Array()[2]);
   const auto dot = Vector3::Dot(v0, v1);
-  auto& n        = MathTmp::Vector3Array[3];
+  auto& n        = MathTmp::Vector3Array()[3];
   Vector3::CrossToRef(v0, v1, n);
   if (Vector3::Dot(n, normal) > 0.f) {
     return std::acos(dot);
@@ -715,23 +710,14 @@ void Vector3::TransformCoordinatesToRef(const Vector3& vector,
                                         const Matrix& transformation,
                                         Vector3& result)
 {
-#if BABYLONCPP_OPTION_ENABLE_SIMD == true
-  SIMD::SIMDVector3::TransformCoordinatesToRefSIMD(vector, transformation,
-                                                   result);
-#else
   Vector3::TransformCoordinatesFromFloatsToRef(vector.x, vector.y, vector.z,
                                                transformation, result);
-#endif
 }
 
 void Vector3::TransformCoordinatesFromFloatsToRef(float x, float y, float z,
                                                   const Matrix& transformation,
                                                   Vector3& result)
 {
-#if BABYLONCPP_OPTION_ENABLE_SIMD == true
-  SIMD::SIMDVector3::TransformCoordinatesFromFloatsToRefSIMD(
-    x, y, z, transformation, result);
-#else
   const auto& m = transformation.m();
   const auto rx = x * m[0] + y * m[4] + z * m[8] + m[12];
   const auto ry = x * m[1] + y * m[5] + z * m[9] + m[13];
@@ -741,7 +727,6 @@ void Vector3::TransformCoordinatesFromFloatsToRef(float x, float y, float z,
   result.x = rx * rw;
   result.y = ry * rw;
   result.z = rz * rw;
-#endif
 }
 
 Vector3 Vector3::TransformNormal(const Vector3& vector,
@@ -917,7 +902,7 @@ Vector3 Vector3::Project(const Vector3& vector, Matrix& world,
   const auto cx = static_cast<float>(viewport.x);
   const auto cy = static_cast<float>(viewport.y);
 
-  auto& viewportMatrix = MathTmp::MatrixArray[1];
+  auto& viewportMatrix = MathTmp::MatrixArray()[1];
 
   Matrix::FromValuesToRef(cw / 2.f, 0.f, 0.f, 0.f,  //
                           0.f, -ch / 2.f, 0.f, 0.f, //
@@ -925,7 +910,7 @@ Vector3 Vector3::Project(const Vector3& vector, Matrix& world,
                           cx + cw / 2.f, ch / 2.f + cy, 0.5f, 1.f,
                           viewportMatrix);
 
-  auto& matrix = MathTmp::MatrixArray[0];
+  auto& matrix = MathTmp::MatrixArray()[0];
   world.multiplyToRef(transform, matrix);
   matrix.multiplyToRef(viewportMatrix, matrix);
 
@@ -948,7 +933,7 @@ Vector3 Vector3::UnprojectFromTransform(Vector3& source, float viewportWidth,
                                         float viewportHeight, Matrix& world,
                                         Matrix& transform)
 {
-  auto& matrix = MathTmp::MatrixArray[0];
+  auto& matrix = MathTmp::MatrixArray()[0];
   world.multiplyToRef(transform, matrix);
   matrix.invert();
   source.x = source.x / viewportWidth * 2.f - 1.f;
@@ -985,11 +970,11 @@ void Vector3::UnprojectFloatsToRef(float sourceX, float sourceY, float sourceZ,
                                    Matrix& world, Matrix& view,
                                    Matrix& projection, Vector3& result)
 {
-  auto& matrix = MathTmp::MatrixArray[0];
+  auto& matrix = MathTmp::MatrixArray()[0];
   world.multiplyToRef(view, matrix);
   matrix.multiplyToRef(projection, matrix);
   matrix.invert();
-  auto& screenSource = MathTmp::Vector3Array[0];
+  auto& screenSource = MathTmp::Vector3Array()[0];
   screenSource.x     = sourceX / viewportWidth * 2.f - 1.f;
   screenSource.y     = -(sourceY / viewportHeight * 2.f - 1.f);
   screenSource.z     = 2.f * sourceZ - 1.f;
@@ -1042,7 +1027,7 @@ Vector3 Vector3::RotationFromAxis(Vector3& axis1, Vector3& axis2,
 void Vector3::RotationFromAxisToRef(Vector3& axis1, Vector3& axis2,
                                     Vector3& axis3, Vector3& ref)
 {
-  auto& quat = MathTmp::QuaternionArray[0];
+  auto& quat = MathTmp::QuaternionArray()[0];
   Quaternion::RotationQuaternionFromAxisToRef(axis1, axis2, axis3, quat);
   quat.toEulerAnglesToRef(ref);
 }
@@ -10,6 +10,7 @@
 #include <babylon/collisions/picking_info.h>
 #include <babylon/culling/bounding_box.h>
 #include <babylon/culling/bounding_info.h>
+#include <babylon/culling/mesh_bvh.h>
 #include <babylon/culling/octrees/octree_scene_component.h>
 #include <babylon/culling/ray.h>
 #include <babylon/engines/_occlusion_data_storage.h>
@@ -229,6 +230,29 @@ bool AbstractMesh::_updateNonUniformScalingState(bool value)
   return true;
 }
 
+bool AbstractMesh::_canBeEvaluatedConcurrently()
+{
+  if (!TransformNode::_canBeEvaluatedConcurrently() || skeleton()) {
+    return false;
+  }
+
+  // A change of the non uniform scaling state marks the (shared) materials as
+  // dirty
+  const auto isNonUniform
+    = !ignoreNonUniformScaling && scaling().isNonUniform();
+  return isNonUniform == get_nonUniformScaling();
+}
+
+bool AbstractMesh::_hasStandardFrustumTest() const
+{
+  return cullingStrategy == AbstractMesh::CULLINGSTRATEGY_STANDARD;
+}
+
+bool AbstractMesh::hasThinInstances() const
+{
+  return false;
+}
+
 void AbstractMesh::set_onCollide(
   const std::function<void(AbstractMesh*, EventState&)>& callback)
 {
@@ -770,12 +794,14 @@ AbstractMesh& AbstractMesh::disableEdgesRendering()
 
 AbstractMesh&
 AbstractMesh::enableEdgesRendering(float epsilon,
-                                   bool checkVerticesInsteadOfIndices)
+                                   bool checkVerticesInsteadOfIndices,
+                                   bool generateEdgesLinesInBackground)
 {
   disableEdgesRendering();
 
   _edgesRenderer = std::make_unique<EdgesRenderer>(
-    shared_from_base<AbstractMesh>(), epsilon, checkVerticesInsteadOfIndices);
+    shared_from_base<AbstractMesh>(), epsilon, checkVerticesInsteadOfIndices,
+    true, generateEdgesLinesInBackground);
 
   return *this;
 }
@@ -1056,9 +1082,9 @@ Float32Array AbstractMesh::_getPositionData(bool applySkeleton)
       skeleton()->prepare();
       auto skeletonMatrices = skeleton()->getTransformMatrices(this);
 
-      auto& tempVector  = Tmp::Vector3Array[0];
-      auto& finalMatrix = Tmp::MatrixArray[0];
-      auto& tempMatrix  = Tmp::MatrixArray[1];
+      auto& tempVector  = Tmp::Vector3Array()[0];
+      auto& finalMatrix = Tmp::MatrixArray()[0];
+      auto& tempMatrix  = Tmp::MatrixArray()[1];
 
       auto matWeightIdx = 0u;
       for (unsigned int index = 0; index < data.size();
@@ -1102,6 +1128,7 @@ Float32Array AbstractMesh::_getPositionData(bool applySkeleton)
         }
       }
     }
+    _resetBVH();
   }
 
   return data;
@@ -1109,14 +1136,17 @@ Float32Array AbstractMesh::_getPositionData(bool applySkeleton)
 
 AbstractMesh& AbstractMesh::_updateBoundingInfo()
 {
-  auto effectiveMesh = _effectiveMesh();
+  // The box enclosing the thin instances does not follow the mesh
+  static const auto identity = Matrix::Identity();
+  auto effectiveMesh         = _effectiveMesh();
+  const auto& worldMatrix
+    = hasThinInstances() ? identity : effectiveMesh->worldMatrixFromCache();
   if (_boundingInfo) {
-    _boundingInfo->update(effectiveMesh->worldMatrixFromCache());
+    _boundingInfo->update(worldMatrix);
   }
   else {
-    _boundingInfo
-      = std::make_unique<BoundingInfo>(absolutePosition(), absolutePosition(),
-                                       effectiveMesh->worldMatrixFromCache());
+    _boundingInfo = std::make_unique<BoundingInfo>(
+      absolutePosition(), absolutePosition(), worldMatrix);
   }
   _updateSubMeshesBoundingInfo(effectiveMesh->worldMatrixFromCache());
   return *this;
@@ -1428,10 +1458,49 @@ AbstractMesh& AbstractMesh::_collideForSubMesh(SubMesh* subMesh,
     }
   }
   // Collide
-  iCollider._collide(
-    subMesh->_trianglePlanes, subMesh->_lastColliderWorldVertices, getIndices(),
-    subMesh->indexStart, subMesh->indexStart + subMesh->indexCount,
-    subMesh->verticesStart, subMesh->getMaterial() != nullptr);
+  auto bvh = _getBVH();
+  if (bvh) {
+    // Only test the triangles overlapping the volume swept by the collider,
+    // brought back into the space of the positions
+    auto& sweptMinimum = Tmp::Vector3Array()[0];
+    auto& sweptMaximum = Tmp::Vector3Array()[1];
+    auto& corner       = Tmp::Vector3Array()[2];
+    iCollider._getSweptBoundsToRef(sweptMinimum, sweptMaximum);
+    auto inverseTransformMatrix = transformMatrix;
+    inverseTransformMatrix.invert();
+    Vector3 minimum(std::numeric_limits<float>::max(),
+                    std::numeric_limits<float>::max(),
+                    std::numeric_limits<float>::max());
+    Vector3 maximum(std::numeric_limits<float>::lowest(),
+                    std::numeric_limits<float>::lowest(),
+                    std::numeric_limits<float>::lowest());
+    for (unsigned int i = 0; i < 8; ++i) {
+      Vector3::TransformCoordinatesFromFloatsToRef(
+        (i & 1) ? sweptMaximum.x : sweptMinimum.x,
+        (i & 2) ? sweptMaximum.y : sweptMinimum.y,
+        (i & 4) ? sweptMaximum.z : sweptMinimum.z, inverseTransformMatrix,
+        corner);
+      minimum.minimizeInPlace(corner);
+      maximum.maximizeInPlace(corner);
+    }
+
+    const auto& indices = getIndices();
+    std::vector<size_t> triangleIndexStarts;
+    bvh->intersectsBox(minimum, maximum, _positions(), indices,
+                       subMesh->indexStart, subMesh->indexCount,
+                       triangleIndexStarts);
+    iCollider._collide(subMesh->_trianglePlanes,
+                       subMesh->_lastColliderWorldVertices, indices,
+                       triangleIndexStarts, subMesh->verticesStart,
+                       subMesh->getMaterial() != nullptr);
+  }
+  else {
+    iCollider._collide(
+      subMesh->_trianglePlanes, subMesh->_lastColliderWorldVertices,
+      getIndices(), subMesh->indexStart,
+      subMesh->indexStart + subMesh->indexCount, subMesh->verticesStart,
+      subMesh->getMaterial() != nullptr);
+  }
   if (iCollider.collisionFound) {
     iCollider.collidedMesh = shared_from_base<AbstractMesh>();
   }
@@ -1466,8 +1535,8 @@ AbstractMesh& AbstractMesh::_checkCollision(Collider& iCollider)
   }
 
   // Transformation matrix
-  auto& collisionsScalingMatrix   = Tmp::MatrixArray[0];
-  auto& collisionsTransformMatrix = Tmp::MatrixArray[1];
+  auto& collisionsScalingMatrix   = Tmp::MatrixArray()[0];
+  auto& collisionsTransformMatrix = Tmp::MatrixArray()[1];
   Matrix::ScalingToRef(1.f / iCollider._radius.x, 1.f / iCollider._radius.y,
                        1.f / iCollider._radius.z, collisionsScalingMatrix);
   worldMatrixFromCache().multiplyToRef(collisionsScalingMatrix,
@@ -1481,6 +1550,15 @@ bool AbstractMesh::_generatePointsArray()
   return false;
 }
 
+MeshBVH* AbstractMesh::_getBVH()
+{
+  return nullptr;
+}
+
+void AbstractMesh::_resetBVH()
+{
+}
+
 PickingInfo
 AbstractMesh::intersects(Ray& ray, bool fastCheck,
                          const TrianglePickingPredicate& trianglePredicate)
@@ -1503,13 +1581,46 @@ AbstractMesh::intersects(Ray& ray, bool fastCheck,
     return pickingInfo;
   }
 
+  // Octrees
+  auto _subMeshes    = _scene->getIntersectingSubMeshCandidates(this, ray);
+  auto intersectInfo = _intersectSubMeshes(ray, _subMeshes, getIndices(),
+                                           fastCheck, trianglePredicate);
+
+  if (intersectInfo) {
+    // Get picked point
+    auto world        = getWorldMatrix();
+    auto& worldOrigin = Tmp::Vector3Array()[0];
+    auto& direction   = Tmp::Vector3Array()[1];
+    Vector3::TransformCoordinatesToRef(ray.origin, world, worldOrigin);
+    ray.direction.scaleToRef(intersectInfo->distance, direction);
+    auto worldDirection = Vector3::TransformNormal(direction, world);
+    auto pickedPoint    = worldDirection.addInPlace(worldOrigin);
+
+    // Return result
+    pickingInfo.hit         = true;
+    pickingInfo.distance    = Vector3::Distance(worldOrigin, pickedPoint);
+    pickingInfo.pickedPoint = pickedPoint;
+    pickingInfo.pickedMesh  = shared_from_base<AbstractMesh>();
+    pickingInfo.bu          = intersectInfo->bu.value_or(0.f);
+    pickingInfo.bv          = intersectInfo->bv.value_or(0.f);
+    pickingInfo.faceId      = static_cast<unsigned>(intersectInfo->faceId);
+    pickingInfo.subMeshId   = static_cast<unsigned>(intersectInfo->subMeshId);
+    return pickingInfo;
+  }
+
+  return pickingInfo;
+}
+
+std::optional<IntersectionInfo> AbstractMesh::_intersectSubMeshes(
+  Ray& ray, const std::vector<SubMesh*>& candidateSubMeshes,
+  const IndicesArray& indices, bool fastCheck,
+  const TrianglePickingPredicate& trianglePredicate)
+{
   std::optional<IntersectionInfo> intersectInfo = std::nullopt;
 
-  // Octrees
-  auto _subMeshes = _scene->getIntersectingSubMeshCandidates(this, ray);
-  auto len        = _subMeshes.size();
+  auto len = candidateSubMeshes.size();
   for (size_t index = 0; index < len; ++index) {
-    auto& subMesh = _subMeshes[index];
+    auto& subMesh = candidateSubMeshes[index];
 
     // Bounding test
     if (len > 1 && !subMesh->canIntersects(ray)) {
@@ -1517,7 +1628,7 @@ AbstractMesh::intersects(Ray& ray, bool fastCheck,
     }
 
     auto currentIntersectInfo = subMesh->intersects(
-      ray, _positions(), getIndices(), fastCheck, trianglePredicate);
+      ray, _positions(), indices, fastCheck, trianglePredicate);
 
     if (currentIntersectInfo) {
       if (fastCheck || !intersectInfo
@@ -1532,29 +1643,7 @@ AbstractMesh::intersects(Ray& ray, bool fastCheck,
     }
   }
 
-  if (intersectInfo) {
-    // Get picked point
-    auto world        = getWorldMatrix();
-    auto& worldOrigin = Tmp::Vector3Array[0];
-    auto& direction   = Tmp::Vector3Array[1];
-    Vector3::TransformCoordinatesToRef(ray.origin, world, worldOrigin);
-    ray.direction.scaleToRef(intersectInfo->distance, direction);
-    auto worldDirection = Vector3::TransformNormal(direction, world);
-    auto pickedPoint    = worldDirection.addInPlace(worldOrigin);
-
-    // Return result
-    pickingInfo.hit         = true;
-    pickingInfo.distance    = Vector3::Distance(worldOrigin, pickedPoint);
-    pickingInfo.pickedPoint = pickedPoint;
-    pickingInfo.pickedMesh  = shared_from_base<AbstractMesh>();
-    pickingInfo.bu          = intersectInfo->bu.value_or(0.f);
-    pickingInfo.bv          = intersectInfo->bv.value_or(0.f);
-    pickingInfo.faceId      = static_cast<unsigned>(intersectInfo->faceId);
-    pickingInfo.subMeshId   = static_cast<unsigned>(intersectInfo->subMeshId);
-    return pickingInfo;
-  }
-
-  return pickingInfo;
+  return intersectInfo;
 }
 
 AbstractMesh* AbstractMesh::clone(const std::string& /*name*/,
@@ -1929,9 +2018,9 @@ int AbstractMesh::getClosestFacetAtCoordinates(float x, float y, float z,
                                                bool checkFace, bool facing)
 {
   auto world   = getWorldMatrix();
-  auto& invMat = Tmp::MatrixArray[5];
+  auto& invMat = Tmp::MatrixArray()[5];
   world.invertToRef(invMat);
-  auto& invVect = Tmp::Vector3Array[8];
+  auto& invVect = Tmp::Vector3Array()[8];
   auto closest  = -1;
   // transform (x,y,z) to coordinates in the mesh local space
   Vector3::TransformCoordinatesFromFloatsToRef(x, y, z, invMat, invVect);
@@ -2056,8 +2145,8 @@ AbstractMesh& AbstractMesh::createNormals(bool updatable)
 AbstractMesh& AbstractMesh::alignWithNormal(Vector3& normal,
                                             const Vector3& upDirection)
 {
-  auto& axisX = Tmp::Vector3Array[0];
-  auto& axisZ = Tmp::Vector3Array[1];
+  auto& axisX = Tmp::Vector3Array()[0];
+  auto& axisZ = Tmp::Vector3Array()[1];
   Vector3::CrossToRef(upDirection, normal, axisZ);
   Vector3::CrossToRef(normal, axisZ, axisX);
 
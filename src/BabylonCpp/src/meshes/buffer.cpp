@@ -1,5 +1,7 @@
 #include <babylon/meshes/buffer.h>
 
+#include <algorithm>
+
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
 #include <babylon/interfaces/igl_rendering_context.h>
@@ -136,6 +138,42 @@ GL::IGLBuffer* Buffer::update(const Float32Array& data)
   return create(data);
 }
 
+GL::IGLBuffer* Buffer::_updateFromData()
+{
+  if (!_buffer || !_updatable || _data.empty()) {
+    return nullptr;
+  }
+
+  _engine->updateDynamicVertexBuffer(_buffer, _data);
+
+  return _buffer.get();
+}
+
+GL::IGLBuffer* Buffer::_updateRange(const Float32Array& data, size_t offset,
+                                    size_t count)
+{
+  if (!_buffer || !_updatable || offset + count > data.size()) {
+    return nullptr;
+  }
+
+  const auto begin = data.begin() + static_cast<std::ptrdiff_t>(offset);
+  _engine->updateDynamicVertexBuffer(
+    _buffer, Float32Array(begin, begin + static_cast<std::ptrdiff_t>(count)),
+    static_cast<int>(offset * sizeof(float)));
+  // Keeps the CPU copy of the whole buffer in sync
+  if (_data.size() == data.size()) {
+    if (&_data != &data) {
+      std::copy(begin, begin + static_cast<std::ptrdiff_t>(count),
+                _data.begin() + static_cast<std::ptrdiff_t>(offset));
+    }
+  }
+  else {
+    _data.clear();
+  }
+
+  return _buffer.get();
+}
+
 GL::IGLBuffer* Buffer::updateDirectly(const Float32Array& data, size_t offset,
                                       const std::optional<size_t>& vertexCount,
                                       bool useBytes)
@@ -25,9 +25,9 @@ MeshPtr RibbonBuilder::CreateRibbon(const std::string& name,
     // only pathArray and sideOrientation parameters are taken into account for
     // positions update
     auto& minimum
-      = Tmp::Vector3Array[0].setAll(std::numeric_limits<float>::max());
+      = Tmp::Vector3Array()[0].setAll(std::numeric_limits<float>::max());
     auto& maximum
-      = Tmp::Vector3Array[1].setAll(std::numeric_limits<float>::lowest());
+      = Tmp::Vector3Array()[1].setAll(std::numeric_limits<float>::lowest());
     const auto positionFunction = [&](Float32Array& positions) -> void {
       auto minlg = pathArray[0].size();
       auto& mesh = instance;
@@ -92,7 +92,7 @@ MeshPtr ShapeBuilder::_ExtrudeShapeGeneric(
         auto rotate = _custom ? _rotateFunction : returnRotation;
         auto scl    = _custom ? _scaleFunction : returnScale;
         auto index  = (_cap == Mesh::NO_CAP || _cap == Mesh::CAP_END) ? 0u : 2u;
-        auto& rotationMatrix = Tmp::MatrixArray[0];
+        auto& rotationMatrix = Tmp::MatrixArray()[0];
         shapePaths.resize(_curve.size());
 
         for (auto i = 0ull; i < _curve.size(); ++i) {
@@ -51,7 +51,7 @@ MeshPtr TubeBuilder::CreateTube(const std::string& name, TubeOptions& options,
         auto rad = 0.f;
         Vector3 normal;
         Vector3 rotated;
-        auto& rotationMatrix = Tmp::MatrixArray[0];
+        auto& rotationMatrix = Tmp::MatrixArray()[0];
         // TODO FIXME
         unsigned int index
           = (_cap == Mesh::NO_CAP || _cap == Mesh::CAP_END) ? 0 : 0;
@@ -0,0 +1,150 @@
+#include <babylon/meshes/cpu_skinning.h>
+
+#include <array>
+#include <cmath>
+
+#include <babylon/core/thread_pool.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Number of vertices skinned by a task of the thread pool
+constexpr size_t SKINNING_GRAIN_SIZE = 2048;
+
+} // end of anonymous namespace
+
+CPUSkinning::CPUSkinning() : _vertexCount{0}, _influencerCount{4}
+{
+}
+
+CPUSkinning::~CPUSkinning()
+{
+}
+
+bool CPUSkinning::initialize(const Float32Array& positions,
+                             const Float32Array& normals,
+                             const Float32Array& matricesIndices,
+                             const Float32Array& matricesWeights,
+                             const Float32Array& matricesIndicesExtra,
+                             const Float32Array& matricesWeightsExtra)
+{
+  const auto vertexCount = positions.size() / 3;
+  const auto needExtras
+    = !matricesIndicesExtra.empty() && !matricesWeightsExtra.empty();
+  if (vertexCount == 0 || normals.size() < vertexCount * 3
+      || matricesIndices.size() < vertexCount * 4
+      || matricesWeights.size() < vertexCount * 4
+      || (needExtras
+          && (matricesIndicesExtra.size() < vertexCount * 4
+              || matricesWeightsExtra.size() < vertexCount * 4))) {
+    return false;
+  }
+
+  _vertexCount     = vertexCount;
+  _influencerCount = needExtras ? 8 : 4;
+
+  _positionsX.resize(vertexCount);
+  _positionsY.resize(vertexCount);
+  _positionsZ.resize(vertexCount);
+  _normalsX.resize(vertexCount);
+  _normalsY.resize(vertexCount);
+  _normalsZ.resize(vertexCount);
+  for (size_t i = 0; i < vertexCount; ++i) {
+    _positionsX[i] = positions[i * 3];
+    _positionsY[i] = positions[i * 3 + 1];
+    _positionsZ[i] = positions[i * 3 + 2];
+    _normalsX[i]   = normals[i * 3];
+    _normalsY[i]   = normals[i * 3 + 1];
+    _normalsZ[i]   = normals[i * 3 + 2];
+  }
+
+  _boneIndices.resize(vertexCount * _influencerCount);
+  _boneWeights.resize(vertexCount * _influencerCount);
+  for (size_t i = 0; i < vertexCount; ++i) {
+    for (size_t inf = 0; inf < 4; ++inf) {
+      const auto target = i * _influencerCount + inf;
+      _boneIndices[target]
+        = static_cast<uint32_t>(std::floor(matricesIndices[i * 4 + inf]));
+      _boneWeights[target] = matricesWeights[i * 4 + inf];
+      if (needExtras) {
+        _boneIndices[target + 4] = static_cast<uint32_t>(
+          std::floor(matricesIndicesExtra[i * 4 + inf]));
+        _boneWeights[target + 4] = matricesWeightsExtra[i * 4 + inf];
+      }
+    }
+  }
+
+  return true;
+}
+
+size_t CPUSkinning::vertexCount() const
+{
+  return _vertexCount;
+}
+
+size_t CPUSkinning::influencerCount() const
+{
+  return _influencerCount;
+}
+
+void CPUSkinning::apply(const Float32Array& boneMatrices, float* positions,
+                        float* normals) const
+{
+  ThreadPool::Default().parallelFor(
+    _vertexCount, SKINNING_GRAIN_SIZE, [&](size_t begin, size_t end) {
+      if (_influencerCount == 8) {
+        _skinRange<8>(boneMatrices, begin, end, positions, normals);
+      }
+      else {
+        _skinRange<4>(boneMatrices, begin, end, positions, normals);
+      }
+    });
+}
+
+template <size_t InfluencerCount>
+void CPUSkinning::_skinRange(const Float32Array& boneMatrices, size_t begin,
+                             size_t end, float* positions,
+                             float* normals) const
+{
+  const auto boneCount = boneMatrices.size() / 16;
+  const auto* bones    = boneMatrices.data();
+
+  std::array<float, 16> m;
+  for (size_t v = begin; v < end; ++v) {
+    // Blended bone matrix, fixed size loops so that they get vectorized
+    m.fill(0.f);
+    const auto* indices = &_boneIndices[v * InfluencerCount];
+    const auto* weights = &_boneWeights[v * InfluencerCount];
+    for (size_t inf = 0; inf < InfluencerCount; ++inf) {
+      const auto weight = weights[inf];
+      if (weight > 0.f && indices[inf] < boneCount) {
+        const auto* bone = bones + indices[inf] * 16;
+        for (size_t k = 0; k < 16; ++k) {
+          m[k] += bone[k] * weight;
+        }
+      }
+    }
+
+    // Same as Vector3::TransformCoordinatesFromFloatsToRef
+    const auto x  = _positionsX[v];
+    const auto y  = _positionsY[v];
+    const auto z  = _positionsZ[v];
+    const auto rw = 1.f / (x * m[3] + y * m[7] + z * m[11] + m[15]);
+
+    positions[v * 3]     = (x * m[0] + y * m[4] + z * m[8] + m[12]) * rw;
+    positions[v * 3 + 1] = (x * m[1] + y * m[5] + z * m[9] + m[13]) * rw;
+    positions[v * 3 + 2] = (x * m[2] + y * m[6] + z * m[10] + m[14]) * rw;
+
+    // Same as Vector3::TransformNormalFromFloatsToRef
+    const auto nx = _normalsX[v];
+    const auto ny = _normalsY[v];
+    const auto nz = _normalsZ[v];
+
+    normals[v * 3]     = nx * m[0] + ny * m[4] + nz * m[8];
+    normals[v * 3 + 1] = nx * m[1] + ny * m[5] + nz * m[9];
+    normals[v * 3 + 2] = nx * m[2] + ny * m[6] + nz * m[10];
+  }
+}
+
+} // end of namespace BABYLON
@@ -4,7 +4,9 @@
 
 #include <babylon/babylon_stl_util.h>
 #include <babylon/bones/skeleton.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/culling/bounding_info.h>
+#include <babylon/culling/mesh_bvh.h>
 #include <babylon/engines/constants.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
@@ -21,9 +23,12 @@
 
 namespace BABYLON {
 
+size_t Geometry::BVHMinimumTriangleCount = 1024;
+
 Geometry::Geometry(const std::string& iId, Scene* scene, VertexData* vertexData,
                    bool updatable, Mesh* mesh)
     : delayLoadState{Constants::DELAYLOADSTATE_NONE}
+    , useBVH{true}
     , boundingBias(this, &Geometry::get_boundingBias,
                    &Geometry::set_boundingBias)
     , extend(this, &Geometry::get_extend)
@@ -34,6 +39,9 @@ Geometry::Geometry(const std::string& iId, Scene* scene, VertexData* vertexData,
     , _boundingBias{std::nullopt}
     , _indexBuffer{nullptr}
     , _indexBufferIsUpdatable{false}
+    , _bvh{nullptr}
+    , _pendingBVH{nullptr}
+    , _bvhBuilt{false}
 {
   id       = iId;
   uniqueId = scene->getUniqueId();
@@ -237,6 +245,24 @@ void Geometry::updateVerticesDataDirectly(const std::string& kind,
   notifyUpdate(kind);
 }
 
+void Geometry::_updateVerticesDataRange(const std::string& kind,
+                                        const Float32Array& data,
+                                        size_t offset, size_t count)
+{
+  auto vertexBuffer = getVertexBuffer(kind);
+
+  if (!vertexBuffer) {
+    return;
+  }
+
+  vertexBuffer->_updateRange(data, offset, count);
+
+  if (kind == VertexBuffer::PositionKind) {
+    _resetPointsArrayCache();
+  }
+  notifyUpdate(kind);
+}
+
 AbstractMesh* Geometry::updateVerticesData(const std::string& kind,
                                            const Float32Array& data,
                                            bool updateExtends,
@@ -428,6 +454,7 @@ void Geometry::updateIndices(const IndicesArray& indices, int offset,
 
     if (!gpuMemoryOnly) {
       _indices = indices;
+      _resetBVH();
     }
     _engine->updateDynamicIndexBuffer(_indexBuffer, indices, offset);
     if (needToUpdateSubMeshes) {
@@ -449,6 +476,7 @@ AbstractMesh* Geometry::setIndices(const IndicesArray& indices,
 
   _indices                = indices;
   _indexBufferIsUpdatable = updatable;
+  _resetBVH();
   if (!_meshes.empty() && !_indices.empty()) {
     _indexBuffer = std::unique_ptr<GL::IGLBuffer>(
       _engine->createIndexBuffer(_indices, updatable));
@@ -561,7 +589,7 @@ void Geometry::_updateExtend(Float32Array data)
   }
 
   _extend
-    = Tools::ExtractMinAndMax(data, 0, _totalVertices, *boundingBias(), 3);
+    = Tools::ExtractMinAndMax(data, 0, _totalVertices, boundingBias(), 3);
 }
 
 void Geometry::_applyToMesh(Mesh* mesh)
@@ -678,6 +706,7 @@ void Geometry::toLeftHanded()
 void Geometry::_resetPointsArrayCache()
 {
   _positions.clear();
+  _resetBVH();
 }
 
 bool Geometry::_generatePointsArray()
@@ -701,6 +730,67 @@ bool Geometry::_generatePointsArray()
   return true;
 }
 
+void Geometry::buildBVH(bool inBackground)
+{
+  std::lock_guard<std::recursive_mutex> lock(_bvhMutex);
+  _resetBVH();
+  if (!_generatePointsArray() || _indices.empty()) {
+    return;
+  }
+
+  _bvhBuilt = true;
+  if (!inBackground) {
+    _bvh = std::make_unique<MeshBVH>(_positions, _indices);
+    return;
+  }
+
+  // The task works on copies so that the geometry can be updated or
+  // destroyed while the hierarchy is built
+  auto pendingBVH = std::make_shared<std::unique_ptr<MeshBVH>>();
+  _pendingBVH     = pendingBVH;
+  _pendingBVHBuild = ThreadPool::Default().enqueue(
+    [pendingBVH, positions = _positions, indices = _indices]() {
+      *pendingBVH = std::make_unique<MeshBVH>(positions, indices);
+    });
+}
+
+MeshBVH* Geometry::_getBVH()
+{
+  std::lock_guard<std::recursive_mutex> lock(_bvhMutex);
+  if (_bvh) {
+    return _bvh.get();
+  }
+
+  if (_pendingBVH) {
+    if (_pendingBVHBuild.wait_for(std::chrono::seconds(0))
+        != std::future_status::ready) {
+      return nullptr;
+    }
+    _pendingBVHBuild.get();
+    _bvh = std::move(*_pendingBVH);
+    _pendingBVH.reset();
+    return _bvh.get();
+  }
+
+  if (!useBVH || _indices.size() / 3 < BVHMinimumTriangleCount) {
+    return nullptr;
+  }
+
+  // The first hierarchy is built on demand, the following ones, after vertex
+  // or index updates, in the background
+  buildBVH(_bvhBuilt);
+  return _bvh.get();
+}
+
+void Geometry::_resetBVH()
+{
+  std::lock_guard<std::recursive_mutex> lock(_bvhMutex);
+  _bvh = nullptr;
+  // A pending build is abandoned, its task only owns copies of the data
+  _pendingBVH.reset();
+  _pendingBVHBuild = std::future<void>();
+}
+
 bool Geometry::isDisposed() const
 {
   return _isDisposed;
@@ -737,6 +827,7 @@ void Geometry::dispose()
   }
   _indexBuffer = nullptr;
   _indices.clear();
+  _resetBVH();
 
   delayLoadState = Constants::DELAYLOADSTATE_NONE;
   delayLoadingFile.clear();
@@ -238,9 +238,9 @@ Matrix& InstancedMesh::getWorldMatrix()
       && _currentLOD->_masterMesh != this) {
     const auto& tempMaster   = _currentLOD->_masterMesh;
     _currentLOD->_masterMesh = this;
-    Tmp::MatrixArray[0].copyFrom(_currentLOD->computeWorldMatrix(true));
+    Tmp::MatrixArray()[0].copyFrom(_currentLOD->computeWorldMatrix(true));
     _currentLOD->_masterMesh = tempMaster;
-    return Tmp::MatrixArray[0];
+    return Tmp::MatrixArray()[0];
   }
 
   return AbstractMesh::getWorldMatrix();
@@ -288,6 +288,16 @@ bool InstancedMesh::_generatePointsArray()
   return _sourceMesh->_generatePointsArray();
 }
 
+MeshBVH* InstancedMesh::_getBVH()
+{
+  return _sourceMesh->_getBVH();
+}
+
+void InstancedMesh::_resetBVH()
+{
+  _sourceMesh->_resetBVH();
+}
+
 InstancedMeshPtr InstancedMesh::clone(const std::string& /*iNname*/,
                                       Node* newParent, bool doNotCloneChildren)
 {
@@ -27,8 +27,10 @@
 #include <babylon/meshes/_creation_data_storage.h>
 #include <babylon/meshes/_instance_data_storage.h>
 #include <babylon/meshes/_instances_batch.h>
+#include <babylon/meshes/_thin_instance_data_storage.h>
 #include <babylon/meshes/_visible_instances.h>
 #include <babylon/meshes/buffer.h>
+#include <babylon/meshes/cpu_skinning.h>
 #include <babylon/meshes/builders/box_builder.h>
 #include <babylon/meshes/builders/cylinder_builder.h>
 #include <babylon/meshes/builders/decal_builder.h>
@@ -52,6 +54,8 @@
 #include <babylon/meshes/ground_mesh.h>
 #include <babylon/meshes/instanced_mesh.h>
 #include <babylon/meshes/mesh_lod_level.h>
+#include <babylon/meshes/simplification/isimplification_task.h>
+#include <babylon/meshes/simplification/simplification_queue.h>
 #include <babylon/meshes/vertex_buffer.h>
 #include <babylon/meshes/vertex_data.h>
 #include <babylon/misc/tools.h>
@@ -89,6 +93,7 @@ Mesh::Mesh(const std::string& iName, Scene* scene, Node* iParent, Mesh* source,
     , _onBeforeDrawObserver{nullptr}
     , _morphTargetManager{nullptr}
     , _instanceDataStorage{std::make_unique<_InstanceDataStorage>()}
+    , _thinInstanceDataStorage{std::make_unique<_ThinInstanceDataStorage>()}
     , _effectiveMaterial{nullptr}
     , _preActivateId{-1}
     , _areNormalsFrozen{false}
@@ -304,17 +309,11 @@ std::vector<std::unique_ptr<MeshLODLevel>>& Mesh::getLODLevels()
 
 void Mesh::_sortLODLevels()
 {
+  // Farthest level first, as expected by getLOD
   std::sort(_LODLevels.begin(), _LODLevels.end(),
             [](const std::unique_ptr<MeshLODLevel>& a,
                const std::unique_ptr<MeshLODLevel>& b) {
-              if (a->distance < b->distance) {
-                return 1;
-              }
-              if (a->distance > b->distance) {
-                return -1;
-              }
-
-              return 0;
+              return a->distance > b->distance;
             });
 }
 
@@ -533,7 +532,8 @@ bool Mesh::isReady(bool completeCheck, bool forceInstanceSupport)
   auto scene  = getScene();
   auto hardwareInstancedRendering
     = forceInstanceSupport
-      || (engine->getCaps().instancedArrays && instances.size() > 0);
+      || (engine->getCaps().instancedArrays
+          && (instances.size() > 0 || hasThinInstances()));
 
   computeWorldMatrix();
 
@@ -773,6 +773,8 @@ Mesh* Mesh::setVerticesData(const std::string& kind, const Float32Array& data,
     _geometry->setVerticesData(kind, data, updatable, stride);
   }
 
+  _invalidateCPUSkinning(kind);
+
   return this;
 }
 
@@ -813,9 +815,21 @@ Mesh* Mesh::updateVerticesData(const std::string& kind,
     updateVerticesData(kind, data, updateExtends, false);
   }
 
+  _invalidateCPUSkinning(kind);
+
   return this;
 }
 
+void Mesh::_invalidateCPUSkinning(const std::string& kind)
+{
+  if (kind == VertexBuffer::MatricesIndicesKind
+      || kind == VertexBuffer::MatricesWeightsKind
+      || kind == VertexBuffer::MatricesIndicesExtraKind
+      || kind == VertexBuffer::MatricesWeightsExtraKind) {
+    _cpuSkinning = nullptr;
+  }
+}
+
 Mesh& Mesh::updateMeshPositions(
   std::function<void(Float32Array& positions)> positionFunction,
   bool computeNormals)
@@ -864,7 +878,8 @@ Mesh* Mesh::setIndices(const IndicesArray& indices, size_t totalVertices,
 
     auto scene = getScene();
 
-    Geometry(Geometry::RandomId(), scene, vertexData.get(), updatable, this);
+    Geometry::New(Geometry::RandomId(), scene, vertexData.get(), updatable,
+                  this);
   }
   else {
     _geometry->setIndices(indices, totalVertices, updatable);
@@ -1049,15 +1064,13 @@ Mesh& Mesh::_renderWithInstances(SubMesh* subMesh, unsigned int fillMode,
                                  const _InstancesBatchPtr& batch,
                                  const EffectPtr& effect, Engine* engine)
 {
-  if (batch->visibleInstances.find(subMesh->_id)
-      == batch->visibleInstances.end()) {
+  auto visibleInstancesIt = batch->visibleInstances.find(subMesh->_id);
+  if (visibleInstancesIt == batch->visibleInstances.end()
+      || visibleInstancesIt->second.empty()) {
     return *this;
   }
 
-  auto& visibleInstances = batch->visibleInstances[subMesh->_id];
-  if (visibleInstances.empty()) {
-    return *this;
-  }
+  const auto& visibleInstances = visibleInstancesIt->second;
 
   size_t matricesCount = visibleInstances.size() + 1;
   size_t bufferSize    = matricesCount * 16 * 4;
@@ -1072,29 +1085,42 @@ Mesh& Mesh::_renderWithInstances(SubMesh* subMesh, unsigned int fillMode,
 
   if (instanceStorage->instancesData.empty()
       || currentInstancesBufferSize != instanceStorage->instancesBufferSize) {
+    const auto slotsCount = instanceStorage->instancesBufferSize / (16 * 4);
     instanceStorage->instancesData
       = Float32Array(instanceStorage->instancesBufferSize / 4);
+    instanceStorage->instancesSlots.assign(slotsCount, nullptr);
+    instanceStorage->instancesSlotsUpdateFlags.assign(slotsCount, 0);
   }
 
-  unsigned int offset         = 0;
+  // The instances data persists across frames: a world matrix is only copied
+  // when the slot held another mesh or when the matrix has been updated since
+  // it was written, and only the range of the modified slots is uploaded
+  auto& instancesSlots        = instanceStorage->instancesSlots;
+  auto& slotsUpdateFlags      = instanceStorage->instancesSlotsUpdateFlags;
   unsigned int instancesCount = 0;
+  unsigned int firstDirtySlot = std::numeric_limits<unsigned int>::max();
+  unsigned int lastDirtySlot  = 0;
+  const auto writeWorldMatrix = [&](const AbstractMesh* mesh,
+                                    const Matrix& world) {
+    const auto slot = instancesCount++;
+    if (instancesSlots[slot] == mesh
+        && slotsUpdateFlags[slot] == world.updateFlag) {
+      return;
+    }
+    world.copyToArray(instanceStorage->instancesData, slot * 16);
+    instancesSlots[slot]   = mesh;
+    slotsUpdateFlags[slot] = world.updateFlag;
+    firstDirtySlot         = std::min(firstDirtySlot, slot);
+    lastDirtySlot          = slot;
+  };
 
-  auto world = getWorldMatrix();
-  if (batch->renderSelf[subMesh->_id]) {
-    world.copyToArray(instanceStorage->instancesData, offset);
-    offset += 16;
-    instancesCount++;
+  auto renderSelfIt = batch->renderSelf.find(subMesh->_id);
+  if (renderSelfIt != batch->renderSelf.end() && renderSelfIt->second) {
+    writeWorldMatrix(this, getWorldMatrix());
   }
 
-  if (!visibleInstances.empty()) {
-    for (size_t instanceIndex = 0; instanceIndex < visibleInstances.size();
-         ++instanceIndex) {
-      auto instance = visibleInstances[instanceIndex];
-      instance->getWorldMatrix().copyToArray(instanceStorage->instancesData,
-                                             offset);
-      offset += 16;
-      ++instancesCount;
-    }
+  for (auto instance : visibleInstances) {
+    writeWorldMatrix(instance, instance->getWorldMatrix());
   }
 
   if (!instancesBuffer
@@ -1103,6 +1129,12 @@ Mesh& Mesh::_renderWithInstances(SubMesh* subMesh, unsigned int fillMode,
       instancesBuffer->dispose();
     }
 
+    // The world attributes are shared with the thin instances
+    if (_thinInstanceDataStorage->matrixBuffer) {
+      _thinInstanceDataStorage->matrixBuffer->dispose();
+      _thinInstanceDataStorage->matrixBuffer = nullptr;
+    }
+
     instancesBuffer = std::make_shared<Buffer>(
       engine, instanceStorage->instancesData, true, 16, false, true);
 
@@ -1115,9 +1147,10 @@ Mesh& Mesh::_renderWithInstances(SubMesh* subMesh, unsigned int fillMode,
     setVerticesBuffer(
       instancesBuffer->createVertexBuffer(VertexBuffer::World3Kind, 12, 4));
   }
-  else {
-    instancesBuffer->updateDirectly(instanceStorage->instancesData, 0,
-                                    instancesCount);
+  else if (firstDirtySlot <= lastDirtySlot) {
+    instancesBuffer->_updateRange(instanceStorage->instancesData,
+                                  firstDirtySlot * 16,
+                                  (lastDirtySlot - firstDirtySlot + 1) * 16);
   }
 
   _bind(subMesh, effect, fillMode);
@@ -1129,6 +1162,63 @@ Mesh& Mesh::_renderWithInstances(SubMesh* subMesh, unsigned int fillMode,
   return *this;
 }
 
+Mesh& Mesh::_renderWithThinInstances(SubMesh* subMesh, unsigned int fillMode,
+                                     const EffectPtr& effect, Engine* engine)
+{
+  auto& storage = *_thinInstanceDataStorage;
+  if (storage.instancesCount == 0) {
+    return *this;
+  }
+
+  if (!storage.matrixBuffer
+      || storage.matrixBufferSize != storage.matrixData.size()) {
+    if (storage.matrixBuffer) {
+      storage.matrixBuffer->dispose();
+    }
+
+    // The world attributes are shared with the instanced meshes
+    auto& instancesBuffer = _instanceDataStorage->instancesBuffer;
+    if (instancesBuffer) {
+      instancesBuffer->dispose();
+      instancesBuffer = nullptr;
+    }
+
+    storage.matrixBuffer = std::make_shared<Buffer>(
+      engine, storage.matrixData, !storage.staticBuffer, 16, false, true);
+    storage.matrixBufferSize = storage.matrixData.size();
+    storage.dirtyMatrixStart = 0;
+    storage.dirtyMatrixEnd   = 0;
+
+    setVerticesBuffer(
+      storage.matrixBuffer->createVertexBuffer(VertexBuffer::World0Kind, 0, 4));
+    setVerticesBuffer(
+      storage.matrixBuffer->createVertexBuffer(VertexBuffer::World1Kind, 4, 4));
+    setVerticesBuffer(
+      storage.matrixBuffer->createVertexBuffer(VertexBuffer::World2Kind, 8, 4));
+    setVerticesBuffer(storage.matrixBuffer->createVertexBuffer(
+      VertexBuffer::World3Kind, 12, 4));
+  }
+  else if (storage.dirtyMatrixStart < storage.dirtyMatrixEnd) {
+    // Only the changed matrices of the drawn instances are uploaded
+    const auto end = std::min(storage.dirtyMatrixEnd, storage.instancesCount);
+    if (storage.dirtyMatrixStart < end) {
+      storage.matrixBuffer->_updateRange(storage.matrixData,
+                                         storage.dirtyMatrixStart * 16,
+                                         (end - storage.dirtyMatrixStart) * 16);
+    }
+    storage.dirtyMatrixStart = 0;
+    storage.dirtyMatrixEnd   = 0;
+  }
+
+  _bind(subMesh, effect, fillMode);
+
+  _draw(subMesh, static_cast<int>(fillMode), storage.instancesCount);
+
+  engine->unbindInstanceAttributes();
+
+  return *this;
+}
+
 Mesh& Mesh::_processRendering(
   SubMesh* subMesh, const EffectPtr& effect, int fillMode,
   const _InstancesBatchPtr& batch, bool hardwareInstancedRendering,
@@ -1141,8 +1231,25 @@ Mesh& Mesh::_processRendering(
   auto engine = scene->getEngine();
 
   if (hardwareInstancedRendering) {
-    _renderWithInstances(subMesh, static_cast<unsigned>(fillMode), batch,
-                         effect, engine);
+    if (hasThinInstances()) {
+      _renderWithThinInstances(subMesh, static_cast<unsigned>(fillMode),
+                               effect, engine);
+    }
+    else {
+      _renderWithInstances(subMesh, static_cast<unsigned>(fillMode), batch,
+                           effect, engine);
+    }
+  }
+  else if (hasThinInstances()) {
+    // No instancing support: one draw call per thin instance
+    const auto& matrixData = _thinInstanceDataStorage->matrixData;
+    for (size_t i = 0; i < _thinInstanceDataStorage->instancesCount; ++i) {
+      auto world = Matrix::FromArray(matrixData, static_cast<unsigned>(i * 16));
+      if (iOnBeforeDraw) {
+        iOnBeforeDraw(true, world, effectiveMaterial);
+      }
+      _draw(subMesh, fillMode);
+    }
   }
   else {
     if (batch->renderSelf[subMesh->_id]) {
@@ -1198,9 +1305,10 @@ Mesh& Mesh::render(SubMesh* subMesh, bool enableAlphaMode)
   auto engine = scene->getEngine();
   auto hardwareInstancedRendering
     = (engine->getCaps().instancedArrays != false)
-      && (batch->visibleInstances.find(subMesh->_id)
-          != batch->visibleInstances.end())
-      && (!batch->visibleInstances[subMesh->_id].empty());
+      && (hasThinInstances()
+          || ((batch->visibleInstances.find(subMesh->_id)
+               != batch->visibleInstances.end())
+              && (!batch->visibleInstances[subMesh->_id].empty())));
 
   // Material
   auto iMaterial = subMesh->getMaterial();
@@ -1565,6 +1673,30 @@ Mesh& Mesh::_checkDelayState()
   return *this;
 }
 
+bool Mesh::_canBeEvaluatedConcurrently()
+{
+  // The frustum test triggers the delayed loading
+  if (delayLoadState != EngineConstants::DELAYLOADSTATE_NONE
+      && delayLoadState != EngineConstants::DELAYLOADSTATE_LOADED) {
+    return false;
+  }
+
+  return (!_geometry || _geometry->isReady())
+         && AbstractMesh::_canBeEvaluatedConcurrently();
+}
+
+bool Mesh::_hasStandardFrustumTest() const
+{
+  // The frustum test triggers the delayed loading
+  if (delayLoadState != EngineConstants::DELAYLOADSTATE_NONE
+      && delayLoadState != EngineConstants::DELAYLOADSTATE_LOADED) {
+    return false;
+  }
+
+  return (!_geometry || _geometry->isReady())
+         && AbstractMesh::_hasStandardFrustumTest();
+}
+
 Mesh& Mesh::_queueLoad(Scene* scene)
 {
   scene->_addPendingData(this);
@@ -1714,6 +1846,18 @@ bool Mesh::_generatePointsArray()
   return false;
 }
 
+MeshBVH* Mesh::_getBVH()
+{
+  return _geometry ? _geometry->_getBVH() : nullptr;
+}
+
+void Mesh::_resetBVH()
+{
+  if (_geometry) {
+    _geometry->_resetBVH();
+  }
+}
+
 MeshPtr Mesh::clone(const std::string& iName, Node* newParent,
                     bool doNotCloneChildren, bool clonePhysicsImpostor)
 {
@@ -1750,6 +1894,12 @@ void Mesh::dispose(bool doNotRecurse, bool disposeMaterialAndTextures)
     _instanceDataStorage->instancesBuffer = nullptr;
   }
 
+  // Thin instances
+  if (_thinInstanceDataStorage->matrixBuffer) {
+    _thinInstanceDataStorage->matrixBuffer->dispose();
+    _thinInstanceDataStorage->matrixBuffer = nullptr;
+  }
+
   for (auto& instance : instances) {
     instance->dispose();
   }
@@ -2048,6 +2198,157 @@ Mesh& Mesh::synchronizeInstances()
   return *this;
 }
 
+bool Mesh::hasThinInstances() const
+{
+  return _thinInstanceDataStorage->instancesCount > 0;
+}
+
+size_t Mesh::thinInstanceCount() const
+{
+  return _thinInstanceDataStorage->instancesCount;
+}
+
+void Mesh::setThinInstanceCount(size_t count)
+{
+  auto& storage = *_thinInstanceDataStorage;
+  if (count * 16 > storage.matrixData.size()) {
+    BABYLON_LOGF_WARN("Mesh",
+                      "Cannot draw %zu thin instances, the matrix buffer of "
+                      "mesh %s only holds %zu matrices",
+                      count, name.c_str(), storage.matrixData.size() / 16)
+    count = storage.matrixData.size() / 16;
+  }
+  storage.instancesCount = count;
+}
+
+void Mesh::thinInstanceSetBuffer(const std::string& kind,
+                                 const Float32Array& buffer,
+                                 unsigned int stride, bool staticBuffer)
+{
+  if (kind != "matrix" || (stride != 0 && stride != 16)) {
+    BABYLON_LOGF_WARN("Mesh", "Unsupported thin instance buffer kind: %s",
+                      kind.c_str())
+    return;
+  }
+
+  auto& storage            = *_thinInstanceDataStorage;
+  storage.matrixData       = buffer;
+  storage.instancesCount   = buffer.size() / 16;
+  storage.staticBuffer     = staticBuffer;
+  storage.dirtyMatrixStart = 0;
+  storage.dirtyMatrixEnd   = storage.instancesCount;
+
+  thinInstanceRefreshBoundingInfo();
+}
+
+Float32Array& Mesh::thinInstanceGetMatrixBuffer()
+{
+  return _thinInstanceDataStorage->matrixData;
+}
+
+size_t Mesh::thinInstanceAdd(const Matrix& matrix, bool refresh)
+{
+  auto& storage    = *_thinInstanceDataStorage;
+  const auto index = storage.instancesCount;
+
+  // Grow the buffer geometrically to amortize the reallocations
+  if ((index + 1) * 16 > storage.matrixData.size()) {
+    storage.matrixData.resize(std::max<size_t>(32, (index + 1) * 2) * 16);
+  }
+  storage.instancesCount = index + 1;
+
+  thinInstanceSetMatrixAt(index, matrix, refresh);
+  return index;
+}
+
+void Mesh::thinInstanceSetMatrixAt(size_t index, const Matrix& matrix,
+                                   bool refresh)
+{
+  auto& storage = *_thinInstanceDataStorage;
+  if (index >= storage.instancesCount) {
+    return;
+  }
+
+  matrix.copyToArray(storage.matrixData, static_cast<unsigned>(index * 16));
+  if (storage.dirtyMatrixStart < storage.dirtyMatrixEnd) {
+    storage.dirtyMatrixStart = std::min(storage.dirtyMatrixStart, index);
+    storage.dirtyMatrixEnd   = std::max(storage.dirtyMatrixEnd, index + 1);
+  }
+  else {
+    storage.dirtyMatrixStart = index;
+    storage.dirtyMatrixEnd   = index + 1;
+  }
+
+  if (refresh) {
+    thinInstanceRefreshBoundingInfo();
+  }
+}
+
+void Mesh::thinInstanceBufferUpdated(const std::string& kind)
+{
+  if (kind == "matrix") {
+    auto& storage            = *_thinInstanceDataStorage;
+    storage.dirtyMatrixStart = 0;
+    storage.dirtyMatrixEnd   = storage.matrixData.size() / 16;
+  }
+}
+
+void Mesh::thinInstanceRefreshBoundingInfo()
+{
+  auto& storage = *_thinInstanceDataStorage;
+  if (storage.instancesCount == 0) {
+    return;
+  }
+
+  // Keep the corners of the local bounding box of the geometry, the bounding
+  // info of the mesh is replaced below
+  if (storage.boundingVectors.empty()) {
+    const auto& vectors = getBoundingInfo()->boundingBox.vectors;
+    storage.boundingVectors.assign(vectors.begin(), vectors.end());
+  }
+
+  Vector3 minimum(std::numeric_limits<float>::max(),
+                  std::numeric_limits<float>::max(),
+                  std::numeric_limits<float>::max());
+  Vector3 maximum(std::numeric_limits<float>::lowest(),
+                  std::numeric_limits<float>::lowest(),
+                  std::numeric_limits<float>::lowest());
+  Matrix matrix;
+  Vector3 corner;
+  for (size_t i = 0; i < storage.instancesCount; ++i) {
+    Matrix::FromArrayToRef(storage.matrixData, static_cast<unsigned>(i * 16),
+                           matrix);
+    for (const auto& vector : storage.boundingVectors) {
+      Vector3::TransformCoordinatesToRef(vector, matrix, corner);
+      minimum.minimizeInPlace(corner);
+      maximum.maximizeInPlace(corner);
+    }
+  }
+
+  // The thin instance matrices are world matrices: the box is kept in world
+  // space by _updateBoundingInfo
+  setBoundingInfo(BoundingInfo(minimum, maximum));
+}
+
+Mesh& Mesh::simplify(
+  const std::vector<ISimplificationSettings>& settings,
+  bool parallelProcessing, SimplificationType simplificationType,
+  const std::function<void(Mesh* mesh, int submeshIndex)>& successCallback)
+{
+  ISimplificationTask task;
+  task.settings           = settings;
+  task.parallelProcessing = parallelProcessing;
+  task.mesh               = this;
+  task.simplificationType = simplificationType;
+  if (successCallback) {
+    task.successCallback = [this, successCallback]() {
+      successCallback(this, 0);
+    };
+  }
+  getScene()->simplificationQueue()->addTask(task);
+  return *this;
+}
+
 void Mesh::optimizeIndices(
   const std::function<void(Mesh* mesh)>& successCallback)
 {
@@ -3082,87 +3383,56 @@ Mesh* Mesh::applySkeleton(const SkeletonPtr& iSkeleton)
     setNormalsForCPUSkinning();
   }
 
-  // positionsData checks for not being Float32Array will only pass at most once
-  auto positionsData = getVerticesData(VertexBuffer::PositionKind);
-
-  if (positionsData.empty()) {
-    return this;
-  }
-
-  // normalsData checks for not being Float32Array will only pass at most once
-  auto normalsData = getVerticesData(VertexBuffer::NormalKind);
-
-  if (normalsData.empty()) {
-    return this;
-  }
-
-  auto matricesIndicesData = getVerticesData(VertexBuffer::MatricesIndicesKind);
-  auto matricesWeightsData = getVerticesData(VertexBuffer::MatricesWeightsKind);
+  // The source geometry and the bone influences are only read once
+  if (!_cpuSkinning) {
+    const bool needExtras = numBoneInfluencers() > 4;
+    auto cpuSkinning      = std::make_unique<CPUSkinning>();
+    if (!cpuSkinning->initialize(
+          _sourcePositions, _sourceNormals,
+          getVerticesData(VertexBuffer::MatricesIndicesKind),
+          getVerticesData(VertexBuffer::MatricesWeightsKind),
+          needExtras ? getVerticesData(VertexBuffer::MatricesIndicesExtraKind) :
+                       Float32Array(),
+          needExtras ? getVerticesData(VertexBuffer::MatricesWeightsExtraKind) :
+                       Float32Array())) {
+      return this;
+    }
+    _cpuSkinning = std::move(cpuSkinning);
+  }
+
+  const auto& skeletonMatrices = iSkeleton->getTransformMatrices(this);
+  const auto vertexCount       = _cpuSkinning->vertexCount();
+
+  // The skinned vertices are written in place into the data of the updatable
+  // vertex buffers when they are tightly packed
+  const auto isWritable = [vertexCount](const VertexBufferPtr& vertexBuffer) {
+    return vertexBuffer && vertexBuffer->isUpdatable()
+           && vertexBuffer->type == VertexBuffer::FLOAT
+           && vertexBuffer->byteOffset == 0
+           && vertexBuffer->byteStride == 3 * sizeof(float)
+           && vertexBuffer->getData().size() == vertexCount * 3;
+  };
 
-  if (matricesWeightsData.empty() || matricesIndicesData.empty()) {
-    return this;
+  auto positionBuffer = getVertexBuffer(VertexBuffer::PositionKind);
+  auto normalBuffer   = getVertexBuffer(VertexBuffer::NormalKind);
+  if (isWritable(positionBuffer) && isWritable(normalBuffer)) {
+    _cpuSkinning->apply(skeletonMatrices, positionBuffer->getData().data(),
+                        normalBuffer->getData().data());
+    positionBuffer->_updateFromData();
+    normalBuffer->_updateFromData();
+    _geometry->_resetPointsArrayCache();
+    _geometry->notifyUpdate(VertexBuffer::PositionKind);
+    _geometry->notifyUpdate(VertexBuffer::NormalKind);
   }
-
-  bool needExtras = numBoneInfluencers() > 4;
-  auto matricesIndicesExtraData
-    = needExtras ? getVerticesData(VertexBuffer::MatricesIndicesExtraKind) :
-                   Float32Array();
-  auto matricesWeightsExtraData
-    = needExtras ? getVerticesData(VertexBuffer::MatricesWeightsExtraKind) :
-                   Float32Array();
-
-  auto skeletonMatrices = iSkeleton->getTransformMatrices(this);
-
-  auto tempVector3 = Vector3::Zero();
-  Matrix finalMatrix;
-  Matrix tempMatrix;
-
-  unsigned int matWeightIdx = 0;
-  unsigned int inf;
-  float weight;
-  for (unsigned int index = 0; index < positionsData.size();
-       index += 3, matWeightIdx += 4) {
-    for (inf = 0; inf < 4; ++inf) {
-      weight = matricesWeightsData[matWeightIdx + inf];
-      if (weight > 0.f) {
-        Matrix::FromFloat32ArrayToRefScaled(
-          skeletonMatrices,
-          static_cast<unsigned int>(
-            std::floor(matricesIndicesData[matWeightIdx + inf] * 16)),
-          weight, tempMatrix);
-        finalMatrix.addToSelf(tempMatrix);
-      }
-    }
-    if (needExtras) {
-      for (inf = 0; inf < 4; ++inf) {
-        weight = matricesWeightsExtraData[matWeightIdx + inf];
-        if (weight > 0.f) {
-          Matrix::FromFloat32ArrayToRefScaled(
-            skeletonMatrices,
-            static_cast<unsigned int>(
-              std::floor(matricesIndicesExtraData[matWeightIdx + inf] * 16)),
-            weight, tempMatrix);
-          finalMatrix.addToSelf(tempMatrix);
-        }
-      }
-    }
-
-    Vector3::TransformCoordinatesFromFloatsToRef(
-      _sourcePositions[index], _sourcePositions[index + 1],
-      _sourcePositions[index + 2], finalMatrix, tempVector3);
-    tempVector3.toArray(positionsData, index);
-
-    Vector3::TransformNormalFromFloatsToRef(
-      _sourceNormals[index], _sourceNormals[index + 1],
-      _sourceNormals[index + 2], finalMatrix, tempVector3);
-    tempVector3.toArray(normalsData, index);
-
-    finalMatrix.reset();
+  else {
+    Float32Array positionsData(vertexCount * 3);
+    Float32Array normalsData(vertexCount * 3);
+    _cpuSkinning->apply(skeletonMatrices, positionsData.data(),
+                        normalsData.data());
+    updateVerticesData(VertexBuffer::PositionKind, positionsData);
+    updateVerticesData(VertexBuffer::NormalKind, normalsData);
   }
 
-  updateVerticesData(VertexBuffer::PositionKind, positionsData);
-  updateVerticesData(VertexBuffer::NormalKind, normalsData);
-
   return this;
 }
 
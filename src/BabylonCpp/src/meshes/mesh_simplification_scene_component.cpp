@@ -34,8 +34,16 @@ void SimplicationQueueSceneComponent::dispose()
 
 void SimplicationQueueSceneComponent::_beforeCameraUpdate()
 {
-  if (scene->simplificationQueue() && !scene->simplificationQueue()->running) {
-    scene->simplificationQueue()->executeNext();
+  auto& simplificationQueue = scene->simplificationQueue();
+  if (!simplificationQueue) {
+    return;
+  }
+
+  if (simplificationQueue->running) {
+    simplificationQueue->_installCompletedSimplifications();
+  }
+  else {
+    simplificationQueue->executeNext();
   }
 }
 
@@ -0,0 +1,617 @@
+#include <babylon/meshes/simplification/quadratic_error_simplification.h>
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/simplification/isimplification_settings.h>
+#include <babylon/meshes/sub_mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Distance under which two vertices are merged when optimizing the mesh
+constexpr float MERGE_EPSILON = 0.0001f;
+
+/**
+ * @brief Cell of the grid used to find the vertices sharing a position.
+ */
+struct GridCell {
+  int64_t x;
+  int64_t y;
+  int64_t z;
+
+  bool operator==(const GridCell& other) const
+  {
+    return x == other.x && y == other.y && z == other.z;
+  }
+};
+
+struct GridCellHash {
+  size_t operator()(const GridCell& cell) const
+  {
+    return static_cast<size_t>((cell.x * 73856093) ^ (cell.y * 19349663)
+                               ^ (cell.z * 83492791));
+  }
+};
+
+GridCell CellOf(const Vector3& position)
+{
+  return {static_cast<int64_t>(std::floor(position.x / MERGE_EPSILON)),
+          static_cast<int64_t>(std::floor(position.y / MERGE_EPSILON)),
+          static_cast<int64_t>(std::floor(position.z / MERGE_EPSILON))};
+}
+
+} // end of anonymous namespace
+
+QuadraticErrorSimplification::QuadraticErrorSimplification(Mesh* mesh)
+    : aggressiveness{7}, decimationIterations{100}, _mesh{mesh}
+{
+}
+
+QuadraticErrorSimplification::~QuadraticErrorSimplification()
+{
+}
+
+void QuadraticErrorSimplification::simplify(
+  const ISimplificationSettings& settings,
+  const std::function<void(const MeshPtr& simplifiedMesh)>& successCallback)
+{
+  _readMeshData();
+  _decimate(settings);
+  auto simplifiedMesh = _createDecimatedMesh();
+  if (successCallback) {
+    successCallback(simplifiedMesh);
+  }
+}
+
+void QuadraticErrorSimplification::_readMeshData()
+{
+  _positionData = _mesh->getVerticesData(VertexBuffer::PositionKind);
+  _normalData   = _mesh->getVerticesData(VertexBuffer::NormalKind);
+  _uvs          = _mesh->getVerticesData(VertexBuffer::UVKind);
+  _colorsData   = _mesh->getVerticesData(VertexBuffer::ColorKind);
+  _indices      = _mesh->getIndices();
+
+  _subMeshes.clear();
+  for (const auto& subMesh : _mesh->subMeshes) {
+    _subMeshes.emplace_back(
+      SubMeshData{subMesh->materialIndex, subMesh->verticesStart,
+                  subMesh->verticesCount, subMesh->indexStart,
+                  subMesh->indexCount});
+  }
+}
+
+void QuadraticErrorSimplification::_decimate(
+  const ISimplificationSettings& settings)
+{
+  _newPositionData.clear();
+  _newNormalData.clear();
+  _newUVsData.clear();
+  _newColorsData.clear();
+  _newIndicesArray.clear();
+  _newSubMeshes.clear();
+
+  for (const auto& subMesh : _subMeshes) {
+    _initWithSubMesh(subMesh, settings.optimizeMesh);
+    _runDecimation(settings);
+    _reconstructSubMesh(subMesh);
+  }
+
+  _vertices.clear();
+  _triangles.clear();
+  _references.clear();
+}
+
+MeshPtr QuadraticErrorSimplification::_createDecimatedMesh() const
+{
+  auto mesh = Mesh::New(_mesh->name + "Decimated", _mesh->getScene());
+  mesh->material         = _mesh->material();
+  mesh->parent           = _mesh->parent();
+  mesh->renderingGroupId = _mesh->renderingGroupId();
+  mesh->isVisible        = false;
+
+  mesh->setIndices(_newIndicesArray, _newPositionData.size() / 3);
+  mesh->setVerticesData(VertexBuffer::PositionKind, _newPositionData);
+  if (!_newNormalData.empty()) {
+    mesh->setVerticesData(VertexBuffer::NormalKind, _newNormalData);
+  }
+  if (!_newUVsData.empty()) {
+    mesh->setVerticesData(VertexBuffer::UVKind, _newUVsData);
+  }
+  if (!_newColorsData.empty()) {
+    mesh->setVerticesData(VertexBuffer::ColorKind, _newColorsData);
+  }
+
+  if (_newSubMeshes.size() > 1) {
+    mesh->subMeshes.clear();
+    for (const auto& subMesh : _newSubMeshes) {
+      SubMesh::AddToMesh(subMesh.materialIndex, subMesh.verticesStart,
+                         subMesh.verticesCount, subMesh.indexStart,
+                         subMesh.indexCount, mesh);
+    }
+  }
+
+  return mesh;
+}
+
+void QuadraticErrorSimplification::_initWithSubMesh(const SubMeshData& subMesh,
+                                                    bool optimizeMesh)
+{
+  _vertices.clear();
+  _triangles.clear();
+  _references.clear();
+
+  if (_positionData.empty() || _indices.empty()) {
+    return;
+  }
+
+  // Vertices, the vertices sharing a position are merged when optimizing
+  std::unordered_map<GridCell, std::vector<size_t>, GridCellHash> grid;
+  const auto findInVertices = [&](const Vector3& position) -> int {
+    if (!optimizeMesh) {
+      return -1;
+    }
+    const auto cell = CellOf(position);
+    for (int64_t dx = -1; dx <= 1; ++dx) {
+      for (int64_t dy = -1; dy <= 1; ++dy) {
+        for (int64_t dz = -1; dz <= 1; ++dz) {
+          auto it = grid.find({cell.x + dx, cell.y + dy, cell.z + dz});
+          if (it == grid.end()) {
+            continue;
+          }
+          for (auto vertexId : it->second) {
+            if (_vertices[vertexId].position.equalsWithEpsilon(
+                  position, MERGE_EPSILON)) {
+              return static_cast<int>(vertexId);
+            }
+          }
+        }
+      }
+    }
+    return -1;
+  };
+
+  std::vector<size_t> vertexReferences(subMesh.verticesCount);
+  for (size_t i = 0; i < subMesh.verticesCount; ++i) {
+    const auto offset   = i + subMesh.verticesStart;
+    const auto position = Vector3::FromArray(
+      _positionData, static_cast<unsigned int>(offset * 3));
+    auto vertexId = findInVertices(position);
+    if (vertexId < 0) {
+      vertexId = static_cast<int>(_vertices.size());
+      _vertices.emplace_back(DecimationVertex(position, vertexId));
+      if (optimizeMesh) {
+        grid[CellOf(position)].emplace_back(_vertices.size() - 1);
+      }
+    }
+    _vertices[static_cast<size_t>(vertexId)].originalOffsets.emplace_back(
+      offset);
+    vertexReferences[i] = static_cast<size_t>(vertexId);
+  }
+
+  // Triangles, the vertices are not added anymore so the pointers are stable
+  const auto triangleCount = subMesh.indexCount / 3;
+  _triangles.reserve(triangleCount);
+  for (size_t i = 0; i < triangleCount; ++i) {
+    const auto pos = subMesh.indexStart + i * 3;
+    std::array<DecimationVertex*, 3> vertices;
+    for (size_t j = 0; j < 3; ++j) {
+      const auto index = _indices[pos + j] - subMesh.verticesStart;
+      vertices[j]      = &_vertices[vertexReferences[index]];
+    }
+    _triangles.emplace_back(DecimationTriangle(vertices));
+    _triangles.back().originalOffset = pos;
+  }
+
+  _init();
+}
+
+void QuadraticErrorSimplification::_init()
+{
+  for (auto& t : _triangles) {
+    t.normal = Vector3::Cross(
+                 t.vertices[1]->position.subtract(t.vertices[0]->position),
+                 t.vertices[2]->position.subtract(t.vertices[0]->position))
+                 .normalize();
+    const auto data = QuadraticMatrix::DataFromNumbers(
+      t.normal.x, t.normal.y, t.normal.z,
+      -(Vector3::Dot(t.normal, t.vertices[0]->position)));
+    for (auto& vertex : t.vertices) {
+      vertex->q.addArrayInPlace(data);
+    }
+  }
+
+  for (auto& t : _triangles) {
+    for (size_t j = 0; j < 3; ++j) {
+      t.error[j] = _calculateError(*t.vertices[j], *t.vertices[(j + 1) % 3]);
+    }
+    t.error[3] = std::min({t.error[0], t.error[1], t.error[2]});
+  }
+}
+
+void QuadraticErrorSimplification::_runDecimation(
+  const ISimplificationSettings& settings)
+{
+  const auto triangleCount = _triangles.size();
+  const auto targetCount
+    = static_cast<size_t>(static_cast<float>(triangleCount) * settings.quality);
+  size_t deletedTriangles = 0;
+
+  const auto isTargetReached = [&]() {
+    return triangleCount - deletedTriangles <= targetCount;
+  };
+
+  for (unsigned int iteration = 0;
+       iteration < decimationIterations && !isTargetReached(); ++iteration) {
+    if (iteration % 5 == 0) {
+      _updateMesh(iteration == 0);
+    }
+
+    for (auto& triangle : _triangles) {
+      triangle.isDirty = false;
+    }
+
+    const auto threshold
+      = 0.000000001f
+        * std::pow(static_cast<float>(iteration + 3),
+                   static_cast<float>(aggressiveness));
+
+    const auto trianglesSize = _triangles.size();
+    for (size_t i = 0; i < trianglesSize && !isTargetReached(); ++i) {
+      auto& t = _triangles[(trianglesSize / 2 + i) % trianglesSize];
+      if (t.error[3] > threshold || t.deleted || t.isDirty) {
+        continue;
+      }
+
+      for (size_t j = 0; j < 3; ++j) {
+        if (t.error[j] >= threshold) {
+          continue;
+        }
+
+        auto v0 = t.vertices[j];
+        auto v1 = t.vertices[(j + 1) % 3];
+
+        if (v0->isBorder || v1->isBorder) {
+          continue;
+        }
+
+        auto p = Vector3::Zero();
+        _calculateError(*v0, *v1, &p);
+
+        std::vector<bool> deleted0(static_cast<size_t>(v0->triangleCount),
+                                   false);
+        std::vector<bool> deleted1(static_cast<size_t>(v1->triangleCount),
+                                   false);
+        std::vector<DecimationTriangle*> delTr;
+
+        if (_isFlipped(v0, v1, p, deleted0, delTr)) {
+          continue;
+        }
+        if (_isFlipped(v1, v0, p, deleted1, delTr)) {
+          continue;
+        }
+
+        if (std::find(deleted0.begin(), deleted0.end(), true) == deleted0.end()
+            || std::find(deleted1.begin(), deleted1.end(), true)
+                 == deleted1.end()) {
+          continue;
+        }
+
+        std::sort(delTr.begin(), delTr.end());
+        delTr.erase(std::unique(delTr.begin(), delTr.end()), delTr.end());
+        for (auto deletedT : delTr) {
+          deletedT->deletePending = true;
+        }
+
+        if (delTr.size() % 2 != 0) {
+          continue;
+        }
+
+        v0->q = v1->q.add(v0->q);
+        v0->updatePosition(p);
+
+        const auto tStart = _references.size();
+
+        deletedTriangles = _updateTriangles(v0, v0, deleted0, deletedTriangles);
+        deletedTriangles = _updateTriangles(v0, v1, deleted1, deletedTriangles);
+
+        const auto tCount = _references.size() - tStart;
+
+        if (tCount <= static_cast<size_t>(v0->triangleCount)) {
+          std::copy(_references.begin() + static_cast<long>(tStart),
+                    _references.end(),
+                    _references.begin() + v0->triangleStart);
+        }
+        else {
+          v0->triangleStart = static_cast<int>(tStart);
+        }
+
+        v0->triangleCount = static_cast<int>(tCount);
+        break;
+      }
+    }
+  }
+}
+
+void QuadraticErrorSimplification::_reconstructSubMesh(
+  const SubMeshData& subMesh)
+{
+  for (auto& vertex : _vertices) {
+    vertex.triangleCount = 0;
+  }
+
+  std::vector<const DecimationTriangle*> newTriangles;
+  for (const auto& t : _triangles) {
+    if (!t.deleted) {
+      for (auto vertex : t.vertices) {
+        vertex->triangleCount = 1;
+      }
+      newTriangles.emplace_back(&t);
+    }
+  }
+
+  const auto startingIndex  = _newIndicesArray.size();
+  const auto startingVertex = _newPositionData.size() / 3;
+  const auto hasNormals     = !_normalData.empty();
+  const auto hasUVs         = !_uvs.empty();
+  const auto hasColors      = !_colorsData.empty();
+
+  size_t vertexCount = 0;
+  for (auto& vertex : _vertices) {
+    vertex.id = static_cast<int>(vertexCount);
+    if (!vertex.triangleCount) {
+      continue;
+    }
+    for (auto originalOffset : vertex.originalOffsets) {
+      _newPositionData.insert(_newPositionData.end(),
+                              {vertex.position.x, vertex.position.y,
+                               vertex.position.z});
+      if (hasNormals) {
+        _newNormalData.insert(_newNormalData.end(),
+                              {_normalData[originalOffset * 3],
+                               _normalData[originalOffset * 3 + 1],
+                               _normalData[originalOffset * 3 + 2]});
+      }
+      if (hasUVs) {
+        _newUVsData.insert(_newUVsData.end(),
+                           {_uvs[originalOffset * 2],
+                            _uvs[originalOffset * 2 + 1]});
+      }
+      if (hasColors) {
+        _newColorsData.insert(_newColorsData.end(),
+                              {_colorsData[originalOffset * 4],
+                               _colorsData[originalOffset * 4 + 1],
+                               _colorsData[originalOffset * 4 + 2],
+                               _colorsData[originalOffset * 4 + 3]});
+      }
+      ++vertexCount;
+    }
+  }
+
+  for (auto t : newTriangles) {
+    for (size_t idx = 0; idx < 3; ++idx) {
+      const auto& originalOffsets = t->vertices[idx]->originalOffsets;
+      const auto id = _indices[t->originalOffset + idx];
+      auto it = std::find(originalOffsets.begin(), originalOffsets.end(), id);
+      const auto offset
+        = (it != originalOffsets.end()) ? it - originalOffsets.begin() : 0;
+      _newIndicesArray.emplace_back(static_cast<uint32_t>(
+        static_cast<size_t>(t->vertices[idx]->id + offset) + startingVertex));
+    }
+  }
+
+  _newSubMeshes.emplace_back(SubMeshData{
+    subMesh.materialIndex, static_cast<unsigned int>(startingVertex),
+    vertexCount, static_cast<unsigned int>(startingIndex),
+    newTriangles.size() * 3});
+}
+
+bool QuadraticErrorSimplification::_isFlipped(
+  DecimationVertex* vertex1, DecimationVertex* vertex2, const Vector3& point,
+  std::vector<bool>& deletedArray, std::vector<DecimationTriangle*>& delTr)
+{
+  for (size_t i = 0; i < static_cast<size_t>(vertex1->triangleCount); ++i) {
+    const auto& ref = _references[vertex1->triangleStart + i];
+    auto& t         = _triangles[static_cast<size_t>(ref.triangleId)];
+    if (t.deleted) {
+      continue;
+    }
+
+    const auto s = static_cast<size_t>(ref.vertexId);
+
+    auto v1 = t.vertices[(s + 1) % 3];
+    auto v2 = t.vertices[(s + 2) % 3];
+
+    if (v1 == vertex2 || v2 == vertex2) {
+      deletedArray[i] = true;
+      delTr.emplace_back(&t);
+      continue;
+    }
+
+    auto d1 = v1->position.subtract(point);
+    d1.normalize();
+    auto d2 = v2->position.subtract(point);
+    d2.normalize();
+    if (std::abs(Vector3::Dot(d1, d2)) > 0.999f) {
+      return true;
+    }
+    auto normal = Vector3::Cross(d1, d2).normalize();
+    deletedArray[i] = false;
+    if (Vector3::Dot(normal, t.normal) < 0.2f) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+size_t QuadraticErrorSimplification::_updateTriangles(
+  DecimationVertex* origVertex, DecimationVertex* vertex,
+  const std::vector<bool>& deletedArray, size_t deletedTriangles)
+{
+  auto newDeleted = deletedTriangles;
+  for (size_t i = 0; i < static_cast<size_t>(vertex->triangleCount); ++i) {
+    // Copied, the references are appended to while iterating
+    const auto ref = _references[vertex->triangleStart + i];
+    auto& t        = _triangles[static_cast<size_t>(ref.triangleId)];
+    if (t.deleted) {
+      continue;
+    }
+    if (deletedArray[i] && t.deletePending) {
+      t.deleted = true;
+      ++newDeleted;
+      continue;
+    }
+    t.vertices[static_cast<size_t>(ref.vertexId)] = origVertex;
+    t.isDirty                                     = true;
+    t.error[0] = _calculateError(*t.vertices[0], *t.vertices[1])
+                 + (t.borderFactor / 2.f);
+    t.error[1] = _calculateError(*t.vertices[1], *t.vertices[2])
+                 + (t.borderFactor / 2.f);
+    t.error[2] = _calculateError(*t.vertices[2], *t.vertices[0])
+                 + (t.borderFactor / 2.f);
+    t.error[3] = std::min({t.error[0], t.error[1], t.error[2]});
+    _references.emplace_back(ref);
+  }
+  return newDeleted;
+}
+
+void QuadraticErrorSimplification::_identifyBorder()
+{
+  // A vertex is a border one as soon as one of its neighbors sees it in a
+  // single triangle, the flag is thus never cleared by another neighbor
+  for (auto& v : _vertices) {
+    v.isBorder = false;
+  }
+
+  std::vector<int> vCount;
+  std::vector<int> vId;
+  for (const auto& v : _vertices) {
+    vCount.clear();
+    vId.clear();
+    for (size_t j = 0; j < static_cast<size_t>(v.triangleCount); ++j) {
+      const auto& triangle = _triangles[static_cast<size_t>(
+        _references[v.triangleStart + j].triangleId)];
+      for (auto vv : triangle.vertices) {
+        auto it = std::find(vId.begin(), vId.end(), vv->id);
+        if (it == vId.end()) {
+          vCount.emplace_back(1);
+          vId.emplace_back(vv->id);
+        }
+        else {
+          ++vCount[static_cast<size_t>(it - vId.begin())];
+        }
+      }
+    }
+
+    for (size_t j = 0; j < vCount.size(); ++j) {
+      if (vCount[j] == 1) {
+        _vertices[static_cast<size_t>(vId[j])].isBorder = true;
+      }
+    }
+  }
+}
+
+void QuadraticErrorSimplification::_updateMesh(bool identifyBorders)
+{
+  if (!identifyBorders) {
+    _triangles.erase(std::remove_if(_triangles.begin(), _triangles.end(),
+                                    [](const DecimationTriangle& triangle) {
+                                      return triangle.deleted;
+                                    }),
+                     _triangles.end());
+  }
+
+  for (auto& vertex : _vertices) {
+    vertex.triangleCount = 0;
+    vertex.triangleStart = 0;
+  }
+
+  for (const auto& t : _triangles) {
+    for (auto v : t.vertices) {
+      ++v->triangleCount;
+    }
+  }
+
+  int tStart = 0;
+  for (auto& vertex : _vertices) {
+    vertex.triangleStart = tStart;
+    tStart += vertex.triangleCount;
+    vertex.triangleCount = 0;
+  }
+
+  std::vector<Reference> newReferences(_triangles.size() * 3, Reference(0, 0));
+  for (size_t i = 0; i < _triangles.size(); ++i) {
+    const auto& t = _triangles[i];
+    for (size_t j = 0; j < 3; ++j) {
+      auto v = t.vertices[j];
+      newReferences[static_cast<size_t>(v->triangleStart + v->triangleCount)]
+        = Reference(static_cast<int>(j), static_cast<int>(i));
+      ++v->triangleCount;
+    }
+  }
+  _references = std::move(newReferences);
+
+  if (identifyBorders) {
+    _identifyBorder();
+  }
+}
+
+float QuadraticErrorSimplification::_vertexError(const QuadraticMatrix& q,
+                                                 const Vector3& point) const
+{
+  const auto& d = q.data;
+  const auto x  = point.x;
+  const auto y  = point.y;
+  const auto z  = point.z;
+  return d[0] * x * x + 2 * d[1] * x * y + 2 * d[2] * x * z + 2 * d[3] * x
+         + d[4] * y * y + 2 * d[5] * y * z + 2 * d[6] * y + d[7] * z * z
+         + 2 * d[8] * z + d[9];
+}
+
+float QuadraticErrorSimplification::_calculateError(
+  const DecimationVertex& vertex1, const DecimationVertex& vertex2,
+  Vector3* pointResult) const
+{
+  const auto q      = vertex1.q.add(vertex2.q);
+  const auto border = vertex1.isBorder && vertex2.isBorder;
+  float error       = 0.f;
+  const auto qDet   = q.det(0, 1, 2, 1, 4, 5, 2, 5, 7);
+
+  if (qDet != 0.f && !border) {
+    Vector3 point;
+    point.x = -1.f / qDet * (q.det(1, 2, 3, 4, 5, 6, 5, 7, 8));
+    point.y = 1.f / qDet * (q.det(0, 2, 3, 1, 5, 6, 2, 7, 8));
+    point.z = -1.f / qDet * (q.det(0, 1, 3, 1, 4, 6, 2, 5, 8));
+    error   = _vertexError(q, point);
+    if (pointResult) {
+      pointResult->copyFrom(point);
+    }
+  }
+  else {
+    const auto p3     = vertex1.position.add(vertex2.position).scale(0.5f);
+    const auto error1 = _vertexError(q, vertex1.position);
+    const auto error2 = _vertexError(q, vertex2.position);
+    const auto error3 = _vertexError(q, p3);
+    error             = std::min({error1, error2, error3});
+    if (pointResult) {
+      if (error == error1) {
+        pointResult->copyFrom(vertex1.position);
+      }
+      else if (error == error2) {
+        pointResult->copyFrom(vertex2.position);
+      }
+      else {
+        pointResult->copyFrom(p3);
+      }
+    }
+  }
+
+  return error;
+}
+
+} // end of namespace BABYLON
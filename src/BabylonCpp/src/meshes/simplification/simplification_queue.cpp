@@ -1,5 +1,10 @@
 #include <babylon/meshes/simplification/simplification_queue.h>
 
+#include <chrono>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/simplification/quadratic_error_simplification.h>
 #include <babylon/meshes/simplification/simplification_settings.h>
 
 namespace BABYLON {
@@ -10,6 +15,12 @@ SimplificationQueue::SimplificationQueue() : running{false}
 
 SimplificationQueue::~SimplificationQueue()
 {
+  // The workers reference the running simplifiers
+  for (auto& decimation : _decimations) {
+    if (decimation.valid()) {
+      decimation.wait();
+    }
+  }
 }
 
 void SimplificationQueue::addTask(const ISimplificationTask& task)
@@ -20,8 +31,8 @@ void SimplificationQueue::addTask(const ISimplificationTask& task)
 void SimplificationQueue::executeNext()
 {
   if (!_simplificationQueue.empty()) {
-    running                         = true;
-    const ISimplificationTask& task = _simplificationQueue.front();
+    running   = true;
+    auto task = _simplificationQueue.front();
     _simplificationQueue.pop();
     runSimplification(task);
   }
@@ -30,18 +41,84 @@ void SimplificationQueue::executeNext()
   }
 }
 
-void SimplificationQueue::runSimplification(const ISimplificationTask& /*task*/)
+void SimplificationQueue::runSimplification(const ISimplificationTask& task)
+{
+  _runningTask = task;
+  _runningSimplifications.clear();
+  _decimations.clear();
+
+  // The geometry is copied on the calling thread, the workers only decimate
+  // the copies
+  for (const auto& setting : task.settings) {
+    auto simplifier = getSimplifier(task);
+    simplifier->_readMeshData();
+    _runningSimplifications.emplace_back(
+      RunningSimplification{setting, std::move(simplifier)});
+  }
+
+  auto& threadPool = ThreadPool::Default();
+  if (task.parallelProcessing) {
+    for (auto& runningSimplification : _runningSimplifications) {
+      auto simplification = &runningSimplification;
+      _decimations.emplace_back(threadPool.enqueue([simplification]() {
+        simplification->simplifier->_decimate(simplification->settings);
+      }));
+    }
+  }
+  else {
+    _decimations.emplace_back(threadPool.enqueue([this]() {
+      for (auto& simplification : _runningSimplifications) {
+        simplification.simplifier->_decimate(simplification.settings);
+      }
+    }));
+  }
+}
+
+void SimplificationQueue::_installCompletedSimplifications()
 {
+  if (!running) {
+    return;
+  }
+
+  for (auto& decimation : _decimations) {
+    if (decimation.wait_for(std::chrono::seconds(0))
+        != std::future_status::ready) {
+      return;
+    }
+  }
+
+  auto decimations     = std::move(_decimations);
+  auto simplifications = std::move(_runningSimplifications);
+  _decimations.clear();
+  _runningSimplifications.clear();
+  running = false;
+
+  // Rethrows the exceptions raised on the worker threads
+  for (auto& decimation : decimations) {
+    decimation.get();
+  }
+
+  for (const auto& simplification : simplifications) {
+    auto simplifiedMesh = simplification.simplifier->_createDecimatedMesh();
+    _runningTask.mesh->addLODLevel(simplification.settings.distance,
+                                   simplifiedMesh);
+    simplifiedMesh->isVisible = true;
+  }
+
+  if (_runningTask.successCallback) {
+    _runningTask.successCallback();
+  }
+
+  executeNext();
 }
 
-ISimplifier* SimplificationQueue::getSimplifier(const ISimplificationTask& task)
+std::unique_ptr<QuadraticErrorSimplification>
+SimplificationQueue::getSimplifier(const ISimplificationTask& task)
 {
   switch (task.simplificationType) {
     case SimplificationType::QUADRATIC:
     default:
-      // TODO FIXME
-      return nullptr;
-      // return new QuadraticErrorSimplification(task.mesh);
+      return std::make_unique<QuadraticErrorSimplification>(task.mesh);
   }
 }
 
@@ -3,6 +3,7 @@
 #include <babylon/babylon_stl_util.h>
 #include <babylon/collisions/intersection_info.h>
 #include <babylon/culling/bounding_info.h>
+#include <babylon/culling/mesh_bvh.h>
 #include <babylon/culling/ray.h>
 #include <babylon/engines/constants.h>
 #include <babylon/engines/engine.h>
@@ -361,6 +362,12 @@ SubMesh::_intersectTriangles(Ray& ray, const std::vector<Vector3>& positions,
                              const IndicesArray& indices, bool fastCheck,
                              const TrianglePickingPredicate& trianglePredicate)
 {
+  auto bvh = _mesh->_getBVH();
+  if (bvh) {
+    return bvh->intersectsRay(ray, positions, indices, indexStart, indexCount,
+                              fastCheck, trianglePredicate);
+  }
+
   std::optional<IntersectionInfo> intersectInfo = std::nullopt;
 
   // Triangles test
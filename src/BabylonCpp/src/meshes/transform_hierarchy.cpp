@@ -0,0 +1,153 @@
+#include <babylon/meshes/transform_hierarchy.h>
+
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/abstract_mesh.h>
+#include <babylon/meshes/transform_node.h>
+
+namespace BABYLON {
+
+TransformHierarchy::TransformHierarchy(Scene* scene)
+    : _scene{scene}, _isDirty{true}, _updateId{0}, _sceneNodeCount{0}
+{
+  const auto onMeshChanged
+    = [this](AbstractMesh* /*mesh*/, EventState& /*es*/) { markAsDirty(); };
+  const auto onTransformNodeChanged
+    = [this](TransformNode* /*node*/, EventState& /*es*/) { markAsDirty(); };
+
+  _onNewMeshAddedObserver = _scene->onNewMeshAddedObservable.add(onMeshChanged);
+  _onMeshRemovedObserver  = _scene->onMeshRemovedObservable.add(onMeshChanged);
+  _onNewTransformNodeAddedObserver
+    = _scene->onNewTransformNodeAddedObservable.add(onTransformNodeChanged);
+  _onTransformNodeRemovedObserver
+    = _scene->onTransformNodeRemovedObservable.add(onTransformNodeChanged);
+}
+
+TransformHierarchy::~TransformHierarchy()
+{
+  _scene->onNewMeshAddedObservable.remove(_onNewMeshAddedObserver);
+  _scene->onMeshRemovedObservable.remove(_onMeshRemovedObserver);
+  _scene->onNewTransformNodeAddedObservable.remove(
+    _onNewTransformNodeAddedObserver);
+  _scene->onTransformNodeRemovedObservable.remove(
+    _onTransformNodeRemovedObserver);
+}
+
+void TransformHierarchy::markAsDirty()
+{
+  _isDirty = true;
+}
+
+const std::vector<TransformNode*>& TransformHierarchy::nodes() const
+{
+  return _nodes;
+}
+
+bool TransformHierarchy::isUpToDate(const TransformNode* node) const
+{
+  return node->_transformHierarchyUpdateId == _updateId;
+}
+
+void TransformHierarchy::_rebuild()
+{
+  std::vector<TransformNode*> nodes;
+  nodes.reserve(_scene->transformNodes.size() + _scene->meshes.size());
+  for (const auto& transformNode : _scene->transformNodes) {
+    nodes.emplace_back(transformNode.get());
+  }
+  for (const auto& mesh : _scene->meshes) {
+    nodes.emplace_back(mesh.get());
+  }
+
+  std::unordered_map<Node*, size_t> indices;
+  indices.reserve(nodes.size());
+  for (size_t index = 0; index < nodes.size(); ++index) {
+    indices[nodes[index]] = index;
+  }
+
+  // Depth of every node among the transform nodes of the scene
+  std::vector<size_t> depths(nodes.size(), 0);
+  for (size_t index = 0; index < nodes.size(); ++index) {
+    for (Node* parent = nodes[index]->parent();
+         parent && indices.find(parent) != indices.end();
+         parent = parent->parent()) {
+      ++depths[index];
+    }
+  }
+
+  // Topological order: sort by depth, keeping the scene order of the siblings
+  std::vector<size_t> order(nodes.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&depths](size_t a, size_t b) {
+    return depths[a] < depths[b];
+  });
+
+  std::vector<size_t> sortedIndices(nodes.size());
+  for (size_t index = 0; index < order.size(); ++index) {
+    sortedIndices[order[index]] = index;
+  }
+
+  _nodes.resize(nodes.size());
+  _parents.resize(nodes.size());
+  _parentIndices.resize(nodes.size());
+  for (size_t index = 0; index < order.size(); ++index) {
+    auto node       = nodes[order[index]];
+    auto parent     = node->parent();
+    _nodes[index]   = node;
+    _parents[index] = parent;
+    if (!parent) {
+      _parentIndices[index] = NO_PARENT;
+    }
+    else {
+      auto it               = indices.find(parent);
+      _parentIndices[index] = (it != indices.end()) ?
+                                static_cast<int>(sortedIndices[it->second]) :
+                                EXTERNAL_PARENT;
+    }
+  }
+
+  _sceneNodeCount = _scene->transformNodes.size() + _scene->meshes.size();
+  _isDirty        = false;
+}
+
+size_t TransformHierarchy::update()
+{
+  if (_isDirty
+      || _sceneNodeCount
+           != _scene->transformNodes.size() + _scene->meshes.size()) {
+    _rebuild();
+  }
+
+  ++_updateId;
+
+  size_t updatedCount = 0;
+  for (size_t index = 0; index < _nodes.size(); ++index) {
+    auto node = _nodes[index];
+
+    if (_parentIndices[index] == EXTERNAL_PARENT
+        || node->parent() != _parents[index]) {
+      // The parent is not visited by the pass or the node has been reparented
+      // since the last rebuild: fall back to the validation of the parent chain
+      if (node->parent() != _parents[index]) {
+        _isDirty = true;
+      }
+      const auto childUpdateId = node->_childUpdateId;
+      node->computeWorldMatrix();
+      if (node->_childUpdateId != childUpdateId) {
+        ++updatedCount;
+      }
+    }
+    else if (node->_computeWorldMatrixFromParent()) {
+      ++updatedCount;
+    }
+
+    node->_transformHierarchyUpdateId = _updateId;
+  }
+
+  return updatedCount;
+}
+
+} // end of namespace BABYLON
@@ -35,6 +35,7 @@ TransformNode::TransformNode(const std::string& iName, Scene* scene,
     , _poseMatrix{std::make_unique<Matrix>(Matrix::Identity())}
     , _localMatrix{Matrix::Zero()}
     , _indexInSceneTransformNodesArray{-1}
+    , _transformHierarchyUpdateId{-1}
     , position{this, &TransformNode::get_position, &TransformNode::set_position}
     , rotation{this, &TransformNode::get_rotation, &TransformNode::set_rotation}
     , scaling{this, &TransformNode::get_scaling, &TransformNode::set_scaling}
@@ -172,6 +173,69 @@ void TransformNode::setProperty(
   }
 }
 
+AnimationPropertySetter
+TransformNode::bindProperty(const std::vector<std::string>& targetPropertyPath)
+{
+  if (targetPropertyPath.size() == 1) {
+    const auto& target = targetPropertyPath[0];
+    if (target == "rotationQuaternion") {
+      return [this](const AnimationValue& value) {
+        if (value.animationType() == Animation::ANIMATIONTYPE_QUATERNION()) {
+          set_rotationQuaternion(value.get<Quaternion>());
+        }
+      };
+    }
+    // Position
+    if (target == "position") {
+      return [this](const AnimationValue& value) {
+        if (value.animationType() == Animation::ANIMATIONTYPE_VECTOR3()) {
+          set_position(value.get<Vector3>());
+        }
+      };
+    }
+    // Rotation
+    if (target == "rotation") {
+      return [this](const AnimationValue& value) {
+        if (value.animationType() == Animation::ANIMATIONTYPE_VECTOR3()) {
+          set_rotation(value.get<Vector3>());
+        }
+      };
+    }
+    // Scaling
+    if (target == "scaling") {
+      return [this](const AnimationValue& value) {
+        if (value.animationType() == Animation::ANIMATIONTYPE_VECTOR3()) {
+          set_scaling(value.get<Vector3>());
+        }
+      };
+    }
+  }
+  else if (targetPropertyPath.size() == 2) {
+    const auto& target = targetPropertyPath[0];
+    const auto& key    = targetPropertyPath[1];
+    float* component   = nullptr;
+    if (target == "position") {
+      component = IAnimatable::bindProperty(key, _position);
+    }
+    else if (target == "rotation") {
+      component = IAnimatable::bindProperty(key, _rotation);
+    }
+    else if (target == "scaling") {
+      component = IAnimatable::bindProperty(key, _scaling);
+    }
+    if (component) {
+      return [this, component](const AnimationValue& value) {
+        if (value.animationType() == Animation::ANIMATIONTYPE_FLOAT()) {
+          *component = value.get<float>();
+          _isDirty   = true;
+        }
+      };
+    }
+  }
+
+  return IAnimatable::bindProperty(targetPropertyPath);
+}
+
 const std::string TransformNode::getClassName() const
 {
   return "TransformNode";
@@ -450,7 +514,7 @@ TransformNode& TransformNode::setAbsolutePosition(
   auto absolutePositionZ = (*iAbsolutePosition).z;
 
   if (parent()) {
-    auto& invertParentWorldMatrix = Tmp::MatrixArray[0];
+    auto& invertParentWorldMatrix = Tmp::MatrixArray()[0];
     parent()->getWorldMatrix().invertToRef(invertParentWorldMatrix);
     Vector3::TransformCoordinatesFromFloatsToRef(
       absolutePositionX, absolutePositionY, absolutePositionZ,
@@ -474,7 +538,7 @@ TransformNode& TransformNode::setPositionWithLocalVector(const Vector3& vector3)
 Vector3 TransformNode::getPositionExpressedInLocalSpace()
 {
   computeWorldMatrix();
-  auto& invLocalWorldMatrix = Tmp::MatrixArray[0];
+  auto& invLocalWorldMatrix = Tmp::MatrixArray()[0];
   _localMatrix.invertToRef(invLocalWorldMatrix);
   return Vector3::TransformNormal(position, invLocalWorldMatrix);
 }
@@ -498,12 +562,12 @@ TransformNode& TransformNode::lookAt(const Vector3& targetPoint, float yawCor,
   if (space == Space::WORLD && parent()) {
     if (rotationQuaternion().has_value()) {
       // Get local rotation matrix of the looking object
-      auto& rotationMatrix = Tmp::MatrixArray[0];
+      auto& rotationMatrix = Tmp::MatrixArray()[0];
       rotationQuaternion()->toRotationMatrix(rotationMatrix);
 
       // Offset rotation by parent's inverted rotation matrix to correct in
       // world space
-      auto& parentRotationMatrix = Tmp::MatrixArray[1];
+      auto& parentRotationMatrix = Tmp::MatrixArray()[1];
       parent()->getWorldMatrix().getRotationMatrixToRef(parentRotationMatrix);
       parentRotationMatrix.invert();
       rotationMatrix.multiplyToRef(parentRotationMatrix, rotationMatrix);
@@ -511,14 +575,14 @@ TransformNode& TransformNode::lookAt(const Vector3& targetPoint, float yawCor,
     }
     else {
       // Get local rotation matrix of the looking object
-      auto& quaternionRotation = Tmp::QuaternionArray[0];
+      auto& quaternionRotation = Tmp::QuaternionArray()[0];
       Quaternion::FromEulerVectorToRef(rotation, quaternionRotation);
-      auto& rotationMatrix = Tmp::MatrixArray[0];
+      auto& rotationMatrix = Tmp::MatrixArray()[0];
       quaternionRotation.toRotationMatrix(rotationMatrix);
 
       // Offset rotation by parent's inverted rotation matrix to correct in
       // world space
-      auto& parentRotationMatrix = Tmp::MatrixArray[1];
+      auto& parentRotationMatrix = Tmp::MatrixArray()[1];
       parent()->getWorldMatrix().getRotationMatrixToRef(parentRotationMatrix);
       parentRotationMatrix.invert();
       rotationMatrix.multiplyToRef(parentRotationMatrix, rotationMatrix);
@@ -575,7 +639,7 @@ TransformNode& TransformNode::setPivotPoint(Vector3& point, Space space)
   auto wm = getWorldMatrix();
 
   if (space == Space::WORLD) {
-    auto& tmat = Tmp::MatrixArray[0];
+    auto& tmat = Tmp::MatrixArray()[0];
     wm.invertToRef(tmat);
     point = Vector3::TransformCoordinates(point, tmat);
   }
@@ -624,9 +688,9 @@ TransformNode& TransformNode::setParent(Node* node)
     return *this;
   }
 
-  auto& quatRotation = Tmp::QuaternionArray[0];
-  auto& newPosition  = Tmp::Vector3Array[0];
-  auto& scale        = Tmp::Vector3Array[1];
+  auto& quatRotation = Tmp::QuaternionArray()[0];
+  auto& newPosition  = Tmp::Vector3Array()[0];
+  auto& scale        = Tmp::Vector3Array()[1];
 
   if (!node) {
     if (parent()) {
@@ -636,8 +700,8 @@ TransformNode& TransformNode::setParent(Node* node)
     getWorldMatrix().decompose(scale, quatRotation, newPosition);
   }
   else {
-    auto& diffMatrix      = Tmp::MatrixArray[0];
-    auto& invParentMatrix = Tmp::MatrixArray[1];
+    auto& diffMatrix      = Tmp::MatrixArray()[0];
+    auto& invParentMatrix = Tmp::MatrixArray()[1];
 
     computeWorldMatrix(true);
     node->computeWorldMatrix(true);
@@ -676,6 +740,31 @@ bool TransformNode::_updateNonUniformScalingState(bool value)
   return true;
 }
 
+bool TransformNode::_computeWorldMatrixFromParent()
+{
+  if (_isWorldMatrixFrozen && !_isDirty) {
+    return false;
+  }
+
+  if (!_isDirty && _cache.parent == parent() && _isSyncedWithParentUpdate()
+      && _isSynchronized()) {
+    _currentRenderId = getScene()->getRenderId();
+    return false;
+  }
+
+  computeWorldMatrix(true);
+  return true;
+}
+
+bool TransformNode::_canBeEvaluatedConcurrently()
+{
+  // The parent, the bone, the active camera and the observers are shared with
+  // other nodes
+  return !parent() && !_transformToBoneReferal && !_infiniteDistance
+         && _billboardMode == TransformNode::BILLBOARDMODE_NONE
+         && !onAfterWorldMatrixUpdateObservable.hasObservers();
+}
+
 TransformNode& TransformNode::attachToBone(Bone* bone,
                                            TransformNode* affectedTransformNode)
 {
@@ -718,7 +807,7 @@ TransformNode& TransformNode::rotate(Vector3 axis, float amount, Space space)
   }
   else {
     if (parent()) {
-      auto& invertParentWorldMatrix = Tmp::MatrixArray[0];
+      auto& invertParentWorldMatrix = Tmp::MatrixArray()[0];
       parent()->getWorldMatrix().invertToRef(invertParentWorldMatrix);
       axis = Vector3::TransformNormal(axis, invertParentWorldMatrix);
     }
@@ -740,16 +829,16 @@ TransformNode& TransformNode::rotateAround(const Vector3& point, Vector3& axis,
     rotation().setAll(0.f);
   }
 
-  auto& tmpVector        = Tmp::Vector3Array[0];
-  auto& finalScale       = Tmp::Vector3Array[1];
-  auto& finalTranslation = Tmp::Vector3Array[2];
+  auto& tmpVector        = Tmp::Vector3Array()[0];
+  auto& finalScale       = Tmp::Vector3Array()[1];
+  auto& finalTranslation = Tmp::Vector3Array()[2];
 
-  auto& finalRotation = Tmp::QuaternionArray[0];
+  auto& finalRotation = Tmp::QuaternionArray()[0];
 
-  auto& translationMatrix    = Tmp::MatrixArray[0]; // T
-  auto& translationMatrixInv = Tmp::MatrixArray[1]; // T'
-  auto& rotationMatrix       = Tmp::MatrixArray[2]; // R
-  auto& finalMatrix          = Tmp::MatrixArray[3]; // T' x R x T
+  auto& translationMatrix    = Tmp::MatrixArray()[0]; // T
+  auto& translationMatrixInv = Tmp::MatrixArray()[1]; // T'
+  auto& rotationMatrix       = Tmp::MatrixArray()[2]; // R
+  auto& finalMatrix          = Tmp::MatrixArray()[3]; // T' x R x T
 
   point.subtractToRef(position, tmpVector);
   Matrix::TranslationToRef(tmpVector.x, tmpVector.y, tmpVector.z,
@@ -790,11 +879,11 @@ TransformNode& TransformNode::addRotation(float x, float y, float z)
     rotationQuaternionTmp = *rotationQuaternion();
   }
   else {
-    rotationQuaternionTmp = Tmp::QuaternionArray[1];
+    rotationQuaternionTmp = Tmp::QuaternionArray()[1];
     Quaternion::RotationYawPitchRollToRef(rotation().y, rotation().x,
                                           rotation().z, rotationQuaternionTmp);
   }
-  auto& accumulation = Tmp::QuaternionArray[0];
+  auto& accumulation = Tmp::QuaternionArray()[0];
   Quaternion::RotationYawPitchRollToRef(y, x, z, accumulation);
   rotationQuaternionTmp.multiplyInPlace(accumulation);
   if (!rotationQuaternion()) {
@@ -885,16 +974,16 @@ Matrix& TransformNode::computeWorldMatrix(bool force,
 
   // Compose
   if (_usePivotMatrix) {
-    auto& scaleMatrix = Tmp::MatrixArray[1];
+    auto& scaleMatrix = Tmp::MatrixArray()[1];
     Matrix::ScalingToRef(iScaling.x, iScaling.y, iScaling.z, scaleMatrix);
 
     // Rotation
-    auto& rotationMatrix = Tmp::MatrixArray[0];
+    auto& rotationMatrix = Tmp::MatrixArray()[0];
     iRotation.toRotationMatrix(rotationMatrix);
 
     // Composing transformations
-    _pivotMatrix.multiplyToRef(scaleMatrix, Tmp::MatrixArray[4]);
-    Tmp::MatrixArray[4].multiplyToRef(rotationMatrix, _localMatrix);
+    _pivotMatrix.multiplyToRef(scaleMatrix, Tmp::MatrixArray()[4]);
+    Tmp::MatrixArray()[4].multiplyToRef(rotationMatrix, _localMatrix);
 
     // Post multiply inverse of pivotMatrix
     if (_postMultiplyPivotMatrix) {
@@ -913,26 +1002,26 @@ Matrix& TransformNode::computeWorldMatrix(bool force,
     if (useBillboardPath) {
       if (_transformToBoneReferal) {
         iParent->getWorldMatrix().multiplyToRef(
-          _transformToBoneReferal->getWorldMatrix(), Tmp::MatrixArray[7]);
+          _transformToBoneReferal->getWorldMatrix(), Tmp::MatrixArray()[7]);
       }
       else {
-        Tmp::MatrixArray[7].copyFrom(iParent->getWorldMatrix());
+        Tmp::MatrixArray()[7].copyFrom(iParent->getWorldMatrix());
       }
 
       // Extract scaling and translation from parent
-      auto& translation = Tmp::Vector3Array[5];
-      auto& scale       = Tmp::Vector3Array[6];
-      Tmp::MatrixArray[7].decompose(scale, std::nullopt, translation);
-      Matrix::ScalingToRef(scale.x, scale.y, scale.z, Tmp::MatrixArray[7]);
-      Tmp::MatrixArray[7].setTranslation(translation);
+      auto& translation = Tmp::Vector3Array()[5];
+      auto& scale       = Tmp::Vector3Array()[6];
+      Tmp::MatrixArray()[7].decompose(scale, std::nullopt, translation);
+      Matrix::ScalingToRef(scale.x, scale.y, scale.z, Tmp::MatrixArray()[7]);
+      Tmp::MatrixArray()[7].setTranslation(translation);
 
-      _localMatrix.multiplyToRef(Tmp::MatrixArray[7], _worldMatrix);
+      _localMatrix.multiplyToRef(Tmp::MatrixArray()[7], _worldMatrix);
     }
     else {
       if (_transformToBoneReferal) {
         _localMatrix.multiplyToRef(iParent->getWorldMatrix(),
-                                   Tmp::MatrixArray[6]);
-        Tmp::MatrixArray[6].multiplyToRef(
+                                   Tmp::MatrixArray()[6]);
+        Tmp::MatrixArray()[6].multiplyToRef(
           _transformToBoneReferal->getWorldMatrix(), _worldMatrix);
       }
       else {
@@ -947,20 +1036,20 @@ Matrix& TransformNode::computeWorldMatrix(bool force,
 
   // Billboarding (testing PG:http://www.babylonjs-playground.com/#UJEIL#13)
   if (useBillboardPath && camera) {
-    auto& storedTranslation = Tmp::Vector3Array[0];
+    auto& storedTranslation = Tmp::Vector3Array()[0];
     _worldMatrix.getTranslationToRef(storedTranslation); // Save translation
 
     // Cancel camera rotation
-    Tmp::MatrixArray[1].copyFrom(camera->getViewMatrix());
-    Tmp::MatrixArray[1].setTranslationFromFloats(0.f, 0.f, 0.f);
-    Tmp::MatrixArray[1].invertToRef(Tmp::MatrixArray[0]);
+    Tmp::MatrixArray()[1].copyFrom(camera->getViewMatrix());
+    Tmp::MatrixArray()[1].setTranslationFromFloats(0.f, 0.f, 0.f);
+    Tmp::MatrixArray()[1].invertToRef(Tmp::MatrixArray()[0]);
 
     if ((billboardMode & TransformNode::BILLBOARDMODE_ALL)
         != TransformNode::BILLBOARDMODE_ALL) {
-      Tmp::MatrixArray[0].decompose(std::nullopt, Tmp::QuaternionArray[0],
+      Tmp::MatrixArray()[0].decompose(std::nullopt, Tmp::QuaternionArray()[0],
                                     std::nullopt);
-      auto& eulerAngles = Tmp::Vector3Array[1];
-      Tmp::QuaternionArray[0].toEulerAnglesToRef(eulerAngles);
+      auto& eulerAngles = Tmp::Vector3Array()[1];
+      Tmp::QuaternionArray()[0].toEulerAnglesToRef(eulerAngles);
 
       if ((billboardMode & TransformNode::BILLBOARDMODE_X)
           != TransformNode::BILLBOARDMODE_X) {
@@ -978,13 +1067,13 @@ Matrix& TransformNode::computeWorldMatrix(bool force,
       }
 
       Matrix::RotationYawPitchRollToRef(eulerAngles.y, eulerAngles.x,
-                                        eulerAngles.z, Tmp::MatrixArray[0]);
+                                        eulerAngles.z, Tmp::MatrixArray()[0]);
     }
     _worldMatrix.setTranslationFromFloats(0.f, 0.f, 0.f);
-    _worldMatrix.multiplyToRef(Tmp::MatrixArray[0], _worldMatrix);
+    _worldMatrix.multiplyToRef(Tmp::MatrixArray()[0], _worldMatrix);
 
     // Restore translation
-    _worldMatrix.setTranslation(Tmp::Vector3Array[0]);
+    _worldMatrix.setTranslation(Tmp::Vector3Array()[0]);
   }
 
   // Normal matrix
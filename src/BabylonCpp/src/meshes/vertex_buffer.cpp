@@ -212,6 +212,17 @@ GL::IGLBuffer* VertexBuffer::update(const Float32Array& data)
   return _getBuffer()->update(data);
 }
 
+GL::IGLBuffer* VertexBuffer::_updateFromData()
+{
+  return _getBuffer()->_updateFromData();
+}
+
+GL::IGLBuffer* VertexBuffer::_updateRange(const Float32Array& data,
+                                          size_t offset, size_t count)
+{
+  return _getBuffer()->_updateRange(data, offset, count);
+}
+
 GL::IGLBuffer* VertexBuffer::updateDirectly(const Float32Array& data,
                                             size_t offset, bool useBytes)
 {
@@ -0,0 +1,463 @@
+#include <babylon/misc/profiler.h>
+
+#include <algorithm>
+#include <istream>
+#include <ostream>
+
+#include <nlohmann/json.hpp>
+
+namespace BABYLON {
+
+namespace {
+
+std::atomic<uint64_t> ProfilerIdCounter{0};
+
+// Magic number and version of the binary format
+constexpr char BINARY_PROFILE_MAGIC[4] = {'B', 'P', 'R', 'F'};
+constexpr uint64_t BINARY_PROFILE_VERSION = 1;
+
+void WriteVarint(std::ostream& stream, uint64_t value)
+{
+  while (value >= 0x80) {
+    stream.put(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  stream.put(static_cast<char>(value));
+}
+
+bool ReadVarint(std::istream& stream, uint64_t& value)
+{
+  value = 0;
+  for (unsigned int shift = 0; shift < 64; shift += 7) {
+    const auto byte = stream.get();
+    if (byte == std::char_traits<char>::eof()) {
+      return false;
+    }
+    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// The signed values are zigzag encoded, the small negative values staying
+// short
+void WriteSignedVarint(std::ostream& stream, int64_t value)
+{
+  WriteVarint(stream, (static_cast<uint64_t>(value) << 1)
+                        ^ static_cast<uint64_t>(value >> 63));
+}
+
+bool ReadSignedVarint(std::istream& stream, int64_t& value)
+{
+  uint64_t encoded = 0;
+  if (!ReadVarint(stream, encoded)) {
+    return false;
+  }
+  value = static_cast<int64_t>(encoded >> 1)
+          ^ -static_cast<int64_t>(encoded & 1);
+  return true;
+}
+
+} // end of anonymous namespace
+
+/**
+ * Events of a thread, written by the thread and read by endFrame(): a single
+ * producer single consumer ring buffer.
+ */
+struct Profiler::ThreadBuffer {
+  struct Scope {
+    uint32_t nameId;
+    uint64_t start;
+  }; // end of struct Scope
+
+  explicit ThreadBuffer(uint32_t iThreadId)
+      : threadId{iThreadId}
+      , events(ThreadBufferCapacity)
+      , head{0}
+      , tail{0}
+      , droppedEventCount{0}
+  {
+  }
+
+  const uint32_t threadId;
+  std::vector<ProfileEvent> events;
+  // Number of events written, only modified by the thread
+  std::atomic<size_t> head;
+  // Number of events read, only modified by endFrame()
+  std::atomic<size_t> tail;
+  std::atomic<size_t> droppedEventCount;
+  // Only accessed by the thread: open scopes and name ids already resolved
+  std::vector<Scope> scopes;
+  std::unordered_map<std::string, uint32_t> nameIds;
+}; // end of struct Profiler::ThreadBuffer
+
+Profiler::Profiler()
+    : maxFrameCount{120}
+    , _id{++ProfilerIdCounter}
+    , _enabled{false}
+    , _epoch{std::chrono::steady_clock::now()}
+    , _frameId{0}
+    , _frameStart{0}
+{
+}
+
+Profiler::~Profiler() = default;
+
+Profiler& Profiler::Default()
+{
+  static Profiler profiler;
+  return profiler;
+}
+
+void Profiler::setEnabled(bool value)
+{
+  _enabled.store(value, std::memory_order_relaxed);
+}
+
+bool Profiler::isEnabled() const
+{
+  return _enabled.load(std::memory_order_relaxed);
+}
+
+uint64_t Profiler::_now() const
+{
+  return static_cast<uint64_t>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - _epoch)
+      .count());
+}
+
+Profiler::ThreadBuffer* Profiler::_getThreadBuffer(bool create)
+{
+  // Buffers of the calling thread, one per profiler. The profiler also owns
+  // them so that they outlive the thread until its events are collected
+  thread_local std::vector<std::pair<uint64_t, std::shared_ptr<ThreadBuffer>>>
+    threadBuffers;
+  for (const auto& [profilerId, buffer] : threadBuffers) {
+    if (profilerId == _id) {
+      return buffer.get();
+    }
+  }
+
+  if (!create) {
+    return nullptr;
+  }
+
+  // Releases the buffers of the destroyed profilers
+  threadBuffers.erase(std::remove_if(threadBuffers.begin(),
+                                     threadBuffers.end(),
+                                     [](const auto& entry) {
+                                       return entry.second.use_count() == 1;
+                                     }),
+                      threadBuffers.end());
+
+  std::lock_guard<std::mutex> lock{_mutex};
+  auto buffer = std::make_shared<ThreadBuffer>(
+    static_cast<uint32_t>(_threadBuffers.size()));
+  _threadBuffers.emplace_back(buffer);
+  threadBuffers.emplace_back(_id, buffer);
+  return buffer.get();
+}
+
+uint32_t Profiler::_getNameId(ThreadBuffer& buffer, const std::string& name)
+{
+  auto it = buffer.nameIds.find(name);
+  if (it != buffer.nameIds.end()) {
+    return it->second;
+  }
+
+  std::lock_guard<std::mutex> lock{_mutex};
+  auto [nameIt, inserted]
+    = _nameIds.try_emplace(name, static_cast<uint32_t>(_names.size()));
+  if (inserted) {
+    _names.emplace_back(name);
+  }
+  buffer.nameIds.emplace(name, nameIt->second);
+  return nameIt->second;
+}
+
+void Profiler::begin(const std::string& name)
+{
+  if (!isEnabled()) {
+    return;
+  }
+
+  auto& buffer = *_getThreadBuffer(true);
+  buffer.scopes.emplace_back(
+    ThreadBuffer::Scope{_getNameId(buffer, name), _now()});
+}
+
+void Profiler::end(const std::string& name)
+{
+  // The scopes opened before the profiler was disabled are still closed
+  auto buffer = _getThreadBuffer(false);
+  if (!buffer || buffer->scopes.empty()) {
+    return;
+  }
+
+  const auto now    = _now();
+  const auto nameId = _getNameId(*buffer, name);
+  auto& scopes      = buffer->scopes;
+  auto it           = std::find_if(scopes.rbegin(), scopes.rend(),
+                         [nameId](const ThreadBuffer::Scope& scope) {
+                           return scope.nameId == nameId;
+                         });
+  if (it == scopes.rend()) {
+    return;
+  }
+
+  ProfileEvent event;
+  event.nameId   = nameId;
+  event.threadId = buffer->threadId;
+  event.depth    = static_cast<uint32_t>(scopes.rend() - it - 1);
+  event.start    = it->start;
+  event.duration = now - it->start;
+  scopes.erase(std::next(it).base());
+
+  const auto head = buffer->head.load(std::memory_order_relaxed);
+  const auto tail = buffer->tail.load(std::memory_order_acquire);
+  if (head - tail >= ThreadBufferCapacity) {
+    buffer->droppedEventCount.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  buffer->events[head % ThreadBufferCapacity] = event;
+  buffer->head.store(head + 1, std::memory_order_release);
+}
+
+const ProfileFrame& Profiler::endFrame()
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  ProfileFrame frame;
+  frame.id    = _frameId++;
+  frame.start = _frameStart;
+  frame.end   = _now();
+  for (auto& buffer : _threadBuffers) {
+    const auto head = buffer->head.load(std::memory_order_acquire);
+    const auto tail = buffer->tail.load(std::memory_order_relaxed);
+    for (auto index = tail; index < head; ++index) {
+      frame.events.emplace_back(buffer->events[index % ThreadBufferCapacity]);
+    }
+    buffer->tail.store(head, std::memory_order_release);
+    frame.droppedEventCount
+      += buffer->droppedEventCount.exchange(0, std::memory_order_relaxed);
+  }
+  _frameStart = frame.end;
+
+  // Enclosing scopes first
+  std::sort(frame.events.begin(), frame.events.end(),
+            [](const ProfileEvent& a, const ProfileEvent& b) {
+              return a.start < b.start
+                     || (a.start == b.start && a.depth < b.depth);
+            });
+  frame.summaries = Summarize(frame.events, _names);
+
+  _frames.emplace_back(std::move(frame));
+  while (_frames.size() > std::max(maxFrameCount, size_t{1})) {
+    _frames.pop_front();
+  }
+  return _frames.back();
+}
+
+const std::deque<ProfileFrame>& Profiler::frames() const
+{
+  return _frames;
+}
+
+std::vector<std::string> Profiler::names() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _names;
+}
+
+void Profiler::clearFrames()
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  _frames.clear();
+}
+
+std::vector<ProfileSummary>
+Profiler::Summarize(const std::vector<ProfileEvent>& events,
+                    const std::vector<std::string>& names)
+{
+  // Time spent in the direct children of each event
+  std::vector<uint64_t> childTimes(events.size(), 0);
+  std::unordered_map<uint32_t, std::vector<size_t>> openEvents;
+  for (size_t index = 0; index < events.size(); ++index) {
+    const auto& event = events[index];
+    auto& ancestors   = openEvents[event.threadId];
+    while (!ancestors.empty()) {
+      const auto& ancestor = events[ancestors.back()];
+      if (ancestor.depth < event.depth
+          && event.start < ancestor.start + ancestor.duration) {
+        break;
+      }
+      ancestors.pop_back();
+    }
+    if (!ancestors.empty()
+        && events[ancestors.back()].depth + 1 == event.depth) {
+      childTimes[ancestors.back()] += event.duration;
+    }
+    ancestors.emplace_back(index);
+  }
+
+  std::vector<ProfileSummary> summaries;
+  std::unordered_map<uint32_t, size_t> summaryIndices;
+  for (size_t index = 0; index < events.size(); ++index) {
+    const auto& event = events[index];
+    auto [it, inserted]
+      = summaryIndices.try_emplace(event.nameId, summaries.size());
+    if (inserted) {
+      summaries.emplace_back();
+      summaries.back().name
+        = event.nameId < names.size() ? names[event.nameId] : "";
+    }
+    auto& summary = summaries[it->second];
+    ++summary.count;
+    summary.totalTime += event.duration;
+    summary.selfTime
+      += event.duration - std::min(event.duration, childTimes[index]);
+  }
+
+  std::stable_sort(summaries.begin(), summaries.end(),
+                   [](const ProfileSummary& a, const ProfileSummary& b) {
+                     return a.totalTime > b.totalTime;
+                   });
+  return summaries;
+}
+
+void Profiler::exportChromeTrace(std::ostream& stream) const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  // Complete events, the times being in microseconds
+  stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  auto first = true;
+  for (const auto& frame : _frames) {
+    for (const auto& event : frame.events) {
+      stream << (first ? "" : ",") << "\n{\"name\":"
+             << nlohmann::json(_names[event.nameId]).dump()
+             << ",\"cat\":\"babylon\",\"ph\":\"X\",\"pid\":0,\"tid\":"
+             << event.threadId << ",\"ts\":" << event.start / 1000 << "."
+             << event.start % 1000 / 100 << event.start % 100 / 10
+             << event.start % 10 << ",\"dur\":" << event.duration / 1000
+             << "." << event.duration % 1000 / 100
+             << event.duration % 100 / 10 << event.duration % 10
+             << ",\"args\":{\"frame\":" << frame.id << "}}";
+      first = false;
+    }
+  }
+  stream << "\n]}\n";
+}
+
+void Profiler::exportBinary(std::ostream& stream) const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  stream.write(BINARY_PROFILE_MAGIC, sizeof(BINARY_PROFILE_MAGIC));
+  WriteVarint(stream, BINARY_PROFILE_VERSION);
+
+  WriteVarint(stream, _names.size());
+  for (const auto& name : _names) {
+    WriteVarint(stream, name.size());
+    stream.write(name.data(), static_cast<std::streamsize>(name.size()));
+  }
+
+  WriteVarint(stream, _frames.size());
+  for (const auto& frame : _frames) {
+    WriteVarint(stream, frame.id);
+    WriteVarint(stream, frame.start);
+    WriteVarint(stream, frame.end - frame.start);
+    WriteVarint(stream, frame.droppedEventCount);
+    WriteVarint(stream, frame.events.size());
+    // The events are sorted: their start times are stored as differences,
+    // starting from the start of the frame. The scopes opened before the
+    // frame start give a negative first difference
+    auto previousStart = frame.start;
+    for (const auto& event : frame.events) {
+      WriteVarint(stream, event.nameId);
+      WriteVarint(stream, event.threadId);
+      WriteVarint(stream, event.depth);
+      WriteSignedVarint(stream,
+                        static_cast<int64_t>(event.start - previousStart));
+      WriteVarint(stream, event.duration);
+      previousStart = event.start;
+    }
+  }
+}
+
+std::vector<ProfileFrame>
+Profiler::ImportBinary(std::istream& stream, std::vector<std::string>& names)
+{
+  names.clear();
+
+  char magic[sizeof(BINARY_PROFILE_MAGIC)];
+  uint64_t version = 0;
+  if (!stream.read(magic, sizeof(magic))
+      || !std::equal(std::begin(magic), std::end(magic),
+                     std::begin(BINARY_PROFILE_MAGIC))
+      || !ReadVarint(stream, version) || version != BINARY_PROFILE_VERSION) {
+    return {};
+  }
+
+  uint64_t nameCount = 0;
+  if (!ReadVarint(stream, nameCount)) {
+    return {};
+  }
+  for (uint64_t i = 0; i < nameCount; ++i) {
+    uint64_t size = 0;
+    if (!ReadVarint(stream, size)) {
+      return {};
+    }
+    std::string name(size, '\0');
+    if (!stream.read(name.data(), static_cast<std::streamsize>(size))) {
+      return {};
+    }
+    names.emplace_back(std::move(name));
+  }
+
+  std::vector<ProfileFrame> frames;
+  uint64_t frameCount = 0;
+  if (!ReadVarint(stream, frameCount)) {
+    return {};
+  }
+  for (uint64_t i = 0; i < frameCount; ++i) {
+    ProfileFrame frame;
+    uint64_t id = 0, duration = 0, droppedEventCount = 0, eventCount = 0;
+    if (!ReadVarint(stream, id) || !ReadVarint(stream, frame.start)
+        || !ReadVarint(stream, duration)
+        || !ReadVarint(stream, droppedEventCount)
+        || !ReadVarint(stream, eventCount)) {
+      return {};
+    }
+    frame.id                = static_cast<size_t>(id);
+    frame.end               = frame.start + duration;
+    frame.droppedEventCount = static_cast<size_t>(droppedEventCount);
+
+    auto previousStart = frame.start;
+    for (uint64_t j = 0; j < eventCount; ++j) {
+      uint64_t nameId = 0, threadId = 0, depth = 0;
+      int64_t startDelta = 0;
+      ProfileEvent event;
+      if (!ReadVarint(stream, nameId) || !ReadVarint(stream, threadId)
+          || !ReadVarint(stream, depth) || !ReadSignedVarint(stream, startDelta)
+          || !ReadVarint(stream, event.duration)) {
+        return {};
+      }
+      event.nameId   = static_cast<uint32_t>(nameId);
+      event.threadId = static_cast<uint32_t>(threadId);
+      event.depth    = static_cast<uint32_t>(depth);
+      event.start    = previousStart + static_cast<uint64_t>(startDelta);
+      previousStart  = event.start;
+      frame.events.emplace_back(event);
+    }
+    frame.summaries = Summarize(frame.events, names);
+    frames.emplace_back(std::move(frame));
+  }
+
+  return frames;
+}
+
+} // end of namespace BABYLON
@@ -35,6 +35,7 @@
 #include <babylon/loading/progress_event.h>
 #include <babylon/math/color4.h>
 #include <babylon/math/vector3.h>
+#include <babylon/misc/profiler.h>
 #include <babylon/utils/base64.h>
 
 namespace BABYLON {
@@ -626,4 +627,24 @@ void Tools::DumpFramebuffer(int /*width*/, int /*height*/, Engine* /*engine*/)
 {
 }
 
+void Tools::StartPerformanceCounter(const std::string& counterName,
+                                    bool condition)
+{
+  if (!condition) {
+    return;
+  }
+
+  Profiler::Default().begin(counterName);
+}
+
+void Tools::EndPerformanceCounter(const std::string& counterName,
+                                  bool condition)
+{
+  if (!condition) {
+    return;
+  }
+
+  Profiler::Default().end(counterName);
+}
+
 } // end of namespace BABYLON
@@ -1135,7 +1135,7 @@ void GPUParticleSystem::_createColorGradientTexture()
   }
 
   Uint8Array data(_rawTextureWidth * 4);
-  auto& tmpColor = Tmp::Color4Array[0];
+  auto& tmpColor = Tmp::Color4Array()[0];
 
   for (unsigned int x = 0; x < _rawTextureWidth; ++x) {
     auto ratio = static_cast<float>(x) / static_cast<float>(_rawTextureWidth);
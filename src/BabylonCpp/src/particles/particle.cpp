@@ -253,9 +253,9 @@ void Particle::_inheritParticleInfoToSubEmitter(const SubEmitterPtr& subEmitter)
       = std::get<AbstractMeshPtr>(subEmitter->particleSystem->emitter);
     emitterMesh->position().copyFrom(position);
     if (subEmitter->inheritDirection) {
-      emitterMesh->position().subtractToRef(direction, Tmp::Vector3Array[0]);
+      emitterMesh->position().subtractToRef(direction, Tmp::Vector3Array()[0]);
       // Look at using Y as forward
-      emitterMesh->lookAt(Tmp::Vector3Array[0], 0.f, Math::PI_2);
+      emitterMesh->lookAt(Tmp::Vector3Array()[0], 0.f, Math::PI_2);
     }
   }
   else if (std::holds_alternative<Vector3>(
@@ -266,9 +266,9 @@ void Particle::_inheritParticleInfoToSubEmitter(const SubEmitterPtr& subEmitter)
   }
   // Set inheritedVelocityOffset to be used when new particles are created
   direction.scaleToRef(subEmitter->inheritedVelocityAmount / 2.f,
-                       Tmp::Vector3Array[0]);
+                       Tmp::Vector3Array()[0]);
   subEmitter->particleSystem->_inheritedVelocityOffset.copyFrom(
-    Tmp::Vector3Array[0]);
+    Tmp::Vector3Array()[0]);
 }
 
 void Particle::_inheritParticleInfoToSubEmitters()
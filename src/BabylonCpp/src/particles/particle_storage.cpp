@@ -0,0 +1,191 @@
+#include <babylon/particles/particle_storage.h>
+
+#include <algorithm>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/particles/particle.h>
+
+namespace BABYLON {
+
+ParticleStorage::ParticleStorage() : _capacity{0}, _size{0}
+{
+}
+
+ParticleStorage::~ParticleStorage() = default;
+
+void ParticleStorage::reserve(size_t capacity)
+{
+  if (capacity == _capacity) {
+    return;
+  }
+
+  // The attribute arrays are strided by the capacity
+  Float32Array components(ComponentCount * capacity);
+  _size = std::min(_size, capacity);
+  for (size_t k = 0; k < ComponentCount; ++k) {
+    std::copy_n(_components.begin() + k * _capacity, _size,
+                components.begin() + k * capacity);
+  }
+  _components = std::move(components);
+  _hasInitialDirection.resize(capacity);
+  _capacity = capacity;
+}
+
+size_t ParticleStorage::capacity() const
+{
+  return _capacity;
+}
+
+size_t ParticleStorage::size() const
+{
+  return _size;
+}
+
+bool ParticleStorage::empty() const
+{
+  return _size == 0;
+}
+
+void ParticleStorage::clear()
+{
+  _size = 0;
+}
+
+void ParticleStorage::add(const Particle& particle)
+{
+  if (_size == _capacity) {
+    return;
+  }
+
+  const auto index = _size++;
+  const auto set   = [this, index](size_t k, float value) {
+    _components[k * _capacity + index] = value;
+  };
+  set(MathKernels::ParticlePositionX, particle.position.x);
+  set(MathKernels::ParticlePositionY, particle.position.y);
+  set(MathKernels::ParticlePositionZ, particle.position.z);
+  set(MathKernels::ParticleDirectionX, particle.direction.x);
+  set(MathKernels::ParticleDirectionY, particle.direction.y);
+  set(MathKernels::ParticleDirectionZ, particle.direction.z);
+  set(MathKernels::ParticleColorR, particle.color.r);
+  set(MathKernels::ParticleColorG, particle.color.g);
+  set(MathKernels::ParticleColorB, particle.color.b);
+  set(MathKernels::ParticleColorA, particle.color.a);
+  set(MathKernels::ParticleColorStepR, particle.colorStep.r);
+  set(MathKernels::ParticleColorStepG, particle.colorStep.g);
+  set(MathKernels::ParticleColorStepB, particle.colorStep.b);
+  set(MathKernels::ParticleColorStepA, particle.colorStep.a);
+  set(MathKernels::ParticleAge, particle.age);
+  set(MathKernels::ParticleLifeTime, particle.lifeTime);
+  set(MathKernels::ParticleAngle, particle.angle);
+  set(MathKernels::ParticleAngularSpeed, particle.angularSpeed);
+  set(Size, particle.size);
+  set(ScaleX, particle.scale.x);
+  set(ScaleY, particle.scale.y);
+  const auto& initialDirection
+    = particle._initialDirection.value_or(particle.direction);
+  set(InitialDirectionX, initialDirection.x);
+  set(InitialDirectionY, initialDirection.y);
+  set(InitialDirectionZ, initialDirection.z);
+  _hasInitialDirection[index] = particle._initialDirection.has_value();
+}
+
+void ParticleStorage::get(size_t index, Particle& particle) const
+{
+  const auto at = [this, index](size_t k) {
+    return _components[k * _capacity + index];
+  };
+  particle.position.copyFromFloats(at(MathKernels::ParticlePositionX),
+                                   at(MathKernels::ParticlePositionY),
+                                   at(MathKernels::ParticlePositionZ));
+  particle.direction.copyFromFloats(at(MathKernels::ParticleDirectionX),
+                                    at(MathKernels::ParticleDirectionY),
+                                    at(MathKernels::ParticleDirectionZ));
+  particle.color.set(at(MathKernels::ParticleColorR),
+                     at(MathKernels::ParticleColorG),
+                     at(MathKernels::ParticleColorB),
+                     at(MathKernels::ParticleColorA));
+  particle.colorStep.set(at(MathKernels::ParticleColorStepR),
+                         at(MathKernels::ParticleColorStepG),
+                         at(MathKernels::ParticleColorStepB),
+                         at(MathKernels::ParticleColorStepA));
+  particle.age          = at(MathKernels::ParticleAge);
+  particle.lifeTime     = at(MathKernels::ParticleLifeTime);
+  particle.angle        = at(MathKernels::ParticleAngle);
+  particle.angularSpeed = at(MathKernels::ParticleAngularSpeed);
+  particle.size         = at(Size);
+  particle.scale.copyFromFloats(at(ScaleX), at(ScaleY));
+  if (_hasInitialDirection[index]) {
+    particle._initialDirection = Vector3(
+      at(InitialDirectionX), at(InitialDirectionY), at(InitialDirectionZ));
+  }
+  else {
+    particle._initialDirection = std::nullopt;
+  }
+}
+
+void ParticleStorage::remove(size_t index)
+{
+  const auto last = --_size;
+  if (index == last) {
+    return;
+  }
+
+  for (size_t k = 0; k < ComponentCount; ++k) {
+    _components[k * _capacity + index] = _components[k * _capacity + last];
+  }
+  _hasInitialDirection[index] = _hasInitialDirection[last];
+}
+
+float* ParticleStorage::component(size_t component)
+{
+  return _components.data() + component * _capacity;
+}
+
+const float* ParticleStorage::component(size_t component) const
+{
+  return _components.data() + component * _capacity;
+}
+
+bool ParticleStorage::hasInitialDirection(size_t index) const
+{
+  return _hasInitialDirection[index] != 0;
+}
+
+size_t ParticleStorage::update(float updateSpeed, const Vector3& gravity)
+{
+  if (_size == 0) {
+    return 0;
+  }
+
+  const float gravityComponents[3] = {gravity.x, gravity.y, gravity.z};
+  const auto& kernels              = MathKernels::Get();
+  const auto updateRange = [&](size_t begin, size_t end) {
+    kernels.updateParticles(_components.data() + begin, _capacity, updateSpeed,
+                            gravityComponents, end - begin);
+  };
+  if (_size < ParallelUpdateThreshold) {
+    updateRange(0, _size);
+  }
+  else {
+    ThreadPool::Default().parallelFor(_size, ParallelUpdateThreshold / 4,
+                                      updateRange);
+  }
+
+  // Recycles by swapping with the last particle, which is already updated
+  const auto* ages      = component(MathKernels::ParticleAge);
+  const auto* lifeTimes = component(MathKernels::ParticleLifeTime);
+  const auto size       = _size;
+  for (size_t index = 0; index < _size;) {
+    if (ages[index] >= lifeTimes[index]) {
+      remove(index);
+    }
+    else {
+      ++index;
+    }
+  }
+
+  return size - _size;
+}
+
+} // end of namespace BABYLON
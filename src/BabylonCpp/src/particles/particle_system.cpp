@@ -6,6 +6,7 @@
 #include <babylon/core/json_util.h>
 #include <babylon/core/random.h>
 #include <babylon/core/string.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
 #include <babylon/materials/effect.h>
@@ -32,6 +33,7 @@
 #include <babylon/particles/emittertypes/sphere_directed_particle_emitter.h>
 #include <babylon/particles/emittertypes/sphere_particle_emitter.h>
 #include <babylon/particles/particle.h>
+#include <babylon/particles/particle_storage.h>
 #include <babylon/particles/sub_emitter.h>
 
 namespace BABYLON {
@@ -40,6 +42,7 @@ ParticleSystem::ParticleSystem(const std::string& iName, size_t capacity,
                                Scene* scene, const EffectPtr& customEffect,
                                bool iIsAnimationSheetEnabled, float epsilon)
     : BaseParticleSystem{iName}
+    , useParticleStorage{false}
     , onDispose{this, &ParticleSystem::set_onDispose}
     , _currentEmitRateGradient{std::nullopt}
     , _currentEmitRate1{0.f}
@@ -244,8 +247,8 @@ ParticleSystem::ParticleSystem(const std::string& iName, size_t capacity,
           static_cast<float>(noiseTextureSize->width),
           static_cast<float>(noiseTextureSize->height), *noiseTextureData);
 
-        auto& force       = Tmp::Vector3Array[0];
-        auto& scaledForce = Tmp::Vector3Array[1];
+        auto& force       = Tmp::Vector3Array()[0];
+        auto& scaledForce = Tmp::Vector3Array()[1];
 
         force.copyFromFloats((2.f * fetchedColorR - 1.f) * noiseStrength.x,
                              (2.f * fetchedColorG - 1.f) * noiseStrength.y,
@@ -332,6 +335,7 @@ ParticleSystem::ParticleSystem(const std::string& iName, size_t capacity,
       }
     }
   };
+  _defaultUpdateFunctionType = &updateFunction.target_type();
 }
 
 ParticleSystem::~ParticleSystem()
@@ -576,7 +580,7 @@ void ParticleSystem::_createRampGradientTexture()
   }
 
   Uint8Array data(static_cast<size_t>(_rawTextureWidth) * 4);
-  auto tmpColor = Tmp::Color3Array[0];
+  auto tmpColor = Tmp::Color3Array()[0];
 
   for (size_t x = 0; x < static_cast<size_t>(_rawTextureWidth); ++x) {
     auto ratio = static_cast<float>(x) / static_cast<float>(_rawTextureWidth);
@@ -829,6 +833,11 @@ size_t ParticleSystem::getCapacity() const
   return _capacity;
 }
 
+size_t ParticleSystem::getActiveCount() const
+{
+  return _activeParticleCount();
+}
+
 bool ParticleSystem::isAlive() const
 {
   return _alive;
@@ -912,6 +921,9 @@ void ParticleSystem::reset()
 {
   _stockParticles.clear();
   _particles.clear();
+  if (_particleStorage) {
+    _particleStorage->clear();
+  }
 }
 
 void ParticleSystem::_appendParticleVertex(unsigned int index,
@@ -1061,8 +1073,11 @@ void ParticleSystem::_emitFromParticle(Particle* /*particle*/)
 
 void ParticleSystem::_update(int newParticles)
 {
+  const auto storageActive = _canUseParticleStorage();
+  _syncParticleStorage(storageActive);
+
   // Update current
-  _alive = !_particles.empty();
+  _alive = _activeParticleCount() > 0;
 
   if (std::holds_alternative<AbstractMeshPtr>(emitter)) {
     auto emitterMesh    = std::get<AbstractMeshPtr>(emitter);
@@ -1074,6 +1089,23 @@ void ParticleSystem::_update(int newParticles)
       emitterPosition.x, emitterPosition.y, emitterPosition.z);
   }
 
+  if (storageActive) {
+    _particleStorage->update(static_cast<float>(_scaledUpdateSpeed), gravity);
+
+    // Add new ones, initialized like the other particles then copied into the
+    // storage
+    for (int index = 0; index < newParticles; ++index) {
+      if (_particleStorage->size() == _capacity) {
+        break;
+      }
+
+      _emittedParticle->_reset();
+      _initializeParticle(_emittedParticle.get());
+      _particleStorage->add(*_emittedParticle);
+    }
+    return;
+  }
+
   updateFunction(_particles);
 
   // Add new ones
@@ -1087,224 +1119,271 @@ void ParticleSystem::_update(int newParticles)
 
     _particles.emplace_back(particle);
 
-    // Emitter
-    auto emitPower = Scalar::RandomRange(minEmitPower, maxEmitPower);
+    _initializeParticle(particle);
+  }
+}
+
+void ParticleSystem::_initializeParticle(Particle* particle)
+{
+  // Emitter
+  auto emitPower = Scalar::RandomRange(minEmitPower, maxEmitPower);
+
+  if (startPositionFunction) {
+    startPositionFunction(_emitterWorldMatrix, particle->position, particle);
+  }
+  else {
+    particleEmitterType->startPositionFunction(_emitterWorldMatrix,
+                                               particle->position, particle);
+  }
+
+  if (startDirectionFunction) {
+    startDirectionFunction(_emitterWorldMatrix, particle->direction,
+                           particle);
+  }
+  else {
+    particleEmitterType->startDirectionFunction(
+      _emitterWorldMatrix, particle->direction, particle);
+  }
 
-    if (startPositionFunction) {
-      startPositionFunction(_emitterWorldMatrix, particle->position, particle);
+  if (emitPower == 0.f) {
+    if (!particle->_initialDirection) {
+      particle->_initialDirection = particle->direction;
     }
     else {
-      particleEmitterType->startPositionFunction(_emitterWorldMatrix,
-                                                 particle->position, particle);
+      particle->_initialDirection = particle->direction;
     }
+  }
+  else {
+    particle->_initialDirection = std::nullopt;
+  }
+
+  particle->direction.scaleInPlace(emitPower);
+
+  // Life time
+  if (targetStopDuration && !_lifeTimeGradients.empty()) {
+    auto ratio
+      = static_cast<float>(Scalar::Clamp(_actualFrame / targetStopDuration));
+    Tools::GetCurrentGradient<FactorGradient>(
+      ratio, _lifeTimeGradients,
+      [&](FactorGradient& currentGradient, FactorGradient& nextGradient,
+          float /*scale*/) {
+        auto& factorGradient1 = currentGradient;
+        auto& factorGradient2 = nextGradient;
+        auto lifeTime1        = factorGradient1.getFactor();
+        auto lifeTime2        = factorGradient2.getFactor();
+        auto gradient
+          = (ratio - factorGradient1.gradient)
+            / (factorGradient2.gradient - factorGradient1.gradient);
+        particle->lifeTime = Scalar::Lerp(lifeTime1, lifeTime2, gradient);
+      });
+  }
+  else {
+    particle->lifeTime = Scalar::RandomRange(minLifeTime, maxLifeTime);
+  }
 
-    if (startDirectionFunction) {
-      startDirectionFunction(_emitterWorldMatrix, particle->direction,
-                             particle);
+  // Size
+  if (_sizeGradients.empty()) {
+    particle->size = Scalar::RandomRange(minSize, maxSize);
+  }
+  else {
+    particle->_currentSizeGradient = _sizeGradients[0];
+    particle->_currentSize1 = (*particle->_currentSizeGradient).getFactor();
+    particle->size          = particle->_currentSize1;
+
+    if (_sizeGradients.size() > 1) {
+      particle->_currentSize2 = _sizeGradients[1].getFactor();
     }
     else {
-      particleEmitterType->startDirectionFunction(
-        _emitterWorldMatrix, particle->direction, particle);
+      particle->_currentSize2 = particle->_currentSize1;
     }
+  }
+  // Size and scale
+  particle->scale.copyFromFloats(Scalar::RandomRange(minScaleX, maxScaleX),
+                                 Scalar::RandomRange(minScaleY, maxScaleY));
+
+  // Adjust scale by start size
+  if (!_startSizeGradients.empty() && targetStopDuration) {
+    auto ratio = static_cast<float>(_actualFrame)
+                 / static_cast<float>(targetStopDuration);
+    Tools::GetCurrentGradient<FactorGradient>(
+      ratio, _startSizeGradients,
+      [&](FactorGradient& currentGradient, FactorGradient& nextGradient,
+          float scale) {
+        if (currentGradient != _currentStartSizeGradient) {
+          _currentStartSize1        = _currentStartSize2;
+          _currentStartSize2        = nextGradient.getFactor();
+          _currentStartSizeGradient = currentGradient;
+        }
 
-    if (emitPower == 0.f) {
-      if (!particle->_initialDirection) {
-        particle->_initialDirection = particle->direction;
-      }
-      else {
-        particle->_initialDirection = particle->direction;
-      }
+        auto value
+          = Scalar::Lerp(_currentStartSize1, _currentStartSize2, scale);
+        particle->scale.scaleInPlace(value);
+      });
+  }
+
+  // Angle
+  if (_angularSpeedGradients.empty()) {
+    particle->angularSpeed
+      = Scalar::RandomRange(minAngularSpeed, maxAngularSpeed);
+  }
+  else {
+    particle->_currentAngularSpeedGradient = _angularSpeedGradients[0];
+    particle->angularSpeed
+      = (*particle->_currentAngularSpeedGradient).getFactor();
+    particle->_currentAngularSpeed1 = particle->angularSpeed;
+
+    if (_angularSpeedGradients.size() > 1) {
+      particle->_currentAngularSpeed2 = _angularSpeedGradients[1].getFactor();
     }
     else {
-      particle->_initialDirection = std::nullopt;
+      particle->_currentAngularSpeed2 = particle->_currentAngularSpeed1;
     }
+  }
+  particle->angle
+    = Scalar::RandomRange(minInitialRotation, maxInitialRotation);
 
-    particle->direction.scaleInPlace(emitPower);
+  // Velocity
+  if (!_velocityGradients.empty()) {
+    particle->_currentVelocityGradient = _velocityGradients[0];
+    particle->_currentVelocity1
+      = (*particle->_currentVelocityGradient).getFactor();
 
-    // Life time
-    if (targetStopDuration && !_lifeTimeGradients.empty()) {
-      auto ratio
-        = static_cast<float>(Scalar::Clamp(_actualFrame / targetStopDuration));
-      Tools::GetCurrentGradient<FactorGradient>(
-        ratio, _lifeTimeGradients,
-        [&](FactorGradient& currentGradient, FactorGradient& nextGradient,
-            float /*scale*/) {
-          auto& factorGradient1 = currentGradient;
-          auto& factorGradient2 = nextGradient;
-          auto lifeTime1        = factorGradient1.getFactor();
-          auto lifeTime2        = factorGradient2.getFactor();
-          auto gradient
-            = (ratio - factorGradient1.gradient)
-              / (factorGradient2.gradient - factorGradient1.gradient);
-          particle->lifeTime = Scalar::Lerp(lifeTime1, lifeTime2, gradient);
-        });
+    if (_velocityGradients.size() > 1) {
+      particle->_currentVelocity2 = _velocityGradients[1].getFactor();
     }
     else {
-      particle->lifeTime = Scalar::RandomRange(minLifeTime, maxLifeTime);
+      particle->_currentVelocity2 = particle->_currentVelocity1;
     }
+  }
+
+  // Limit velocity
+  if (!_limitVelocityGradients.empty()) {
+    particle->_currentLimitVelocityGradient = _limitVelocityGradients[0];
+    particle->_currentLimitVelocity1
+      = particle->_currentLimitVelocityGradient->getFactor();
 
-    // Size
-    if (!_sizeGradients.empty()) {
-      particle->size = Scalar::RandomRange(minSize, maxSize);
+    if (_limitVelocityGradients.size() > 1) {
+      particle->_currentLimitVelocity2
+        = _limitVelocityGradients[1].getFactor();
     }
     else {
-      particle->_currentSizeGradient = _sizeGradients[0];
-      particle->_currentSize1 = (*particle->_currentSizeGradient).getFactor();
-      particle->size          = particle->_currentSize1;
-
-      if (_sizeGradients.size() > 1) {
-        particle->_currentSize2 = _sizeGradients[1].getFactor();
-      }
-      else {
-        particle->_currentSize2 = particle->_currentSize1;
-      }
+      particle->_currentLimitVelocity2 = particle->_currentLimitVelocity1;
     }
-    // Size and scale
-    particle->scale.copyFromFloats(Scalar::RandomRange(minScaleX, maxScaleX),
-                                   Scalar::RandomRange(minScaleY, maxScaleY));
-
-    // Adjust scale by start size
-    if (!_startSizeGradients.empty() && targetStopDuration) {
-      auto ratio = static_cast<float>(_actualFrame)
-                   / static_cast<float>(targetStopDuration);
-      Tools::GetCurrentGradient<FactorGradient>(
-        ratio, _startSizeGradients,
-        [&](FactorGradient& currentGradient, FactorGradient& nextGradient,
-            float scale) {
-          if (currentGradient != _currentStartSizeGradient) {
-            _currentStartSize1        = _currentStartSize2;
-            _currentStartSize2        = nextGradient.getFactor();
-            _currentStartSizeGradient = currentGradient;
-          }
+  }
 
-          auto value
-            = Scalar::Lerp(_currentStartSize1, _currentStartSize2, scale);
-          particle->scale.scaleInPlace(value);
-        });
-    }
+  // Drag
+  if (!_dragGradients.empty()) {
+    particle->_currentDragGradient = _dragGradients[0];
+    particle->_currentDrag1 = particle->_currentDragGradient->getFactor();
 
-    // Angle
-    if (!_angularSpeedGradients.empty()) {
-      particle->angularSpeed
-        = Scalar::RandomRange(minAngularSpeed, maxAngularSpeed);
+    if (_dragGradients.size() > 1) {
+      particle->_currentDrag2 = _dragGradients[1].getFactor();
     }
     else {
-      particle->_currentAngularSpeedGradient = _angularSpeedGradients[0];
-      particle->angularSpeed
-        = (*particle->_currentAngularSpeedGradient).getFactor();
-      particle->_currentAngularSpeed1 = particle->angularSpeed;
-
-      if (_angularSpeedGradients.size() > 1) {
-        particle->_currentAngularSpeed2 = _angularSpeedGradients[1].getFactor();
-      }
-      else {
-        particle->_currentAngularSpeed2 = particle->_currentAngularSpeed1;
-      }
+      particle->_currentDrag2 = particle->_currentDrag1;
     }
-    particle->angle
-      = Scalar::RandomRange(minInitialRotation, maxInitialRotation);
+  }
 
-    // Velocity
-    if (!_velocityGradients.empty()) {
-      particle->_currentVelocityGradient = _velocityGradients[0];
-      particle->_currentVelocity1
-        = (*particle->_currentVelocityGradient).getFactor();
+  // Color
+  if (_colorGradients.empty()) {
+    auto step = Scalar::RandomRange(0.f, 1.f);
 
-      if (_velocityGradients.size() > 1) {
-        particle->_currentVelocity2 = _velocityGradients[1].getFactor();
-      }
-      else {
-        particle->_currentVelocity2 = particle->_currentVelocity1;
-      }
-    }
+    Color4::LerpToRef(color1, color2, step, particle->color);
 
-    // Limit velocity
-    if (!_limitVelocityGradients.empty()) {
-      particle->_currentLimitVelocityGradient = _limitVelocityGradients[0];
-      particle->_currentLimitVelocity1
-        = particle->_currentLimitVelocityGradient->getFactor();
+    colorDead.subtractToRef(particle->color, _colorDiff);
+    _colorDiff.scaleToRef(1.f / particle->lifeTime, particle->colorStep);
+  }
+  else {
+    auto currentColorGradient = _colorGradients[0];
+    currentColorGradient.getColorToRef(particle->color);
+    particle->_currentColorGradient = currentColorGradient;
+    particle->_currentColor1.copyFrom(particle->color);
 
-      if (_limitVelocityGradients.size() > 1) {
-        particle->_currentLimitVelocity2
-          = _limitVelocityGradients[1].getFactor();
-      }
-      else {
-        particle->_currentLimitVelocity2 = particle->_currentLimitVelocity1;
-      }
+    if (_colorGradients.size() > 1) {
+      _colorGradients[1].getColorToRef(particle->_currentColor2);
     }
-
-    // Drag
-    if (_dragGradients.empty()) {
-      particle->_currentDragGradient = _dragGradients[0];
-      particle->_currentDrag1 = particle->_currentDragGradient->getFactor();
-
-      if (_dragGradients.size() > 1) {
-        particle->_currentDrag2 = _dragGradients[1].getFactor();
-      }
-      else {
-        particle->_currentDrag2 = particle->_currentDrag1;
-      }
+    else {
+      particle->_currentColor2.copyFrom(particle->color);
     }
+  }
 
-    // Color
-    if (_colorGradients.empty()) {
-      auto step = Scalar::RandomRange(0.f, 1.f);
+  // Sheet
+  if (_isAnimationSheetEnabled) {
+    particle->_initialStartSpriteCellID = startSpriteCellID;
+    particle->_initialEndSpriteCellID   = endSpriteCellID;
+  }
 
-      Color4::LerpToRef(color1, color2, step, particle->color);
+  // Inherited Velocity
+  particle->direction.addInPlace(_inheritedVelocityOffset);
 
-      colorDead.subtractToRef(particle->color, _colorDiff);
-      _colorDiff.scaleToRef(1.f / particle->lifeTime, particle->colorStep);
+  // Ramp
+  if (_useRampGradients) {
+    particle->remapData = Vector4(0.f, 1.f, 0.f, 1.f);
+  }
+
+  // Noise texture coordinates
+  if (noiseTexture()) {
+    if (particle->_randomNoiseCoordinates1.has_value()) {
+      particle->_randomNoiseCoordinates1->copyFromFloats(
+        Math::random(), Math::random(), Math::random());
+      particle->_randomNoiseCoordinates2.copyFromFloats(
+        Math::random(), Math::random(), Math::random());
     }
     else {
-      auto currentColorGradient = _colorGradients[0];
-      currentColorGradient.getColorToRef(particle->color);
-      particle->_currentColorGradient = currentColorGradient;
-      particle->_currentColor1.copyFrom(particle->color);
-
-      if (_colorGradients.size() > 1) {
-        _colorGradients[1].getColorToRef(particle->_currentColor2);
-      }
-      else {
-        particle->_currentColor2.copyFrom(particle->color);
-      }
+      particle->_randomNoiseCoordinates1
+        = Vector3(Math::random(), Math::random(), Math::random());
+      particle->_randomNoiseCoordinates2
+        = Vector3(Math::random(), Math::random(), Math::random());
     }
+  }
 
-    // Sheet
-    if (_isAnimationSheetEnabled) {
-      particle->_initialStartSpriteCellID = startSpriteCellID;
-      particle->_initialEndSpriteCellID   = endSpriteCellID;
-    }
+  // Update the position of the attached sub-emitters to match their attached
+  // particle
+  particle->_inheritParticleInfoToSubEmitters();
+}
 
-    // Inherited Velocity
-    particle->direction.addInPlace(_inheritedVelocityOffset);
+bool ParticleSystem::_canUseParticleStorage()
+{
+  // The behaviours evaluated per particle are only run by updateFunction, and
+  // a custom updateFunction replaces the storage kernels
+  return useParticleStorage && updateFunction
+         && updateFunction.target_type() == *_defaultUpdateFunctionType
+         && _colorGradients.empty() && _sizeGradients.empty()
+         && _angularSpeedGradients.empty() && _velocityGradients.empty()
+         && _limitVelocityGradients.empty() && _dragGradients.empty()
+         && !noiseTexture() && subEmitters.empty() && _subEmitters.empty()
+         && !_isAnimationSheetEnabled && !_useRampGradients;
+}
 
-    // Ramp
-    if (_useRampGradients) {
-      particle->remapData = Vector4(0.f, 1.f, 0.f, 1.f);
+void ParticleSystem::_syncParticleStorage(bool storageActive)
+{
+  if (storageActive) {
+    if (!_particleStorage) {
+      _particleStorage = std::make_unique<ParticleStorage>();
+      _particleStorage->reserve(_capacity);
+      _emittedParticle = std::make_unique<Particle>(this);
     }
-
-    // Noise texture coordinates
-    if (noiseTexture()) {
-      if (particle->_randomNoiseCoordinates1.has_value()) {
-        particle->_randomNoiseCoordinates1->copyFromFloats(
-          Math::random(), Math::random(), Math::random());
-        particle->_randomNoiseCoordinates2.copyFromFloats(
-          Math::random(), Math::random(), Math::random());
-      }
-      else {
-        particle->_randomNoiseCoordinates1
-          = Vector3(Math::random(), Math::random(), Math::random());
-        particle->_randomNoiseCoordinates2
-          = Vector3(Math::random(), Math::random(), Math::random());
-      }
+    for (auto& particle : _particles) {
+      _particleStorage->add(*particle);
+      _stockParticles.emplace_back(particle);
     }
-
-    // Update the position of the attached sub-emitters to match their attached
-    // particle
-    particle->_inheritParticleInfoToSubEmitters();
+    _particles.clear();
+  }
+  else if (_particleStorage && !_particleStorage->empty()) {
+    for (size_t index = 0; index < _particleStorage->size(); ++index) {
+      auto particle = _createParticle();
+      _particleStorage->get(index, *particle);
+      _particles.emplace_back(particle);
+    }
+    _particleStorage->clear();
   }
 }
 
+size_t ParticleSystem::_activeParticleCount() const
+{
+  return _particles.size() + (_particleStorage ? _particleStorage->size() : 0);
+}
+
 std::vector<std::string> ParticleSystem::_GetAttributeNamesOrOptions(
   bool iIsAnimationSheetEnabled, bool iIsBillboardBased, bool iUseRampGradients)
 {
@@ -1530,6 +1609,7 @@ void ParticleSystem::animate(bool preWarmOnly)
       _appendParticleVertices(offset, particle);
       offset += _useInstancing ? 1 : 4;
     }
+    _appendStoredParticleVertices();
 
     if (_vertexBuffer) {
       _vertexBuffer->update(_vertexData);
@@ -1541,6 +1621,11 @@ void ParticleSystem::animate(bool preWarmOnly)
   }
 }
 
+const Float32Array& ParticleSystem::_getVertexData() const
+{
+  return _vertexData;
+}
+
 void ParticleSystem::_appendParticleVertices(unsigned int offset,
                                              Particle* particle)
 {
@@ -1552,6 +1637,86 @@ void ParticleSystem::_appendParticleVertices(unsigned int offset,
   }
 }
 
+void ParticleSystem::_appendStoredParticleVertices()
+{
+  if (!_particleStorage || _particleStorage->empty()) {
+    return;
+  }
+
+  // Same layout as _appendParticleVertex, without the cell index and the
+  // remap data which are not used by the stored particles
+  const auto& storage  = *_particleStorage;
+  const auto component = [&storage](size_t k) { return storage.component(k); };
+
+  const auto positionX         = component(MathKernels::ParticlePositionX);
+  const auto positionY         = component(MathKernels::ParticlePositionY);
+  const auto positionZ         = component(MathKernels::ParticlePositionZ);
+  const auto directionX        = component(MathKernels::ParticleDirectionX);
+  const auto directionY        = component(MathKernels::ParticleDirectionY);
+  const auto directionZ        = component(MathKernels::ParticleDirectionZ);
+  const auto initialDirectionX = component(ParticleStorage::InitialDirectionX);
+  const auto initialDirectionY = component(ParticleStorage::InitialDirectionY);
+  const auto initialDirectionZ = component(ParticleStorage::InitialDirectionZ);
+  const auto colorR            = component(MathKernels::ParticleColorR);
+  const auto colorG            = component(MathKernels::ParticleColorG);
+  const auto colorB            = component(MathKernels::ParticleColorB);
+  const auto colorA            = component(MathKernels::ParticleColorA);
+  const auto angle             = component(MathKernels::ParticleAngle);
+  const auto size              = component(ParticleStorage::Size);
+  const auto scaleX            = component(ParticleStorage::ScaleX);
+  const auto scaleY            = component(ParticleStorage::ScaleY);
+
+  const auto vertexCount = _useInstancing ? 1u : 4u;
+  const auto hasDirection
+    = !_isBillboardBased || billboardMode == BILLBOARDMODE_STRETCHED;
+  const float cornerOffsets[4][2]
+    = {{0.f, 0.f}, {1.f, 0.f}, {1.f, 1.f}, {0.f, 1.f}};
+
+  const auto appendRange = [&](size_t begin, size_t end) {
+    for (size_t index = begin; index < end; ++index) {
+      const auto useInitialDirection
+        = !_isBillboardBased && storage.hasInitialDirection(index);
+      for (unsigned int vertex = 0; vertex < vertexCount; ++vertex) {
+        auto offset = (index * vertexCount + vertex) * _vertexBufferSize;
+        _vertexData[offset++] = positionX[index] + worldOffset.x;
+        _vertexData[offset++] = positionY[index] + worldOffset.y;
+        _vertexData[offset++] = positionZ[index] + worldOffset.z;
+        _vertexData[offset++] = colorR[index];
+        _vertexData[offset++] = colorG[index];
+        _vertexData[offset++] = colorB[index];
+        _vertexData[offset++] = colorA[index];
+        _vertexData[offset++] = angle[index];
+        _vertexData[offset++] = scaleX[index] * size[index];
+        _vertexData[offset++] = scaleY[index] * size[index];
+        if (hasDirection) {
+          _vertexData[offset++] = useInitialDirection ?
+                                    initialDirectionX[index] :
+                                    directionX[index];
+          _vertexData[offset++] = useInitialDirection ?
+                                    initialDirectionY[index] :
+                                    directionY[index];
+          _vertexData[offset++] = useInitialDirection ?
+                                    initialDirectionZ[index] :
+                                    directionZ[index];
+        }
+        if (!_useInstancing) {
+          _vertexData[offset++] = cornerOffsets[vertex][0];
+          _vertexData[offset++] = cornerOffsets[vertex][1];
+        }
+      }
+    }
+  };
+
+  if (storage.size() < ParticleStorage::ParallelUpdateThreshold) {
+    appendRange(0, storage.size());
+  }
+  else {
+    ThreadPool::Default().parallelFor(
+      storage.size(), ParticleStorage::ParallelUpdateThreshold / 4,
+      appendRange);
+  }
+}
+
 void ParticleSystem::rebuild()
 {
   _createIndexBuffer();
@@ -1563,10 +1728,10 @@ void ParticleSystem::rebuild()
 
 bool ParticleSystem::isReady()
 {
-  if (!std::holds_alternative<AbstractMeshPtr>(emitter)
-      || !std::holds_alternative<Vector3>(emitter)
-      || !_imageProcessingConfiguration->isReady() || !particleTexture
-      || !particleTexture->isReady()) {
+  if (!hasEmitter()
+      || (_imageProcessingConfiguration
+          && !_imageProcessingConfiguration->isReady())
+      || !particleTexture || !particleTexture->isReady()) {
     return false;
   }
 
@@ -1656,22 +1821,23 @@ size_t ParticleSystem::_render(unsigned int iBlendMode)
       break;
   }
 
+  const auto particleCount = _activeParticleCount();
   if (_useInstancing) {
     engine->drawArraysType(Material::TriangleFanDrawMode, 0, 4,
-                           static_cast<int>(_particles.size()));
+                           static_cast<int>(particleCount));
   }
   else {
     engine->drawElementsType(Material::TriangleFillMode, 0,
-                             static_cast<int>(_particles.size() * 6));
+                             static_cast<int>(particleCount * 6));
   }
 
-  return _particles.size();
+  return particleCount;
 }
 
 size_t ParticleSystem::render(bool /*preWarm*/)
 {
   // Check
-  if (!isReady() || !_particles.empty()) {
+  if (!isReady() || _activeParticleCount() == 0) {
     return 0;
   }
 
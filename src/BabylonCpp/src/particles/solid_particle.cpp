@@ -84,7 +84,7 @@ void SolidParticle::getRotationMatrix(Matrix& m) const
     quaternion = *rotationQuaternion;
   }
   else {
-    quaternion            = Tmp::QuaternionArray[0];
+    quaternion            = Tmp::QuaternionArray()[0];
     const auto& _rotation = rotation;
     Quaternion::RotationYawPitchRollToRef(_rotation.y, _rotation.x, _rotation.z,
                                           quaternion);
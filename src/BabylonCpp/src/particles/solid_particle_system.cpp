@@ -1,9 +1,12 @@
 #include <babylon/particles/solid_particle_system.h>
 
+#include <mutex>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/cameras/target_camera.h>
 #include <babylon/core/random.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/culling/bounding_info.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
@@ -11,6 +14,7 @@
 #include <babylon/math/color4.h>
 #include <babylon/math/tmp.h>
 #include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/geometry.h>
 #include <babylon/meshes/mesh.h>
 #include <babylon/meshes/mesh_builder.h>
 #include <babylon/meshes/vertex_buffer.h>
@@ -46,9 +50,11 @@ SolidParticleSystem::SolidParticleSystem(
     , _computeBoundingBox{false}
     , _depthSortParticles{true}
     , _mustUnrotateFixedNormals{false}
-    , _scale{Tmp::Vector3Array[2]}
-    , _translation{Tmp::Vector3Array[3]}
+    , _scale{Tmp::Vector3Array()[2]}
+    , _translation{Tmp::Vector3Array()[3]}
     , _needs32Bits{false}
+    , _dirtyVertexStart{std::numeric_limits<size_t>::max()}
+    , _dirtyVertexEnd{0}
 {
   name       = iName;
   _scene     = scene ? scene : Engine::LastCreatedScene();
@@ -130,6 +136,7 @@ MeshPtr SolidParticleSystem::buildMesh()
 
   if (!_updatable) {
     particles.clear();
+    _modelShapes.clear();
   }
 
   return _mesh;
@@ -218,8 +225,8 @@ SolidParticleSystem::digest(Mesh* _mesh,
     if (_particlesIntersect) {
       bInfo = BoundingInfo(barycenter, barycenter);
     }
-    auto modelShape = std::make_unique<ModelShape>(
-      _shapeCounter, shape, size * 3, shapeUV, nullptr, nullptr);
+    _modelShapes.emplace_back(std::make_unique<ModelShape>(
+      _shapeCounter, shape, size * 3, shapeUV, nullptr, nullptr));
 
     // add the particle in the SPS
     auto currentPos = static_cast<unsigned int>(_positions.size());
@@ -227,7 +234,7 @@ SolidParticleSystem::digest(Mesh* _mesh,
     _meshBuilder(_index, shape, _positions, facetInd, _indices, facetUV, _uvs,
                  facetCol, _colors, meshNor, _normals, idx, 0,
                  {nullptr, nullptr});
-    _addParticle(idx, currentPos, currentInd, std::move(modelShape),
+    _addParticle(idx, currentPos, currentInd, _modelShapes.back().get(),
                  _shapeCounter, 0, bInfo);
     // initialize the particle position
     particles[nbParticles]->position.addInPlace(barycenter);
@@ -245,9 +252,9 @@ void SolidParticleSystem::_unrotateFixedNormals()
 {
   unsigned int index      = 0;
   unsigned int idx        = 0;
-  auto& tmpNormal         = Tmp::Vector3Array[0];
-  auto& quaternion        = Tmp::QuaternionArray[0];
-  auto& invertedRotMatrix = Tmp::MatrixArray[0];
+  auto& tmpNormal         = Tmp::Vector3Array()[0];
+  auto& quaternion        = Tmp::QuaternionArray()[0];
+  auto& invertedRotMatrix = Tmp::MatrixArray()[0];
   for (const auto& particle : particles) {
     auto& shape = particle->_model->_shape;
 
@@ -308,11 +315,11 @@ SolidParticle* SolidParticleSystem::_meshBuilder(
     _mustUnrotateFixedNormals = true;
   }
 
-  auto& rotMatrix            = Tmp::MatrixArray[0];
-  auto& tmpVertex            = Tmp::Vector3Array[0];
-  auto& tmpRotated           = Tmp::Vector3Array[1];
-  auto& pivotBackTranslation = Tmp::Vector3Array[2];
-  auto& scaledPivot          = Tmp::Vector3Array[3];
+  auto& rotMatrix            = Tmp::MatrixArray()[0];
+  auto& tmpVertex            = Tmp::Vector3Array()[0];
+  auto& tmpRotated           = Tmp::Vector3Array()[1];
+  auto& pivotBackTranslation = Tmp::Vector3Array()[2];
+  auto& scaledPivot          = Tmp::Vector3Array()[3];
   copy.getRotationMatrix(rotMatrix);
 
   copy.pivot.multiplyToRef(copy.scaling, scaledPivot);
@@ -420,12 +427,11 @@ Float32Array SolidParticleSystem::_uvsToShapeUV(const Float32Array& uvs)
 }
 
 SolidParticle* SolidParticleSystem::_addParticle(
-  unsigned int idx, unsigned int idxpos, unsigned int idxind,
-  std::unique_ptr<ModelShape>&& model, int shapeId, unsigned int idxInShape,
-  const BoundingInfo& bInfo)
+  unsigned int idx, unsigned int idxpos, unsigned int idxind, ModelShape* model,
+  int shapeId, unsigned int idxInShape, const BoundingInfo& bInfo)
 {
   particles.emplace_back(std::make_unique<SolidParticle>(
-    idx, idxpos, idxind, model.get(), shapeId, idxInShape, this, bInfo));
+    idx, idxpos, idxind, model, shapeId, idxInShape, this, bInfo));
   return particles.back().get();
 }
 
@@ -450,8 +456,9 @@ int SolidParticleSystem::addShape(
   auto& posfunc = options.positionFunction;
   auto& vtxfunc = options.vertexFunction;
 
-  auto modelShape = std::make_unique<ModelShape>(
-    _shapeCounter, shape, meshInd.size(), shapeUV, posfunc, vtxfunc);
+  _modelShapes.emplace_back(std::make_unique<ModelShape>(
+    _shapeCounter, shape, meshInd.size(), shapeUV, posfunc, vtxfunc));
+  auto modelShape = _modelShapes.back().get();
 
   // particles
   SolidParticle* sp = nullptr;
@@ -463,8 +470,8 @@ int SolidParticleSystem::addShape(
       = _meshBuilder(_index, shape, _positions, meshInd, _indices, meshUV, _uvs,
                      meshCol, _colors, meshNor, _normals, idx, i, options);
     if (_updatable) {
-      sp = _addParticle(idx, currentPos, currentInd, std::move(modelShape),
-                        _shapeCounter, i, *bbInfo);
+      sp = _addParticle(idx, currentPos, currentInd, modelShape, _shapeCounter,
+                        i, *bbInfo);
       sp->position.copyFrom(currentCopy->position);
       sp->rotation.copyFrom(currentCopy->rotation);
       if (currentCopy->rotationQuaternion) {
@@ -496,11 +503,11 @@ void SolidParticleSystem::_rebuildParticle(SolidParticle* particle)
                                         particle->idxInShape);
   }
 
-  auto& rotMatrix            = Tmp::MatrixArray[0];
-  auto& tmpVertex            = Tmp::Vector3Array[0];
-  auto& tmpRotated           = Tmp::Vector3Array[1];
-  auto& pivotBackTranslation = Tmp::Vector3Array[2];
-  auto& scaledPivot          = Tmp::Vector3Array[3];
+  auto& rotMatrix            = Tmp::MatrixArray()[0];
+  auto& tmpVertex            = Tmp::Vector3Array()[0];
+  auto& tmpRotated           = Tmp::Vector3Array()[1];
+  auto& pivotBackTranslation = Tmp::Vector3Array()[2];
+  auto& scaledPivot          = Tmp::Vector3Array()[3];
 
   copy.getRotationMatrix(rotMatrix);
 
@@ -556,11 +563,13 @@ SolidParticleSystem& SolidParticleSystem::setParticles(unsigned int start,
     return *this;
   }
 
+  end = (end >= nbParticles) ? nbParticles - 1 : end;
+
   // custom beforeUpdate
   beforeUpdateParticles(start, end, update);
 
-  auto& rotMatrix      = Tmp::MatrixArray[0];
-  auto& invertedMatrix = Tmp::MatrixArray[1];
+  auto& rotMatrix      = Tmp::MatrixArray()[0];
+  auto& invertedMatrix = Tmp::MatrixArray()[1];
   auto& colors32       = _colors32;
   auto& positions32    = _positions32;
   auto& normals32      = _normals32;
@@ -569,12 +578,12 @@ SolidParticleSystem& SolidParticleSystem::setParticles(unsigned int start,
   auto& indices        = _indices;
   auto& fixedNormal32  = _fixedNormal32;
 
-  auto& tempVectors = Tmp::Vector3Array;
+  auto& tempVectors = Tmp::Vector3Array();
   auto& camAxisX    = tempVectors[5].copyFromFloats(1.f, 0.f, 0.f);
   auto& camAxisY    = tempVectors[6].copyFromFloats(0.f, 1.f, 0.f);
   auto& camAxisZ    = tempVectors[7].copyFromFloats(0.f, 0.f, 1.f);
   auto& minimum     = tempVectors[8].setAll(std::numeric_limits<float>::max());
-  auto& maximum     = tempVectors[9].setAll(std::numeric_limits<float>::min());
+  auto& maximum = tempVectors[9].setAll(std::numeric_limits<float>::lowest());
   auto& camInvertedPosition = tempVectors[10].setAll(0);
 
   // cases when the World Matrix is to be computed first
@@ -607,22 +616,11 @@ SolidParticleSystem& SolidParticleSystem::setParticles(unsigned int start,
   }
 
   Matrix::IdentityToRef(rotMatrix);
-  auto idx   = 0ull; // current position index in the global array positions32
-  auto index = 0ull; // position start index in the global array positions32 of
-                     // the current particle
-  auto colidx     = 0ull; // current color index in the global array colors32
-  auto colorIndex = 0ull; // color start index in the global array colors32 of
-                          // the current particle
-  auto uvidx = 0ull;      // current uv index in the global array uvs32
-  auto uvIndex
-    = 0ull; // uv start index in the global array uvs32 of the current particle
-  auto pt = 0ull; // current index in the particle model shape
 
   if (mesh->isFacetDataEnabled()) {
     _computeBoundingBox = true;
   }
 
-  end = (end >= nbParticles) ? nbParticles - 1 : end;
   if (_computeBoundingBox) {
     if (start != 0
         || end != nbParticles - 1) { // only some particles are updated, then
@@ -636,24 +634,18 @@ SolidParticleSystem& SolidParticleSystem::setParticles(unsigned int start,
     }
   }
 
-  // particle loop
-  index      = particles[start]->_pos;
-  auto vpos  = (index / 3);
-  colorIndex = vpos * 4;
-  uvIndex    = vpos * 2;
-
+  // particle loop : the custom updates and the particle transforms, in order
+  // as a particle transform depends on its parent one
+  _updatedParticles.clear();
   for (unsigned int p = start; p <= end; p++) {
     auto particle = particles[p].get();
 
     // call to custom user function to update the particle properties
     updateParticle(particle);
 
-    auto& shape                  = particle->_model->_shape;
-    auto& shapeUV                = particle->_model->_shapeUV;
     auto& particleRotationMatrix = particle->_rotationMatrix;
     auto& particlePosition       = particle->position;
     auto& particleRotation       = particle->rotation;
-    auto& particleScaling        = particle->scaling;
     auto& particleGlobalPosition = particle->_globalPosition;
 
     // camera-particle distance for depth sorting
@@ -668,20 +660,14 @@ SolidParticleSystem& SolidParticleSystem::setParticles(unsigned int start,
     // skip the computations for inactive or already invisible particles
     if (!particle->alive
         || (particle->_stillInvisible && !particle->isVisible)) {
-      // increment indexes for the next particle
-      pt = shape.size();
-      index += pt * 3;
-      colorIndex += pt * 4;
-      uvIndex += pt * 2;
       continue;
     }
 
+    _updatedParticles.emplace_back(particle);
+
     if (particle->isVisible) {
       particle->_stillInvisible = false; // un-mark permanent invisibility
 
-      auto& scaledPivot = tempVectors[12];
-      particle->pivot.multiplyToRef(particleScaling, scaledPivot);
-
       // particle rotation matrix
       if (billboard) {
         particleRotation.x = 0.f;
@@ -769,207 +755,68 @@ SolidParticleSystem& SolidParticleSystem::setParticles(unsigned int start,
           particleRotationMatrix[8]   = rotMatrixValues[10];
         }
       }
-
-      auto& pivotBackTranslation = tempVectors[11];
-      if (particle->translateFromPivot) {
-        pivotBackTranslation.setAll(0.f);
-      }
-      else {
-        pivotBackTranslation.copyFrom(scaledPivot);
-      }
-
-      // particle vertex loop
-      for (pt = 0; pt < shape.size(); ++pt) {
-        idx    = index + pt * 3;
-        colidx = colorIndex + pt * 4;
-        uvidx  = uvIndex + pt * 2;
-
-        auto& tmpVertex = tempVectors[0];
-        tmpVertex.copyFrom(shape[pt]);
-        if (_computeParticleVertex) {
-          updateParticleVertex(particle, tmpVertex, pt);
-        }
-
-        // positions
-        auto vertexX = tmpVertex.x * particleScaling.x - scaledPivot.x;
-        auto vertexY = tmpVertex.y * particleScaling.y - scaledPivot.y;
-        auto vertexZ = tmpVertex.z * particleScaling.z - scaledPivot.z;
-
-        auto rotatedX = vertexX * particleRotationMatrix[0]
-                        + vertexY * particleRotationMatrix[3]
-                        + vertexZ * particleRotationMatrix[6];
-        auto rotatedY = vertexX * particleRotationMatrix[1]
-                        + vertexY * particleRotationMatrix[4]
-                        + vertexZ * particleRotationMatrix[7];
-        auto rotatedZ = vertexX * particleRotationMatrix[2]
-                        + vertexY * particleRotationMatrix[5]
-                        + vertexZ * particleRotationMatrix[8];
-
-        rotatedX += pivotBackTranslation.x;
-        rotatedY += pivotBackTranslation.y;
-        rotatedZ += pivotBackTranslation.z;
-
-        auto px = positions32[idx]
-          = particleGlobalPosition.x + camAxisX.x * rotatedX
-            + camAxisY.x * rotatedY + camAxisZ.x * rotatedZ;
-        auto py = positions32[idx + 1]
-          = particleGlobalPosition.y + camAxisX.y * rotatedX
-            + camAxisY.y * rotatedY + camAxisZ.y * rotatedZ;
-        auto pz = positions32[idx + 2]
-          = particleGlobalPosition.z + camAxisX.z * rotatedX
-            + camAxisY.z * rotatedY + camAxisZ.z * rotatedZ;
-
-        if (_computeBoundingBox) {
-          minimum.minimizeInPlaceFromFloats(px, py, pz);
-          maximum.maximizeInPlaceFromFloats(px, py, pz);
-        }
-
-        // normals : if the particles can't be morphed then just rotate the
-        // normals, what is much more faster than ComputeNormals()
-        if (!_computeParticleVertex) {
-          const auto& normalx = fixedNormal32[idx];
-          const auto& normaly = fixedNormal32[idx + 1];
-          const auto& normalz = fixedNormal32[idx + 2];
-
-          const auto rotatedx = normalx * particleRotationMatrix[0]
-                                + normaly * particleRotationMatrix[3]
-                                + normalz * particleRotationMatrix[6];
-          const auto rotatedy = normalx * particleRotationMatrix[1]
-                                + normaly * particleRotationMatrix[4]
-                                + normalz * particleRotationMatrix[7];
-          const auto rotatedz = normalx * particleRotationMatrix[2]
-                                + normaly * particleRotationMatrix[5]
-                                + normalz * particleRotationMatrix[8];
-
-          normals32[idx] = camAxisX.x * rotatedx + camAxisY.x * rotatedy
-                           + camAxisZ.x * rotatedz;
-          normals32[idx + 1] = camAxisX.y * rotatedx + camAxisY.y * rotatedy
-                               + camAxisZ.y * rotatedz;
-          normals32[idx + 2] = camAxisX.z * rotatedx + camAxisY.z * rotatedy
-                               + camAxisZ.z * rotatedz;
-        }
-
-        if (_computeParticleColor && particle->color.has_value()) {
-          const auto& color     = particle->color.value();
-          _colors32[colidx]     = color.r;
-          _colors32[colidx + 1] = color.g;
-          _colors32[colidx + 2] = color.b;
-          _colors32[colidx + 3] = color.a;
-        }
-
-        if (_computeParticleTexture) {
-          const auto& uvs  = particle->uvs;
-          uvs32[uvidx]     = shapeUV[pt * 2] * (uvs.z - uvs.x) + uvs.x;
-          uvs32[uvidx + 1] = shapeUV[pt * 2 + 1] * (uvs.w - uvs.y) + uvs.y;
-        }
-      }
     }
     // particle just set invisible : scaled to zero and positioned at the origin
     else {
       particle->_stillInvisible = true; // mark the particle as invisible
-      for (pt = 0; pt < shape.size(); pt++) {
-        idx    = index + pt * 3;
-        colidx = colorIndex + pt * 4;
-        uvidx  = uvIndex + pt * 2;
-
-        positions32[idx] = positions32[idx + 1] = positions32[idx + 2] = 0;
-        normals32[idx] = normals32[idx + 1] = normals32[idx + 2] = 0;
-        if (_computeParticleColor && particle->color.has_value()) {
-          const auto& color    = particle->color.value();
-          colors32[colidx]     = color.r;
-          colors32[colidx + 1] = color.g;
-          colors32[colidx + 2] = color.b;
-          colors32[colidx + 3] = color.a;
-        }
-        if (_computeParticleTexture) {
-          const auto& uvs  = particle->uvs;
-          uvs32[uvidx]     = shapeUV[pt * 2] * (uvs.z - uvs.x) + uvs.x;
-          uvs32[uvidx + 1] = shapeUV[pt * 2 + 1] * (uvs.w - uvs.y) + uvs.y;
-        }
-      }
     }
+  }
 
-    // if the particle intersections must be computed : update the bbInfo
-    if (_particlesIntersect) {
-      auto& bInfo             = particle->_boundingInfo;
-      auto& bBox              = bInfo->boundingBox;
-      auto& bSphere           = bInfo->boundingSphere;
-      auto& modelBoundingInfo = particle->_modelBoundingInfo;
-      if (!_bSphereOnly) {
-        // place, scale and rotate the particle bbox within the SPS local
-        // system, then update it
-        auto& modelBoundingInfoVectors = modelBoundingInfo->boundingBox.vectors;
-
-        auto& tempMin = tempVectors[1];
-        auto& tempMax = tempVectors[2];
-        tempMin.setAll(std::numeric_limits<float>::max());
-        tempMax.setAll(std::numeric_limits<float>::min());
-        for (unsigned int b = 0; b < 8; b++) {
-          const auto scaledX
-            = modelBoundingInfoVectors[b].x * particleScaling.x;
-          const auto scaledY
-            = modelBoundingInfoVectors[b].y * particleScaling.y;
-          const auto scaledZ
-            = modelBoundingInfoVectors[b].z * particleScaling.z;
-          const auto rotatedX = scaledX * particleRotationMatrix[0]
-                                + scaledY * particleRotationMatrix[3]
-                                + scaledZ * particleRotationMatrix[6];
-          const auto rotatedY = scaledX * particleRotationMatrix[1]
-                                + scaledY * particleRotationMatrix[4]
-                                + scaledZ * particleRotationMatrix[7];
-          const auto rotatedZ = scaledX * particleRotationMatrix[2]
-                                + scaledY * particleRotationMatrix[5]
-                                + scaledZ * particleRotationMatrix[8];
-          const auto x = particlePosition.x + camAxisX.x * rotatedX
-                         + camAxisY.x * rotatedY + camAxisZ.x * rotatedZ;
-          const auto y = particlePosition.y + camAxisX.y * rotatedX
-                         + camAxisY.y * rotatedY + camAxisZ.y * rotatedZ;
-          const auto z = particlePosition.z + camAxisX.z * rotatedX
-                         + camAxisY.z * rotatedY + camAxisZ.z * rotatedZ;
-          tempMin.minimizeInPlaceFromFloats(x, y, z);
-          tempMax.maximizeInPlaceFromFloats(x, y, z);
-        }
-
-        bBox.reConstruct(tempMin, tempMax, mesh->_worldMatrix);
+  // vertex loop : each particle writes its own vertex range, so the particles
+  // are split in chunks on the thread pool unless the custom vertex function
+  // is called
+  if (!_updatedParticles.empty()) {
+    const std::array<Vector3, 3> camAxes{{camAxisX, camAxisY, camAxisZ}};
+    const Vector3 initialMinimum{minimum};
+    const Vector3 initialMaximum{maximum};
+    std::mutex boundingBoxMutex;
+    const auto setVertices = [&](size_t first, size_t last) {
+      Vector3 chunkMinimum{initialMinimum};
+      Vector3 chunkMaximum{initialMaximum};
+      for (size_t i = first; i < last; ++i) {
+        _setParticleVertices(_updatedParticles[i], camAxes, chunkMinimum,
+                             chunkMaximum);
       }
-
-      // place and scale the particle bouding sphere in the SPS local system,
-      // then update it
-      auto minBbox = modelBoundingInfo->minimum().multiplyToRef(particleScaling,
-                                                                tempVectors[1]);
-      auto maxBbox = modelBoundingInfo->maximum().multiplyToRef(particleScaling,
-                                                                tempVectors[2]);
-
-      const auto bSphereCenter = maxBbox.addToRef(minBbox, tempVectors[3])
-                                   .scaleInPlace(0.5f)
-                                   .addInPlace(particleGlobalPosition);
-      const auto halfDiag = maxBbox.subtractToRef(minBbox, tempVectors[4])
-                              .scaleInPlace(0.5f * _bSphereRadiusFactor);
-      const auto bSphereMinBbox
-        = bSphereCenter.subtractToRef(halfDiag, tempVectors[1]);
-      const auto bSphereMaxBbox
-        = bSphereCenter.addToRef(halfDiag, tempVectors[2]);
-      bSphere.reConstruct(bSphereMinBbox, bSphereMaxBbox, mesh->_worldMatrix);
+      if (_computeBoundingBox) {
+        std::lock_guard<std::mutex> lock(boundingBoxMutex);
+        minimum.minimizeInPlace(chunkMinimum);
+        maximum.maximizeInPlace(chunkMaximum);
+      }
+    };
+    const auto updatedCount = _updatedParticles.size();
+    if (_computeParticleVertex || updatedCount < ParallelUpdateThreshold) {
+      setVertices(0, updatedCount);
+    }
+    else {
+      ThreadPool::Default().parallelFor(
+        updatedCount, ParallelUpdateThreshold / 4, setVertices);
     }
 
-    // increment indexes for the next particle
-    index      = idx + 3;
-    colorIndex = colidx + 4;
-    uvIndex    = uvidx + 2;
+    // the particles are ordered in the vertex arrays
+    const auto first  = _updatedParticles.front();
+    const auto last   = _updatedParticles.back();
+    _dirtyVertexStart = std::min(_dirtyVertexStart, size_t(first->_pos / 3));
+    _dirtyVertexEnd   = std::max(
+      _dirtyVertexEnd, size_t(last->_pos / 3) + last->_model->_shape.size());
   }
 
   // if the VBO must be updated
   if (update) {
-    if (_computeParticleColor) {
-      mesh->updateVerticesData(VertexBuffer::ColorKind, colors32, false, false);
-    }
-    if (_computeParticleTexture) {
-      mesh->updateVerticesData(VertexBuffer::UVKind, uvs32, false, false);
+    // only the vertices rewritten since the last VBO update are uploaded
+    const auto isDirty = _dirtyVertexStart < _dirtyVertexEnd;
+    if (isDirty) {
+      if (_computeParticleColor) {
+        _updateVerticesDataRange(VertexBuffer::ColorKind, colors32, 4);
+      }
+      if (_computeParticleTexture) {
+        _updateVerticesDataRange(VertexBuffer::UVKind, uvs32, 2);
+      }
+      _updateVerticesDataRange(VertexBuffer::PositionKind, positions32, 3);
     }
-    mesh->updateVerticesData(VertexBuffer::PositionKind, positions32, false,
-                             false);
     if (!mesh->areNormalsFrozen || mesh->isFacetDataEnabled) {
-      if (_computeParticleVertex || mesh->isFacetDataEnabled) {
+      const auto computeNormals
+        = _computeParticleVertex || mesh->isFacetDataEnabled;
+      if (computeNormals) {
         // recompute the normals only if the particles can be morphed, update
         // then also the normal reference array _fixedNormal32[]
         if (mesh->isFacetDataEnabled) {
@@ -985,10 +832,18 @@ SolidParticleSystem& SolidParticleSystem::setParticles(unsigned int start,
         }
       }
       if (!mesh->areNormalsFrozen) {
-        mesh->updateVerticesData(VertexBuffer::NormalKind, normals32, false,
-                                 false);
+        // the rigid particle normals are rotated in the dirty range only
+        if (computeNormals) {
+          mesh->updateVerticesData(VertexBuffer::NormalKind, normals32, false,
+                                   false);
+        }
+        else if (isDirty) {
+          _updateVerticesDataRange(VertexBuffer::NormalKind, normals32, 3);
+        }
       }
     }
+    _dirtyVertexStart = std::numeric_limits<size_t>::max();
+    _dirtyVertexEnd   = 0;
     if (_depthSort && _depthSortParticles) {
       std::sort(depthSortedParticles.begin(), depthSortedParticles.end(),
                 _depthSortFunction);
@@ -1018,6 +873,222 @@ SolidParticleSystem& SolidParticleSystem::setParticles(unsigned int start,
   return *this;
 }
 
+void SolidParticleSystem::_setParticleVertices(
+  SolidParticle* particle, const std::array<Vector3, 3>& camAxes,
+  Vector3& minimum, Vector3& maximum)
+{
+  auto& positions32   = _positions32;
+  auto& normals32     = _normals32;
+  auto& colors32      = _colors32;
+  auto& uvs32         = _uvs32;
+  auto& fixedNormal32 = _fixedNormal32;
+  const auto& camAxisX = camAxes[0];
+  const auto& camAxisY = camAxes[1];
+  const auto& camAxisZ = camAxes[2];
+
+  auto& shape                        = particle->_model->_shape;
+  auto& shapeUV                      = particle->_model->_shapeUV;
+  const auto& particleRotationMatrix = particle->_rotationMatrix;
+  const auto& particlePosition       = particle->position;
+  const auto& particleScaling        = particle->scaling;
+  const auto& particleGlobalPosition = particle->_globalPosition;
+
+  // position, color and uv start indices of the particle
+  const size_t index      = particle->_pos;
+  const size_t colorIndex = index / 3 * 4;
+  const size_t uvIndex    = index / 3 * 2;
+
+  if (particle->isVisible) {
+    Vector3 scaledPivot;
+    particle->pivot.multiplyToRef(particleScaling, scaledPivot);
+
+    Vector3 pivotBackTranslation;
+    if (!particle->translateFromPivot) {
+      pivotBackTranslation.copyFrom(scaledPivot);
+    }
+
+    // particle vertex loop
+    Vector3 tmpVertex;
+    for (size_t pt = 0; pt < shape.size(); ++pt) {
+      const auto idx    = index + pt * 3;
+      const auto colidx = colorIndex + pt * 4;
+      const auto uvidx  = uvIndex + pt * 2;
+
+      tmpVertex.copyFrom(shape[pt]);
+      if (_computeParticleVertex) {
+        updateParticleVertex(particle, tmpVertex, pt);
+      }
+
+      // positions
+      auto vertexX = tmpVertex.x * particleScaling.x - scaledPivot.x;
+      auto vertexY = tmpVertex.y * particleScaling.y - scaledPivot.y;
+      auto vertexZ = tmpVertex.z * particleScaling.z - scaledPivot.z;
+
+      auto rotatedX = vertexX * particleRotationMatrix[0]
+                      + vertexY * particleRotationMatrix[3]
+                      + vertexZ * particleRotationMatrix[6];
+      auto rotatedY = vertexX * particleRotationMatrix[1]
+                      + vertexY * particleRotationMatrix[4]
+                      + vertexZ * particleRotationMatrix[7];
+      auto rotatedZ = vertexX * particleRotationMatrix[2]
+                      + vertexY * particleRotationMatrix[5]
+                      + vertexZ * particleRotationMatrix[8];
+
+      rotatedX += pivotBackTranslation.x;
+      rotatedY += pivotBackTranslation.y;
+      rotatedZ += pivotBackTranslation.z;
+
+      auto px = positions32[idx]
+        = particleGlobalPosition.x + camAxisX.x * rotatedX
+          + camAxisY.x * rotatedY + camAxisZ.x * rotatedZ;
+      auto py = positions32[idx + 1]
+        = particleGlobalPosition.y + camAxisX.y * rotatedX
+          + camAxisY.y * rotatedY + camAxisZ.y * rotatedZ;
+      auto pz = positions32[idx + 2]
+        = particleGlobalPosition.z + camAxisX.z * rotatedX
+          + camAxisY.z * rotatedY + camAxisZ.z * rotatedZ;
+
+      if (_computeBoundingBox) {
+        minimum.minimizeInPlaceFromFloats(px, py, pz);
+        maximum.maximizeInPlaceFromFloats(px, py, pz);
+      }
+
+      // normals : if the particles can't be morphed then just rotate the
+      // normals, what is much more faster than ComputeNormals()
+      if (!_computeParticleVertex) {
+        const auto& normalx = fixedNormal32[idx];
+        const auto& normaly = fixedNormal32[idx + 1];
+        const auto& normalz = fixedNormal32[idx + 2];
+
+        const auto rotatedx = normalx * particleRotationMatrix[0]
+                              + normaly * particleRotationMatrix[3]
+                              + normalz * particleRotationMatrix[6];
+        const auto rotatedy = normalx * particleRotationMatrix[1]
+                              + normaly * particleRotationMatrix[4]
+                              + normalz * particleRotationMatrix[7];
+        const auto rotatedz = normalx * particleRotationMatrix[2]
+                              + normaly * particleRotationMatrix[5]
+                              + normalz * particleRotationMatrix[8];
+
+        normals32[idx] = camAxisX.x * rotatedx + camAxisY.x * rotatedy
+                         + camAxisZ.x * rotatedz;
+        normals32[idx + 1] = camAxisX.y * rotatedx + camAxisY.y * rotatedy
+                             + camAxisZ.y * rotatedz;
+        normals32[idx + 2] = camAxisX.z * rotatedx + camAxisY.z * rotatedy
+                             + camAxisZ.z * rotatedz;
+      }
+
+      if (_computeParticleColor && particle->color.has_value()) {
+        const auto& color    = particle->color.value();
+        colors32[colidx]     = color.r;
+        colors32[colidx + 1] = color.g;
+        colors32[colidx + 2] = color.b;
+        colors32[colidx + 3] = color.a;
+      }
+
+      if (_computeParticleTexture) {
+        const auto& uvs  = particle->uvs;
+        uvs32[uvidx]     = shapeUV[pt * 2] * (uvs.z - uvs.x) + uvs.x;
+        uvs32[uvidx + 1] = shapeUV[pt * 2 + 1] * (uvs.w - uvs.y) + uvs.y;
+      }
+    }
+  }
+  // particle just set invisible : scaled to zero and positioned at the origin
+  else {
+    for (size_t pt = 0; pt < shape.size(); pt++) {
+      const auto idx    = index + pt * 3;
+      const auto colidx = colorIndex + pt * 4;
+      const auto uvidx  = uvIndex + pt * 2;
+
+      positions32[idx] = positions32[idx + 1] = positions32[idx + 2] = 0;
+      normals32[idx] = normals32[idx + 1] = normals32[idx + 2] = 0;
+      if (_computeParticleColor && particle->color.has_value()) {
+        const auto& color    = particle->color.value();
+        colors32[colidx]     = color.r;
+        colors32[colidx + 1] = color.g;
+        colors32[colidx + 2] = color.b;
+        colors32[colidx + 3] = color.a;
+      }
+      if (_computeParticleTexture) {
+        const auto& uvs  = particle->uvs;
+        uvs32[uvidx]     = shapeUV[pt * 2] * (uvs.z - uvs.x) + uvs.x;
+        uvs32[uvidx + 1] = shapeUV[pt * 2 + 1] * (uvs.w - uvs.y) + uvs.y;
+      }
+    }
+  }
+
+  // if the particle intersections must be computed : update the bbInfo
+  if (_particlesIntersect) {
+    auto& bInfo             = particle->_boundingInfo;
+    auto& bBox              = bInfo->boundingBox;
+    auto& bSphere           = bInfo->boundingSphere;
+    auto& modelBoundingInfo = particle->_modelBoundingInfo;
+    if (!_bSphereOnly) {
+      // place, scale and rotate the particle bbox within the SPS local
+      // system, then update it
+      auto& modelBoundingInfoVectors = modelBoundingInfo->boundingBox.vectors;
+
+      Vector3 tempMin;
+      Vector3 tempMax;
+      tempMin.setAll(std::numeric_limits<float>::max());
+      tempMax.setAll(std::numeric_limits<float>::lowest());
+      for (unsigned int b = 0; b < 8; b++) {
+        const auto scaledX = modelBoundingInfoVectors[b].x * particleScaling.x;
+        const auto scaledY = modelBoundingInfoVectors[b].y * particleScaling.y;
+        const auto scaledZ = modelBoundingInfoVectors[b].z * particleScaling.z;
+        const auto rotatedX = scaledX * particleRotationMatrix[0]
+                              + scaledY * particleRotationMatrix[3]
+                              + scaledZ * particleRotationMatrix[6];
+        const auto rotatedY = scaledX * particleRotationMatrix[1]
+                              + scaledY * particleRotationMatrix[4]
+                              + scaledZ * particleRotationMatrix[7];
+        const auto rotatedZ = scaledX * particleRotationMatrix[2]
+                              + scaledY * particleRotationMatrix[5]
+                              + scaledZ * particleRotationMatrix[8];
+        const auto x = particlePosition.x + camAxisX.x * rotatedX
+                       + camAxisY.x * rotatedY + camAxisZ.x * rotatedZ;
+        const auto y = particlePosition.y + camAxisX.y * rotatedX
+                       + camAxisY.y * rotatedY + camAxisZ.y * rotatedZ;
+        const auto z = particlePosition.z + camAxisX.z * rotatedX
+                       + camAxisY.z * rotatedY + camAxisZ.z * rotatedZ;
+        tempMin.minimizeInPlaceFromFloats(x, y, z);
+        tempMax.maximizeInPlaceFromFloats(x, y, z);
+      }
+
+      bBox.reConstruct(tempMin, tempMax, mesh->_worldMatrix);
+    }
+
+    // place and scale the particle bouding sphere in the SPS local system,
+    // then update it
+    Vector3 minBbox;
+    Vector3 maxBbox;
+    modelBoundingInfo->minimum().multiplyToRef(particleScaling, minBbox);
+    modelBoundingInfo->maximum().multiplyToRef(particleScaling, maxBbox);
+
+    Vector3 bSphereCenter;
+    Vector3 halfDiag;
+    maxBbox.addToRef(minBbox, bSphereCenter)
+      .scaleInPlace(0.5f)
+      .addInPlace(particleGlobalPosition);
+    maxBbox.subtractToRef(minBbox, halfDiag)
+      .scaleInPlace(0.5f * _bSphereRadiusFactor);
+    bSphere.reConstruct(bSphereCenter.subtract(halfDiag),
+                        bSphereCenter.add(halfDiag), mesh->_worldMatrix);
+  }
+}
+
+void SolidParticleSystem::_updateVerticesDataRange(const std::string& kind,
+                                                   const Float32Array& data,
+                                                   size_t stride)
+{
+  auto geometry = mesh->geometry();
+  if (geometry) {
+    geometry->_updateVerticesDataRange(
+      kind, data, _dirtyVertexStart * stride,
+      (_dirtyVertexEnd - _dirtyVertexStart) * stride);
+  }
+}
+
 void SolidParticleSystem::dispose(bool /*doNotRecurse*/,
                                   bool /*disposeMaterialAndTextures*/)
 {
@@ -50,7 +50,9 @@ float PhysicsEngine::getTimeStep() const
 
 void PhysicsEngine::dispose()
 {
-  for (const auto& impostor : _impostors) {
+  // The impostors remove themselves from the list while being disposed
+  const auto impostors = _impostors;
+  for (const auto& impostor : impostors) {
     impostor->dispose();
   }
   _physicsPlugin->dispose();
@@ -137,8 +139,7 @@ void PhysicsEngine::_step(float delta)
     delta = 1.f / 60.f;
   }
 
-  // TODO FIXME
-  // _physicsPlugin->executeStep(delta, _impostors);
+  _physicsPlugin->executeStep(delta, _impostors);
 }
 
 IPhysicsEnginePlugin* PhysicsEngine::getPhysicsPlugin()
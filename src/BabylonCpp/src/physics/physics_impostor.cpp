@@ -51,8 +51,10 @@ PhysicsImpostor::PhysicsImpostor(IPhysicsEnabledObject* iObject,
     , parent{this, &PhysicsImpostor::get_parent, &PhysicsImpostor::set_parent}
     , _options{options}
     , _scene{scene}
+    , _physicsBody{nullptr}
     , _bodyUpdateRequired{false}
     , _deltaPosition{Vector3::Zero()}
+    , _parent{nullptr}
     , _isDisposed{false}
     , nullPhysicsImpostor{nullptr}
 {
@@ -138,7 +140,7 @@ void PhysicsImpostor::_init()
 
 PhysicsImpostorPtr PhysicsImpostor::_getPhysicsParent()
 {
-  if (object->parent()->type() == Type::ABSTRACTMESH) {
+  if (object->parent() && object->parent()->type() == Type::ABSTRACTMESH) {
     auto parentMesh = static_cast<AbstractMesh*>(object->parent());
     return parentMesh->physicsImpostor();
   }
@@ -181,7 +183,7 @@ void PhysicsImpostor::set_parent(PhysicsImpostor* const& value)
 
 void PhysicsImpostor::set_physicsBody(IPhysicsBody* const& iPhysicsBody)
 {
-  if (iPhysicsBody && _physicsEngine) {
+  if (_physicsBody && _physicsEngine) {
     _physicsEngine->getPhysicsPlugin()->removePhysicsBody(*this);
   }
   _physicsBody = iPhysicsBody;
@@ -0,0 +1,88 @@
+#include <babylon/physics/plugins/native_physics_body.h>
+
+namespace BABYLON {
+
+NativePhysicsBody::NativePhysicsBody(NativePhysicsWorld& world,
+                                     NativePhysicsWorld::BodyId id)
+    : _world{world}, _id{id}
+{
+}
+
+NativePhysicsBody::~NativePhysicsBody() = default;
+
+NativePhysicsWorld::BodyId NativePhysicsBody::id() const
+{
+  return _id;
+}
+
+void NativePhysicsBody::setPosition(const Vector3& newPosition)
+{
+  _world.setTransformation(_id, newPosition, _world.orientation(_id));
+}
+
+void NativePhysicsBody::setOrientation(const Quaternion& newRotation)
+{
+  _world.setTransformation(_id, _world.position(_id), newRotation);
+}
+
+void NativePhysicsBody::setShapesDensity(float /*density*/)
+{
+  // The bodies have a single shape, their mass is set directly
+}
+
+void NativePhysicsBody::setupMass(int mass)
+{
+  _world.setMass(_id, static_cast<float>(mass));
+}
+
+float NativePhysicsBody::mass()
+{
+  return _world.mass(_id);
+}
+
+void NativePhysicsBody::applyImpulse(const Vector3& position,
+                                     const Vector3& force)
+{
+  _world.applyImpulse(_id, force, position);
+}
+
+Vector3 NativePhysicsBody::angularVelocity()
+{
+  return _world.angularVelocity(_id);
+}
+
+void NativePhysicsBody::setAngularVelocity(const Vector3& velocity)
+{
+  _world.setAngularVelocity(_id, velocity);
+}
+
+Vector3 NativePhysicsBody::linearVelocity()
+{
+  return _world.linearVelocity(_id);
+}
+
+void NativePhysicsBody::setLinearVelocity(const Vector3& velocity)
+{
+  _world.setLinearVelocity(_id, velocity);
+}
+
+void NativePhysicsBody::sleep()
+{
+  _world.sleep(_id);
+}
+
+bool NativePhysicsBody::sleeping()
+{
+  return _world.isSleeping(_id);
+}
+
+void NativePhysicsBody::awake()
+{
+  _world.wakeUp(_id);
+}
+
+void NativePhysicsBody::syncShapes()
+{
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,552 @@
+#include <babylon/physics/plugins/native_physics_plugin.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <babylon/babylon_constants.h>
+#include <babylon/core/logging.h>
+#include <babylon/meshes/abstract_mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/physics/iphysics_enabled_object.h>
+#include <babylon/physics/joint/distance_joint.h>
+#include <babylon/physics/joint/imotor_enabled_joint.h>
+#include <babylon/physics/joint/physics_joint.h>
+#include <babylon/physics/physics_impostor.h>
+#include <babylon/physics/physics_impostor_joint.h>
+#include <babylon/physics/physics_raycast_result.h>
+#include <babylon/physics/plugins/native_physics_body.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Half thickness given to the plane impostors and flat boxes
+constexpr float MIN_HALF_EXTENT = 0.005f;
+// Radius of the particle impostors
+constexpr float PARTICLE_RADIUS = 0.01f;
+// Number of sides of the prism approximating the cylinder impostors
+constexpr unsigned int CYLINDER_SEGMENTS = 16;
+
+} // end of anonymous namespace
+
+NativePhysicsPlugin::NativePhysicsPlugin(size_t iterations)
+    : maxSubSteps{3}, _fixedTimeStep{1.f / 60.f}, _accumulator{0.f}
+{
+  world = nullptr;
+  name  = "NativePhysicsPlugin";
+  _world.solverIterations = iterations;
+}
+
+NativePhysicsPlugin::~NativePhysicsPlugin() = default;
+
+NativePhysicsWorld& NativePhysicsPlugin::getWorld()
+{
+  return _world;
+}
+
+void NativePhysicsPlugin::setGravity(const Vector3& gravity)
+{
+  _world.setGravity(gravity);
+}
+
+void NativePhysicsPlugin::setTimeStep(float timeStep)
+{
+  _fixedTimeStep = timeStep;
+}
+
+float NativePhysicsPlugin::getTimeStep() const
+{
+  return _fixedTimeStep;
+}
+
+void NativePhysicsPlugin::executeStep(
+  float delta, const std::vector<PhysicsImpostorPtr>& impostors)
+{
+  for (const auto& impostor : impostors) {
+    impostor->beforeStep();
+  }
+
+  // Fixed time steps, dropping the time which can not be caught up
+  _accumulator = std::min(_accumulator + delta,
+                          static_cast<float>(maxSubSteps) * _fixedTimeStep);
+  while (_accumulator >= _fixedTimeStep) {
+    _world.step(_fixedTimeStep);
+    _accumulator -= _fixedTimeStep;
+  }
+
+  for (const auto& impostor : impostors) {
+    impostor->afterStep();
+  }
+}
+
+NativePhysicsWorld::BodyId
+NativePhysicsPlugin::_getBodyId(const PhysicsImpostor& impostor) const
+{
+  auto it = _bodies.find(&impostor);
+  return (it != _bodies.end()) ? it->second->id() :
+                                 NativePhysicsWorld::InvalidId;
+}
+
+void NativePhysicsPlugin::applyImpulse(const PhysicsImpostor& impostor,
+                                       const Vector3& force,
+                                       const Vector3& contactPoint)
+{
+  const auto id = _getBodyId(impostor);
+  if (id != NativePhysicsWorld::InvalidId) {
+    _world.applyImpulse(id, force, contactPoint);
+  }
+}
+
+void NativePhysicsPlugin::applyForce(const PhysicsImpostor& impostor,
+                                     const Vector3& force,
+                                     const Vector3& contactPoint)
+{
+  const auto id = _getBodyId(impostor);
+  if (id != NativePhysicsWorld::InvalidId) {
+    _world.applyForce(id, force, contactPoint);
+  }
+}
+
+NativePhysicsShape
+NativePhysicsPlugin::_createShape(PhysicsImpostor& impostor) const
+{
+  const auto extendSize = impostor.getObjectExtendSize();
+  const auto halfExtents
+    = Vector3(std::max(extendSize.x * 0.5f, MIN_HALF_EXTENT),
+              std::max(extendSize.y * 0.5f, MIN_HALF_EXTENT),
+              std::max(extendSize.z * 0.5f, MIN_HALF_EXTENT));
+
+  switch (impostor.physicsImposterType) {
+    case PhysicsImpostor::SphereImpostor:
+      return NativePhysicsShape::Sphere(
+        std::max({halfExtents.x, halfExtents.y, halfExtents.z}));
+    case PhysicsImpostor::CapsuleImpostor: {
+      const auto radius = std::max(halfExtents.x, halfExtents.z);
+      return NativePhysicsShape::Capsule(
+        radius, std::max(halfExtents.y - radius, 0.f));
+    }
+    case PhysicsImpostor::CylinderImpostor: {
+      std::vector<Vector3> points;
+      for (unsigned int i = 0; i < CYLINDER_SEGMENTS; ++i) {
+        const auto angle = Math::PI2 * static_cast<float>(i)
+                           / static_cast<float>(CYLINDER_SEGMENTS);
+        const auto x = std::cos(angle) * halfExtents.x;
+        const auto z = std::sin(angle) * halfExtents.z;
+        points.emplace_back(Vector3(x, -halfExtents.y, z));
+        points.emplace_back(Vector3(x, halfExtents.y, z));
+      }
+      return NativePhysicsShape::ConvexHull(points);
+    }
+    case PhysicsImpostor::ParticleImpostor:
+      return NativePhysicsShape::Sphere(PARTICLE_RADIUS);
+    case PhysicsImpostor::MeshImpostor:
+    case PhysicsImpostor::HeightmapImpostor:
+    case PhysicsImpostor::ConvexHullImpostor: {
+      const auto positions
+        = impostor.object->getVerticesData(VertexBuffer::PositionKind);
+      if (positions.size() >= 12) {
+        const auto& scaling = impostor.object->scaling();
+        std::vector<Vector3> points;
+        points.reserve(positions.size() / 3);
+        for (size_t i = 0; i + 2 < positions.size(); i += 3) {
+          points.emplace_back(Vector3(positions[i] * scaling.x,
+                                      positions[i + 1] * scaling.y,
+                                      positions[i + 2] * scaling.z));
+        }
+        return NativePhysicsShape::ConvexHull(points);
+      }
+      return NativePhysicsShape::Box(halfExtents);
+    }
+    default:
+      return NativePhysicsShape::Box(halfExtents);
+  }
+}
+
+void NativePhysicsPlugin::generatePhysicsBody(const PhysicsImpostor& iImpostor)
+{
+  // The plugin interface is const but the impostor object is updated while
+  // measuring its extend size
+  auto& impostor = const_cast<PhysicsImpostor&>(iImpostor);
+
+  if (impostor.soft) {
+    BABYLON_LOG_WARN("NativePhysicsPlugin",
+                     "Soft body impostors are not supported")
+    return;
+  }
+  if (impostor.parent()) {
+    BABYLON_LOG_WARN("NativePhysicsPlugin",
+                     "Compound (parented) impostors are not supported")
+    return;
+  }
+
+  auto* object = impostor.object;
+  object->computeWorldMatrix(true);
+  const auto& rotationQuaternion = object->rotationQuaternion();
+  const auto id                  = _world.createBody(
+    _createShape(impostor), impostor.getParam("mass"),
+    object->getAbsolutePosition(),
+    rotationQuaternion ? *rotationQuaternion : Quaternion());
+  _world.setFriction(id, impostor.getParam("friction"));
+  _world.setRestitution(id, impostor.getParam("restitution"));
+
+  // Setting the body of the impostor removes its previous body
+  auto body            = std::make_unique<NativePhysicsBody>(_world, id);
+  impostor.physicsBody = body.get();
+  _bodies[&iImpostor]  = std::move(body);
+}
+
+void NativePhysicsPlugin::removePhysicsBody(const PhysicsImpostor& impostor)
+{
+  auto it = _bodies.find(&impostor);
+  if (it != _bodies.end()) {
+    _world.removeBody(it->second->id());
+    _bodies.erase(it);
+  }
+}
+
+void NativePhysicsPlugin::generateJoint(PhysicsImpostorJoint* impostorJoint)
+{
+  const auto mainId      = _getBodyId(*impostorJoint->mainImpostor);
+  const auto connectedId = _getBodyId(*impostorJoint->connectedImpostor);
+  if (mainId == NativePhysicsWorld::InvalidId
+      || connectedId == NativePhysicsWorld::InvalidId) {
+    return;
+  }
+
+  auto& joint          = impostorJoint->joint;
+  const auto& data     = joint->jointData;
+  const auto pivotA    = data.mainPivot.value_or(Vector3::Zero());
+  const auto pivotB    = data.connectedPivot.value_or(Vector3::Zero());
+  const auto collision = data.collision.value_or(false);
+
+  NativePhysicsWorld::JointId id;
+  switch (joint->jointType) {
+    case PhysicsJoint::DistanceJoint: {
+      // The maximum distance is not part of the generic joint data, the
+      // current distance of the pivots is kept instead
+      const auto worldPivotA
+        = _world.position(mainId)
+          + NativePhysicsShapeInstance::Rotate(_world.orientation(mainId),
+                                               pivotA);
+      const auto worldPivotB
+        = _world.position(connectedId)
+          + NativePhysicsShapeInstance::Rotate(
+            _world.orientation(connectedId), pivotB);
+      const auto distance = (worldPivotB - worldPivotA).length();
+      id = _world.createDistanceJoint(mainId, connectedId, pivotA, pivotB,
+                                      distance, distance, collision);
+    } break;
+    case PhysicsJoint::HingeJoint:
+    case PhysicsJoint::WheelJoint:
+      id = _world.createHingeJoint(
+        mainId, connectedId, pivotA, pivotB,
+        data.mainAxis.value_or(Vector3::Up()),
+        data.connectedAxis.value_or(data.mainAxis.value_or(Vector3::Up())),
+        collision);
+      break;
+    case PhysicsJoint::BallAndSocketJoint:
+    case PhysicsJoint::PointToPointJoint:
+      id = _world.createBallAndSocketJoint(mainId, connectedId, pivotA, pivotB,
+                                           collision);
+      break;
+    case PhysicsJoint::LockJoint:
+      id = _world.createLockJoint(mainId, connectedId, pivotA, pivotB,
+                                  collision);
+      break;
+    default:
+      BABYLON_LOG_WARN("NativePhysicsPlugin", "Unsupported joint type")
+      return;
+  }
+  _joints[joint.get()] = id;
+}
+
+void NativePhysicsPlugin::removeJoint(PhysicsImpostorJoint* impostorJoint)
+{
+  auto it = _joints.find(impostorJoint->joint.get());
+  if (it != _joints.end()) {
+    _world.removeJoint(it->second);
+    _joints.erase(it);
+  }
+}
+
+bool NativePhysicsPlugin::isSupported()
+{
+  return true;
+}
+
+void NativePhysicsPlugin::setTransformationFromPhysicsBody(
+  const PhysicsImpostor& impostor)
+{
+  const auto id = _getBodyId(impostor);
+  if (id == NativePhysicsWorld::InvalidId) {
+    return;
+  }
+  auto* object     = impostor.object;
+  object->position = _world.position(id);
+  if (object->rotationQuaternion()) {
+    object->rotationQuaternion = _world.orientation(id);
+  }
+}
+
+void NativePhysicsPlugin::setPhysicsBodyTransformation(
+  const PhysicsImpostor& impostor, const Vector3& newPosition,
+  const Quaternion& newRotation)
+{
+  const auto id = _getBodyId(impostor);
+  if (id != NativePhysicsWorld::InvalidId) {
+    _world.setTransformation(id, newPosition, newRotation);
+  }
+}
+
+void NativePhysicsPlugin::setLinearVelocity(
+  const PhysicsImpostor& impostor, const std::optional<Vector3>& velocity)
+{
+  const auto id = _getBodyId(impostor);
+  if (id != NativePhysicsWorld::InvalidId) {
+    _world.setLinearVelocity(id, velocity.value_or(Vector3::Zero()));
+  }
+}
+
+void NativePhysicsPlugin::setAngularVelocity(
+  const PhysicsImpostor& impostor, const std::optional<Vector3>& velocity)
+{
+  const auto id = _getBodyId(impostor);
+  if (id != NativePhysicsWorld::InvalidId) {
+    _world.setAngularVelocity(id, velocity.value_or(Vector3::Zero()));
+  }
+}
+
+Vector3 NativePhysicsPlugin::getLinearVelocity(const PhysicsImpostor& impostor)
+{
+  const auto id = _getBodyId(impostor);
+  return (id != NativePhysicsWorld::InvalidId) ? _world.linearVelocity(id) :
+                                                 Vector3::Zero();
+}
+
+Vector3 NativePhysicsPlugin::getAngularVelocity(const PhysicsImpostor& impostor)
+{
+  const auto id = _getBodyId(impostor);
+  return (id != NativePhysicsWorld::InvalidId) ? _world.angularVelocity(id) :
+                                                 Vector3::Zero();
+}
+
+void NativePhysicsPlugin::setBodyMass(const PhysicsImpostor& impostor,
+                                      float mass)
+{
+  const auto id = _getBodyId(impostor);
+  if (id != NativePhysicsWorld::InvalidId) {
+    _world.setMass(id, mass);
+  }
+}
+
+float NativePhysicsPlugin::getBodyMass(const PhysicsImpostor& impostor)
+{
+  const auto id = _getBodyId(impostor);
+  return (id != NativePhysicsWorld::InvalidId) ? _world.mass(id) : 0.f;
+}
+
+float NativePhysicsPlugin::getBodyFriction(const PhysicsImpostor& impostor)
+{
+  const auto id = _getBodyId(impostor);
+  return (id != NativePhysicsWorld::InvalidId) ? _world.friction(id) : 0.f;
+}
+
+void NativePhysicsPlugin::setBodyFriction(const PhysicsImpostor& impostor,
+                                          float friction)
+{
+  const auto id = _getBodyId(impostor);
+  if (id != NativePhysicsWorld::InvalidId) {
+    _world.setFriction(id, friction);
+  }
+}
+
+float NativePhysicsPlugin::getBodyRestitution(const PhysicsImpostor& impostor)
+{
+  const auto id = _getBodyId(impostor);
+  return (id != NativePhysicsWorld::InvalidId) ? _world.restitution(id) : 0.f;
+}
+
+void NativePhysicsPlugin::setBodyRestitution(const PhysicsImpostor& impostor,
+                                             float restitution)
+{
+  const auto id = _getBodyId(impostor);
+  if (id != NativePhysicsWorld::InvalidId) {
+    _world.setRestitution(id, restitution);
+  }
+}
+
+float NativePhysicsPlugin::getBodyPressure(const PhysicsImpostor& /*impostor*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin",
+                   "Pressure is only supported by soft bodies")
+  return 0.f;
+}
+
+void NativePhysicsPlugin::setBodyPressure(const PhysicsImpostor& /*impostor*/,
+                                          float /*pressure*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin",
+                   "Pressure is only supported by soft bodies")
+}
+
+float NativePhysicsPlugin::getBodyStiffness(
+  const PhysicsImpostor& /*impostor*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin",
+                   "Stiffness is only supported by soft bodies")
+  return 0.f;
+}
+
+void NativePhysicsPlugin::setBodyStiffness(const PhysicsImpostor& /*impostor*/,
+                                           float /*stiffness*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin",
+                   "Stiffness is only supported by soft bodies")
+}
+
+size_t NativePhysicsPlugin::getBodyVelocityIterations(
+  const PhysicsImpostor& /*impostor*/)
+{
+  return _world.solverIterations;
+}
+
+void NativePhysicsPlugin::setBodyVelocityIterations(
+  const PhysicsImpostor& /*impostor*/, size_t /*velocityIterations*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin",
+                   "Velocity iterations are only supported by soft bodies")
+}
+
+size_t NativePhysicsPlugin::getBodyPositionIterations(
+  const PhysicsImpostor& /*impostor*/)
+{
+  return 0;
+}
+
+void NativePhysicsPlugin::setBodyPositionIterations(
+  const PhysicsImpostor& /*impostor*/, size_t /*positionIterations*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin",
+                   "Position iterations are only supported by soft bodies")
+}
+
+void NativePhysicsPlugin::appendAnchor(
+  const PhysicsImpostor& /*impostor*/,
+  const PhysicsImpostorPtr& /*otherImpostor*/, int /*width*/, int /*height*/,
+  float /*influence*/, bool /*noCollisionBetweenLinkedBodies*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin",
+                   "Anchors are only supported by soft bodies")
+}
+
+void NativePhysicsPlugin::appendHook(
+  const PhysicsImpostor& /*impostor*/,
+  const PhysicsImpostorPtr& /*otherImpostor*/, float /*length*/,
+  float /*influence*/, bool /*noCollisionBetweenLinkedBodies*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin",
+                   "Hooks are only supported by soft bodies")
+}
+
+void NativePhysicsPlugin::sleepBody(const PhysicsImpostor& impostor)
+{
+  const auto id = _getBodyId(impostor);
+  if (id != NativePhysicsWorld::InvalidId) {
+    _world.sleep(id);
+  }
+}
+
+void NativePhysicsPlugin::wakeUpBody(const PhysicsImpostor& impostor)
+{
+  const auto id = _getBodyId(impostor);
+  if (id != NativePhysicsWorld::InvalidId) {
+    _world.wakeUp(id);
+  }
+}
+
+PhysicsRaycastResult NativePhysicsPlugin::raycast(const Vector3& from,
+                                                  const Vector3& to)
+{
+  PhysicsRaycastResult result;
+  result.reset(from, to);
+
+  Vector3 point, normal;
+  if (_world.raycast(from, to, point, normal)
+      != NativePhysicsWorld::InvalidId) {
+    result.setHitData({normal.x, normal.y, normal.z},
+                      {point.x, point.y, point.z});
+    result.calculateHitDistance();
+  }
+
+  return result;
+}
+
+void NativePhysicsPlugin::updateDistanceJoint(DistanceJoint* joint,
+                                              float maxDistance,
+                                              float minDistance)
+{
+  auto it = _joints.find(joint);
+  if (it != _joints.end()) {
+    _world.setDistanceJointLimits(it->second, minDistance, maxDistance);
+  }
+}
+
+void NativePhysicsPlugin::setMotor(IMotorEnabledJoint* /*joint*/,
+                                   float /*speed*/, float /*maxForce*/,
+                                   unsigned int /*motorIndex*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin", "Joint motors are not supported")
+}
+
+void NativePhysicsPlugin::setLimit(IMotorEnabledJoint* /*joint*/,
+                                   float /*upperLimit*/, float /*lowerLimit*/,
+                                   unsigned int /*motorIndex*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin", "Joint limits are not supported")
+}
+
+float NativePhysicsPlugin::getRadius(const PhysicsImpostor& impostor)
+{
+  const auto id = _getBodyId(impostor);
+  if (id == NativePhysicsWorld::InvalidId) {
+    return 0.f;
+  }
+  const auto& shape = _world.shape(id);
+  return (shape.type() == NativePhysicsShape::Type::ConvexHull) ?
+           shape.getHalfExtents().x :
+           shape.radius();
+}
+
+void NativePhysicsPlugin::getBoxSizeToRef(const PhysicsImpostor& impostor,
+                                          Vector3& result)
+{
+  const auto id = _getBodyId(impostor);
+  if (id == NativePhysicsWorld::InvalidId) {
+    result.copyFromFloats(0.f, 0.f, 0.f);
+    return;
+  }
+  result.copyFrom(_world.shape(id).getHalfExtents().scale(2.f));
+}
+
+void NativePhysicsPlugin::syncMeshWithImpostor(AbstractMesh* mesh,
+                                               const PhysicsImpostor& impostor)
+{
+  const auto id = _getBodyId(impostor);
+  if (id == NativePhysicsWorld::InvalidId) {
+    return;
+  }
+  mesh->position = _world.position(id);
+  if (mesh->rotationQuaternion()) {
+    mesh->rotationQuaternion = _world.orientation(id);
+  }
+}
+
+void NativePhysicsPlugin::dispose()
+{
+  _joints.clear();
+  _bodies.clear();
+  _world.clear();
+  _accumulator = 0.f;
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,1023 @@
+#include <babylon/physics/plugins/native_physics_shape.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <set>
+
+namespace BABYLON {
+
+namespace {
+
+Vector3 ClosestPointOnSegment(const Vector3& point, const Vector3& a,
+                              const Vector3& b)
+{
+  const auto ab     = b - a;
+  const auto length = Vector3::Dot(ab, ab);
+  if (length <= std::numeric_limits<float>::epsilon()) {
+    return a;
+  }
+  const auto t = std::clamp(Vector3::Dot(point - a, ab) / length, 0.f, 1.f);
+  return a + ab * t;
+}
+
+/**
+ * @brief Closest points of two segments (Ericson, Real-Time Collision
+ * Detection, 5.1.9).
+ */
+void ClosestPointsOfSegments(const Vector3& p1, const Vector3& q1,
+                             const Vector3& p2, const Vector3& q2, Vector3& c1,
+                             Vector3& c2)
+{
+  constexpr float epsilon = 1e-12f;
+
+  const auto d1 = q1 - p1;
+  const auto d2 = q2 - p2;
+  const auto r  = p1 - p2;
+  const auto a  = Vector3::Dot(d1, d1);
+  const auto e  = Vector3::Dot(d2, d2);
+  const auto f  = Vector3::Dot(d2, r);
+
+  float s = 0.f, t = 0.f;
+  if (a <= epsilon && e <= epsilon) {
+    c1 = p1;
+    c2 = p2;
+    return;
+  }
+  if (a <= epsilon) {
+    t = std::clamp(f / e, 0.f, 1.f);
+  }
+  else {
+    const auto c = Vector3::Dot(d1, r);
+    if (e <= epsilon) {
+      s = std::clamp(-c / a, 0.f, 1.f);
+    }
+    else {
+      const auto b     = Vector3::Dot(d1, d2);
+      const auto denom = a * e - b * b;
+      s = denom > epsilon ? std::clamp((b * f - c * e) / denom, 0.f, 1.f) : 0.f;
+      t = (b * s + f) / e;
+      if (t < 0.f) {
+        t = 0.f;
+        s = std::clamp(-c / a, 0.f, 1.f);
+      }
+      else if (t > 1.f) {
+        t = 1.f;
+        s = std::clamp((b - c) / a, 0.f, 1.f);
+      }
+    }
+  }
+
+  c1 = p1 + d1 * s;
+  c2 = p2 + d2 * t;
+}
+
+/**
+ * @brief Closest point of a triangle (Ericson, Real-Time Collision Detection,
+ * 5.1.5).
+ */
+Vector3 ClosestPointOnTriangle(const Vector3& p, const Vector3& a,
+                               const Vector3& b, const Vector3& c)
+{
+  const auto ab = b - a;
+  const auto ac = c - a;
+  const auto ap = p - a;
+  const auto d1 = Vector3::Dot(ab, ap);
+  const auto d2 = Vector3::Dot(ac, ap);
+  if (d1 <= 0.f && d2 <= 0.f) {
+    return a;
+  }
+
+  const auto bp = p - b;
+  const auto d3 = Vector3::Dot(ab, bp);
+  const auto d4 = Vector3::Dot(ac, bp);
+  if (d3 >= 0.f && d4 <= d3) {
+    return b;
+  }
+
+  const auto vc = d1 * d4 - d3 * d2;
+  if (vc <= 0.f && d1 >= 0.f && d3 <= 0.f) {
+    return a + ab * (d1 / (d1 - d3));
+  }
+
+  const auto cp = p - c;
+  const auto d5 = Vector3::Dot(ab, cp);
+  const auto d6 = Vector3::Dot(ac, cp);
+  if (d6 >= 0.f && d5 <= d6) {
+    return c;
+  }
+
+  const auto vb = d5 * d2 - d1 * d6;
+  if (vb <= 0.f && d2 >= 0.f && d6 <= 0.f) {
+    return a + ac * (d2 / (d2 - d6));
+  }
+
+  const auto va = d3 * d6 - d5 * d4;
+  if (va <= 0.f && (d4 - d3) >= 0.f && (d5 - d6) >= 0.f) {
+    return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+  }
+
+  const auto denom = 1.f / (va + vb + vc);
+  return a + ab * (vb * denom) + ac * (vc * denom);
+}
+
+/**
+ * @brief Closest point of the surface of a hull to a point outside of it.
+ */
+Vector3 ClosestPointOnHull(const NativePhysicsShapeInstance& hull,
+                           const Vector3& point)
+{
+  auto bestDistance = std::numeric_limits<float>::max();
+  Vector3 best      = point;
+  for (const auto& face : hull.shape->faces()) {
+    const auto& a = hull.vertices[face.indices[0]];
+    for (size_t i = 1; i + 1 < face.indices.size(); ++i) {
+      const auto closest = ClosestPointOnTriangle(
+        point, a, hull.vertices[face.indices[i]],
+        hull.vertices[face.indices[i + 1]]);
+      const auto distance = (closest - point).lengthSquared();
+      if (distance < bestDistance) {
+        bestDistance = distance;
+        best         = closest;
+      }
+    }
+  }
+  return best;
+}
+
+Vector3 AnyPerpendicular(const Vector3& v)
+{
+  return std::abs(v.x) < 0.57735f ?
+           Vector3::Cross(v, Vector3(1.f, 0.f, 0.f)).normalize() :
+           Vector3::Cross(v, Vector3(0.f, 1.f, 0.f)).normalize();
+}
+
+void AddContact(std::vector<NativePhysicsContact>& contacts, size_t first,
+                const Vector3& point, const Vector3& normal, float depth,
+                float mergeDistance)
+{
+  for (auto i = first; i < contacts.size(); ++i) {
+    if ((contacts[i].point - point).lengthSquared()
+        < mergeDistance * mergeDistance) {
+      contacts[i].depth = std::max(contacts[i].depth, depth);
+      return;
+    }
+  }
+  contacts.emplace_back(NativePhysicsContact{point, normal, depth});
+}
+
+bool IsRounded(const NativePhysicsShapeInstance& instance)
+{
+  return instance.shape->type() != NativePhysicsShape::Type::ConvexHull;
+}
+
+void CollideRounded(const NativePhysicsShapeInstance& a,
+                    const NativePhysicsShapeInstance& b,
+                    std::vector<NativePhysicsContact>& contacts)
+{
+  const auto ra    = a.shape->radius();
+  const auto rb    = b.shape->radius();
+  const auto r     = ra + rb;
+  const auto first = contacts.size();
+
+  std::vector<std::pair<Vector3, Vector3>> candidates;
+  Vector3 ca, cb;
+  ClosestPointsOfSegments(a.coreStart, a.coreEnd, b.coreStart, b.coreEnd, ca,
+                          cb);
+  candidates.emplace_back(ca, cb);
+  // Capsules lying side by side touch along a segment: keep both ends
+  if (a.shape->type() == NativePhysicsShape::Type::Capsule) {
+    for (const auto& end : {a.coreStart, a.coreEnd}) {
+      candidates.emplace_back(
+        end, ClosestPointOnSegment(end, b.coreStart, b.coreEnd));
+    }
+  }
+  if (b.shape->type() == NativePhysicsShape::Type::Capsule) {
+    for (const auto& end : {b.coreStart, b.coreEnd}) {
+      candidates.emplace_back(
+        ClosestPointOnSegment(end, a.coreStart, a.coreEnd), end);
+    }
+  }
+
+  for (const auto& [pa, pb] : candidates) {
+    const auto delta    = pb - pa;
+    const auto distance = delta.length();
+    if (distance >= r) {
+      continue;
+    }
+    const auto normal = distance > 1e-6f ? delta / distance :
+                                           Vector3(0.f, 1.f, 0.f);
+    const auto depth = r - distance;
+    AddContact(contacts, first, pa + normal * (ra - depth * 0.5f), normal,
+               depth, 0.01f * r);
+  }
+}
+
+void CollideRoundedWithHull(const NativePhysicsShapeInstance& core,
+                            const NativePhysicsShapeInstance& hull,
+                            bool coreIsFirst,
+                            std::vector<NativePhysicsContact>& contacts)
+{
+  const auto radius = core.shape->radius();
+  const auto first  = contacts.size();
+  const auto isCapsule
+    = core.shape->type() == NativePhysicsShape::Type::Capsule;
+  std::vector<Vector3> ends{core.coreStart};
+  if (isCapsule) {
+    ends.emplace_back(core.coreEnd);
+  }
+
+  // Normals computed from the hull to the core
+  const auto emit = [&](const Vector3& point, const Vector3& normal,
+                        float depth) {
+    AddContact(contacts, first, point, coreIsFirst ? -normal : normal, depth,
+               0.01f * radius);
+  };
+
+  // Separating axis test on the hull faces
+  auto maxSeparation = -std::numeric_limits<float>::max();
+  size_t bestFace    = 0;
+  for (size_t f = 0; f < hull.normals.size(); ++f) {
+    auto separation = std::numeric_limits<float>::max();
+    for (const auto& end : ends) {
+      separation = std::min(
+        separation, Vector3::Dot(hull.normals[f], end) - hull.offsets[f]);
+    }
+    if (separation > radius) {
+      return;
+    }
+    if (separation > maxSeparation) {
+      maxSeparation = separation;
+      bestFace      = f;
+    }
+  }
+
+  if (maxSeparation <= 0.f) {
+    // The core is inside the hull, push it out through the closest face
+    const auto& normal = hull.normals[bestFace];
+    for (const auto& end : ends) {
+      const auto separation
+        = Vector3::Dot(normal, end) - hull.offsets[bestFace];
+      if (separation < radius) {
+        emit(end - normal * ((radius + separation) * 0.5f), normal,
+             radius - separation);
+      }
+    }
+    return;
+  }
+
+  // The core is outside the hull
+  for (const auto& end : ends) {
+    const auto hullPoint = ClosestPointOnHull(hull, end);
+    const auto delta     = end - hullPoint;
+    const auto distance  = delta.length();
+    if (distance < radius && distance > 1e-6f) {
+      const auto normal = delta / distance;
+      emit((hullPoint + end - normal * radius) * 0.5f, normal,
+           radius - distance);
+    }
+  }
+
+  if (isCapsule && contacts.size() == first) {
+    // Segment crossing an edge of the hull
+    auto bestDistance = std::numeric_limits<float>::max();
+    Vector3 bestCore, bestHull;
+    for (const auto& [i, j] : hull.shape->edges()) {
+      Vector3 c, h;
+      ClosestPointsOfSegments(core.coreStart, core.coreEnd, hull.vertices[i],
+                              hull.vertices[j], c, h);
+      const auto distance = (c - h).lengthSquared();
+      if (distance < bestDistance) {
+        bestDistance = distance;
+        bestCore     = c;
+        bestHull     = h;
+      }
+    }
+    const auto distance = std::sqrt(bestDistance);
+    if (distance < radius && distance > 1e-6f) {
+      const auto normal = (bestCore - bestHull) / distance;
+      emit((bestHull + bestCore - normal * radius) * 0.5f, normal,
+           radius - distance);
+    }
+  }
+}
+
+float Support(const std::vector<Vector3>& vertices, const Vector3& axis,
+              bool maximum)
+{
+  auto result = maximum ? -std::numeric_limits<float>::max() :
+                          std::numeric_limits<float>::max();
+  for (const auto& vertex : vertices) {
+    const auto d = Vector3::Dot(vertex, axis);
+    result       = maximum ? std::max(result, d) : std::min(result, d);
+  }
+  return result;
+}
+
+struct FaceQuery {
+  float separation = -std::numeric_limits<float>::max();
+  size_t face      = 0;
+}; // end of struct FaceQuery
+
+FaceQuery QueryFaces(const NativePhysicsShapeInstance& a,
+                     const NativePhysicsShapeInstance& b)
+{
+  FaceQuery query;
+  for (size_t f = 0; f < a.normals.size(); ++f) {
+    const auto separation
+      = Support(b.vertices, a.normals[f], false) - a.offsets[f];
+    if (separation > query.separation) {
+      query.separation = separation;
+      query.face       = f;
+      if (separation > 0.f) {
+        break;
+      }
+    }
+  }
+  return query;
+}
+
+void ClipPolygon(std::vector<Vector3>& polygon, const Vector3& normal,
+                 float offset, std::vector<Vector3>& scratch)
+{
+  scratch.clear();
+  for (size_t i = 0; i < polygon.size(); ++i) {
+    const auto& p  = polygon[i];
+    const auto& q  = polygon[(i + 1) % polygon.size()];
+    const auto dp  = Vector3::Dot(normal, p) - offset;
+    const auto dq  = Vector3::Dot(normal, q) - offset;
+    const auto pIn = dp <= 0.f;
+    const auto qIn = dq <= 0.f;
+    if (pIn) {
+      scratch.emplace_back(p);
+    }
+    if (pIn != qIn) {
+      scratch.emplace_back(p + (q - p) * (dp / (dp - dq)));
+    }
+  }
+  polygon.swap(scratch);
+}
+
+void CollideHulls(const NativePhysicsShapeInstance& a,
+                  const NativePhysicsShapeInstance& b,
+                  std::vector<NativePhysicsContact>& contacts)
+{
+  const auto faceA = QueryFaces(a, b);
+  if (faceA.separation > 0.f) {
+    return;
+  }
+  const auto faceB = QueryFaces(b, a);
+  if (faceB.separation > 0.f) {
+    return;
+  }
+
+  // Edge pairs
+  const auto centerDelta  = b.position - a.position;
+  auto edgeSeparation     = -std::numeric_limits<float>::max();
+  Vector3 edgeAxis;
+  const auto& edgesA = a.shape->edges();
+  const auto& edgesB = b.shape->edges();
+  for (const auto& [ia, ja] : edgesA) {
+    const auto directionA = a.vertices[ja] - a.vertices[ia];
+    for (const auto& [ib, jb] : edgesB) {
+      auto axis = Vector3::Cross(directionA, b.vertices[jb] - b.vertices[ib]);
+      const auto length = axis.length();
+      if (length < 1e-5f * directionA.length()) {
+        continue;
+      }
+      axis /= length;
+      if (Vector3::Dot(axis, centerDelta) < 0.f) {
+        axis = -axis;
+      }
+      const auto separation
+        = Support(b.vertices, axis, false) - Support(a.vertices, axis, true);
+      if (separation > 0.f) {
+        return;
+      }
+      if (separation > edgeSeparation) {
+        edgeSeparation = separation;
+        edgeAxis       = axis;
+      }
+    }
+  }
+
+  // Faces are preferred to get stable manifolds
+  constexpr float tolerance = 0.005f;
+  const auto faceSeparation = std::max(faceA.separation, faceB.separation);
+  if (edgeSeparation > faceSeparation + tolerance) {
+    // Closest points of the supporting edges
+    auto bestA = -std::numeric_limits<float>::max();
+    auto bestB = std::numeric_limits<float>::max();
+    std::pair<size_t, size_t> supportA, supportB;
+    for (const auto& edge : edgesA) {
+      const auto d = std::min(Vector3::Dot(a.vertices[edge.first], edgeAxis),
+                              Vector3::Dot(a.vertices[edge.second], edgeAxis));
+      if (d > bestA) {
+        bestA    = d;
+        supportA = edge;
+      }
+    }
+    for (const auto& edge : edgesB) {
+      const auto d = std::max(Vector3::Dot(b.vertices[edge.first], edgeAxis),
+                              Vector3::Dot(b.vertices[edge.second], edgeAxis));
+      if (d < bestB) {
+        bestB    = d;
+        supportB = edge;
+      }
+    }
+    Vector3 pa, pb;
+    ClosestPointsOfSegments(
+      a.vertices[supportA.first], a.vertices[supportA.second],
+      b.vertices[supportB.first], b.vertices[supportB.second], pa, pb);
+    contacts.emplace_back(
+      NativePhysicsContact{(pa + pb) * 0.5f, edgeAxis, -edgeSeparation});
+    return;
+  }
+
+  // Reference face clipping
+  const auto referenceIsA = faceA.separation + tolerance >= faceB.separation;
+  const auto& reference   = referenceIsA ? a : b;
+  const auto& incident    = referenceIsA ? b : a;
+  const auto face         = referenceIsA ? faceA.face : faceB.face;
+  const auto& normal      = reference.normals[face];
+  const auto offset       = reference.offsets[face];
+
+  size_t incidentFace = 0;
+  auto minDot         = std::numeric_limits<float>::max();
+  for (size_t f = 0; f < incident.normals.size(); ++f) {
+    const auto d = Vector3::Dot(incident.normals[f], normal);
+    if (d < minDot) {
+      minDot       = d;
+      incidentFace = f;
+    }
+  }
+
+  std::vector<Vector3> polygon, scratch;
+  for (auto index : incident.shape->faces()[incidentFace].indices) {
+    polygon.emplace_back(incident.vertices[index]);
+  }
+  const auto& indices = reference.shape->faces()[face].indices;
+  for (size_t i = 0; i < indices.size() && !polygon.empty(); ++i) {
+    const auto& p = reference.vertices[indices[i]];
+    const auto& q = reference.vertices[indices[(i + 1) % indices.size()]];
+    const auto sideNormal = Vector3::Cross(q - p, normal).normalize();
+    ClipPolygon(polygon, sideNormal, Vector3::Dot(sideNormal, p), scratch);
+  }
+
+  std::vector<NativePhysicsContact> clipped;
+  for (const auto& point : polygon) {
+    const auto separation = Vector3::Dot(normal, point) - offset;
+    if (separation <= 0.f) {
+      clipped.emplace_back(NativePhysicsContact{
+        point - normal * (separation * 0.5f),
+        referenceIsA ? normal : -normal, -separation});
+    }
+  }
+
+  // Keep at most 4 points: the extremes along two axes of the reference face
+  if (clipped.size() > 4) {
+    const auto u = AnyPerpendicular(normal);
+    const auto v = Vector3::Cross(normal, u);
+    std::array<size_t, 4> extremes{0, 0, 0, 0};
+    for (size_t i = 1; i < clipped.size(); ++i) {
+      const auto du = Vector3::Dot(clipped[i].point, u);
+      const auto dv = Vector3::Dot(clipped[i].point, v);
+      if (du < Vector3::Dot(clipped[extremes[0]].point, u)) {
+        extremes[0] = i;
+      }
+      if (du > Vector3::Dot(clipped[extremes[1]].point, u)) {
+        extremes[1] = i;
+      }
+      if (dv < Vector3::Dot(clipped[extremes[2]].point, v)) {
+        extremes[2] = i;
+      }
+      if (dv > Vector3::Dot(clipped[extremes[3]].point, v)) {
+        extremes[3] = i;
+      }
+    }
+    const auto first = contacts.size();
+    for (auto i : extremes) {
+      AddContact(contacts, first, clipped[i].point, clipped[i].normal,
+                 clipped[i].depth, 1e-4f);
+    }
+    return;
+  }
+
+  contacts.insert(contacts.end(), clipped.begin(), clipped.end());
+}
+
+} // end of anonymous namespace
+
+NativePhysicsShape::NativePhysicsShape()
+    : _type{Type::Sphere}, _radius{0.5f}, _halfHeight{0.f}
+{
+}
+
+NativePhysicsShape::~NativePhysicsShape() = default;
+
+NativePhysicsShape NativePhysicsShape::Sphere(float radius)
+{
+  NativePhysicsShape shape;
+  shape._type   = Type::Sphere;
+  shape._radius = radius;
+  return shape;
+}
+
+NativePhysicsShape NativePhysicsShape::Capsule(float radius, float halfHeight)
+{
+  NativePhysicsShape shape;
+  shape._type       = Type::Capsule;
+  shape._radius     = radius;
+  shape._halfHeight = halfHeight;
+  return shape;
+}
+
+NativePhysicsShape NativePhysicsShape::Box(const Vector3& halfExtents)
+{
+  std::vector<Vector3> corners;
+  for (auto x : {-1.f, 1.f}) {
+    for (auto y : {-1.f, 1.f}) {
+      for (auto z : {-1.f, 1.f}) {
+        corners.emplace_back(halfExtents.x * x, halfExtents.y * y,
+                             halfExtents.z * z);
+      }
+    }
+  }
+  return ConvexHull(corners);
+}
+
+NativePhysicsShape NativePhysicsShape::ConvexHull(
+  const std::vector<Vector3>& points)
+{
+  NativePhysicsShape shape;
+  shape._type   = Type::ConvexHull;
+  shape._radius = 0.f;
+  if (points.empty()) {
+    return Box(Vector3(0.5f, 0.5f, 0.5f));
+  }
+
+  auto minimum = points[0], maximum = points[0];
+  for (const auto& point : points) {
+    minimum = Vector3::Minimize(minimum, point);
+    maximum = Vector3::Maximize(maximum, point);
+  }
+  const auto extent  = maximum - minimum;
+  const auto scale   = std::max({extent.x, extent.y, extent.z, 1e-3f});
+  const auto epsilon = 1e-5f * scale;
+
+  const auto boundingBox = [&]() {
+    const auto thickness = 0.01f * scale;
+    const Vector3 margin(thickness, thickness, thickness);
+    const auto low = minimum - margin, high = maximum + margin;
+    return ConvexHull({{low.x, low.y, low.z},
+                       {high.x, low.y, low.z},
+                       {low.x, high.y, low.z},
+                       {high.x, high.y, low.z},
+                       {low.x, low.y, high.z},
+                       {high.x, low.y, high.z},
+                       {low.x, high.y, high.z},
+                       {high.x, high.y, high.z}});
+  };
+
+  // Initial tetrahedron from extreme points
+  size_t i0 = 0;
+  for (size_t i = 1; i < points.size(); ++i) {
+    if (points[i].x < points[i0].x) {
+      i0 = i;
+    }
+  }
+  const auto farthest = [&](auto&& f) {
+    size_t best       = 0;
+    auto bestDistance = -1.f;
+    for (size_t i = 0; i < points.size(); ++i) {
+      const auto distance = f(points[i]);
+      if (distance > bestDistance) {
+        bestDistance = distance;
+        best         = i;
+      }
+    }
+    return std::make_pair(best, bestDistance);
+  };
+  const auto& p0 = points[i0];
+  const auto [i1, d1]
+    = farthest([&](const Vector3& p) { return (p - p0).length(); });
+  if (d1 < epsilon) {
+    return boundingBox();
+  }
+  const auto& p1       = points[i1];
+  const auto direction = (p1 - p0).normalizeToNew();
+  const auto [i2, d2]  = farthest([&](const Vector3& p) {
+    return Vector3::Cross(p - p0, direction).length();
+  });
+  if (d2 < epsilon) {
+    return boundingBox();
+  }
+  const auto& p2 = points[i2];
+  const auto planeNormal
+    = Vector3::Cross(p1 - p0, p2 - p0).normalizeToNew();
+  const auto [i3, d3] = farthest([&](const Vector3& p) {
+    return std::abs(Vector3::Dot(p - p0, planeNormal));
+  });
+  if (d3 < epsilon) {
+    return boundingBox();
+  }
+
+  struct Triangle {
+    std::array<size_t, 3> v;
+    Vector3 normal;
+    float offset;
+    bool alive;
+  }; // end of struct Triangle
+  std::vector<Triangle> triangles;
+  const auto interior
+    = (points[i0] + points[i1] + points[i2] + points[i3]) * 0.25f;
+  const auto addTriangle = [&](size_t a, size_t b, size_t c, bool orient) {
+    auto normal
+      = Vector3::Cross(points[b] - points[a], points[c] - points[a]);
+    normal.normalize();
+    if (orient && Vector3::Dot(normal, points[a] - interior) < 0.f) {
+      std::swap(b, c);
+      normal = -normal;
+    }
+    triangles.emplace_back(
+      Triangle{{a, b, c}, normal, Vector3::Dot(normal, points[a]), true});
+  };
+  addTriangle(i0, i1, i2, true);
+  addTriangle(i0, i1, i3, true);
+  addTriangle(i0, i2, i3, true);
+  addTriangle(i1, i2, i3, true);
+
+  // Incremental hull: replace the faces visible from each outside point
+  std::set<std::pair<size_t, size_t>> visibleEdges;
+  for (size_t p = 0; p < points.size(); ++p) {
+    if (p == i0 || p == i1 || p == i2 || p == i3) {
+      continue;
+    }
+    visibleEdges.clear();
+    for (auto& triangle : triangles) {
+      if (triangle.alive
+          && Vector3::Dot(triangle.normal, points[p]) - triangle.offset
+               > epsilon) {
+        triangle.alive = false;
+        for (size_t e = 0; e < 3; ++e) {
+          visibleEdges.emplace(triangle.v[e], triangle.v[(e + 1) % 3]);
+        }
+      }
+    }
+    for (const auto& [a, b] : visibleEdges) {
+      if (!visibleEdges.count({b, a})) {
+        addTriangle(a, b, p, false);
+      }
+    }
+    triangles.erase(std::remove_if(triangles.begin(), triangles.end(),
+                                   [](const Triangle& triangle) {
+                                     return !triangle.alive;
+                                   }),
+                    triangles.end());
+  }
+
+  // Keep the hull vertices only
+  std::vector<size_t> remap(points.size(), std::numeric_limits<size_t>::max());
+  std::vector<std::array<size_t, 3>> hullTriangles;
+  for (const auto& triangle : triangles) {
+    std::array<size_t, 3> indices;
+    for (size_t e = 0; e < 3; ++e) {
+      auto& index = remap[triangle.v[e]];
+      if (index == std::numeric_limits<size_t>::max()) {
+        index = shape._vertices.size();
+        shape._vertices.emplace_back(points[triangle.v[e]]);
+      }
+      indices[e] = index;
+    }
+    hullTriangles.emplace_back(indices);
+  }
+
+  shape._mergeCoplanarFaces(hullTriangles);
+  return shape;
+}
+
+void NativePhysicsShape::_mergeCoplanarFaces(
+  const std::vector<std::array<size_t, 3>>& triangles)
+{
+  std::vector<Vector3> normals;
+  for (const auto& t : triangles) {
+    normals.emplace_back(Vector3::Cross(_vertices[t[1]] - _vertices[t[0]],
+                                        _vertices[t[2]] - _vertices[t[0]])
+                           .normalize());
+  }
+
+  auto scale = 0.f;
+  for (const auto& vertex : _vertices) {
+    scale = std::max(scale, vertex.length());
+  }
+  const auto planeTolerance = 1e-4f * std::max(scale, 1e-3f);
+
+  std::vector<bool> merged(triangles.size(), false);
+  std::set<std::pair<size_t, size_t>> edges;
+  for (size_t i = 0; i < triangles.size(); ++i) {
+    if (merged[i]) {
+      continue;
+    }
+    const auto offset = Vector3::Dot(normals[i], _vertices[triangles[i][0]]);
+
+    // On a convex hull, the coplanar triangles belong to the same face
+    Vector3 normal;
+    std::vector<size_t> indices;
+    for (auto j = i; j < triangles.size(); ++j) {
+      if (merged[j] || Vector3::Dot(normals[i], normals[j]) < 0.9999f
+          || std::abs(Vector3::Dot(normals[i], _vertices[triangles[j][0]])
+                      - offset)
+               > planeTolerance) {
+        continue;
+      }
+      merged[j] = true;
+      normal += normals[j];
+      for (auto index : triangles[j]) {
+        if (std::find(indices.begin(), indices.end(), index) == indices.end()) {
+          indices.emplace_back(index);
+        }
+      }
+    }
+    normal.normalize();
+
+    // Counter clockwise order around the face normal
+    Vector3 center;
+    for (auto index : indices) {
+      center += _vertices[index];
+    }
+    center /= static_cast<float>(indices.size());
+    const auto u = (_vertices[indices[0]] - center).normalizeToNew();
+    const auto v = Vector3::Cross(normal, u);
+    std::sort(indices.begin(), indices.end(), [&](size_t a, size_t b) {
+      const auto da = _vertices[a] - center;
+      const auto db = _vertices[b] - center;
+      return std::atan2(Vector3::Dot(da, v), Vector3::Dot(da, u))
+             < std::atan2(Vector3::Dot(db, v), Vector3::Dot(db, u));
+    });
+
+    auto faceOffset = 0.f;
+    for (auto index : indices) {
+      faceOffset += Vector3::Dot(normal, _vertices[index]);
+    }
+    faceOffset /= static_cast<float>(indices.size());
+
+    for (size_t e = 0; e < indices.size(); ++e) {
+      const auto a = indices[e];
+      const auto b = indices[(e + 1) % indices.size()];
+      edges.emplace(std::min(a, b), std::max(a, b));
+    }
+    _faces.emplace_back(NativePhysicsFace{normal, faceOffset, indices});
+  }
+
+  _edges.assign(edges.begin(), edges.end());
+}
+
+NativePhysicsShape::Type NativePhysicsShape::type() const
+{
+  return _type;
+}
+
+float NativePhysicsShape::radius() const
+{
+  return _radius;
+}
+
+float NativePhysicsShape::halfHeight() const
+{
+  return _halfHeight;
+}
+
+const std::vector<Vector3>& NativePhysicsShape::vertices() const
+{
+  return _vertices;
+}
+
+const std::vector<NativePhysicsFace>& NativePhysicsShape::faces() const
+{
+  return _faces;
+}
+
+const std::vector<std::pair<size_t, size_t>>& NativePhysicsShape::edges() const
+{
+  return _edges;
+}
+
+Vector3 NativePhysicsShape::getHalfExtents() const
+{
+  switch (_type) {
+    case Type::Sphere:
+      return Vector3(_radius, _radius, _radius);
+    case Type::Capsule:
+      return Vector3(_radius, _halfHeight + _radius, _radius);
+    case Type::ConvexHull:
+    default: {
+      Vector3 extents;
+      for (const auto& vertex : _vertices) {
+        extents = Vector3::Maximize(
+          extents,
+          Vector3(std::abs(vertex.x), std::abs(vertex.y), std::abs(vertex.z)));
+      }
+      return extents;
+    }
+  }
+}
+
+Vector3 NativePhysicsShape::computeInertia(float mass) const
+{
+  switch (_type) {
+    case Type::Sphere: {
+      const auto i = 0.4f * mass * _radius * _radius;
+      return Vector3(i, i, i);
+    }
+    case Type::Capsule: {
+      const auto height = 2.f * (_halfHeight + _radius);
+      const auto r2     = _radius * _radius;
+      const auto side   = mass * (3.f * r2 + height * height) / 12.f;
+      return Vector3(side, 0.5f * mass * r2, side);
+    }
+    case Type::ConvexHull:
+    default: {
+      const auto e = getHalfExtents();
+      return Vector3(mass * (e.y * e.y + e.z * e.z) / 3.f,
+                     mass * (e.x * e.x + e.z * e.z) / 3.f,
+                     mass * (e.x * e.x + e.y * e.y) / 3.f);
+    }
+  }
+}
+
+namespace {
+
+bool RaycastSphere(const Vector3& origin, const Vector3& direction,
+                   const Vector3& center, float radius, float& distance,
+                   Vector3& normal)
+{
+  const auto m = origin - center;
+  const auto b = Vector3::Dot(m, direction);
+  const auto c = Vector3::Dot(m, m) - radius * radius;
+  if (c > 0.f && b > 0.f) {
+    return false;
+  }
+  const auto discriminant = b * b - c;
+  if (discriminant < 0.f) {
+    return false;
+  }
+  distance = std::max(0.f, -b - std::sqrt(discriminant));
+  normal   = c <= 0.f ? -direction :
+                      (origin + direction * distance - center).normalize();
+  return true;
+}
+
+} // end of anonymous namespace
+
+bool NativePhysicsShape::raycast(const Vector3& origin,
+                                 const Vector3& direction, float maxDistance,
+                                 float& distance, Vector3& normal) const
+{
+  switch (_type) {
+    case Type::Sphere:
+      return RaycastSphere(origin, direction, Vector3::Zero(), _radius,
+                           distance, normal)
+             && distance <= maxDistance;
+    case Type::Capsule: {
+      auto hit = false;
+      distance = maxDistance;
+      float t;
+      Vector3 n;
+      for (auto y : {-_halfHeight, _halfHeight}) {
+        if (RaycastSphere(origin, direction, Vector3(0.f, y, 0.f), _radius, t,
+                          n)
+            && t <= distance) {
+          hit      = true;
+          distance = t;
+          normal   = n;
+        }
+      }
+      // Cylinder around the core segment
+      const auto a = direction.x * direction.x + direction.z * direction.z;
+      if (a > 1e-8f) {
+        const auto b = origin.x * direction.x + origin.z * direction.z;
+        const auto c
+          = origin.x * origin.x + origin.z * origin.z - _radius * _radius;
+        const auto discriminant = b * b - a * c;
+        if (discriminant >= 0.f) {
+          t = (-b - std::sqrt(discriminant)) / a;
+          const auto y = origin.y + direction.y * t;
+          if (t >= 0.f && t <= distance && std::abs(y) <= _halfHeight) {
+            hit      = true;
+            distance = t;
+            const auto x = origin.x + direction.x * t;
+            const auto z = origin.z + direction.z * t;
+            normal       = Vector3(x, 0.f, z).normalize();
+          }
+        }
+      }
+      return hit;
+    }
+    case Type::ConvexHull:
+    default: {
+      auto enter = 0.f, exit = maxDistance;
+      auto entered = false;
+      for (const auto& face : _faces) {
+        const auto denominator = Vector3::Dot(face.normal, direction);
+        const auto separation
+          = Vector3::Dot(face.normal, origin) - face.offset;
+        if (std::abs(denominator) < 1e-8f) {
+          if (separation > 0.f) {
+            return false;
+          }
+          continue;
+        }
+        const auto t = -separation / denominator;
+        if (denominator < 0.f) {
+          if (t > enter) {
+            enter   = t;
+            normal  = face.normal;
+            entered = true;
+          }
+        }
+        else {
+          exit = std::min(exit, t);
+        }
+        if (enter > exit) {
+          return false;
+        }
+      }
+      distance = enter;
+      if (!entered) {
+        normal = -direction;
+      }
+      return true;
+    }
+  }
+}
+
+void NativePhysicsShapeInstance::update(const NativePhysicsShape& iShape,
+                                        const Vector3& iPosition,
+                                        const Quaternion& iOrientation)
+{
+  shape       = &iShape;
+  position    = iPosition;
+  orientation = iOrientation;
+
+  if (iShape.type() != NativePhysicsShape::Type::ConvexHull) {
+    const auto axis
+      = Rotate(orientation, Vector3(0.f, iShape.halfHeight(), 0.f));
+    const auto radius = iShape.radius();
+    const Vector3 inflate(radius, radius, radius);
+    coreStart = position - axis;
+    coreEnd   = position + axis;
+    minimum   = Vector3::Minimize(coreStart, coreEnd) - inflate;
+    maximum   = Vector3::Maximize(coreStart, coreEnd) + inflate;
+    return;
+  }
+
+  const auto& localVertices = iShape.vertices();
+  const auto& faces         = iShape.faces();
+  vertices.resize(localVertices.size());
+  normals.resize(faces.size());
+  offsets.resize(faces.size());
+  for (size_t i = 0; i < localVertices.size(); ++i) {
+    vertices[i] = position + Rotate(orientation, localVertices[i]);
+    if (i == 0) {
+      minimum = maximum = vertices[i];
+      continue;
+    }
+    minimum = Vector3::Minimize(minimum, vertices[i]);
+    maximum = Vector3::Maximize(maximum, vertices[i]);
+  }
+  for (size_t f = 0; f < faces.size(); ++f) {
+    normals[f] = Rotate(orientation, faces[f].normal);
+    offsets[f] = faces[f].offset + Vector3::Dot(normals[f], position);
+  }
+}
+
+Vector3 NativePhysicsShapeInstance::Rotate(const Quaternion& q,
+                                           const Vector3& v)
+{
+  // v + 2w (q x v) + 2 q x (q x v)
+  const Vector3 qv(q.x, q.y, q.z);
+  const auto t = Vector3::Cross(qv, v) * 2.f;
+  return v + t * q.w + Vector3::Cross(qv, t);
+}
+
+void NativePhysicsShapeInstance::Collide(
+  const NativePhysicsShapeInstance& a, const NativePhysicsShapeInstance& b,
+  std::vector<NativePhysicsContact>& contacts)
+{
+  const auto roundedA = IsRounded(a);
+  const auto roundedB = IsRounded(b);
+  if (roundedA && roundedB) {
+    CollideRounded(a, b, contacts);
+  }
+  else if (roundedA) {
+    CollideRoundedWithHull(a, b, true, contacts);
+  }
+  else if (roundedB) {
+    CollideRoundedWithHull(b, a, false, contacts);
+  }
+  else {
+    CollideHulls(a, b, contacts);
+  }
+}
+
+} // end of namespace BABYLON
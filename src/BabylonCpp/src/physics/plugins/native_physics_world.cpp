@@ -0,0 +1,1194 @@
+#include <babylon/physics/plugins/native_physics_world.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <numeric>
+
+#include <babylon/core/thread_pool.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Baumgarte stabilization factor and allowed penetration
+constexpr float BAUMGARTE   = 0.2f;
+constexpr float LINEAR_SLOP = 0.005f;
+// Closing speed above which the restitution applies
+constexpr float RESTITUTION_THRESHOLD = 1.f;
+// Fattening of the bounding boxes of the broadphase
+constexpr float AABB_MARGIN = 0.02f;
+// Distance under which a contact point inherits the previous step impulses
+constexpr float WARM_START_DISTANCE = 0.05f;
+// Squared velocities and duration under which an island falls asleep
+constexpr float SLEEP_LINEAR_VELOCITY  = 0.01f;
+constexpr float SLEEP_ANGULAR_VELOCITY = 0.01f;
+constexpr float TIME_TO_SLEEP          = 0.5f;
+// Number of pairs collided and islands solved per worker task
+constexpr size_t PAIRS_GRAIN_SIZE   = 64;
+constexpr size_t ISLANDS_GRAIN_SIZE = 1;
+
+Vector3 RotateVector(const Quaternion& rotation, const Vector3& vector)
+{
+  return NativePhysicsShapeInstance::Rotate(rotation, vector);
+}
+
+/**
+ * @brief 3x3 matrix used for the inertia tensors and the joint masses.
+ */
+struct Matrix3 {
+  std::array<float, 9> m{};
+
+  static Matrix3 Diagonal(const Vector3& d)
+  {
+    Matrix3 result;
+    result.m[0] = d.x;
+    result.m[4] = d.y;
+    result.m[8] = d.z;
+    return result;
+  }
+
+  static Matrix3 Skew(const Vector3& v)
+  {
+    Matrix3 result;
+    result.m = {0.f, -v.z, v.y, v.z, 0.f, -v.x, -v.y, v.x, 0.f};
+    return result;
+  }
+
+  static Matrix3 FromQuaternion(const Quaternion& q)
+  {
+    const auto xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+    const auto xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+    const auto wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+    Matrix3 result;
+    result.m = {1.f - 2.f * (yy + zz), 2.f * (xy - wz),
+                2.f * (xz + wy),       2.f * (xy + wz),
+                1.f - 2.f * (xx + zz), 2.f * (yz - wx),
+                2.f * (xz - wy),       2.f * (yz + wx),
+                1.f - 2.f * (xx + yy)};
+    return result;
+  }
+
+  Matrix3 transpose() const
+  {
+    Matrix3 result;
+    for (size_t r = 0; r < 3; ++r) {
+      for (size_t c = 0; c < 3; ++c) {
+        result.m[c * 3 + r] = m[r * 3 + c];
+      }
+    }
+    return result;
+  }
+
+  Matrix3 inverse() const
+  {
+    const auto c0 = m[4] * m[8] - m[5] * m[7];
+    const auto c1 = m[5] * m[6] - m[3] * m[8];
+    const auto c2 = m[3] * m[7] - m[4] * m[6];
+    const auto determinant = m[0] * c0 + m[1] * c1 + m[2] * c2;
+    Matrix3 result;
+    if (std::abs(determinant) < 1e-12f) {
+      return result;
+    }
+    const auto i = 1.f / determinant;
+    result.m     = {c0 * i,
+                (m[2] * m[7] - m[1] * m[8]) * i,
+                (m[1] * m[5] - m[2] * m[4]) * i,
+                c1 * i,
+                (m[0] * m[8] - m[2] * m[6]) * i,
+                (m[2] * m[3] - m[0] * m[5]) * i,
+                c2 * i,
+                (m[1] * m[6] - m[0] * m[7]) * i,
+                (m[0] * m[4] - m[1] * m[3]) * i};
+    return result;
+  }
+
+  Matrix3 operator*(const Matrix3& other) const
+  {
+    Matrix3 result;
+    for (size_t r = 0; r < 3; ++r) {
+      for (size_t c = 0; c < 3; ++c) {
+        result.m[r * 3 + c] = m[r * 3] * other.m[c]
+                              + m[r * 3 + 1] * other.m[3 + c]
+                              + m[r * 3 + 2] * other.m[6 + c];
+      }
+    }
+    return result;
+  }
+
+  Matrix3 operator-(const Matrix3& other) const
+  {
+    Matrix3 result;
+    for (size_t i = 0; i < 9; ++i) {
+      result.m[i] = m[i] - other.m[i];
+    }
+    return result;
+  }
+
+  Vector3 operator*(const Vector3& v) const
+  {
+    return Vector3(m[0] * v.x + m[1] * v.y + m[2] * v.z,
+                   m[3] * v.x + m[4] * v.y + m[5] * v.z,
+                   m[6] * v.x + m[7] * v.y + m[8] * v.z);
+  }
+}; // end of struct Matrix3
+
+Vector3 AnyPerpendicular(const Vector3& v)
+{
+  return std::abs(v.x) < 0.57735f ?
+           Vector3::Cross(v, Vector3(1.f, 0.f, 0.f)).normalize() :
+           Vector3::Cross(v, Vector3(0.f, 1.f, 0.f)).normalize();
+}
+
+} // end of anonymous namespace
+
+struct NativePhysicsWorld::Body {
+  // Allocated separately so that the instance pointer survives the storage
+  // reallocations
+  std::unique_ptr<NativePhysicsShape> shape;
+  NativePhysicsShapeInstance instance;
+  Vector3 position;
+  Quaternion orientation;
+  Vector3 linearVelocity;
+  Vector3 angularVelocity;
+  Vector3 force;
+  Vector3 torque;
+  float mass        = 0.f;
+  float inverseMass = 0.f;
+  // Local diagonal and world inverse inertia tensors
+  Vector3 inverseInertia;
+  Matrix3 inverseInertiaWorld;
+  float friction    = 0.2f;
+  float restitution = 0.2f;
+  bool alive        = false;
+  bool sleeping     = false;
+  float sleepTime   = 0.f;
+  size_t island     = InvalidId;
+}; // end of struct NativePhysicsWorld::Body
+
+struct NativePhysicsWorld::Joint {
+  BodyId bodyA   = InvalidId;
+  BodyId bodyB   = InvalidId;
+  bool collision = false;
+  bool alive     = false;
+  // Ball and socket constraints, as pairs of local anchors
+  std::vector<std::pair<Vector3, Vector3>> anchors;
+  std::vector<Vector3> impulses;
+  // Distance constraint, when the range is valid
+  bool isDistance       = false;
+  float minDistance     = 0.f;
+  float maxDistance     = 0.f;
+  float distanceImpulse = 0.f;
+}; // end of struct NativePhysicsWorld::Joint
+
+struct NativePhysicsWorld::ContactPoint {
+  Vector3 point;
+  float depth = 0.f;
+  Vector3 rA;
+  Vector3 rB;
+  std::array<Vector3, 2> tangents;
+  float normalMass = 0.f;
+  std::array<float, 2> tangentMasses{};
+  float bias          = 0.f;
+  float normalImpulse = 0.f;
+  std::array<float, 2> tangentImpulses{};
+}; // end of struct NativePhysicsWorld::ContactPoint
+
+struct NativePhysicsWorld::Manifold {
+  BodyId bodyA = InvalidId;
+  BodyId bodyB = InvalidId;
+  Vector3 normal;
+  float friction    = 0.f;
+  float restitution = 0.f;
+  std::vector<ContactPoint> points;
+}; // end of struct NativePhysicsWorld::Manifold
+
+struct NativePhysicsWorld::Island {
+  std::vector<BodyId> bodies;
+  std::vector<size_t> manifolds;
+  std::vector<JointId> joints;
+  bool sleeping = false;
+}; // end of struct NativePhysicsWorld::Island
+
+NativePhysicsWorld::NativePhysicsWorld()
+    : solverIterations{10}
+    , parallelIslands{true}
+    , allowSleep{true}
+    , _gravity{0.f, -9.807f, 0.f}
+    , _contactCount{0}
+{
+}
+
+NativePhysicsWorld::~NativePhysicsWorld() = default;
+
+void NativePhysicsWorld::setGravity(const Vector3& gravity)
+{
+  _gravity = gravity;
+  for (auto& body : _bodies) {
+    body.sleeping  = false;
+    body.sleepTime = 0.f;
+  }
+}
+
+const Vector3& NativePhysicsWorld::gravity() const
+{
+  return _gravity;
+}
+
+void NativePhysicsWorld::clear()
+{
+  _bodies.clear();
+  _freeBodies.clear();
+  _joints.clear();
+  _freeJoints.clear();
+  _ignoredPairs.clear();
+  _pairs.clear();
+  _manifolds.clear();
+  _previous.clear();
+  _previousManifolds.clear();
+  _islands.clear();
+  _contactCount = 0;
+}
+
+NativePhysicsWorld::Body& NativePhysicsWorld::_body(BodyId body)
+{
+  return _bodies[body];
+}
+
+const NativePhysicsWorld::Body& NativePhysicsWorld::_body(BodyId body) const
+{
+  return _bodies[body];
+}
+
+NativePhysicsWorld::BodyId
+NativePhysicsWorld::createBody(const NativePhysicsShape& shape, float mass,
+                               const Vector3& position,
+                               const Quaternion& orientation)
+{
+  BodyId id;
+  if (!_freeBodies.empty()) {
+    id = _freeBodies.back();
+    _freeBodies.pop_back();
+    _bodies[id] = Body();
+  }
+  else {
+    id = _bodies.size();
+    _bodies.emplace_back();
+  }
+
+  auto& body       = _bodies[id];
+  body.shape       = std::make_unique<NativePhysicsShape>(shape);
+  body.position    = position;
+  body.orientation = orientation;
+  body.mass        = mass;
+  body.alive       = true;
+  _updateMassProperties(body);
+  body.instance.update(*body.shape, body.position, body.orientation);
+
+  return id;
+}
+
+void NativePhysicsWorld::_updateMassProperties(Body& body)
+{
+  if (body.mass > 0.f) {
+    const auto inertia  = body.shape->computeInertia(body.mass);
+    body.inverseMass    = 1.f / body.mass;
+    body.inverseInertia = Vector3(inertia.x > 0.f ? 1.f / inertia.x : 0.f,
+                                  inertia.y > 0.f ? 1.f / inertia.y : 0.f,
+                                  inertia.z > 0.f ? 1.f / inertia.z : 0.f);
+  }
+  else {
+    body.inverseMass     = 0.f;
+    body.inverseInertia  = Vector3::Zero();
+    body.linearVelocity  = Vector3::Zero();
+    body.angularVelocity = Vector3::Zero();
+  }
+}
+
+void NativePhysicsWorld::removeBody(BodyId id)
+{
+  if (!hasBody(id)) {
+    return;
+  }
+
+  for (JointId joint = 0; joint < _joints.size(); ++joint) {
+    if (_joints[joint].alive
+        && (_joints[joint].bodyA == id || _joints[joint].bodyB == id)) {
+      removeJoint(joint);
+    }
+  }
+
+  // The bodies resting on the removed one must fall
+  for (const auto& manifold : _previous) {
+    if (manifold.bodyA == id || manifold.bodyB == id) {
+      wakeUp(manifold.bodyA == id ? manifold.bodyB : manifold.bodyA);
+    }
+  }
+
+  _bodies[id].alive = false;
+  _freeBodies.emplace_back(id);
+}
+
+bool NativePhysicsWorld::hasBody(BodyId body) const
+{
+  return body < _bodies.size() && _bodies[body].alive;
+}
+
+size_t NativePhysicsWorld::bodyCount() const
+{
+  return _bodies.size() - _freeBodies.size();
+}
+
+const NativePhysicsShape& NativePhysicsWorld::shape(BodyId body) const
+{
+  return *_body(body).shape;
+}
+
+const Vector3& NativePhysicsWorld::position(BodyId body) const
+{
+  return _body(body).position;
+}
+
+const Quaternion& NativePhysicsWorld::orientation(BodyId body) const
+{
+  return _body(body).orientation;
+}
+
+void NativePhysicsWorld::setTransformation(BodyId id, const Vector3& position,
+                                           const Quaternion& orientation)
+{
+  auto& body = _body(id);
+  // Bodies synchronized with an unchanged transformation keep sleeping
+  constexpr float epsilon = 1e-6f;
+  if ((body.position - position).lengthSquared() < epsilon * epsilon
+      && std::abs(Quaternion::Dot(body.orientation, orientation))
+           > 1.f - epsilon) {
+    return;
+  }
+
+  body.position    = position;
+  body.orientation = orientation;
+  body.instance.update(*body.shape, body.position, body.orientation);
+  wakeUp(id);
+}
+
+const Vector3& NativePhysicsWorld::linearVelocity(BodyId body) const
+{
+  return _body(body).linearVelocity;
+}
+
+void NativePhysicsWorld::setLinearVelocity(BodyId id, const Vector3& velocity)
+{
+  auto& body = _body(id);
+  if (body.inverseMass > 0.f) {
+    body.linearVelocity = velocity;
+    wakeUp(id);
+  }
+}
+
+const Vector3& NativePhysicsWorld::angularVelocity(BodyId body) const
+{
+  return _body(body).angularVelocity;
+}
+
+void NativePhysicsWorld::setAngularVelocity(BodyId id, const Vector3& velocity)
+{
+  auto& body = _body(id);
+  if (body.inverseMass > 0.f) {
+    body.angularVelocity = velocity;
+    wakeUp(id);
+  }
+}
+
+float NativePhysicsWorld::mass(BodyId body) const
+{
+  return _body(body).mass;
+}
+
+void NativePhysicsWorld::setMass(BodyId id, float mass)
+{
+  auto& body = _body(id);
+  body.mass  = std::max(mass, 0.f);
+  _updateMassProperties(body);
+  wakeUp(id);
+}
+
+float NativePhysicsWorld::friction(BodyId body) const
+{
+  return _body(body).friction;
+}
+
+void NativePhysicsWorld::setFriction(BodyId body, float friction)
+{
+  _body(body).friction = friction;
+}
+
+float NativePhysicsWorld::restitution(BodyId body) const
+{
+  return _body(body).restitution;
+}
+
+void NativePhysicsWorld::setRestitution(BodyId body, float restitution)
+{
+  _body(body).restitution = restitution;
+}
+
+void NativePhysicsWorld::applyImpulse(BodyId id, const Vector3& impulse,
+                                      const Vector3& point)
+{
+  auto& body = _body(id);
+  if (body.inverseMass <= 0.f) {
+    return;
+  }
+  const auto rotation = Matrix3::FromQuaternion(body.orientation);
+  const auto inverseInertia
+    = rotation * Matrix3::Diagonal(body.inverseInertia) * rotation.transpose();
+  body.linearVelocity += impulse * body.inverseMass;
+  body.angularVelocity
+    += inverseInertia * Vector3::Cross(point - body.position, impulse);
+  wakeUp(id);
+}
+
+void NativePhysicsWorld::applyForce(BodyId id, const Vector3& force,
+                                    const Vector3& point)
+{
+  auto& body = _body(id);
+  if (body.inverseMass <= 0.f) {
+    return;
+  }
+  body.force += force;
+  body.torque += Vector3::Cross(point - body.position, force);
+  wakeUp(id);
+}
+
+bool NativePhysicsWorld::isSleeping(BodyId body) const
+{
+  return _body(body).sleeping;
+}
+
+void NativePhysicsWorld::sleep(BodyId id)
+{
+  auto& body           = _body(id);
+  body.sleeping        = true;
+  body.linearVelocity  = Vector3::Zero();
+  body.angularVelocity = Vector3::Zero();
+}
+
+void NativePhysicsWorld::wakeUp(BodyId id)
+{
+  auto& body     = _body(id);
+  body.sleeping  = false;
+  body.sleepTime = 0.f;
+}
+
+NativePhysicsWorld::JointId NativePhysicsWorld::_addJoint(Joint&& joint)
+{
+  joint.alive = true;
+  joint.impulses.assign(joint.anchors.size(), Vector3::Zero());
+  if (!joint.collision) {
+    _ignoredPairs.emplace(std::min(joint.bodyA, joint.bodyB),
+                          std::max(joint.bodyA, joint.bodyB));
+  }
+  wakeUp(joint.bodyA);
+  wakeUp(joint.bodyB);
+
+  if (!_freeJoints.empty()) {
+    const auto id = _freeJoints.back();
+    _freeJoints.pop_back();
+    _joints[id] = std::move(joint);
+    return id;
+  }
+  _joints.emplace_back(std::move(joint));
+  return _joints.size() - 1;
+}
+
+NativePhysicsWorld::JointId NativePhysicsWorld::createBallAndSocketJoint(
+  BodyId bodyA, BodyId bodyB, const Vector3& pivotA, const Vector3& pivotB,
+  bool collision)
+{
+  Joint joint;
+  joint.bodyA     = bodyA;
+  joint.bodyB     = bodyB;
+  joint.collision = collision;
+  joint.anchors   = {{pivotA, pivotB}};
+  return _addJoint(std::move(joint));
+}
+
+NativePhysicsWorld::JointId NativePhysicsWorld::createHingeJoint(
+  BodyId bodyA, BodyId bodyB, const Vector3& pivotA, const Vector3& pivotB,
+  const Vector3& axisA, const Vector3& axisB, bool collision)
+{
+  Joint joint;
+  joint.bodyA     = bodyA;
+  joint.bodyB     = bodyB;
+  joint.collision = collision;
+  joint.anchors   = {{pivotA, pivotB},
+                   {pivotA + axisA.normalizeToNew(),
+                    pivotB + axisB.normalizeToNew()}};
+  return _addJoint(std::move(joint));
+}
+
+NativePhysicsWorld::JointId
+NativePhysicsWorld::createLockJoint(BodyId bodyA, BodyId bodyB,
+                                    const Vector3& pivotA,
+                                    const Vector3& pivotB, bool collision)
+{
+  // Offsets expressed in the frame of the first body, then mapped to the
+  // second one with the current relative rotation
+  const auto& a = _body(bodyA);
+  const auto& b = _body(bodyB);
+  Quaternion inverseB;
+  b.orientation.conjugateToRef(inverseB);
+  const auto relative = inverseB.multiply(a.orientation);
+
+  Joint joint;
+  joint.bodyA     = bodyA;
+  joint.bodyB     = bodyB;
+  joint.collision = collision;
+  joint.anchors   = {{pivotA, pivotB}};
+  for (const auto& offset : {Vector3(1.f, 0.f, 0.f), Vector3(0.f, 1.f, 0.f)}) {
+    joint.anchors.emplace_back(pivotA + offset,
+                               pivotB + RotateVector(relative, offset));
+  }
+  return _addJoint(std::move(joint));
+}
+
+NativePhysicsWorld::JointId NativePhysicsWorld::createDistanceJoint(
+  BodyId bodyA, BodyId bodyB, const Vector3& pivotA, const Vector3& pivotB,
+  float minDistance, float maxDistance, bool collision)
+{
+  Joint joint;
+  joint.bodyA       = bodyA;
+  joint.bodyB       = bodyB;
+  joint.collision   = collision;
+  joint.isDistance  = true;
+  joint.minDistance = minDistance;
+  joint.maxDistance = maxDistance;
+  joint.anchors     = {{pivotA, pivotB}};
+  const auto id     = _addJoint(std::move(joint));
+  _joints[id].impulses.clear();
+  return id;
+}
+
+void NativePhysicsWorld::setDistanceJointLimits(JointId id, float minDistance,
+                                                float maxDistance)
+{
+  auto& joint       = _joints[id];
+  joint.minDistance = minDistance;
+  joint.maxDistance = maxDistance;
+  wakeUp(joint.bodyA);
+  wakeUp(joint.bodyB);
+}
+
+void NativePhysicsWorld::removeJoint(JointId id)
+{
+  if (id >= _joints.size() || !_joints[id].alive) {
+    return;
+  }
+
+  auto& joint = _joints[id];
+  if (!joint.collision) {
+    auto it = _ignoredPairs.find(
+      {std::min(joint.bodyA, joint.bodyB), std::max(joint.bodyA, joint.bodyB)});
+    if (it != _ignoredPairs.end()) {
+      _ignoredPairs.erase(it);
+    }
+  }
+  wakeUp(joint.bodyA);
+  wakeUp(joint.bodyB);
+  joint.alive = false;
+  _freeJoints.emplace_back(id);
+}
+
+void NativePhysicsWorld::step(float timeStep)
+{
+  if (timeStep <= 0.f) {
+    return;
+  }
+
+  // Forces and world inertia
+  for (auto& body : _bodies) {
+    if (!body.alive || body.inverseMass <= 0.f || body.sleeping) {
+      continue;
+    }
+    const auto rotation = Matrix3::FromQuaternion(body.orientation);
+    body.inverseInertiaWorld = rotation
+                               * Matrix3::Diagonal(body.inverseInertia)
+                               * rotation.transpose();
+    body.linearVelocity
+      += (_gravity + body.force * body.inverseMass) * timeStep;
+    body.angularVelocity += body.inverseInertiaWorld * body.torque * timeStep;
+    body.force  = Vector3::Zero();
+    body.torque = Vector3::Zero();
+  }
+
+  _findPairs();
+  _collidePairs();
+  _buildIslands();
+
+  auto solve = [this, timeStep](size_t begin, size_t end) {
+    for (auto index = begin; index < end; ++index) {
+      _solveIsland(_islands[index], timeStep);
+    }
+  };
+  if (parallelIslands && _islands.size() > 1) {
+    ThreadPool::Default().parallelFor(_islands.size(), ISLANDS_GRAIN_SIZE,
+                                      solve);
+  }
+  else {
+    solve(0, _islands.size());
+  }
+
+  // Keep the impulses for the warm start of the next step
+  _previous.swap(_manifolds);
+  _previousManifolds.clear();
+  for (size_t i = 0; i < _previous.size(); ++i) {
+    _previousManifolds[{_previous[i].bodyA, _previous[i].bodyB}] = i;
+  }
+}
+
+void NativePhysicsWorld::_findPairs()
+{
+  _pairs.clear();
+  _sortedBodies.clear();
+
+  // Sweep along the axis with the largest spread of the bodies
+  Vector3 sum, sumSquared;
+  for (BodyId id = 0; id < _bodies.size(); ++id) {
+    const auto& body = _bodies[id];
+    if (!body.alive) {
+      continue;
+    }
+    _sortedBodies.emplace_back(id);
+    const auto center = (body.instance.minimum + body.instance.maximum) * 0.5f;
+    sum += center;
+    sumSquared += center * center;
+  }
+  if (_sortedBodies.size() < 2) {
+    return;
+  }
+  const auto count    = static_cast<float>(_sortedBodies.size());
+  const auto variance = sumSquared / count - (sum / count) * (sum / count);
+  unsigned int axis   = 0;
+  if (variance.y > variance.x) {
+    axis = 1;
+  }
+  if (variance.z > variance[axis]) {
+    axis = 2;
+  }
+
+  std::sort(_sortedBodies.begin(), _sortedBodies.end(),
+            [this, axis](BodyId a, BodyId b) {
+              return _bodies[a].instance.minimum[axis]
+                     < _bodies[b].instance.minimum[axis];
+            });
+
+  for (size_t i = 0; i < _sortedBodies.size(); ++i) {
+    const auto idA = _sortedBodies[i];
+    const auto& a  = _bodies[idA];
+    const auto max = a.instance.maximum[axis] + AABB_MARGIN;
+    for (auto j = i + 1; j < _sortedBodies.size(); ++j) {
+      const auto idB = _sortedBodies[j];
+      const auto& b  = _bodies[idB];
+      if (b.instance.minimum[axis] - AABB_MARGIN > max) {
+        break;
+      }
+      // At least one awake dynamic body
+      const auto activeA = a.inverseMass > 0.f && !a.sleeping;
+      const auto activeB = b.inverseMass > 0.f && !b.sleeping;
+      if (!activeA && !activeB) {
+        continue;
+      }
+      auto overlap = true;
+      for (unsigned int k = 0; k < 3 && overlap; ++k) {
+        overlap
+          = a.instance.minimum[k] - AABB_MARGIN
+              <= b.instance.maximum[k] + AABB_MARGIN
+            && b.instance.minimum[k] - AABB_MARGIN
+                 <= a.instance.maximum[k] + AABB_MARGIN;
+      }
+      if (!overlap) {
+        continue;
+      }
+      const auto pair = std::make_pair(std::min(idA, idB), std::max(idA, idB));
+      if (!_ignoredPairs.empty() && _ignoredPairs.count(pair)) {
+        continue;
+      }
+      _pairs.emplace_back(pair);
+    }
+  }
+}
+
+void NativePhysicsWorld::_collidePairs()
+{
+  _manifolds.resize(_pairs.size());
+
+  auto collide = [this](size_t begin, size_t end) {
+    std::vector<NativePhysicsContact> contacts;
+    for (auto index = begin; index < end; ++index) {
+      const auto [idA, idB] = _pairs[index];
+      const auto& a         = _bodies[idA];
+      const auto& b         = _bodies[idB];
+      auto& manifold        = _manifolds[index];
+      manifold.bodyA        = idA;
+      manifold.bodyB        = idB;
+      manifold.friction     = std::sqrt(a.friction * b.friction);
+      manifold.restitution  = std::max(a.restitution, b.restitution);
+      manifold.points.clear();
+
+      contacts.clear();
+      NativePhysicsShapeInstance::Collide(a.instance, b.instance, contacts);
+      if (contacts.empty()) {
+        continue;
+      }
+
+      // Impulses of the previous step for the points which barely moved
+      const Manifold* previous = nullptr;
+      auto it                  = _previousManifolds.find({idA, idB});
+      if (it != _previousManifolds.end()) {
+        previous = &_previous[it->second];
+      }
+
+      manifold.normal = contacts[0].normal;
+      for (const auto& contact : contacts) {
+        ContactPoint point;
+        point.point = contact.point;
+        point.depth = contact.depth;
+        if (previous) {
+          for (const auto& old : previous->points) {
+            if ((old.point - contact.point).lengthSquared()
+                < WARM_START_DISTANCE * WARM_START_DISTANCE) {
+              point.normalImpulse   = old.normalImpulse;
+              point.tangentImpulses = old.tangentImpulses;
+              break;
+            }
+          }
+        }
+        manifold.points.emplace_back(point);
+      }
+    }
+  };
+  ThreadPool::Default().parallelFor(_pairs.size(), PAIRS_GRAIN_SIZE, collide);
+
+  _manifolds.erase(std::remove_if(_manifolds.begin(), _manifolds.end(),
+                                  [](const Manifold& manifold) {
+                                    return manifold.points.empty();
+                                  }),
+                   _manifolds.end());
+
+  _contactCount = 0;
+  for (const auto& manifold : _manifolds) {
+    _contactCount += manifold.points.size();
+  }
+}
+
+void NativePhysicsWorld::_buildIslands()
+{
+  // Union find of the dynamic bodies linked by contacts and joints
+  std::vector<BodyId> parents(_bodies.size());
+  std::iota(parents.begin(), parents.end(), 0);
+  const auto find = [&parents](BodyId id) {
+    while (parents[id] != id) {
+      parents[id] = parents[parents[id]];
+      id          = parents[id];
+    }
+    return id;
+  };
+  const auto isDynamic = [this](BodyId id) {
+    return _bodies[id].alive && _bodies[id].inverseMass > 0.f;
+  };
+  const auto link = [&](BodyId a, BodyId b) {
+    if (isDynamic(a) && isDynamic(b)) {
+      parents[find(a)] = find(b);
+    }
+  };
+  for (const auto& manifold : _manifolds) {
+    link(manifold.bodyA, manifold.bodyB);
+  }
+  for (const auto& joint : _joints) {
+    if (joint.alive) {
+      link(joint.bodyA, joint.bodyB);
+    }
+  }
+
+  _islands.clear();
+  for (BodyId id = 0; id < _bodies.size(); ++id) {
+    _bodies[id].island = InvalidId;
+  }
+  for (BodyId id = 0; id < _bodies.size(); ++id) {
+    if (!isDynamic(id)) {
+      continue;
+    }
+    auto& root = _bodies[find(id)];
+    if (root.island == InvalidId) {
+      root.island = _islands.size();
+      _islands.emplace_back();
+    }
+    _bodies[id].island = root.island;
+    _islands[root.island].bodies.emplace_back(id);
+  }
+
+  const auto islandOf = [this, &isDynamic](BodyId a, BodyId b) {
+    return _bodies[isDynamic(a) ? a : b].island;
+  };
+  for (size_t m = 0; m < _manifolds.size(); ++m) {
+    const auto island = islandOf(_manifolds[m].bodyA, _manifolds[m].bodyB);
+    if (island != InvalidId) {
+      _islands[island].manifolds.emplace_back(m);
+    }
+  }
+  for (JointId j = 0; j < _joints.size(); ++j) {
+    if (!_joints[j].alive) {
+      continue;
+    }
+    const auto island = islandOf(_joints[j].bodyA, _joints[j].bodyB);
+    if (island != InvalidId) {
+      _islands[island].joints.emplace_back(j);
+    }
+  }
+
+  // An island wakes up as a whole
+  for (auto& island : _islands) {
+    island.sleeping = std::all_of(
+      island.bodies.begin(), island.bodies.end(),
+      [this](BodyId id) { return _bodies[id].sleeping; });
+    if (!island.sleeping) {
+      for (auto id : island.bodies) {
+        auto& body = _bodies[id];
+        if (body.sleeping) {
+          body.sleeping = false;
+          body.sleepTime = 0.f;
+          const auto rotation = Matrix3::FromQuaternion(body.orientation);
+          body.inverseInertiaWorld = rotation
+                                     * Matrix3::Diagonal(body.inverseInertia)
+                                     * rotation.transpose();
+        }
+      }
+    }
+  }
+}
+
+namespace {
+
+void ApplyImpulse(float inverseMass, const Matrix3& inverseInertia,
+                  Vector3& linearVelocity, Vector3& angularVelocity,
+                  const Vector3& r, const Vector3& impulse)
+{
+  if (inverseMass <= 0.f) {
+    return;
+  }
+  linearVelocity += impulse * inverseMass;
+  angularVelocity += inverseInertia * Vector3::Cross(r, impulse);
+}
+
+float EffectiveMass(float inverseMassA, const Matrix3& inverseInertiaA,
+                    const Vector3& rA, float inverseMassB,
+                    const Matrix3& inverseInertiaB, const Vector3& rB,
+                    const Vector3& direction)
+{
+  const auto rnA = Vector3::Cross(rA, direction);
+  const auto rnB = Vector3::Cross(rB, direction);
+  const auto k   = inverseMassA + inverseMassB
+                 + Vector3::Dot(rnA, inverseInertiaA * rnA)
+                 + Vector3::Dot(rnB, inverseInertiaB * rnB);
+  return k > 0.f ? 1.f / k : 0.f;
+}
+
+struct PointConstraint {
+  Vector3 rA;
+  Vector3 rB;
+  Matrix3 mass;
+  Vector3 bias;
+}; // end of struct PointConstraint
+
+} // end of anonymous namespace
+
+void NativePhysicsWorld::_solveIsland(Island& island, float timeStep)
+{
+  if (island.sleeping) {
+    return;
+  }
+
+  const auto inverseStep = 1.f / timeStep;
+  const auto impulse     = [this](Body& body, const Vector3& r,
+                              const Vector3& value) {
+    ApplyImpulse(body.inverseMass, body.inverseInertiaWorld,
+                 body.linearVelocity, body.angularVelocity, r, value);
+  };
+  const auto velocityAt = [](const Body& body, const Vector3& r) {
+    return body.linearVelocity + Vector3::Cross(body.angularVelocity, r);
+  };
+
+  // Contacts setup and warm start
+  for (auto m : island.manifolds) {
+    auto& manifold = _manifolds[m];
+    auto& a        = _bodies[manifold.bodyA];
+    auto& b        = _bodies[manifold.bodyB];
+    const auto& n  = manifold.normal;
+    for (auto& point : manifold.points) {
+      point.rA          = point.point - a.position;
+      point.rB          = point.point - b.position;
+      point.tangents[0] = AnyPerpendicular(n);
+      point.tangents[1] = Vector3::Cross(n, point.tangents[0]);
+      point.normalMass
+        = EffectiveMass(a.inverseMass, a.inverseInertiaWorld, point.rA,
+                        b.inverseMass, b.inverseInertiaWorld, point.rB, n);
+      for (size_t t = 0; t < 2; ++t) {
+        point.tangentMasses[t] = EffectiveMass(
+          a.inverseMass, a.inverseInertiaWorld, point.rA, b.inverseMass,
+          b.inverseInertiaWorld, point.rB, point.tangents[t]);
+      }
+
+      const auto closingVelocity = Vector3::Dot(
+        velocityAt(b, point.rB) - velocityAt(a, point.rA), n);
+      point.bias = BAUMGARTE * inverseStep
+                   * std::max(point.depth - LINEAR_SLOP, 0.f);
+      if (closingVelocity < -RESTITUTION_THRESHOLD) {
+        point.bias
+          = std::max(point.bias, -manifold.restitution * closingVelocity);
+      }
+
+      const auto warmStart = n * point.normalImpulse
+                             + point.tangents[0] * point.tangentImpulses[0]
+                             + point.tangents[1] * point.tangentImpulses[1];
+      impulse(a, point.rA, -warmStart);
+      impulse(b, point.rB, warmStart);
+    }
+  }
+
+  // Joints setup and warm start
+  std::vector<std::vector<PointConstraint>> points(island.joints.size());
+  std::vector<std::pair<Vector3, float>> distances(island.joints.size());
+  for (size_t j = 0; j < island.joints.size(); ++j) {
+    auto& joint = _joints[island.joints[j]];
+    auto& a     = _bodies[joint.bodyA];
+    auto& b     = _bodies[joint.bodyB];
+
+    if (joint.isDistance) {
+      auto& constraint = points[j];
+      constraint.resize(1);
+      auto& c = constraint[0];
+      c.rA    = RotateVector(a.orientation, joint.anchors[0].first);
+      c.rB    = RotateVector(b.orientation, joint.anchors[0].second);
+      auto d  = (b.position + c.rB) - (a.position + c.rA);
+      const auto length = d.length();
+      auto& [direction, error] = distances[j];
+      direction = length > 1e-6f ? d / length : Vector3(0.f, 1.f, 0.f);
+      error     = 0.f;
+      if (length > joint.maxDistance) {
+        error = length - joint.maxDistance;
+      }
+      else if (length < joint.minDistance) {
+        error = length - joint.minDistance;
+      }
+      else {
+        joint.distanceImpulse = 0.f;
+      }
+      c.mass.m[0] = EffectiveMass(a.inverseMass, a.inverseInertiaWorld, c.rA,
+                                  b.inverseMass, b.inverseInertiaWorld, c.rB,
+                                  direction);
+      const auto warmStart = direction * joint.distanceImpulse;
+      impulse(a, c.rA, -warmStart);
+      impulse(b, c.rB, warmStart);
+      continue;
+    }
+
+    for (size_t k = 0; k < joint.anchors.size(); ++k) {
+      PointConstraint c;
+      c.rA = RotateVector(a.orientation, joint.anchors[k].first);
+      c.rB = RotateVector(b.orientation, joint.anchors[k].second);
+      const auto skewA = Matrix3::Skew(c.rA);
+      const auto skewB = Matrix3::Skew(c.rB);
+      const auto masses
+        = Matrix3::Diagonal(Vector3(1.f, 1.f, 1.f)
+                            * (a.inverseMass + b.inverseMass));
+      const auto k3 = masses - skewA * a.inverseInertiaWorld * skewA
+                      - skewB * b.inverseInertiaWorld * skewB;
+      c.mass = k3.inverse();
+      c.bias = ((b.position + c.rB) - (a.position + c.rA))
+               * (BAUMGARTE * inverseStep);
+      impulse(a, c.rA, -joint.impulses[k]);
+      impulse(b, c.rB, joint.impulses[k]);
+      points[j].emplace_back(c);
+    }
+  }
+
+  // Sequential impulses
+  for (size_t iteration = 0; iteration < solverIterations; ++iteration) {
+    for (size_t j = 0; j < island.joints.size(); ++j) {
+      auto& joint = _joints[island.joints[j]];
+      auto& a     = _bodies[joint.bodyA];
+      auto& b     = _bodies[joint.bodyB];
+
+      if (joint.isDistance) {
+        const auto& [direction, error] = distances[j];
+        const auto& c                  = points[j][0];
+        if (error == 0.f) {
+          continue;
+        }
+        const auto velocity = Vector3::Dot(
+          velocityAt(b, c.rB) - velocityAt(a, c.rA), direction);
+        auto lambda
+          = -c.mass.m[0] * (velocity + BAUMGARTE * inverseStep * error);
+        // Only pull when too long, only push when too short
+        const auto previous = joint.distanceImpulse;
+        joint.distanceImpulse
+          = error > 0.f ? std::min(previous + lambda, 0.f) :
+                          std::max(previous + lambda, 0.f);
+        lambda = joint.distanceImpulse - previous;
+        impulse(a, c.rA, direction * -lambda);
+        impulse(b, c.rB, direction * lambda);
+        continue;
+      }
+
+      for (size_t k = 0; k < points[j].size(); ++k) {
+        const auto& c = points[j][k];
+        const auto velocity = velocityAt(b, c.rB) - velocityAt(a, c.rA);
+        const auto lambda   = c.mass * -(velocity + c.bias);
+        joint.impulses[k] += lambda;
+        impulse(a, c.rA, -lambda);
+        impulse(b, c.rB, lambda);
+      }
+    }
+
+    for (auto m : island.manifolds) {
+      auto& manifold = _manifolds[m];
+      auto& a        = _bodies[manifold.bodyA];
+      auto& b        = _bodies[manifold.bodyB];
+      const auto& n  = manifold.normal;
+      for (auto& point : manifold.points) {
+        // Friction, bounded by the normal impulse
+        const auto maxFriction = manifold.friction * point.normalImpulse;
+        for (size_t t = 0; t < 2; ++t) {
+          const auto velocity = Vector3::Dot(
+            velocityAt(b, point.rB) - velocityAt(a, point.rA),
+            point.tangents[t]);
+          const auto previous = point.tangentImpulses[t];
+          point.tangentImpulses[t]
+            = std::clamp(previous - point.tangentMasses[t] * velocity,
+                         -maxFriction, maxFriction);
+          const auto lambda
+            = point.tangents[t] * (point.tangentImpulses[t] - previous);
+          impulse(a, point.rA, -lambda);
+          impulse(b, point.rB, lambda);
+        }
+
+        // Non penetration
+        const auto velocity = Vector3::Dot(
+          velocityAt(b, point.rB) - velocityAt(a, point.rA), n);
+        const auto previous = point.normalImpulse;
+        point.normalImpulse = std::max(
+          previous + point.normalMass * (point.bias - velocity), 0.f);
+        const auto lambda = n * (point.normalImpulse - previous);
+        impulse(a, point.rA, -lambda);
+        impulse(b, point.rB, lambda);
+      }
+    }
+  }
+
+  // Integration
+  auto minSleepTime = std::numeric_limits<float>::max();
+  for (auto id : island.bodies) {
+    auto& body = _bodies[id];
+    body.position += body.linearVelocity * timeStep;
+    const auto& w = body.angularVelocity;
+    const Quaternion spin(w.x, w.y, w.z, 0.f);
+    auto& q = body.orientation;
+    q.addInPlace(spin.multiply(q).scale(0.5f * timeStep));
+    q.normalize();
+    body.instance.update(*body.shape, body.position, body.orientation);
+
+    if (body.linearVelocity.lengthSquared() < SLEEP_LINEAR_VELOCITY
+        && body.angularVelocity.lengthSquared() < SLEEP_ANGULAR_VELOCITY) {
+      body.sleepTime += timeStep;
+    }
+    else {
+      body.sleepTime = 0.f;
+    }
+    minSleepTime = std::min(minSleepTime, body.sleepTime);
+  }
+
+  if (allowSleep && minSleepTime > TIME_TO_SLEEP) {
+    for (auto id : island.bodies) {
+      auto& body           = _bodies[id];
+      body.sleeping        = true;
+      body.linearVelocity  = Vector3::Zero();
+      body.angularVelocity = Vector3::Zero();
+    }
+  }
+}
+
+NativePhysicsWorld::BodyId NativePhysicsWorld::raycast(const Vector3& from,
+                                                       const Vector3& to,
+                                                       Vector3& point,
+                                                       Vector3& normal) const
+{
+  auto direction    = to - from;
+  const auto length = direction.length();
+  if (length <= 0.f) {
+    return InvalidId;
+  }
+  direction /= length;
+
+  auto closest = length;
+  auto hit     = InvalidId;
+  for (BodyId id = 0; id < _bodies.size(); ++id) {
+    const auto& body = _bodies[id];
+    if (!body.alive) {
+      continue;
+    }
+
+    // Slab test against the bounding box
+    auto enter = 0.f, exit = closest;
+    for (unsigned int k = 0; k < 3 && enter <= exit; ++k) {
+      if (std::abs(direction[k]) < 1e-8f) {
+        if (from[k] < body.instance.minimum[k]
+            || from[k] > body.instance.maximum[k]) {
+          exit = -1.f;
+        }
+        continue;
+      }
+      auto t0 = (body.instance.minimum[k] - from[k]) / direction[k];
+      auto t1 = (body.instance.maximum[k] - from[k]) / direction[k];
+      if (t0 > t1) {
+        std::swap(t0, t1);
+      }
+      enter = std::max(enter, t0);
+      exit  = std::min(exit, t1);
+    }
+    if (enter > exit) {
+      continue;
+    }
+
+    // Exact test in the body space
+    Quaternion inverse;
+    body.orientation.conjugateToRef(inverse);
+    float distance;
+    Vector3 localNormal;
+    if (body.shape->raycast(RotateVector(inverse, from - body.position),
+                           RotateVector(inverse, direction), closest, distance,
+                           localNormal)
+        && distance <= closest) {
+      closest = distance;
+      hit     = id;
+      normal  = RotateVector(body.orientation, localNormal);
+    }
+  }
+
+  if (hit != InvalidId) {
+    point = from + direction * closest;
+  }
+  return hit;
+}
+
+size_t NativePhysicsWorld::islandCount() const
+{
+  return _islands.size();
+}
+
+size_t NativePhysicsWorld::contactCount() const
+{
+  return _contactCount;
+}
+
+} // end of namespace BABYLON
@@ -402,7 +402,7 @@ void SSAO2RenderingPipeline::_createSSAOCombinePostProcess(float ratio)
 
   _ssaoCombinePostProcess->onApply = [&](Effect* effect, EventState&) {
     const auto& viewport = _scene->activeCamera->viewport;
-    effect->setVector4("viewport", Tmp::Vector4Array[0].copyFromFloats(
+    effect->setVector4("viewport", Tmp::Vector4Array()[0].copyFromFloats(
                                      static_cast<float>(viewport.x),
                                      static_cast<float>(viewport.y),
                                      static_cast<float>(viewport.width),
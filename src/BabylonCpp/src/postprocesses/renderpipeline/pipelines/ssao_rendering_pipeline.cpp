@@ -218,8 +218,8 @@ void SSAORenderingPipeline::_createSSAOCombinePostProcess(float ratio)
     false);
 
   _ssaoCombinePostProcess->onApply = [&](Effect* effect, EventState&) {
-    effect->setVector4("viewport",
-                       Tmp::Vector4Array[0].copyFromFloats(0.f, 0.f, 1.f, 1.f));
+    effect->setVector4(
+      "viewport", Tmp::Vector4Array()[0].copyFromFloats(0.f, 0.f, 1.f, 1.f));
     effect->setTextureFromPostProcess("originalColor",
                                       _originalColorPostProcess.get());
   };
@@ -2,23 +2,26 @@
 
 #include <babylon/babylon_stl_util.h>
 #include <babylon/cameras/camera.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
 #include <babylon/materials/ishader_material_options.h>
 #include <babylon/materials/shader_material.h>
 #include <babylon/meshes/abstract_mesh.h>
 #include <babylon/meshes/vertex_buffer.h>
-#include <babylon/rendering/face_adjacencies.h>
+#include <babylon/rendering/face_adjacencies_builder.h>
 
 namespace BABYLON {
 
 EdgesRenderer::EdgesRenderer(const AbstractMeshPtr& source, float epsilon,
                              bool checkVerticesInsteadOfIndices,
-                             bool generateEdgesLines)
+                             bool generateEdgesLines,
+                             bool generateEdgesLinesInBackground)
     : edgesWidthScalerForOrthographic{1000.f}
     , edgesWidthScalerForPerspective{50.f}
     , _source{source}
     , _epsilon{epsilon}
+    , _indicesCount{0}
     , _lineShader{nullptr}
     , _ib{nullptr}
     , _checkVerticesInsteadOfIndices{checkVerticesInsteadOfIndices}
@@ -27,7 +30,12 @@ EdgesRenderer::EdgesRenderer(const AbstractMeshPtr& source, float epsilon,
 
   _prepareResources();
   if (generateEdgesLines) {
-    _generateEdgesLines();
+    if (generateEdgesLinesInBackground) {
+      _generateEdgesLinesInBackground();
+    }
+    else {
+      _generateEdgesLines();
+    }
   }
 
   _meshRebuildObserver = _source->onRebuildObservable.add(
@@ -39,6 +47,10 @@ EdgesRenderer::EdgesRenderer(const AbstractMeshPtr& source, float epsilon,
 
 EdgesRenderer::~EdgesRenderer()
 {
+  // The worker writes to the members of the renderer
+  if (_backgroundGeneration.valid()) {
+    _backgroundGeneration.wait();
+  }
 }
 
 void EdgesRenderer::_prepareResources()
@@ -71,6 +83,13 @@ void EdgesRenderer::_rebuild()
     }
   }
 
+  // The buffers are created once the generation is over, the index buffer is
+  // only recreated if the generation was already over
+  const auto wasGenerating = _backgroundGeneration.valid();
+  if (!_completeBackgroundGeneration() || wasGenerating) {
+    return;
+  }
+
   auto scene  = _source->getScene();
   auto engine = scene->getEngine();
   _ib         = engine->createIndexBuffer(_linesIndices);
@@ -82,6 +101,11 @@ void EdgesRenderer::dispose(bool /*doNotRecurse*/,
   _source->onRebuildObservable.remove(_meshRebuildObserver);
   _source->onDisposeObservable.remove(_meshDisposeObserver);
 
+  if (_backgroundGeneration.valid()) {
+    _backgroundGeneration.wait();
+    _backgroundGeneration = {};
+  }
+
   if (_buffers.find(VertexBuffer::PositionKind) != _buffers.end()) {
     auto& buffer = _buffers[VertexBuffer::PositionKind];
     if (buffer) {
@@ -104,49 +128,6 @@ void EdgesRenderer::dispose(bool /*doNotRecurse*/,
   _lineShader->dispose();
 }
 
-int EdgesRenderer::_processEdgeForAdjacencies(unsigned int pa, unsigned int pb,
-                                              unsigned int p0, unsigned int p1,
-                                              unsigned int p2)
-{
-  if ((pa == p0 && pb == p1) || (pa == p1 && pb == p0)) {
-    return 0;
-  }
-
-  if ((pa == p1 && pb == p2) || (pa == p2 && pb == p1)) {
-    return 1;
-  }
-
-  if ((pa == p2 && pb == p0) || (pa == p0 && pb == p2)) {
-    return 2;
-  }
-
-  return -1;
-}
-
-int EdgesRenderer::_processEdgeForAdjacenciesWithVertices(const Vector3& pa,
-                                                          const Vector3& pb,
-                                                          const Vector3& p0,
-                                                          const Vector3& p1,
-                                                          const Vector3& p2)
-{
-  if ((pa.equalsWithEpsilon(p0) && pb.equalsWithEpsilon(p1))
-      || (pa.equalsWithEpsilon(p1) && pb.equalsWithEpsilon(p0))) {
-    return 0;
-  }
-
-  if ((pa.equalsWithEpsilon(p1) && pb.equalsWithEpsilon(p2))
-      || (pa.equalsWithEpsilon(p2) && pb.equalsWithEpsilon(p1))) {
-    return 1;
-  }
-
-  if ((pa.equalsWithEpsilon(p2) && pb.equalsWithEpsilon(p0))
-      || (pa.equalsWithEpsilon(p0) && pb.equalsWithEpsilon(p2))) {
-    return 2;
-  }
-
-  return -1;
-}
-
 void EdgesRenderer::_checkEdge(size_t faceIndex, int edge,
                                const std::vector<Vector3>& faceNormals,
                                const Vector3& p0, const Vector3& p1)
@@ -204,121 +185,60 @@ void EdgesRenderer::_generateEdgesLines()
   }
 
   // First let's find adjacencies
-  std::vector<FaceAdjacencies> adjacencies;
-  std::vector<Vector3> faceNormals;
-
-  // Prepare faces
-  for (unsigned int index = 0; index < indices.size(); index += 3) {
-    FaceAdjacencies _faceAdjacencies;
-    unsigned int p0Index = indices[index + 0];
-    unsigned int p1Index = indices[index + 1];
-    unsigned int p2Index = indices[index + 2];
-
-    _faceAdjacencies.edges = {0, 0, 0};
-
-    _faceAdjacencies.p0
-      = Vector3(positions[p0Index * 3 + 0], positions[p0Index * 3 + 1],
-                positions[p0Index * 3 + 2]);
-    _faceAdjacencies.p1
-      = Vector3(positions[p1Index * 3 + 0], positions[p1Index * 3 + 1],
-                positions[p1Index * 3 + 2]);
-    _faceAdjacencies.p2
-      = Vector3(positions[p2Index * 3 + 0], positions[p2Index * 3 + 1],
-                positions[p2Index * 3 + 2]);
-    auto faceNormal
-      = Vector3::Cross(_faceAdjacencies.p1.subtract(_faceAdjacencies.p0),
-                       _faceAdjacencies.p2.subtract(_faceAdjacencies.p1));
-
-    faceNormal.normalize();
-
-    faceNormals.emplace_back(faceNormal);
-    adjacencies.emplace_back(_faceAdjacencies);
-  }
+  const auto adjacencies = FaceAdjacenciesBuilder::Build(
+    positions, indices, _checkVerticesInsteadOfIndices);
+  const auto faceNormals
+    = FaceAdjacenciesBuilder::ComputeFaceNormals(adjacencies);
 
-  // Scan
-  for (unsigned int index = 0; index < adjacencies.size(); ++index) {
-    auto& faceAdjacencies = adjacencies[index];
+  _createEdgesLines(adjacencies, faceNormals);
+  _createEdgesBuffers();
+}
 
-    for (unsigned int otherIndex = index + 1; otherIndex < adjacencies.size();
-         ++otherIndex) {
-      auto& otherFaceAdjacencies = adjacencies[otherIndex];
+void EdgesRenderer::_generateEdgesLinesInBackground()
+{
+  auto positions = _source->getVerticesData(VertexBuffer::PositionKind);
+  auto indices   = _source->getIndices();
 
-      if (faceAdjacencies.edgesConnectedCount == 3) { // Full
-        break;
-      }
+  if (indices.empty() || positions.empty()) {
+    return;
+  }
 
-      if (otherFaceAdjacencies.edgesConnectedCount == 3) { // Full
-        continue;
-      }
+  // Only the adjacencies are computed on the worker, the lines and the
+  // buffers are created on the rendering thread
+  _backgroundGeneration = ThreadPool::Default().enqueue(
+    [this, positions = std::move(positions), indices = std::move(indices),
+     checkVerticesInsteadOfIndices = _checkVerticesInsteadOfIndices]() {
+      _backgroundAdjacencies = FaceAdjacenciesBuilder::Build(
+        positions, indices, checkVerticesInsteadOfIndices);
+      _backgroundFaceNormals
+        = FaceAdjacenciesBuilder::ComputeFaceNormals(_backgroundAdjacencies);
+    });
+}
 
-      const auto& otherP0 = indices[otherIndex * 3 + 0];
-      const auto& otherP1 = indices[otherIndex * 3 + 1];
-      const auto& otherP2 = indices[otherIndex * 3 + 2];
-
-      for (unsigned int edgeIndex = 0; edgeIndex < 3; ++edgeIndex) {
-        int otherEdgeIndex = 0;
-
-        if (edgeIndex >= faceAdjacencies.edges.size()) {
-          continue;
-        }
-
-        switch (edgeIndex) {
-          case 0:
-            if (_checkVerticesInsteadOfIndices) {
-              otherEdgeIndex = _processEdgeForAdjacenciesWithVertices(
-                faceAdjacencies.p0, faceAdjacencies.p1, otherFaceAdjacencies.p0,
-                otherFaceAdjacencies.p1, otherFaceAdjacencies.p2);
-            }
-            else {
-              otherEdgeIndex = _processEdgeForAdjacencies(
-                indices[index * 3], indices[index * 3 + 1], otherP0, otherP1,
-                otherP2);
-            }
-            break;
-          case 1:
-            if (_checkVerticesInsteadOfIndices) {
-              otherEdgeIndex = _processEdgeForAdjacenciesWithVertices(
-                faceAdjacencies.p1, faceAdjacencies.p2, otherFaceAdjacencies.p0,
-                otherFaceAdjacencies.p1, otherFaceAdjacencies.p2);
-            }
-            else {
-              otherEdgeIndex = _processEdgeForAdjacencies(
-                indices[index * 3 + 1], indices[index * 3 + 2], otherP0,
-                otherP1, otherP2);
-            }
-            break;
-          case 2:
-          default:
-            if (_checkVerticesInsteadOfIndices) {
-              otherEdgeIndex = _processEdgeForAdjacenciesWithVertices(
-                faceAdjacencies.p2, faceAdjacencies.p0, otherFaceAdjacencies.p0,
-                otherFaceAdjacencies.p1, otherFaceAdjacencies.p2);
-            }
-            else {
-              otherEdgeIndex = _processEdgeForAdjacencies(
-                indices[index * 3 + 2], indices[index * 3], otherP0, otherP1,
-                otherP2);
-            }
-        }
-
-        if (otherEdgeIndex == -1) {
-          continue;
-        }
-
-        faceAdjacencies.edges[edgeIndex] = static_cast<int>(otherIndex);
-        otherFaceAdjacencies.edges[static_cast<size_t>(otherEdgeIndex)]
-          = static_cast<int>(index);
-
-        ++faceAdjacencies.edgesConnectedCount;
-        ++otherFaceAdjacencies.edgesConnectedCount;
-
-        if (faceAdjacencies.edgesConnectedCount == 3) {
-          break;
-        }
-      }
-    }
+bool EdgesRenderer::_completeBackgroundGeneration()
+{
+  if (!_backgroundGeneration.valid()) {
+    return true;
+  }
+
+  if (_backgroundGeneration.wait_for(std::chrono::seconds(0))
+      != std::future_status::ready) {
+    return false;
   }
 
+  _backgroundGeneration.get();
+  _createEdgesLines(_backgroundAdjacencies, _backgroundFaceNormals);
+  _createEdgesBuffers();
+  _backgroundAdjacencies.clear();
+  _backgroundFaceNormals.clear();
+
+  return true;
+}
+
+void EdgesRenderer::_createEdgesLines(
+  const std::vector<FaceAdjacencies>& adjacencies,
+  const std::vector<Vector3>& faceNormals)
+{
   // Create lines
   for (unsigned index = 0; index < adjacencies.size(); ++index) {
     // We need a line when a face has no adjacency on a specific edge or if all
@@ -329,7 +249,10 @@ void EdgesRenderer::_generateEdgesLines()
     _checkEdge(index, current.edges[1], faceNormals, current.p1, current.p2);
     _checkEdge(index, current.edges[2], faceNormals, current.p2, current.p0);
   }
+}
 
+void EdgesRenderer::_createEdgesBuffers()
+{
   // Merge into a single mesh
   auto engine = _source->getScene()->getEngine();
 
@@ -345,7 +268,7 @@ void EdgesRenderer::_generateEdgesLines()
 
 bool EdgesRenderer::isReady()
 {
-  return _lineShader->isReady();
+  return _completeBackgroundGeneration() && _lineShader->isReady();
 }
 
 void EdgesRenderer::render()
@@ -0,0 +1,178 @@
+#include <babylon/rendering/face_adjacencies_builder.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <unordered_map>
+
+namespace BABYLON {
+
+namespace {
+
+struct CellHash {
+  size_t operator()(const std::array<int64_t, 3>& cell) const
+  {
+    // Spatial hash of "Optimized Spatial Hashing for Collision Detection of
+    // Deformable Objects" (Teschner et al.)
+    return static_cast<size_t>((cell[0] * 73856093) ^ (cell[1] * 19349663)
+                               ^ (cell[2] * 83492791));
+  }
+}; // end of struct CellHash
+
+} // end of anonymous namespace
+
+Uint32Array FaceAdjacenciesBuilder::WeldVertices(const Float32Array& positions,
+                                                 float epsilon)
+{
+  const auto count = positions.size() / 3;
+  Uint32Array welded(count);
+
+  // Grid of the representative vertices, with cells of the size of epsilon so
+  // that a match is always in the cell of the vertex or in a neighbor one
+  const auto cellSize = std::max(epsilon, 1e-7f);
+  std::unordered_map<std::array<int64_t, 3>, Uint32Array, CellHash> grid;
+  grid.reserve(count);
+
+  for (uint32_t vertex = 0; vertex < count; ++vertex) {
+    const auto* p = &positions[vertex * 3];
+    const std::array<int64_t, 3> cell{
+      static_cast<int64_t>(std::floor(p[0] / cellSize)),
+      static_cast<int64_t>(std::floor(p[1] / cellSize)),
+      static_cast<int64_t>(std::floor(p[2] / cellSize))};
+
+    auto match = vertex;
+    for (int64_t dx = -1; dx <= 1 && match == vertex; ++dx) {
+      for (int64_t dy = -1; dy <= 1 && match == vertex; ++dy) {
+        for (int64_t dz = -1; dz <= 1 && match == vertex; ++dz) {
+          auto it = grid.find({cell[0] + dx, cell[1] + dy, cell[2] + dz});
+          if (it == grid.end()) {
+            continue;
+          }
+          for (auto other : it->second) {
+            const auto* q = &positions[other * 3];
+            if (std::abs(p[0] - q[0]) <= epsilon
+                && std::abs(p[1] - q[1]) <= epsilon
+                && std::abs(p[2] - q[2]) <= epsilon) {
+              match = other;
+              break;
+            }
+          }
+        }
+      }
+    }
+
+    if (match == vertex) {
+      grid[cell].emplace_back(vertex);
+    }
+    welded[vertex] = match;
+  }
+
+  return welded;
+}
+
+std::vector<FaceAdjacencies>
+FaceAdjacenciesBuilder::Build(const Float32Array& positions,
+                              const IndicesArray& indices,
+                              bool checkVerticesInsteadOfIndices,
+                              float epsilon)
+{
+  const auto faceCount   = indices.size() / 3;
+  const auto vertexCount = static_cast<uint32_t>(positions.size() / 3);
+
+  if (vertexCount == 0) {
+    return {};
+  }
+
+  std::vector<FaceAdjacencies> adjacencies(faceCount);
+  for (size_t face = 0; face < faceCount; ++face) {
+    auto& faceAdjacencies = adjacencies[face];
+    faceAdjacencies.edges = {-1, -1, -1};
+    for (unsigned int corner = 0; corner < 3; ++corner) {
+      const auto index = std::min(indices[face * 3 + corner], vertexCount - 1);
+      auto& p          = (corner == 0) ? faceAdjacencies.p0 :
+                         (corner == 1) ? faceAdjacencies.p1 :
+                                         faceAdjacencies.p2;
+      p.copyFromFloats(positions[index * 3 + 0], positions[index * 3 + 1],
+                       positions[index * 3 + 2]);
+    }
+  }
+
+  // Vertex identifiers compared to find the shared edges
+  Uint32Array welded;
+  if (checkVerticesInsteadOfIndices) {
+    welded = WeldVertices(positions, epsilon);
+  }
+  const auto vertexId = [&](size_t corner) {
+    const auto index = indices[corner];
+    return checkVerticesInsteadOfIndices && index < vertexCount ?
+             welded[index] :
+             index;
+  };
+
+  // Edge keys, sorted by vertex pair then by face
+  std::vector<std::pair<uint64_t, uint32_t>> edges;
+  edges.reserve(faceCount * 3);
+  for (size_t face = 0; face < faceCount; ++face) {
+    for (unsigned int edge = 0; edge < 3; ++edge) {
+      const auto a = vertexId(face * 3 + edge);
+      const auto b = vertexId(face * 3 + (edge + 1) % 3);
+      if (a == b) {
+        // Degenerated edge
+        continue;
+      }
+      const auto key = (static_cast<uint64_t>(std::min(a, b)) << 32)
+                       | static_cast<uint64_t>(std::max(a, b));
+      edges.emplace_back(key, static_cast<uint32_t>(face * 3 + edge));
+    }
+  }
+  std::sort(edges.begin(), edges.end());
+
+  // Pairs the consecutive faces of each group sharing an edge, the first
+  // faces of non manifold edges being linked first
+  for (size_t begin = 0; begin < edges.size();) {
+    auto end = begin + 1;
+    while (end < edges.size() && edges[end].first == edges[begin].first) {
+      ++end;
+    }
+
+    auto pending = edges.size();
+    for (auto i = begin; i < end; ++i) {
+      if (pending == edges.size()) {
+        pending = i;
+        continue;
+      }
+      const auto face      = edges[pending].second / 3;
+      const auto otherFace = edges[i].second / 3;
+      if (face == otherFace) {
+        continue;
+      }
+      adjacencies[face].edges[edges[pending].second % 3]
+        = static_cast<int>(otherFace);
+      adjacencies[otherFace].edges[edges[i].second % 3]
+        = static_cast<int>(face);
+      ++adjacencies[face].edgesConnectedCount;
+      ++adjacencies[otherFace].edgesConnectedCount;
+      pending = edges.size();
+    }
+
+    begin = end;
+  }
+
+  return adjacencies;
+}
+
+std::vector<Vector3> FaceAdjacenciesBuilder::ComputeFaceNormals(
+  const std::vector<FaceAdjacencies>& adjacencies)
+{
+  std::vector<Vector3> faceNormals;
+  faceNormals.reserve(adjacencies.size());
+  for (const auto& face : adjacencies) {
+    auto faceNormal
+      = Vector3::Cross(face.p1.subtract(face.p0), face.p2.subtract(face.p1));
+    faceNormal.normalize();
+    faceNormals.emplace_back(faceNormal);
+  }
+  return faceNormals;
+}
+
+} // end of namespace BABYLON
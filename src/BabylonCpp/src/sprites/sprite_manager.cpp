@@ -257,20 +257,20 @@ SpriteManager::intersects(const Ray ray, const CameraPtr& camera,
   if (currentSprite) {
     PickingInfo result;
 
-    cameraView.invertToRef(Tmp::MatrixArray[0]);
+    cameraView.invertToRef(Tmp::MatrixArray()[0]);
     result.hit          = true;
     result.pickedSprite = currentSprite;
     result.distance     = distance;
 
     // Get picked point
-    auto& direction = Tmp::Vector3Array[0];
+    auto& direction = Tmp::Vector3Array()[0];
     direction.copyFrom(ray.direction);
     direction.normalize();
     direction.scaleInPlace(distance);
 
     ray.origin.addToRef(direction, pickedPoint);
     result.pickedPoint
-      = Vector3::TransformCoordinates(pickedPoint, Tmp::MatrixArray[0]);
+      = Vector3::TransformCoordinates(pickedPoint, Tmp::MatrixArray()[0]);
 
     return result;
   }
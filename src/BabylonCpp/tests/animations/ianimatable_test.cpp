@@ -0,0 +1,56 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <babylon/animations/ianimatable.h>
+
+namespace {
+
+class AnimatableStub : public BABYLON::IAnimatable {
+
+public:
+  BABYLON::Type type() const override
+  {
+    return BABYLON::Type::NODE;
+  }
+
+  void setProperty(const std::vector<std::string>& targetPropertyPath,
+                   const BABYLON::AnimationValue& value) override
+  {
+    lastPath  = targetPropertyPath;
+    lastValue = value.get<float>();
+  }
+
+  std::vector<std::string> lastPath;
+  float lastValue = 0.f;
+
+}; // end of class AnimatableStub
+
+} // end of anonymous namespace
+
+TEST(TestIAnimatable, BindPropertyComponent)
+{
+  using namespace BABYLON;
+
+  Vector3 vector(1.f, 2.f, 3.f);
+  EXPECT_EQ(IAnimatable::bindProperty("x", vector), &vector.x);
+  EXPECT_EQ(IAnimatable::bindProperty("z", vector), &vector.z);
+  EXPECT_EQ(IAnimatable::bindProperty("w", vector), nullptr);
+
+  Color4 color(0.f, 0.f, 0.f, 1.f);
+  EXPECT_EQ(IAnimatable::bindProperty("a", color), &color.a);
+
+  IAnimatable::setProperty("y", vector, 5.f);
+  EXPECT_FLOAT_EQ(vector.y, 5.f);
+}
+
+TEST(TestIAnimatable, BindPropertyForwardsToSetProperty)
+{
+  using namespace BABYLON;
+
+  AnimatableStub animatable;
+  auto setter = animatable.bindProperty({"position", "x"});
+  ASSERT_TRUE(setter);
+  setter(AnimationValue(4.f));
+  EXPECT_THAT(animatable.lastPath, ::testing::ElementsAre("position", "x"));
+  EXPECT_FLOAT_EQ(animatable.lastValue, 4.f);
+}
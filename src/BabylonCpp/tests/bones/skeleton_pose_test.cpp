@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include <babylon/bones/skeleton_pose.h>
+#include <babylon/math/matrix.h>
+#include <babylon/math/quaternion.h>
+#include <babylon/math/vector3.h>
+
+TEST(TestSkeletonPose, SetHierarchy)
+{
+  using namespace BABYLON;
+
+  SkeletonPose pose;
+  // Children listed before their parents
+  EXPECT_TRUE(pose.setHierarchy({2, -1, 1, 0}, {0, 1, 2, 3}));
+  EXPECT_EQ(pose.boneCount(), 4ull);
+
+  // Cycle
+  EXPECT_FALSE(pose.setHierarchy({1, 0}, {0, 1}));
+  EXPECT_EQ(pose.boneCount(), 0ull);
+
+  // Unknown parent
+  EXPECT_FALSE(pose.setHierarchy({-1, 5}, {0, 1}));
+}
+
+TEST(TestSkeletonPose, Evaluate)
+{
+  using namespace BABYLON;
+
+  // Bone 0 is the child of bone 2, bone 3 is the child of bone 0 and bone 1 is
+  // a root without transform matrix
+  const std::vector<int> parents{2, -1, -1, 0};
+  const std::vector<int> outputs{1, -1, 0, 2};
+  std::vector<Matrix> locals, inverseBinds;
+  for (size_t i = 0; i < parents.size(); ++i) {
+    const auto f = static_cast<float>(i + 1);
+    locals.emplace_back(Matrix::Compose(
+      Vector3(1.f, 0.5f * f, 1.f),
+      Quaternion::RotationYawPitchRoll(0.3f * f, -0.2f, 0.1f * f),
+      Vector3(f, -f, 2.f)));
+    inverseBinds.emplace_back(Matrix::Translation(-f, 0.f, f));
+  }
+  auto skinMatrix = Matrix::RotationY(0.7f);
+
+  SkeletonPose pose;
+  ASSERT_TRUE(pose.setHierarchy(parents, outputs));
+  for (size_t i = 0; i < parents.size(); ++i) {
+    pose.setLocalMatrix(i, locals[i].m().data());
+    pose.setInverseBindMatrix(i, inverseBinds[i].m().data());
+  }
+
+  Float32Array transformMatrices(3 * 16, -1.f);
+  pose.evaluate(skinMatrix, transformMatrices);
+
+  std::vector<Matrix> worlds(parents.size());
+  for (auto i : {2, 1, 0, 3}) {
+    worlds[i] = locals[i].multiply(
+      parents[i] < 0 ? skinMatrix : worlds[static_cast<size_t>(parents[i])]);
+  }
+
+  Matrix world;
+  for (size_t i = 0; i < parents.size(); ++i) {
+    pose.getWorldMatrixToRef(i, world);
+    for (size_t k = 0; k < 16; ++k) {
+      EXPECT_NEAR(world.m()[k], worlds[i].m()[k], 1e-5f);
+    }
+    if (outputs[i] < 0) {
+      continue;
+    }
+    const auto expected = inverseBinds[i].multiply(worlds[i]);
+    for (size_t k = 0; k < 16; ++k) {
+      EXPECT_NEAR(transformMatrices[static_cast<size_t>(outputs[i]) * 16 + k],
+                  expected.m()[k], 1e-5f);
+    }
+  }
+
+  // Without initial skin matrix, the root bones world matrices are their local
+  // matrices
+  pose.evaluate(std::nullopt, transformMatrices);
+  pose.getWorldMatrixToRef(1, world);
+  EXPECT_EQ(world.m(), locals[1].m());
+}
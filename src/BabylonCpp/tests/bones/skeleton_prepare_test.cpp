@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/engine.h>
+#include <babylon/engines/headless/headless_canvas.h>
+#include <babylon/engines/scene.h>
+#include <babylon/math/matrix.h>
+#include <babylon/meshes/mesh.h>
+
+namespace {
+
+void ExpectNearMatrix(const BABYLON::Matrix& lhs, const BABYLON::Matrix& rhs)
+{
+  for (size_t i = 0; i < 16; ++i) {
+    EXPECT_NEAR(lhs.m()[i], rhs.m()[i], 1e-5f) << "element " << i;
+  }
+}
+
+// World matrices of the bones of two skeletons, the hand bone of the second
+// skeleton being the child of the arm bone of the first one
+std::vector<BABYLON::Matrix> EvaluateLinkedSkeletons(bool parallel,
+                                                     bool batched)
+{
+  using namespace BABYLON;
+
+  auto canvas = std::make_unique<HeadlessCanvas>();
+  auto engine = Engine::New(canvas.get());
+  auto scene  = Scene::New(engine.get());
+  FreeCamera::New("camera", Vector3(0.f, 0.f, -10.f), scene.get());
+  scene->parallelSkeletonsEvaluation = parallel;
+
+  auto body = Skeleton::New("body", "body", scene.get());
+  auto root = Bone::New("root", body.get(), nullptr,
+                        Matrix::Translation(1.f, 0.f, 0.f));
+  auto arm  = Bone::New("arm", body.get(), root.get(),
+                        Matrix::Translation(0.f, 2.f, 0.f));
+  auto tool = Skeleton::New("tool", "tool", scene.get());
+  auto hand = Bone::New("hand", tool.get(), arm.get(),
+                        Matrix::Translation(0.f, 0.f, 3.f));
+  body->useBatchedBoneEvaluation = batched;
+  tool->useBatchedBoneEvaluation = batched;
+
+  // The serial path prepares the skeletons in the activation order of their
+  // meshes, the parallel path must order them by itself
+  MeshPtr bodyMesh;
+  if (!parallel) {
+    bodyMesh = Mesh::CreateBox("bodyMesh", 1.f, scene.get());
+  }
+  auto toolMesh = Mesh::CreateBox("toolMesh", 1.f, scene.get());
+  if (parallel) {
+    bodyMesh = Mesh::CreateBox("bodyMesh", 1.f, scene.get());
+  }
+  bodyMesh->skeleton = body;
+  toolMesh->skeleton = tool;
+
+  std::vector<Matrix> worldMatrices;
+  for (unsigned int frame = 0; frame < 3; ++frame) {
+    arm->updateMatrix(Matrix::RotationZ(0.4f * static_cast<float>(frame + 1))
+                        .multiply(Matrix::Translation(0.f, 2.f, 0.f)));
+    hand->markAsDirty();
+    engine->beginFrame();
+    scene->render();
+    engine->endFrame();
+    for (const auto& bone : {root, arm, hand}) {
+      worldMatrices.emplace_back(bone->getWorldMatrix());
+    }
+
+    const auto expected = hand->getLocalMatrix()
+                            .multiply(arm->getLocalMatrix())
+                            .multiply(root->getLocalMatrix());
+    ExpectNearMatrix(expected, hand->getWorldMatrix());
+  }
+  return worldMatrices;
+}
+
+} // end of anonymous namespace
+
+TEST(TestSkeletonPrepare, LinkedSkeletons)
+{
+  const auto serial          = EvaluateLinkedSkeletons(false, false);
+  const auto batchedSerial   = EvaluateLinkedSkeletons(false, true);
+  const auto parallel        = EvaluateLinkedSkeletons(true, false);
+  const auto batchedParallel = EvaluateLinkedSkeletons(true, true);
+  ASSERT_EQ(serial.size(), 9u);
+  for (const auto* worldMatrices :
+       {&batchedSerial, &parallel, &batchedParallel}) {
+    ASSERT_EQ(worldMatrices->size(), serial.size());
+    for (size_t i = 0; i < serial.size(); ++i) {
+      ExpectNearMatrix(serial[i], (*worldMatrices)[i]);
+    }
+  }
+}
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <babylon/core/logging.h>
+
+namespace {
+
+std::vector<BABYLON::LogMessage> _messages;
+std::thread::id _listenerThreadId;
+
+void onLogMessage(const BABYLON::LogMessage& logMessage)
+{
+  _listenerThreadId = std::this_thread::get_id();
+  _messages.emplace_back(logMessage);
+}
+
+auto _logListener = SA::delegate<void(const BABYLON::LogMessage&)>::create<
+  &onLogMessage>();
+
+std::mutex _markersMutex;
+std::vector<std::string> _markers;
+
+void onMarkerMessage(const BABYLON::LogMessage& logMessage)
+{
+  std::lock_guard<std::mutex> lock{_markersMutex};
+  _markers.emplace_back(logMessage.message());
+}
+
+auto _markerListener = SA::delegate<void(const BABYLON::LogMessage&)>::create<
+  &onMarkerMessage>();
+
+} // end of anonymous namespace
+
+TEST(TestLogger, AsynchronousDispatch)
+{
+  using namespace BABYLON;
+
+  auto& logger = Logger::Instance();
+  _messages.clear();
+  logger.registerLogMessageListener(LogLevels::LEVEL_WARN, _logListener);
+  const int lineNumber = __LINE__ + 1;
+  BABYLON_LOG_WARN("Context" << 1, "value", 42, 1.5f)
+  BABYLON_LOGF_WARN("Context", "%s=%d", "count", 3)
+  logger.flush();
+  logger.unregisterLogMessageListener(_logListener);
+
+  ASSERT_EQ(_messages.size(), 2ull);
+  EXPECT_EQ(_messages[0].level(), LogLevels::LEVEL_WARN);
+  EXPECT_EQ(_messages[0].context(), "Context1");
+  EXPECT_EQ(_messages[0].message(), "value 42 1.5");
+  EXPECT_EQ(_messages[0].lineNumber(), lineNumber);
+  EXPECT_EQ(_messages[1].message(), "count=3");
+  EXPECT_NE(_listenerThreadId, std::this_thread::get_id());
+}
+
+TEST(TestLogger, SynchronousDispatch)
+{
+  using namespace BABYLON;
+
+  auto& logger = Logger::Instance();
+  _messages.clear();
+  logger.registerLogMessageListener(LogLevels::LEVEL_WARN, _logListener);
+  logger.setAsynchronous(false);
+  BABYLON_LOG_WARN("Context", "message")
+  logger.setAsynchronous(true);
+  logger.unregisterLogMessageListener(_logListener);
+
+  ASSERT_EQ(_messages.size(), 1ull);
+  EXPECT_EQ(_messages[0].message(), "message");
+  EXPECT_EQ(_listenerThreadId, std::this_thread::get_id());
+}
+
+TEST(TestLogger, RateLimiting)
+{
+  using namespace BABYLON;
+
+  auto& logger = Logger::Instance();
+  _messages.clear();
+  logger.registerLogMessageListener(LogLevels::LEVEL_WARN, _logListener);
+  const auto maxMessagesPerSecond = logger.maxMessagesPerSecond();
+  logger.setMaxMessagesPerSecond(5);
+  for (int i = 0; i < 20; ++i) {
+    BABYLON_LOG_WARN("Context", "message", i)
+  }
+  logger.flush();
+  logger.setMaxMessagesPerSecond(maxMessagesPerSecond);
+  logger.unregisterLogMessageListener(_logListener);
+
+  // Unless the loop spans two windows
+  ASSERT_GE(_messages.size(), 5ull);
+  EXPECT_LE(_messages.size(), 10ull);
+  EXPECT_EQ(_messages[4].message(), "message 4");
+}
+
+TEST(TestLogger, TruncatedMessage)
+{
+  using namespace BABYLON;
+
+  auto& logger = Logger::Instance();
+  _messages.clear();
+  logger.registerLogMessageListener(LogLevels::LEVEL_WARN, _logListener);
+  BABYLON_LOG_WARN("Context", std::string(1000, 'a'))
+  BABYLON_LOGF_WARN("Context", "%s", std::string(1000, 'b').c_str())
+  logger.flush();
+  logger.unregisterLogMessageListener(_logListener);
+
+  ASSERT_EQ(_messages.size(), 2ull);
+  EXPECT_EQ(_messages[0].message(),
+            std::string(LogRecord::TextCapacity - 7, 'a'));
+  EXPECT_EQ(_messages[1].message(),
+            std::string(LogRecord::TextCapacity - 8, 'b'));
+}
+
+TEST(TestLogger, FlushWithConcurrentProducers)
+{
+  using namespace BABYLON;
+
+  auto& logger = Logger::Instance();
+  logger.registerLogMessageListener(LogLevels::LEVEL_WARN, _markerListener);
+  const auto maxMessagesPerSecond = logger.maxMessagesPerSecond();
+  logger.setMaxMessagesPerSecond(0);
+
+  // Records from other threads are pushed while the markers are flushed, the
+  // budget keeps the queue from being full
+  std::atomic<bool> done{false};
+  std::atomic<int> budget{0};
+  std::vector<std::thread> producers;
+  for (int i = 0; i < 8; ++i) {
+    producers.emplace_back([&done, &budget]() {
+      while (!done) {
+        if (budget.fetch_sub(1) > 0) {
+          BABYLON_LOG_INFO("Producer", "record")
+        }
+        else {
+          budget.fetch_add(1);
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  // Markers which had not reached the listener when flush returned
+  int missedMarkers = 0;
+  for (int i = 0; i < 2000; ++i) {
+    budget = 256;
+    BABYLON_LOG_WARN("Context", "marker", i)
+    logger.flush();
+    std::lock_guard<std::mutex> lock{_markersMutex};
+    const auto marker = "marker " + std::to_string(i);
+    if (std::find(_markers.begin(), _markers.end(), marker) == _markers.end()) {
+      ++missedMarkers;
+    }
+    _markers.clear();
+  }
+
+  done = true;
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  logger.setMaxMessagesPerSecond(maxMessagesPerSecond);
+  logger.unregisterLogMessageListener(_markerListener);
+
+  EXPECT_EQ(missedMarkers, 0);
+}
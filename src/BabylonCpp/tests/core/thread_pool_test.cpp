@@ -0,0 +1,68 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <babylon/core/thread_pool.h>
+
+TEST(TestThreadPool, ParallelForVisitsEveryElementOnce)
+{
+  using namespace BABYLON;
+
+  ThreadPool pool(4);
+  std::vector<int> visits(10007, 0);
+  pool.parallelFor(visits.size(), 64, [&visits](size_t begin, size_t end) {
+    for (auto i = begin; i < end; ++i) {
+      ++visits[i];
+    }
+  });
+
+  for (const auto& visit : visits) {
+    EXPECT_EQ(visit, 1);
+  }
+}
+
+TEST(TestThreadPool, ParallelForRethrowsExceptions)
+{
+  using namespace BABYLON;
+
+  ThreadPool pool(2);
+  std::atomic<size_t> processed{0};
+  EXPECT_THROW(pool.parallelFor(100, 1,
+                                [&processed](size_t begin, size_t /*end*/) {
+                                  ++processed;
+                                  if (begin == 42) {
+                                    throw std::runtime_error("chunk 42");
+                                  }
+                                }),
+               std::runtime_error);
+  EXPECT_EQ(processed.load(), 100u);
+}
+
+TEST(TestThreadPool, NestedParallelFor)
+{
+  using namespace BABYLON;
+
+  ThreadPool pool(2);
+  std::atomic<size_t> count{0};
+  pool.parallelFor(8, 1, [&pool, &count](size_t /*begin*/, size_t /*end*/) {
+    pool.parallelFor(8, 1, [&count](size_t begin, size_t end) {
+      count += end - begin;
+    });
+  });
+  EXPECT_EQ(count.load(), 64u);
+}
+
+TEST(TestThreadPool, Enqueue)
+{
+  using namespace BABYLON;
+
+  ThreadPool pool(1);
+  bool ranOnWorker = false;
+  pool.enqueue([&pool, &ranOnWorker]() { ranOnWorker = pool.isWorkerThread(); })
+    .wait();
+  EXPECT_TRUE(ranOnWorker);
+  EXPECT_FALSE(pool.isWorkerThread());
+}
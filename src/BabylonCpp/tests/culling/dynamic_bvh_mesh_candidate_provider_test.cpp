@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/culling/dynamic_bvh_mesh_candidate_provider.h>
+#include <babylon/engines/engine.h>
+#include <babylon/engines/headless/headless_canvas.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/mesh.h>
+
+namespace {
+
+std::vector<BABYLON::AbstractMesh*> RenderActiveMeshes(BABYLON::Engine* engine,
+                                                       BABYLON::Scene* scene)
+{
+  engine->beginFrame();
+  scene->render();
+  engine->endFrame();
+  auto activeMeshes = scene->getActiveMeshes();
+  std::sort(activeMeshes.begin(), activeMeshes.end());
+  return activeMeshes;
+}
+
+} // end of anonymous namespace
+
+TEST(TestDynamicBVHMeshCandidateProvider, SameActiveMeshesAsDefault)
+{
+  using namespace BABYLON;
+
+  auto canvas = std::make_unique<HeadlessCanvas>();
+  auto engine = Engine::New(canvas.get());
+  auto scene  = Scene::New(engine.get());
+  FreeCamera::New("camera", Vector3(0.f, 0.f, -30.f), scene.get());
+  // The candidates of the provider are evaluated on the worker threads
+  scene->parallelActiveMeshesEvaluation          = true;
+  scene->parallelActiveMeshesEvaluationThreshold = 64;
+
+  // Moving boxes crossing the frustum, a few of them parented to another one
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<float> distribution(-40.f, 40.f);
+  std::vector<MeshPtr> boxes;
+  std::vector<Vector3> velocities;
+  for (unsigned int i = 0; i < 400; ++i) {
+    auto box = Mesh::CreateBox("box" + std::to_string(i), 1.f, scene.get());
+    box->position = Vector3(distribution(generator), distribution(generator),
+                            distribution(generator));
+    if (i % 50 == 49) {
+      box->setParent(boxes.front().get());
+    }
+    boxes.emplace_back(box);
+    velocities.emplace_back(distribution(generator) * 0.05f,
+                            distribution(generator) * 0.05f,
+                            distribution(generator) * 0.05f);
+  }
+
+  DynamicBVHMeshCandidateProvider provider(scene.get());
+  RenderActiveMeshes(engine.get(), scene.get());
+  for (unsigned int frame = 0; frame < 10; ++frame) {
+    for (size_t i = 0; i < boxes.size(); ++i) {
+      boxes[i]->position().addInPlace(velocities[i]);
+    }
+
+    scene->setActiveMeshCandidateProvider(&provider);
+    const auto activeMeshes = RenderActiveMeshes(engine.get(), scene.get());
+    scene->setActiveMeshCandidateProvider(nullptr);
+    const auto defaultActiveMeshes
+      = RenderActiveMeshes(engine.get(), scene.get());
+
+    EXPECT_GT(activeMeshes.size(), 0u);
+    EXPECT_LT(activeMeshes.size(), boxes.size());
+    EXPECT_EQ(activeMeshes, defaultActiveMeshes) << "frame " << frame;
+  }
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include <babylon/culling/dynamic_bvh.h>
+#include <babylon/math/frustum.h>
+#include <babylon/math/matrix.h>
+#include <babylon/math/plane.h>
+
+namespace {
+
+// Returns true if the box is not entirely behind one of the planes
+bool IsInFrustum(const BABYLON::Vector3& minimum,
+                 const BABYLON::Vector3& maximum,
+                 const std::array<BABYLON::Plane, 6>& frustumPlanes)
+{
+  for (const auto& plane : frustumPlanes) {
+    const BABYLON::Vector3 positive(
+      plane.normal.x >= 0.f ? maximum.x : minimum.x,
+      plane.normal.y >= 0.f ? maximum.y : minimum.y,
+      plane.normal.z >= 0.f ? maximum.z : minimum.z);
+    if (plane.dotCoordinate(positive) < 0.f) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // end of anonymous namespace
+
+TEST(TestDynamicBVH, CreateMoveDestroy)
+{
+  using namespace BABYLON;
+
+  DynamicBVH bvh;
+  EXPECT_EQ(bvh.proxyCount(), 0u);
+  EXPECT_EQ(bvh.height(), 0);
+
+  const auto proxyA = bvh.createProxy(Vector3(0.f, 0.f, 0.f),
+                                      Vector3(1.f, 1.f, 1.f), 10);
+  const auto proxyB = bvh.createProxy(Vector3(5.f, 0.f, 0.f),
+                                      Vector3(6.f, 1.f, 1.f), 20);
+  EXPECT_EQ(bvh.proxyCount(), 2u);
+  EXPECT_EQ(bvh.height(), 1);
+  EXPECT_EQ(bvh.getData(proxyA), 10u);
+  EXPECT_EQ(bvh.getData(proxyB), 20u);
+
+  // Small moves stay in the enlarged bounds
+  EXPECT_FALSE(bvh.moveProxy(proxyA, Vector3(0.01f, 0.f, 0.f),
+                             Vector3(1.01f, 1.f, 1.f)));
+  EXPECT_TRUE(bvh.moveProxy(proxyA, Vector3(10.f, 0.f, 0.f),
+                            Vector3(11.f, 1.f, 1.f)));
+  EXPECT_EQ(bvh.getData(proxyA), 10u);
+
+  bvh.destroyProxy(proxyB);
+  EXPECT_EQ(bvh.proxyCount(), 1u);
+  EXPECT_EQ(bvh.height(), 0);
+
+  // Free nodes are reused
+  const auto proxyC = bvh.createProxy(Vector3(0.f, 0.f, 0.f),
+                                      Vector3(1.f, 1.f, 1.f), 30);
+  EXPECT_EQ(bvh.getData(proxyC), 30u);
+  EXPECT_EQ(bvh.proxyCount(), 2u);
+}
+
+TEST(TestDynamicBVH, SelectAsLinearTest)
+{
+  using namespace BABYLON;
+
+  std::mt19937 generator(11);
+  std::uniform_real_distribution<float> coordinate(-100.f, 100.f);
+  std::uniform_real_distribution<float> extent(0.5f, 4.f);
+  std::uniform_real_distribution<float> step(-3.f, 3.f);
+
+  struct Box {
+    Vector3 minimum;
+    Vector3 maximum;
+    int proxyId;
+  };
+  std::vector<Box> boxes(1000);
+  DynamicBVH bvh;
+  for (size_t index = 0; index < boxes.size(); ++index) {
+    auto& box   = boxes[index];
+    box.minimum = Vector3(coordinate(generator), coordinate(generator),
+                          coordinate(generator));
+    box.maximum = box.minimum.add(
+      Vector3(extent(generator), extent(generator), extent(generator)));
+    box.proxyId = bvh.createProxy(box.minimum, box.maximum, index);
+  }
+
+  Vector3 target(0.f, 0.f, 0.f);
+  auto projection = Matrix::PerspectiveFovLH(0.8f, 1.5f, 1.f, 150.f);
+  std::vector<size_t> selection;
+  for (unsigned int frame = 0; frame < 50; ++frame) {
+    // Move some boxes and remove a few others
+    for (size_t index = 0; index < boxes.size(); ++index) {
+      auto& box = boxes[index];
+      if (box.proxyId == DynamicBVH::NullNode || index % 3 != frame % 3) {
+        continue;
+      }
+      if (index % 97 == frame) {
+        bvh.destroyProxy(box.proxyId);
+        box.proxyId = DynamicBVH::NullNode;
+        continue;
+      }
+      const Vector3 offset(step(generator), step(generator), step(generator));
+      box.minimum.addInPlace(offset);
+      box.maximum.addInPlace(offset);
+      bvh.moveProxy(box.proxyId, box.minimum, box.maximum);
+    }
+
+    const Vector3 eye(coordinate(generator), coordinate(generator),
+                      coordinate(generator));
+    auto view                = Matrix::LookAtLH(eye, target, Vector3::Up());
+    const auto frustumPlanes = Frustum::GetPlanes(view.multiply(projection));
+
+    selection.clear();
+    bvh.select(frustumPlanes, selection);
+
+    // No duplicate and every box in the frustum is selected
+    std::sort(selection.begin(), selection.end());
+    EXPECT_TRUE(std::adjacent_find(selection.begin(), selection.end())
+                == selection.end());
+    size_t proxyCount = 0;
+    for (size_t index = 0; index < boxes.size(); ++index) {
+      const auto& box = boxes[index];
+      if (box.proxyId == DynamicBVH::NullNode) {
+        continue;
+      }
+      ++proxyCount;
+      const auto isSelected
+        = std::binary_search(selection.begin(), selection.end(), index);
+      if (IsInFrustum(box.minimum, box.maximum, frustumPlanes)) {
+        EXPECT_TRUE(isSelected);
+      }
+    }
+    EXPECT_EQ(bvh.proxyCount(), proxyCount);
+    EXPECT_LT(selection.size(), proxyCount);
+
+    // The rotations keep the tree balanced
+    EXPECT_LE(bvh.height(), 20);
+  }
+}
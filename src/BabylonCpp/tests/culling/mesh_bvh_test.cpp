@@ -0,0 +1,207 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+
+#include <babylon/culling/mesh_bvh.h>
+#include <babylon/culling/ray.h>
+
+namespace {
+
+struct TestMesh {
+  std::vector<BABYLON::Vector3> positions;
+  BABYLON::IndicesArray indices;
+};
+
+// Wavy grid of size x size quads in the XZ plane
+TestMesh CreateGrid(unsigned int size)
+{
+  TestMesh mesh;
+  for (unsigned int z = 0; z <= size; ++z) {
+    for (unsigned int x = 0; x <= size; ++x) {
+      const auto fx = static_cast<float>(x);
+      const auto fz = static_cast<float>(z);
+      mesh.positions.emplace_back(
+        fx, std::sin(fx * 0.3f) * std::cos(fz * 0.2f) * 2.f, fz);
+    }
+  }
+  for (unsigned int z = 0; z < size; ++z) {
+    for (unsigned int x = 0; x < size; ++x) {
+      const auto i = z * (size + 1) + x;
+      mesh.indices.insert(mesh.indices.end(),
+                          {i, i + size + 1, i + 1, i + 1, i + size + 1,
+                           i + size + 2});
+    }
+  }
+  return mesh;
+}
+
+std::optional<BABYLON::IntersectionInfo>
+IntersectsLinearly(BABYLON::Ray& ray, const TestMesh& mesh, size_t indexStart,
+                   size_t indexCount)
+{
+  std::optional<BABYLON::IntersectionInfo> intersectInfo = std::nullopt;
+  for (auto index = indexStart; index < indexStart + indexCount; index += 3) {
+    const auto currentIntersectInfo
+      = ray.intersectsTriangle(mesh.positions[mesh.indices[index]],
+                               mesh.positions[mesh.indices[index + 1]],
+                               mesh.positions[mesh.indices[index + 2]]);
+    if (currentIntersectInfo && currentIntersectInfo->distance >= 0.f
+        && (!intersectInfo
+            || currentIntersectInfo->distance < intersectInfo->distance)) {
+      intersectInfo         = currentIntersectInfo;
+      intersectInfo->faceId = index / 3;
+    }
+  }
+  return intersectInfo;
+}
+
+} // end of anonymous namespace
+
+TEST(TestMeshBVH, Structure)
+{
+  using namespace BABYLON;
+
+  const auto mesh = CreateGrid(32);
+  MeshBVH bvh(mesh.positions, mesh.indices);
+  EXPECT_EQ(bvh.primitiveCount(), mesh.indices.size() / 3);
+
+  // Every triangle is in exactly one leaf, no leaf is larger than allowed
+  size_t leafTriangles = 0;
+  for (const auto& node : bvh.nodes()) {
+    EXPECT_LE(node.count, MeshBVH::MaxLeafPrimitives);
+    leafTriangles += node.count;
+  }
+  EXPECT_EQ(leafTriangles, bvh.primitiveCount());
+
+  const MeshBVH emptyBVH({}, {});
+  EXPECT_TRUE(emptyBVH.nodes().empty());
+}
+
+TEST(TestMeshBVH, IntersectsRayAsLinearTest)
+{
+  using namespace BABYLON;
+
+  const auto mesh = CreateGrid(40);
+  const MeshBVH bvh(mesh.positions, mesh.indices);
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<float> coordinate(-5.f, 45.f);
+  const auto indexCount    = mesh.indices.size();
+  const auto subMeshStart  = indexCount / 3 / 3 * 3;
+  const auto subMeshLength = indexCount / 2 / 3 * 3;
+  for (unsigned int i = 0; i < 500; ++i) {
+    const Vector3 origin(coordinate(generator), 10.f, coordinate(generator));
+    const Vector3 target(coordinate(generator), -5.f, coordinate(generator));
+    Ray ray(origin, (target - origin).normalize());
+
+    const auto expected = IntersectsLinearly(ray, mesh, 0, indexCount);
+    const auto result
+      = bvh.intersectsRay(ray, mesh.positions, mesh.indices, 0, indexCount,
+                          false);
+    ASSERT_EQ(result.has_value(), expected.has_value());
+    if (expected) {
+      EXPECT_EQ(result->faceId, expected->faceId);
+      EXPECT_FLOAT_EQ(result->distance, expected->distance);
+    }
+
+    const auto fastResult = bvh.intersectsRay(
+      ray, mesh.positions, mesh.indices, 0, indexCount, true);
+    EXPECT_EQ(fastResult.has_value(), expected.has_value());
+
+    // Sub-range of the index buffer, as used by sub meshes
+    const auto expectedInRange
+      = IntersectsLinearly(ray, mesh, subMeshStart, subMeshLength);
+    const auto resultInRange
+      = bvh.intersectsRay(ray, mesh.positions, mesh.indices, subMeshStart,
+                          subMeshLength, false);
+    ASSERT_EQ(resultInRange.has_value(), expectedInRange.has_value());
+    if (expectedInRange) {
+      EXPECT_EQ(resultInRange->faceId, expectedInRange->faceId);
+    }
+  }
+}
+
+TEST(TestMeshBVH, IntersectsBoxAsLinearTest)
+{
+  using namespace BABYLON;
+
+  const auto mesh = CreateGrid(40);
+  const MeshBVH bvh(mesh.positions, mesh.indices);
+
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<float> coordinate(-2.f, 42.f);
+  std::uniform_real_distribution<float> extent(0.f, 4.f);
+  for (unsigned int i = 0; i < 200; ++i) {
+    const Vector3 minimum(coordinate(generator), -1.f, coordinate(generator));
+    const Vector3 maximum = minimum.add(
+      Vector3(extent(generator), extent(generator), extent(generator)));
+
+    std::vector<size_t> expected;
+    for (size_t index = 0; index < mesh.indices.size(); index += 3) {
+      auto triangleMinimum = mesh.positions[mesh.indices[index]];
+      auto triangleMaximum = triangleMinimum;
+      for (size_t j = 1; j < 3; ++j) {
+        const auto& position = mesh.positions[mesh.indices[index + j]];
+        triangleMinimum.minimizeInPlace(position);
+        triangleMaximum.maximizeInPlace(position);
+      }
+      if (triangleMinimum.x <= maximum.x && triangleMaximum.x >= minimum.x
+          && triangleMinimum.y <= maximum.y && triangleMaximum.y >= minimum.y
+          && triangleMinimum.z <= maximum.z && triangleMaximum.z >= minimum.z) {
+        expected.emplace_back(index);
+      }
+    }
+
+    std::vector<size_t> result;
+    bvh.intersectsBox(minimum, maximum, mesh.positions, mesh.indices, 0,
+                      mesh.indices.size(), result);
+    EXPECT_EQ(result, expected);
+  }
+}
+
+TEST(TestMeshBVH, RayCandidatesOfBoxes)
+{
+  using namespace BABYLON;
+
+  std::mt19937 generator(3);
+  std::uniform_real_distribution<float> coordinate(-50.f, 50.f);
+  std::uniform_real_distribution<float> extent(0.5f, 5.f);
+  std::vector<MinMax> boxes(300);
+  for (auto& box : boxes) {
+    box.min = Vector3(coordinate(generator), coordinate(generator),
+                      coordinate(generator));
+    box.max = box.min.add(
+      Vector3(extent(generator), extent(generator), extent(generator)));
+  }
+  const MeshBVH bvh(boxes);
+  EXPECT_EQ(bvh.primitiveCount(), boxes.size());
+
+  for (unsigned int i = 0; i < 100; ++i) {
+    const Vector3 origin(coordinate(generator), coordinate(generator),
+                         coordinate(generator));
+    const Vector3 target(coordinate(generator), coordinate(generator),
+                         coordinate(generator));
+    const Ray ray(origin, (target - origin).normalize());
+
+    // Every box crossed by the ray is visited
+    std::vector<bool> visited(boxes.size(), false);
+    bvh.forEachRayCandidate(ray, [&](size_t box) {
+      visited[box] = true;
+      return ray.length;
+    });
+    for (size_t box = 0; box < boxes.size(); ++box) {
+      if (ray.intersectsBoxMinMax(boxes[box].min, boxes[box].max)) {
+        EXPECT_TRUE(visited[box]);
+      }
+    }
+
+    // A negative distance stops the traversal
+    size_t visitCount = 0;
+    bvh.forEachRayCandidate(ray, [&](size_t /*box*/) {
+      ++visitCount;
+      return -1.f;
+    });
+    EXPECT_LE(visitCount, 1u);
+  }
+}
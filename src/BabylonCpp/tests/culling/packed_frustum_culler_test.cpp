@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <babylon/culling/bounding_info.h>
+#include <babylon/culling/packed_frustum_culler.h>
+#include <babylon/engines/constants.h>
+#include <babylon/math/frustum.h>
+#include <babylon/math/matrix.h>
+#include <babylon/math/plane.h>
+#include <babylon/math/quaternion.h>
+
+TEST(TestPackedFrustumCuller, CullAsBoundingInfo)
+{
+  using namespace BABYLON;
+
+  std::mt19937 generator(17);
+  std::uniform_real_distribution<float> coordinate(-60.f, 60.f);
+  std::uniform_real_distribution<float> offset(-4.f, 4.f);
+  std::uniform_real_distribution<float> size(0.2f, 3.f);
+  std::uniform_real_distribution<float> angle(-3.f, 3.f);
+
+  // Clusters of boxes, so that some blocks are entirely in or out of the
+  // frustum, with a count which does not fill the last block
+  std::vector<BoundingInfo> boundingInfos;
+  for (unsigned int cluster = 0; cluster < 40; ++cluster) {
+    const Vector3 clusterCenter(coordinate(generator), coordinate(generator),
+                                coordinate(generator));
+    for (unsigned int i = 0; i < 25; ++i) {
+      const Vector3 extent(size(generator), size(generator), size(generator));
+      BoundingInfo boundingInfo(extent.negate(), extent);
+      const auto world = Matrix::Compose(
+        Vector3(size(generator), size(generator), size(generator)),
+        Quaternion::RotationYawPitchRoll(angle(generator), angle(generator),
+                                         angle(generator)),
+        clusterCenter.add(
+          Vector3(offset(generator), offset(generator), offset(generator))));
+      boundingInfo.update(world);
+      boundingInfos.emplace_back(boundingInfo);
+    }
+  }
+
+  PackedFrustumCuller culler;
+  std::vector<uint8_t> visible;
+  auto projection = Matrix::PerspectiveFovLH(0.8f, 1.5f, 1.f, 80.f);
+  for (unsigned int frame = 0; frame < 20; ++frame) {
+    culler.reset(boundingInfos.size());
+    for (const auto& boundingInfo : boundingInfos) {
+      culler.add(boundingInfo);
+    }
+    EXPECT_EQ(culler.size(), boundingInfos.size());
+
+    const Vector3 eye(coordinate(generator), coordinate(generator),
+                      coordinate(generator));
+    Vector3 target(coordinate(generator), coordinate(generator),
+                   coordinate(generator));
+    auto view                = Matrix::LookAtLH(eye, target, Vector3::Up());
+    const auto frustumPlanes = Frustum::GetPlanes(view.multiply(projection));
+
+    culler.cull(frustumPlanes, visible);
+    ASSERT_EQ(visible.size(), boundingInfos.size());
+    for (size_t index = 0; index < boundingInfos.size(); ++index) {
+      EXPECT_EQ(visible[index] != 0,
+                boundingInfos[index].isInFrustum(
+                  frustumPlanes, Constants::MESHES_CULLINGSTRATEGY_STANDARD))
+        << "volume " << index << " of frame " << frame;
+    }
+  }
+}
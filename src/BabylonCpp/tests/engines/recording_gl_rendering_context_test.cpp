@@ -0,0 +1,79 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <babylon/engines/headless/headless_canvas.h>
+#include <babylon/engines/headless/recording_gl_rendering_context.h>
+
+TEST(TestRecordingGLRenderingContext, StableHandles)
+{
+  using namespace BABYLON;
+
+  GL::RecordingGLRenderingContext gl;
+  auto buffer  = gl.createBuffer();
+  auto texture = gl.createTexture();
+  EXPECT_EQ(buffer->value, 1u);
+  EXPECT_EQ(texture->value, 2u);
+
+  gl.resetHandles();
+  auto program = gl.createProgram();
+  EXPECT_EQ(program->value, 1u);
+  EXPECT_EQ(gl.statistics().objectsCreated, 3u);
+}
+
+TEST(TestRecordingGLRenderingContext, Statistics)
+{
+  using namespace BABYLON;
+
+  GL::RecordingGLRenderingContext gl;
+  auto buffer = gl.createBuffer();
+  gl.bindBuffer(GL::ARRAY_BUFFER, buffer.get());
+  gl.bufferData(GL::ARRAY_BUFFER, Float32Array(12), GL::STATIC_DRAW);
+  gl.bufferSubData(GL::ARRAY_BUFFER, 0, Uint8Array(10));
+  gl.enable(GL::DEPTH_TEST);
+  gl.drawElements(GL::TRIANGLES, 36, GL::UNSIGNED_INT, 0);
+  gl.drawElementsInstanced(GL::TRIANGLES, 36, GL::UNSIGNED_INT, 0, 10);
+
+  const auto& stats = gl.statistics();
+  EXPECT_EQ(stats.bufferBinds, 1u);
+  EXPECT_EQ(stats.bufferUploads, 2u);
+  EXPECT_EQ(stats.bufferBytesUploaded, 12 * sizeof(float) + 10);
+  EXPECT_EQ(stats.stateChanges, 2u);
+  EXPECT_EQ(stats.drawCalls, 2u);
+  EXPECT_EQ(stats.instancedDrawCalls, 1u);
+  EXPECT_EQ(stats.drawnInstances, 11u);
+  EXPECT_TRUE(gl.isEnabled(GL::DEPTH_TEST));
+
+  EXPECT_EQ(gl.countCalls("drawElements"), 1u);
+  const auto& draw = gl.calls()[5];
+  EXPECT_STREQ(draw.name, "drawElements");
+  EXPECT_EQ(draw.arguments[1], 36.0);
+
+  gl.resetStatistics();
+  EXPECT_EQ(gl.statistics().drawCalls, 0u);
+}
+
+TEST(TestRecordingGLRenderingContext, UniformLocations)
+{
+  using namespace BABYLON;
+
+  GL::RecordingGLRenderingContext gl;
+  auto program = gl.createProgram();
+  auto world   = gl.getUniformLocation(program.get(), "world");
+  auto view    = gl.getUniformLocation(program.get(), "view");
+  auto world2  = gl.getUniformLocation(program.get(), "world");
+  EXPECT_EQ(world->value, 0);
+  EXPECT_EQ(view->value, 1);
+  EXPECT_EQ(world2->value, 0);
+  EXPECT_EQ(gl["TEXTURE3"], static_cast<unsigned>(GL::TEXTURE0 + 3));
+}
+
+TEST(TestHeadlessCanvas, Context)
+{
+  using namespace BABYLON;
+
+  HeadlessCanvas canvas(640, 480);
+  auto gl = canvas.getContext3d(EngineOptions());
+  EXPECT_EQ(gl, canvas.recordingContext());
+  EXPECT_EQ(gl->drawingBufferWidth, 640);
+  EXPECT_EQ(canvas.clientHeight, 480);
+}
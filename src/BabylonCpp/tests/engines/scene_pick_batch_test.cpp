@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <babylon/babylon_constants.h>
+#include <babylon/cameras/free_camera.h>
+#include <babylon/collisions/picking_info.h>
+#include <babylon/collisions/ray_hit.h>
+#include <babylon/culling/ray.h>
+#include <babylon/engines/engine.h>
+#include <babylon/engines/headless/headless_canvas.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/sub_mesh.h>
+
+TEST(TestScenePickBatch, SameHitsAsPickWithRay)
+{
+  using namespace BABYLON;
+
+  auto canvas = std::make_unique<HeadlessCanvas>();
+  auto engine = Engine::New(canvas.get());
+  auto scene  = Scene::New(engine.get());
+  FreeCamera::New("camera", Vector3(0.f, 0.f, -10.f), scene.get());
+
+  // A box made of two sub meshes, a rotated box partly hidden behind it, a
+  // sphere and a box that can not be picked
+  auto box = Mesh::CreateBox("box", 2.f, scene.get());
+  box->subMeshes.clear();
+  SubMesh::AddToMesh(0, 0, box->getTotalVertices(), 0, 18, box);
+  SubMesh::AddToMesh(1, 0, box->getTotalVertices(), 18, 18, box);
+  auto rotatedBox      = Mesh::CreateBox("rotatedBox", 2.f, scene.get());
+  rotatedBox->position = Vector3(1.5f, 0.5f, 3.f);
+  rotatedBox->rotation = Vector3(0.3f, 0.7f, 0.2f);
+  auto sphere          = Mesh::CreateSphere("sphere", 16, 3.f, scene.get());
+  sphere->position     = Vector3(-4.f, 1.f, 1.f);
+  auto hiddenBox       = Mesh::CreateBox("hiddenBox", 2.f, scene.get());
+  hiddenBox->position  = Vector3(4.f, -2.f, -2.f);
+
+  hiddenBox->isPickable = false;
+
+  engine->beginFrame();
+  scene->render();
+  engine->endFrame();
+
+  // A grid of rays, the ones at its borders missing every mesh, and oblique
+  // rays hitting the box from its sides
+  std::vector<Ray> rays;
+  for (int y = -12; y <= 12; ++y) {
+    for (int x = -14; x <= 14; ++x) {
+      rays.emplace_back(
+        Vector3(static_cast<float>(x) * 0.5f, static_cast<float>(y) * 0.5f,
+                -10.f),
+        Vector3(0.f, 0.f, 1.f), 100.f);
+    }
+  }
+  for (int i = 0; i < 16; ++i) {
+    const auto angle = static_cast<float>(i) * Math::PI / 8.f;
+    rays.emplace_back(Vector3(std::cos(angle) * 8.f, 0.3f,
+                              std::sin(angle) * 8.f),
+                      Vector3(-std::cos(angle), 0.f, -std::sin(angle)), 100.f);
+  }
+
+  const auto hits = scene->pickBatch(rays);
+  ASSERT_EQ(hits.size(), rays.size());
+  size_t hitCount = 0, subMeshHitCounts[2] = {0, 0};
+  for (size_t i = 0; i < rays.size(); ++i) {
+    const auto& hit        = hits[i];
+    const auto pickingInfo = scene->pickWithRay(rays[i]);
+    ASSERT_TRUE(pickingInfo.has_value());
+    ASSERT_EQ(hit.hit(), pickingInfo->hit) << "ray " << i;
+    if (!hit.hit()) {
+      continue;
+    }
+
+    ++hitCount;
+    EXPECT_EQ(hit.mesh, pickingInfo->pickedMesh.get()) << "ray " << i;
+    EXPECT_NE(hit.mesh, hiddenBox.get());
+    EXPECT_EQ(hit.faceId, pickingInfo->faceId) << "ray " << i;
+    EXPECT_EQ(hit.subMeshId, pickingInfo->subMeshId) << "ray " << i;
+    EXPECT_NEAR(hit.distance, pickingInfo->distance, 1e-4f) << "ray " << i;
+    EXPECT_NEAR(hit.bu, pickingInfo->bu, 1e-4f) << "ray " << i;
+    EXPECT_NEAR(hit.bv, pickingInfo->bv, 1e-4f) << "ray " << i;
+    if (hit.mesh == box.get()) {
+      ASSERT_LT(hit.subMeshId, 2u);
+      ++subMeshHitCounts[hit.subMeshId];
+    }
+  }
+
+  // Both the hits and the misses are covered
+  EXPECT_GT(hitCount, 0u);
+  EXPECT_LT(hitCount, rays.size());
+  EXPECT_GT(subMeshHitCounts[0], 0u);
+  EXPECT_GT(subMeshHitCounts[1], 0u);
+}
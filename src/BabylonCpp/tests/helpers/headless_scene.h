@@ -0,0 +1,44 @@
+#ifndef BABYLON_TESTS_HELPERS_HEADLESS_SCENE_H
+#define BABYLON_TESTS_HELPERS_HEADLESS_SCENE_H
+
+#include <memory>
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/engine.h>
+#include <babylon/engines/headless/headless_canvas.h>
+#include <babylon/engines/scene.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Scene with a free camera, rendered by an engine running on a
+ * headless canvas.
+ */
+struct HeadlessScene {
+  HeadlessScene(const Vector3& cameraPosition = Vector3(0.f, 0.f, -10.f))
+      : canvas{std::make_unique<HeadlessCanvas>()}
+      , engine{Engine::New(canvas.get())}
+      , scene{Scene::New(engine.get())}
+      , camera{FreeCamera::New("camera", cameraPosition, scene.get())}
+  {
+  }
+
+  /**
+   * @brief Renders a frame.
+   */
+  void render()
+  {
+    engine->beginFrame();
+    scene->render();
+    engine->endFrame();
+  }
+
+  std::unique_ptr<HeadlessCanvas> canvas;
+  std::unique_ptr<Engine> engine;
+  std::unique_ptr<Scene> scene;
+  FreeCameraPtr camera;
+}; // end of struct HeadlessScene
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_TESTS_HELPERS_HEADLESS_SCENE_H
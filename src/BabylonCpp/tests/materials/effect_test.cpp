@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <babylon/engines/engine.h>
+#include <babylon/engines/headless/headless_canvas.h>
+#include <babylon/engines/headless/recording_gl_rendering_context.h>
+#include <babylon/materials/effect.h>
+#include <babylon/materials/effect_creation_options.h>
+#include <babylon/math/matrix.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+namespace {
+
+BABYLON::EffectPtr CreateEffect(BABYLON::Engine* engine)
+{
+  using namespace BABYLON;
+
+  EffectCreationOptions options;
+  options.attributes    = {VertexBuffer::PositionKind};
+  options.uniformsNames = {"world", "alpha", "vFogInfos"};
+  return engine->createEffect("default", options, engine);
+}
+
+} // end of anonymous namespace
+
+TEST(TestEffect, UniformIds)
+{
+  using namespace BABYLON;
+
+  // The ids are process wide, the same name always gives the same id
+  const auto worldId = Effect::GetUniformId("world");
+  const auto alphaId = Effect::GetUniformId("alpha");
+  EXPECT_NE(worldId.value, alphaId.value);
+  EXPECT_EQ(Effect::GetUniformId("world").value, worldId.value);
+
+  auto canvas = std::make_unique<HeadlessCanvas>();
+  auto engine = Engine::New(canvas.get());
+  auto effect = CreateEffect(engine.get());
+  ASSERT_TRUE(effect->isReady());
+
+  // The ids resolve to the index of the uniform in the list of the effect,
+  // the unknown ones to none
+  EXPECT_EQ(effect->getUniformIndex("world"), 0);
+  EXPECT_EQ(effect->getUniformIndex("alpha"), 1);
+  EXPECT_EQ(effect->getUniformIndex("unknown"), -1);
+
+  auto& gl = *canvas->recordingContext();
+  gl.clearCalls();
+  effect->setFloat(Effect::GetUniformId("unknown"), 1.f);
+  effect->setFloat(alphaId, 0.5f);
+  EXPECT_EQ(gl.countCalls("uniform1f"), 1u);
+}
+
+TEST(TestEffect, UniformValueCache)
+{
+  using namespace BABYLON;
+
+  auto canvas = std::make_unique<HeadlessCanvas>();
+  auto engine = Engine::New(canvas.get());
+  auto effect = CreateEffect(engine.get());
+  ASSERT_TRUE(effect->isReady());
+  const auto alphaId = Effect::GetUniformId("alpha");
+
+  // A repeated identical value is not uploaded again, by name or by id
+  auto& gl = *canvas->recordingContext();
+  gl.clearCalls();
+  effect->setFloat("alpha", 0.5f);
+  effect->setFloat("alpha", 0.5f);
+  effect->setFloat(alphaId, 0.5f);
+  EXPECT_EQ(gl.countCalls("uniform1f"), 1u);
+  effect->setFloat(alphaId, 0.25f);
+  EXPECT_EQ(gl.countCalls("uniform1f"), 2u);
+
+  effect->setFloat4("vFogInfos", 1.f, 2.f, 3.f, 4.f);
+  effect->setFloat4("vFogInfos", 1.f, 2.f, 3.f, 4.f);
+  EXPECT_EQ(gl.countCalls("uniform4f"), 1u);
+
+  // The matrices are compared through their update flag
+  auto world = Matrix::Translation(1.f, 2.f, 3.f);
+  effect->setMatrix("world", world);
+  effect->setMatrix(Effect::GetUniformId("world"), world);
+  EXPECT_EQ(gl.countCalls("uniformMatrix4fv"), 1u);
+  world.addAtIndex(12, 1.f);
+  effect->setMatrix("world", world);
+  EXPECT_EQ(gl.countCalls("uniformMatrix4fv"), 2u);
+
+  // The array setters bypass the cache and invalidate it
+  effect->setArray("alpha", {0.25f});
+  effect->setFloat(alphaId, 0.25f);
+  EXPECT_EQ(gl.countCalls("uniform1f"), 3u);
+  effect->setArray4("vFogInfos", {1.f, 2.f, 3.f, 4.f});
+  effect->setFloat4("vFogInfos", 1.f, 2.f, 3.f, 4.f);
+  EXPECT_EQ(gl.countCalls("uniform4f"), 2u);
+
+  // A rebuilt program has no value set yet
+  const auto& shadersStore = Effect::ShadersStore();
+  effect->_rebuildProgram(shadersStore.at("defaultVertexShader"),
+                          shadersStore.at("defaultPixelShader"), nullptr,
+                          nullptr);
+  ASSERT_TRUE(effect->isReady());
+  EXPECT_TRUE(effect->getCompilationError().empty());
+  gl.clearCalls();
+  effect->setFloat(alphaId, 0.25f);
+  effect->setMatrix("world", world);
+  EXPECT_EQ(gl.countCalls("uniform1f"), 1u);
+  EXPECT_EQ(gl.countCalls("uniformMatrix4fv"), 1u);
+}
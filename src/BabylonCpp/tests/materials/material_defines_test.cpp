@@ -0,0 +1,125 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <babylon/engines/engine.h>
+#include <babylon/engines/headless/headless_canvas.h>
+#include <babylon/materials/effect.h>
+#include <babylon/materials/effect_creation_options.h>
+#include <babylon/materials/material_defines.h>
+#include <babylon/materials/standard_material_defines.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+TEST(TestMaterialDefines, BoolDefines)
+{
+  using namespace BABYLON;
+
+  MaterialDefines defines;
+  defines.boolDef = {{"DIFFUSE", false}, {"BUMP", false}};
+  EXPECT_EQ(defines.boolDef.size(), 2u);
+  EXPECT_FALSE(defines["DIFFUSE"]);
+
+  defines.boolDef["DIFFUSE"] = true;
+  EXPECT_TRUE(defines["DIFFUSE"]);
+  EXPECT_TRUE(defines.boolDef.contains("BUMP"));
+  EXPECT_FALSE(defines.boolDef.contains("UNKNOWN_DEFINE"));
+  EXPECT_FALSE(defines["UNKNOWN_DEFINE"]);
+
+  // Subscripting adds the define to the set
+  defines.boolDef["LIGHT0"] = false;
+  EXPECT_TRUE(defines.boolDef.contains("LIGHT0"));
+  EXPECT_EQ(defines.boolDef.size(), 3u);
+
+  EXPECT_EQ(defines.toString(), "#define DIFFUSE\n");
+}
+
+TEST(TestMaterialDefines, CompareAndHash)
+{
+  using namespace BABYLON;
+
+  MaterialDefines defines;
+  defines.boolDef                       = {{"DIFFUSE", true}, {"FOG", false}};
+  defines.intDef["NUM_BONE_INFLUENCERS"] = 4;
+
+  MaterialDefines other;
+  defines.cloneTo(other);
+  EXPECT_TRUE(defines.isEqual(other));
+  EXPECT_TRUE(defines.hasSameDefines(other));
+  EXPECT_EQ(defines.hash(), other.hash());
+
+  // Unset defines do not change the generated shader
+  other.boolDef["SHADOWFLOAT"] = false;
+  EXPECT_FALSE(defines.isEqual(other));
+  EXPECT_TRUE(defines.hasSameDefines(other));
+  EXPECT_EQ(defines.hash(), other.hash());
+
+  other.boolDef["FOG"] = true;
+  EXPECT_FALSE(defines.hasSameDefines(other));
+  EXPECT_NE(defines.hash(), other.hash());
+
+  other.boolDef["FOG"] = false;
+  EXPECT_TRUE(defines.hasSameDefines(other));
+
+  other.intDef["NUM_BONE_INFLUENCERS"] = 2;
+  EXPECT_FALSE(defines.hasSameDefines(other));
+  EXPECT_NE(defines.hash(), other.hash());
+}
+
+TEST(TestMaterialDefines, ImageProcessingDefines)
+{
+  using namespace BABYLON;
+
+  StandardMaterialDefines defines;
+  StandardMaterialDefines other;
+  defines.cloneTo(other);
+  EXPECT_TRUE(defines.hasSameDefines(other));
+  EXPECT_EQ(defines.hash(), other.hash());
+
+  // The image processing defines are not part of boolDef
+  other.TONEMAPPING = true;
+  EXPECT_EQ(defines.boolDef.hash(), other.boolDef.hash());
+  EXPECT_FALSE(defines.hasSameDefines(other));
+  EXPECT_NE(defines.hash(), other.hash());
+
+  // Each set of defines gets its own effect
+  auto canvas = std::make_unique<HeadlessCanvas>();
+  auto engine = Engine::New(canvas.get());
+  const auto createEffect = [&engine](MaterialDefines& materialDefines) {
+    EffectCreationOptions options;
+    options.attributes      = {VertexBuffer::PositionKind};
+    options.materialDefines = &materialDefines;
+    return engine->createEffect("default", options, engine.get());
+  };
+  auto effect      = createEffect(defines);
+  auto otherEffect = createEffect(other);
+  EXPECT_NE(effect, otherEffect);
+  EXPECT_EQ(createEffect(defines), effect);
+  EXPECT_EQ(createEffect(other), otherEffect);
+}
+
+TEST(TestMaterialDefines, ImageProcessingEffectCache)
+{
+  using namespace BABYLON;
+
+  StandardMaterialDefines defines;
+  defines.TONEMAPPING = true;
+
+  auto canvas      = std::make_unique<HeadlessCanvas>();
+  auto engine      = Engine::New(canvas.get());
+  EffectPtr effect = nullptr;
+  for (unsigned int i = 0; i < 3; ++i) {
+    EffectCreationOptions options;
+    options.attributes      = {VertexBuffer::PositionKind};
+    options.materialDefines = &defines;
+
+    auto current = engine->createEffect("default", options, engine.get());
+    if (i == 0) {
+      effect = current;
+      continue;
+    }
+    // The effect is found through the hash of the defines, the defines string
+    // is not built and the cache does not grow
+    EXPECT_EQ(current, effect);
+    EXPECT_TRUE(options.defines.empty());
+    EXPECT_EQ(engine->_getCompiledEffectsByDefinesCount(), 1u);
+  }
+}
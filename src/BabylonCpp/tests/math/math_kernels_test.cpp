@@ -0,0 +1,298 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include <babylon/math/frustum.h>
+#include <babylon/math/math_kernels.h>
+#include <babylon/math/matrix.h>
+#include <babylon/math/plane.h>
+#include <babylon/math/quaternion.h>
+#include <babylon/math/vector3.h>
+
+namespace {
+
+// Not a multiple of the register widths, so that the scalar tails are tested
+constexpr size_t COUNT = 19;
+
+std::vector<const BABYLON::MathKernels*> AvailableKernels()
+{
+  using namespace BABYLON;
+  std::vector<const MathKernels*> kernels;
+  for (auto instructionSet :
+       {SIMDInstructionSet::Scalar, SIMDInstructionSet::SSE4,
+        SIMDInstructionSet::AVX2, SIMDInstructionSet::NEON}) {
+    if (const auto* available = MathKernels::Get(instructionSet)) {
+      EXPECT_EQ(available->instructionSet, instructionSet);
+      kernels.emplace_back(available);
+    }
+  }
+  return kernels;
+}
+
+std::vector<BABYLON::Matrix> RandomTransforms(std::mt19937& generator)
+{
+  using namespace BABYLON;
+  std::uniform_real_distribution<float> distribution(-2.f, 2.f);
+  std::vector<Matrix> matrices;
+  for (size_t i = 0; i < COUNT; ++i) {
+    const Vector3 scaling(std::abs(distribution(generator)) + 0.5f,
+                          std::abs(distribution(generator)) + 0.5f,
+                          std::abs(distribution(generator)) + 0.5f);
+    const auto rotation = Quaternion::RotationYawPitchRoll(
+      distribution(generator), distribution(generator),
+      distribution(generator));
+    const Vector3 translation(distribution(generator), distribution(generator),
+                              distribution(generator));
+    matrices.emplace_back(Matrix::Compose(scaling, rotation, translation));
+  }
+  return matrices;
+}
+
+BABYLON::Float32Array Flatten(const std::vector<BABYLON::Matrix>& matrices)
+{
+  BABYLON::Float32Array data;
+  for (const auto& matrix : matrices) {
+    data.insert(data.end(), matrix.m().begin(), matrix.m().end());
+  }
+  return data;
+}
+
+} // end of anonymous namespace
+
+TEST(TestMathKernels, Get)
+{
+  using namespace BABYLON;
+
+  const auto& kernels = MathKernels::Get();
+  EXPECT_EQ(kernels.instructionSet, MathKernels::DetectInstructionSet());
+  EXPECT_EQ(MathKernels::Get(SIMDInstructionSet::Scalar),
+            &MathKernels::Scalar());
+}
+
+TEST(TestMathKernels, MultiplyMatrices)
+{
+  using namespace BABYLON;
+
+  std::mt19937 generator(42);
+  auto left    = RandomTransforms(generator);
+  auto right   = RandomTransforms(generator);
+  const auto l = Flatten(left);
+  const auto r = Flatten(right);
+
+  for (const auto* kernels : AvailableKernels()) {
+    Float32Array result(COUNT * 16);
+    kernels->multiplyMatrices(l.data(), r.data(), result.data(), COUNT);
+    for (size_t i = 0; i < COUNT; ++i) {
+      const auto expected = left[i].multiply(right[i]);
+      for (size_t k = 0; k < 16; ++k) {
+        EXPECT_NEAR(result[i * 16 + k], expected.m()[k], 1e-5f);
+      }
+    }
+
+    // In place
+    auto inPlace = l;
+    kernels->multiplyMatrices(inPlace.data(), r.data(), inPlace.data(), COUNT);
+    for (size_t k = 0; k < inPlace.size(); ++k) {
+      EXPECT_NEAR(inPlace[k], result[k], 1e-5f);
+    }
+  }
+}
+
+TEST(TestMathKernels, InvertMatrices)
+{
+  using namespace BABYLON;
+
+  std::mt19937 generator(7);
+  auto matrices = RandomTransforms(generator);
+  // Not invertible, copied unchanged
+  matrices[3] = Matrix::Scaling(1.f, 0.f, 1.f);
+  const auto data = Flatten(matrices);
+
+  for (const auto* kernels : AvailableKernels()) {
+    Float32Array result(COUNT * 16);
+    kernels->invertMatrices(data.data(), result.data(), COUNT);
+    for (size_t i = 0; i < COUNT; ++i) {
+      Matrix expected;
+      matrices[i].invertToRef(expected);
+      for (size_t k = 0; k < 16; ++k) {
+        EXPECT_NEAR(result[i * 16 + k], expected.m()[k], 1e-4f);
+      }
+    }
+  }
+}
+
+TEST(TestMathKernels, TransformCoordinates)
+{
+  using namespace BABYLON;
+
+  std::mt19937 generator(3);
+  std::uniform_real_distribution<float> distribution(-10.f, 10.f);
+  const auto transformation = Matrix::PerspectiveFovLH(0.8f, 1.5f, 0.1f, 100.f)
+                                .multiply(Matrix::Translation(0.f, 0.f, 20.f));
+  Float32Array vectors(COUNT * 3);
+  for (auto& value : vectors) {
+    value = distribution(generator);
+  }
+
+  for (const auto* kernels : AvailableKernels()) {
+    Float32Array result(COUNT * 3);
+    kernels->transformCoordinates(vectors.data(), transformation.m().data(),
+                                  result.data(), COUNT);
+    for (size_t i = 0; i < COUNT; ++i) {
+      const auto expected = Vector3::TransformCoordinates(
+        Vector3(vectors[i * 3], vectors[i * 3 + 1], vectors[i * 3 + 2]),
+        transformation);
+      EXPECT_NEAR(result[i * 3], expected.x, 1e-5f);
+      EXPECT_NEAR(result[i * 3 + 1], expected.y, 1e-5f);
+      EXPECT_NEAR(result[i * 3 + 2], expected.z, 1e-5f);
+    }
+  }
+}
+
+TEST(TestMathKernels, ComposeAndDecomposeMatrices)
+{
+  using namespace BABYLON;
+
+  std::mt19937 generator(11);
+  auto matrices = RandomTransforms(generator);
+  // Mirrored, the sign of the Y scaling is flipped
+  matrices[5] = Matrix::Scaling(2.f, -3.f, 4.f);
+  // Null scaling, identity rotation
+  matrices[9] = Matrix::Scaling(0.f, 1.f, 1.f);
+  const auto data = Flatten(matrices);
+
+  for (const auto* kernels : AvailableKernels()) {
+    Float32Array scalings(COUNT * 3), rotations(COUNT * 4),
+      translations(COUNT * 3);
+    kernels->decomposeMatrices(data.data(), scalings.data(), rotations.data(),
+                               translations.data(), COUNT);
+    EXPECT_FLOAT_EQ(scalings[5 * 3], 2.f);
+    EXPECT_FLOAT_EQ(scalings[5 * 3 + 1], -3.f);
+    EXPECT_FLOAT_EQ(scalings[5 * 3 + 2], 4.f);
+    EXPECT_FLOAT_EQ(rotations[9 * 4 + 3], 1.f);
+
+    Float32Array composed(COUNT * 16);
+    kernels->composeMatrices(scalings.data(), rotations.data(),
+                             translations.data(), composed.data(), COUNT);
+    for (size_t i = 0; i < COUNT; ++i) {
+      const Vector3 scaling(scalings[i * 3], scalings[i * 3 + 1],
+                            scalings[i * 3 + 2]);
+      const Quaternion rotation(rotations[i * 4], rotations[i * 4 + 1],
+                                rotations[i * 4 + 2], rotations[i * 4 + 3]);
+      const Vector3 translation(translations[i * 3], translations[i * 3 + 1],
+                                translations[i * 3 + 2]);
+      const auto expected = Matrix::Compose(scaling, rotation, translation);
+      for (size_t k = 0; k < 16; ++k) {
+        EXPECT_NEAR(composed[i * 16 + k], expected.m()[k], 1e-5f);
+        if (i != 9) {
+          // Round trip
+          EXPECT_NEAR(composed[i * 16 + k], data[i * 16 + k], 1e-4f);
+        }
+      }
+    }
+  }
+}
+
+TEST(TestMathKernels, CullBoundingVolumes)
+{
+  using namespace BABYLON;
+
+  std::mt19937 generator(5);
+  std::uniform_real_distribution<float> distribution(-10.f, 10.f);
+  Float32Array volumes(COUNT * MathKernels::CullVolumeComponents);
+  for (size_t i = 0; i < COUNT; ++i) {
+    for (size_t k = 0; k < MathKernels::CullVolumeComponents; ++k) {
+      volumes[k * COUNT + i] = distribution(generator);
+    }
+    // Bounding sphere of the box
+    volumes[MathKernels::SphereCenterX * COUNT + i]
+      = volumes[MathKernels::BoxCenterX * COUNT + i];
+    volumes[MathKernels::SphereCenterY * COUNT + i]
+      = volumes[MathKernels::BoxCenterY * COUNT + i];
+    volumes[MathKernels::SphereCenterZ * COUNT + i]
+      = volumes[MathKernels::BoxCenterZ * COUNT + i];
+    volumes[MathKernels::SphereRadius * COUNT + i] = 30.f;
+  }
+  const auto planes = Frustum::GetPlanes(
+    Matrix::PerspectiveFovLH(0.8f, 1.5f, 0.1f, 100.f)
+      .multiply(Matrix::Translation(0.f, 0.f, 10.f)));
+  Float32Array packedPlanes;
+  for (const auto& plane : planes) {
+    packedPlanes.insert(packedPlanes.end(),
+                        {plane.normal.x, plane.normal.y, plane.normal.z,
+                         plane.d});
+  }
+
+  std::vector<uint8_t> expected(COUNT);
+  MathKernels::Scalar().cullBoundingVolumes(volumes.data(), COUNT,
+                                            packedPlanes.data(), planes.size(),
+                                            expected.data(), COUNT);
+  EXPECT_NE(std::count(expected.begin(), expected.end(), 0), 0);
+  EXPECT_NE(std::count(expected.begin(), expected.end(), 1), 0);
+  for (const auto* kernels : AvailableKernels()) {
+    std::vector<uint8_t> visible(COUNT, 2);
+    kernels->cullBoundingVolumes(volumes.data(), COUNT, packedPlanes.data(),
+                                 planes.size(), visible.data(), COUNT);
+    EXPECT_EQ(visible, expected);
+  }
+}
+
+TEST(TestMathKernels, UpdateParticles)
+{
+  using namespace BABYLON;
+
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+  Float32Array particles(COUNT * MathKernels::ParticleComponents);
+  for (auto& value : particles) {
+    value = distribution(generator);
+  }
+  for (size_t i = 0; i < COUNT; ++i) {
+    // Some particles die during the step
+    particles[MathKernels::ParticleAge * COUNT + i] = 0.1f * i;
+    particles[MathKernels::ParticleLifeTime * COUNT + i] = 1.f;
+  }
+  const float updateSpeed = 0.25f;
+  const float gravity[3]  = {0.f, -9.81f, 0.f};
+
+  // Same as the built-in behaviours of ParticleSystem::updateFunction
+  auto expected = particles;
+  for (size_t i = 0; i < COUNT; ++i) {
+    const auto at = [&expected, i](size_t k) -> float& {
+      return expected[k * COUNT + i];
+    };
+    auto step = updateSpeed;
+    if (at(MathKernels::ParticleAge) + step
+        > at(MathKernels::ParticleLifeTime)) {
+      step = at(MathKernels::ParticleLifeTime) - at(MathKernels::ParticleAge);
+      at(MathKernels::ParticleAge) = at(MathKernels::ParticleLifeTime);
+    }
+    else {
+      at(MathKernels::ParticleAge) += step;
+    }
+    for (size_t k = 0; k < 4; ++k) {
+      at(MathKernels::ParticleColorR + k)
+        += at(MathKernels::ParticleColorStepR + k) * step;
+    }
+    at(MathKernels::ParticleColorA)
+      = std::max(at(MathKernels::ParticleColorA), 0.f);
+    at(MathKernels::ParticleAngle)
+      += at(MathKernels::ParticleAngularSpeed) * step;
+    for (size_t k = 0; k < 3; ++k) {
+      at(MathKernels::ParticlePositionX + k)
+        += at(MathKernels::ParticleDirectionX + k) * step;
+      at(MathKernels::ParticleDirectionX + k) += gravity[k] * step;
+    }
+  }
+
+  for (const auto* kernels : AvailableKernels()) {
+    auto updated = particles;
+    kernels->updateParticles(updated.data(), COUNT, updateSpeed, gravity,
+                             COUNT);
+    for (size_t i = 0; i < updated.size(); ++i) {
+      EXPECT_NEAR(updated[i], expected[i], 1e-5f);
+    }
+  }
+}
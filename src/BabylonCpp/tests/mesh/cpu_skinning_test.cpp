@@ -0,0 +1,99 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <babylon/math/matrix.h>
+#include <babylon/meshes/cpu_skinning.h>
+
+namespace {
+
+BABYLON::Float32Array BoneMatrices(const std::vector<BABYLON::Matrix>& bones)
+{
+  BABYLON::Float32Array matrices(bones.size() * 16);
+  for (size_t i = 0; i < bones.size(); ++i) {
+    bones[i].copyToArray(matrices, static_cast<unsigned int>(i * 16));
+  }
+  return matrices;
+}
+
+} // end of anonymous namespace
+
+TEST(TestCPUSkinning, FourInfluencers)
+{
+  using namespace BABYLON;
+
+  const Float32Array positions{1.f, 0.f, 0.f, 0.f, 2.f, 0.f};
+  const Float32Array normals{0.f, 1.f, 0.f, 1.f, 0.f, 0.f};
+  const Float32Array matricesIndices{0.f, 0.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f};
+  const Float32Array matricesWeights{1.f, 0.f, 0.f, 0.f, 0.5f, 0.5f, 0.f, 0.f};
+
+  CPUSkinning skinning;
+  ASSERT_TRUE(skinning.initialize(positions, normals, matricesIndices,
+                                  matricesWeights));
+  EXPECT_EQ(skinning.vertexCount(), 2u);
+  EXPECT_EQ(skinning.influencerCount(), 4u);
+
+  const auto boneMatrices = BoneMatrices(
+    {Matrix::Translation(1.f, 2.f, 3.f), Matrix::Translation(3.f, 0.f, 1.f)});
+  Float32Array skinnedPositions(6);
+  Float32Array skinnedNormals(6);
+  skinning.apply(boneMatrices, skinnedPositions.data(), skinnedNormals.data());
+
+  // First vertex follows the first bone
+  EXPECT_FLOAT_EQ(skinnedPositions[0], 2.f);
+  EXPECT_FLOAT_EQ(skinnedPositions[1], 2.f);
+  EXPECT_FLOAT_EQ(skinnedPositions[2], 3.f);
+  // Second vertex is blended between both bones
+  EXPECT_FLOAT_EQ(skinnedPositions[3], 2.f);
+  EXPECT_FLOAT_EQ(skinnedPositions[4], 3.f);
+  EXPECT_FLOAT_EQ(skinnedPositions[5], 2.f);
+  // Translations do not change the normals
+  for (size_t i = 0; i < normals.size(); ++i) {
+    EXPECT_FLOAT_EQ(skinnedNormals[i], normals[i]);
+  }
+}
+
+TEST(TestCPUSkinning, EightInfluencers)
+{
+  using namespace BABYLON;
+
+  const size_t vertexCount = 5000;
+  Float32Array positions(vertexCount * 3, 0.f);
+  Float32Array normals(vertexCount * 3, 0.f);
+  Float32Array matricesIndices(vertexCount * 4, 0.f);
+  Float32Array matricesWeights(vertexCount * 4, 0.f);
+  Float32Array matricesIndicesExtra(vertexCount * 4, 1.f);
+  Float32Array matricesWeightsExtra(vertexCount * 4, 0.f);
+  for (size_t i = 0; i < vertexCount; ++i) {
+    positions[i * 3]            = static_cast<float>(i);
+    normals[i * 3 + 2]          = 1.f;
+    matricesWeights[i * 4]      = 0.75f;
+    matricesWeightsExtra[i * 4] = 0.25f;
+  }
+
+  CPUSkinning skinning;
+  ASSERT_TRUE(skinning.initialize(positions, normals, matricesIndices,
+                                  matricesWeights, matricesIndicesExtra,
+                                  matricesWeightsExtra));
+  EXPECT_EQ(skinning.influencerCount(), 8u);
+
+  const auto boneMatrices = BoneMatrices(
+    {Matrix::Identity(), Matrix::Scaling(1.f, 1.f, 5.f)});
+  Float32Array skinnedPositions(vertexCount * 3);
+  Float32Array skinnedNormals(vertexCount * 3);
+  skinning.apply(boneMatrices, skinnedPositions.data(), skinnedNormals.data());
+
+  for (size_t i = 0; i < vertexCount; ++i) {
+    EXPECT_FLOAT_EQ(skinnedPositions[i * 3], static_cast<float>(i));
+    EXPECT_FLOAT_EQ(skinnedNormals[i * 3 + 2], 2.f);
+  }
+}
+
+TEST(TestCPUSkinning, InvalidData)
+{
+  using namespace BABYLON;
+
+  CPUSkinning skinning;
+  EXPECT_FALSE(skinning.initialize({}, {}, {}, {}));
+  EXPECT_FALSE(skinning.initialize({0.f, 0.f, 0.f}, {0.f, 1.f, 0.f},
+                                   {0.f, 0.f}, {1.f, 0.f}));
+}
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/engine.h>
+#include <babylon/engines/headless/headless_canvas.h>
+#include <babylon/engines/headless/recording_gl_rendering_context.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/instanced_mesh.h>
+#include <babylon/meshes/mesh.h>
+
+namespace {
+
+std::vector<BABYLON::GL::GLCallRecord>
+ArrayBufferUploads(const BABYLON::GL::RecordingGLRenderingContext& gl)
+{
+  std::vector<BABYLON::GL::GLCallRecord> uploads;
+  for (const auto& call : gl.calls()) {
+    if ((std::string(call.name) == "bufferSubData"
+         || std::string(call.name) == "bufferData")
+        && call.arguments[0] == BABYLON::GL::ARRAY_BUFFER) {
+      uploads.emplace_back(call);
+    }
+  }
+  return uploads;
+}
+
+} // end of anonymous namespace
+
+TEST(TestInstancedMesh, DirtyWorldMatrixUpload)
+{
+  using namespace BABYLON;
+
+  auto canvas = std::make_unique<HeadlessCanvas>();
+  auto engine = Engine::New(canvas.get());
+  auto scene  = Scene::New(engine.get());
+  FreeCamera::New("camera", Vector3(0.f, 0.f, -20.f), scene.get());
+  const auto render = [&engine, &scene]() {
+    engine->beginFrame();
+    scene->render();
+    engine->endFrame();
+  };
+
+  // The source mesh takes the first slot, followed by its instances in their
+  // activation order
+  auto box = Mesh::CreateBox("box", 1.f, scene.get());
+  std::vector<InstancedMeshPtr> instances;
+  for (unsigned int i = 0; i < 8; ++i) {
+    auto instance = box->createInstance("instance" + std::to_string(i));
+    instance->position = Vector3(static_cast<float>(i) - 3.5f, 1.f, 0.f);
+    instances.emplace_back(instance);
+  }
+  render();
+  render();
+
+  // A static frame uploads nothing
+  auto& gl = *canvas->recordingContext();
+  gl.clearCalls();
+  render();
+  EXPECT_GT(gl.statistics().instancedDrawCalls, 0u);
+  EXPECT_TRUE(ArrayBufferUploads(gl).empty());
+
+  // Only the world matrix of the moved instance is uploaded
+  gl.clearCalls();
+  instances[3]->position().y = -1.f;
+  render();
+  const auto uploads = ArrayBufferUploads(gl);
+  ASSERT_EQ(uploads.size(), 1u);
+  EXPECT_STREQ(uploads[0].name, "bufferSubData");
+  EXPECT_EQ(uploads[0].arguments[1], 16.0 * sizeof(float));
+  EXPECT_EQ(uploads[0].arguments[2], 4.0 * 16.0 * sizeof(float));
+}
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_lod_level.h>
+#include <babylon/meshes/simplification/quadratic_error_simplification.h>
+#include <babylon/meshes/simplification/simplification_queue.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+#include "helpers/headless_scene.h"
+
+namespace {
+
+// Sum of the areas of the triangles of the mesh
+float SurfaceArea(BABYLON::Mesh& mesh)
+{
+  using namespace BABYLON;
+  const auto positions = mesh.getVerticesData(VertexBuffer::PositionKind);
+  const auto indices   = mesh.getIndices();
+  float area           = 0.f;
+  for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+    const auto p0 = Vector3::FromArray(positions, indices[i] * 3);
+    const auto p1 = Vector3::FromArray(positions, indices[i + 1] * 3);
+    const auto p2 = Vector3::FromArray(positions, indices[i + 2] * 3);
+    area += Vector3::Cross(p1.subtract(p0), p2.subtract(p0)).length() * 0.5f;
+  }
+  return area;
+}
+
+} // end of anonymous namespace
+
+TEST(TestMeshSimplification, QuadraticErrorSimplification)
+{
+  using namespace BABYLON;
+
+  // 20x20 quads of a 10x10 plane
+  HeadlessScene simplificationScene(Vector3(0.f, 5.f, -10.f));
+  auto ground
+    = Mesh::CreateGround("ground", 10, 10, 20, simplificationScene.scene.get());
+  const auto triangleCount = ground->getTotalIndices() / 3;
+  ASSERT_EQ(triangleCount, 800u);
+
+  MeshPtr simplifiedMesh;
+  QuadraticErrorSimplification simplifier(ground.get());
+  simplifier.simplify(ISimplificationSettings{0.3f, 10.f, false},
+                      [&simplifiedMesh](const MeshPtr& mesh) {
+                        simplifiedMesh = mesh;
+                      });
+  ASSERT_TRUE(simplifiedMesh != nullptr);
+
+  // The target triangle count is reached
+  const auto simplifiedTriangleCount = simplifiedMesh->getTotalIndices() / 3;
+  EXPECT_GT(simplifiedTriangleCount, 0u);
+  EXPECT_LE(simplifiedTriangleCount, 240u);
+
+  // The border vertices are kept on the border: the plane keeps its extent
+  // and its area
+  const auto positions
+    = simplifiedMesh->getVerticesData(VertexBuffer::PositionKind);
+  Vector3 minimum(10.f, 10.f, 10.f), maximum(-10.f, -10.f, -10.f);
+  for (size_t i = 0; i < positions.size(); i += 3) {
+    const auto position
+      = Vector3::FromArray(positions, static_cast<unsigned int>(i));
+    minimum.minimizeInPlace(position);
+    maximum.maximizeInPlace(position);
+  }
+  EXPECT_TRUE(minimum.equalsWithEpsilon(Vector3(-5.f, 0.f, -5.f), 1e-4f));
+  EXPECT_TRUE(maximum.equalsWithEpsilon(Vector3(5.f, 0.f, 5.f), 1e-4f));
+  EXPECT_NEAR(SurfaceArea(*simplifiedMesh), 100.f, 1e-2f);
+}
+
+TEST(TestMeshSimplification, SimplificationQueue)
+{
+  using namespace BABYLON;
+
+  HeadlessScene simplificationScene(Vector3(0.f, 5.f, -10.f));
+  auto scene  = simplificationScene.scene.get();
+  auto ground = Mesh::CreateGround("ground", 10, 10, 20, scene);
+  auto plane  = Mesh::CreateGround("plane", 10, 10, 10, scene);
+
+  // The tasks complete in the order they are added, the levels of a task are
+  // decimated in parallel
+  std::vector<Mesh*> simplifiedMeshes;
+  const auto onSimplified = [&simplifiedMeshes](Mesh* mesh, int) {
+    simplifiedMeshes.emplace_back(mesh);
+  };
+  ground->simplify({ISimplificationSettings{0.8f, 10.f, false},
+                    ISimplificationSettings{0.2f, 30.f, false},
+                    ISimplificationSettings{0.5f, 20.f, false}},
+                   true, SimplificationType::QUADRATIC, onSimplified);
+  plane->simplify({ISimplificationSettings{0.5f, 15.f, false}}, false,
+                  SimplificationType::QUADRATIC, onSimplified);
+
+  // The simplifications are installed by the scene, between two frames
+  const auto timeout
+    = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+  while (simplifiedMeshes.size() < 2
+         && std::chrono::steady_clock::now() < timeout) {
+    simplificationScene.render();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  ASSERT_EQ(simplifiedMeshes.size(), 2u);
+  EXPECT_EQ(simplifiedMeshes[0], ground.get());
+  EXPECT_EQ(simplifiedMeshes[1], plane.get());
+  EXPECT_FALSE(scene->simplificationQueue()->running);
+
+  // The levels are sorted from the farthest one, the farther the coarser
+  const auto& levels = ground->getLODLevels();
+  ASSERT_EQ(levels.size(), 3u);
+  const float distances[3] = {30.f, 20.f, 10.f};
+  size_t previousTriangleCount = 0;
+  for (size_t i = 0; i < levels.size(); ++i) {
+    EXPECT_FLOAT_EQ(levels[i]->distance, distances[i]);
+    ASSERT_TRUE(levels[i]->mesh != nullptr);
+    const auto levelTriangleCount = levels[i]->mesh->getTotalIndices() / 3;
+    EXPECT_GT(levelTriangleCount, previousTriangleCount);
+    EXPECT_LT(levelTriangleCount, ground->getTotalIndices() / 3);
+    previousTriangleCount = levelTriangleCount;
+  }
+  EXPECT_EQ(ground->getLODLevelAtDistance(20.f), levels[1]->mesh);
+  ASSERT_EQ(plane->getLODLevels().size(), 1u);
+}
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <babylon/culling/bounding_info.h>
+#include <babylon/engines/headless/recording_gl_rendering_context.h>
+#include <babylon/meshes/mesh.h>
+
+#include "helpers/headless_scene.h"
+
+namespace {
+
+struct ThinInstancesScene : public BABYLON::HeadlessScene {
+  ThinInstancesScene()
+      : BABYLON::HeadlessScene(BABYLON::Vector3(0.f, 0.f, -20.f))
+  {
+    box = BABYLON::Mesh::CreateBox("box", 1.f, scene.get());
+    // a row of boxes going through the center of the view
+    for (unsigned int i = 0; i < 10; ++i) {
+      box->thinInstanceAdd(
+        BABYLON::Matrix::Translation(static_cast<float>(i) - 4.5f, 0.f, 0.f),
+        i == 9);
+    }
+  }
+
+  BABYLON::MeshPtr box;
+};
+
+} // end of anonymous namespace
+
+TEST(TestThinInstances, SingleInstancedDraw)
+{
+  using namespace BABYLON;
+
+  ThinInstancesScene thinInstancesScene;
+  thinInstancesScene.render();
+
+  auto& gl = *thinInstancesScene.canvas->recordingContext();
+  gl.resetStatistics();
+  thinInstancesScene.render();
+  EXPECT_EQ(gl.statistics().drawCalls, 1u);
+  EXPECT_EQ(gl.statistics().instancedDrawCalls, 1u);
+  EXPECT_EQ(gl.statistics().drawnInstances, 10u);
+}
+
+TEST(TestThinInstances, DirtyRangeUpload)
+{
+  using namespace BABYLON;
+
+  ThinInstancesScene thinInstancesScene;
+  thinInstancesScene.render();
+
+  // only the matrix of the third instance is uploaded
+  auto& gl = *thinInstancesScene.canvas->recordingContext();
+  gl.clearCalls();
+  thinInstancesScene.box->thinInstanceSetMatrixAt(
+    2, Matrix::Translation(0.f, 1.f, 0.f));
+  thinInstancesScene.render();
+  std::vector<GL::GLCallRecord> uploads;
+  for (const auto& call : gl.calls()) {
+    if ((std::string(call.name) == "bufferSubData"
+         || std::string(call.name) == "bufferData")
+        && call.arguments[0] == GL::ARRAY_BUFFER) {
+      uploads.emplace_back(call);
+    }
+  }
+  ASSERT_EQ(uploads.size(), 1u);
+  EXPECT_STREQ(uploads[0].name, "bufferSubData");
+  EXPECT_EQ(uploads[0].arguments[1], 16.0 * sizeof(float));
+  EXPECT_EQ(uploads[0].arguments[2], 2.0 * 16.0 * sizeof(float));
+
+  // the span between the changed instances is uploaded once
+  gl.clearCalls();
+  thinInstancesScene.box->thinInstanceSetMatrixAt(
+    6, Matrix::Translation(0.f, -1.f, 0.f), false);
+  thinInstancesScene.box->thinInstanceSetMatrixAt(
+    4, Matrix::Translation(0.f, 2.f, 0.f));
+  thinInstancesScene.render();
+  EXPECT_EQ(gl.countCalls("bufferSubData"), 1u);
+  for (const auto& call : gl.calls()) {
+    if (std::string(call.name) == "bufferSubData") {
+      EXPECT_EQ(call.arguments[1], 3.0 * 16.0 * sizeof(float));
+      EXPECT_EQ(call.arguments[2], 4.0 * 16.0 * sizeof(float));
+    }
+  }
+
+  // nothing is uploaded when no matrix changed
+  gl.clearCalls();
+  thinInstancesScene.render();
+  EXPECT_EQ(gl.countCalls("bufferSubData"), 0u);
+}
+
+TEST(TestThinInstances, WorldSpaceBoundingInfo)
+{
+  using namespace BABYLON;
+
+  ThinInstancesScene thinInstancesScene;
+  auto& box = thinInstancesScene.box;
+  thinInstancesScene.render();
+  const auto& boundingBox = box->getBoundingInfo()->boundingBox;
+  EXPECT_TRUE(boundingBox.minimumWorld.equalsWithEpsilon(
+    Vector3(-5.f, -0.5f, -0.5f), 1e-5f));
+  EXPECT_TRUE(boundingBox.maximumWorld.equalsWithEpsilon(
+    Vector3(5.f, 0.5f, 0.5f), 1e-5f));
+
+  // the instance matrices are world matrices, the box does not follow the mesh
+  box->position = Vector3(10.f, 3.f, 0.f);
+  box->scaling  = Vector3(2.f, 2.f, 2.f);
+  box->computeWorldMatrix(true);
+  thinInstancesScene.render();
+  const auto& movedBoundingBox = box->getBoundingInfo()->boundingBox;
+  EXPECT_TRUE(movedBoundingBox.minimumWorld.equalsWithEpsilon(
+    Vector3(-5.f, -0.5f, -0.5f), 1e-5f));
+  EXPECT_TRUE(movedBoundingBox.maximumWorld.equalsWithEpsilon(
+    Vector3(5.f, 0.5f, 0.5f), 1e-5f));
+}
@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/engine.h>
+#include <babylon/engines/headless/headless_canvas.h>
+#include <babylon/engines/scene.h>
+#include <babylon/math/matrix.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/transform_hierarchy.h>
+#include <babylon/meshes/transform_node.h>
+
+namespace {
+
+size_t IndexOf(const BABYLON::TransformHierarchy& hierarchy,
+               const BABYLON::TransformNode* node)
+{
+  const auto& nodes = hierarchy.nodes();
+  return static_cast<size_t>(std::find(nodes.begin(), nodes.end(), node)
+                             - nodes.begin());
+}
+
+void ExpectTranslation(BABYLON::TransformNode& node,
+                       const BABYLON::Vector3& translation)
+{
+  const auto& m = node.getWorldMatrix().m();
+  EXPECT_NEAR(m[12], translation.x, 1e-5f) << node.name;
+  EXPECT_NEAR(m[13], translation.y, 1e-5f) << node.name;
+  EXPECT_NEAR(m[14], translation.z, 1e-5f) << node.name;
+}
+
+} // end of anonymous namespace
+
+TEST(TestTransformHierarchy, TopologicalRebuildAfterReparent)
+{
+  using namespace BABYLON;
+
+  auto canvas = std::make_unique<HeadlessCanvas>();
+  auto engine = Engine::New(canvas.get());
+  auto scene  = Scene::New(engine.get());
+
+  // The children are added to the scene before their parents
+  auto child         = Mesh::New("child", scene.get());
+  auto parent        = TransformNode::New("parent", scene.get());
+  auto ancestor      = TransformNode::New("ancestor", scene.get());
+  child->parent      = parent.get();
+  child->position    = Vector3(0.f, 0.f, 1.f);
+  parent->position   = Vector3(0.f, 2.f, 0.f);
+  ancestor->position = Vector3(3.f, 0.f, 0.f);
+
+  TransformHierarchy hierarchy(scene.get());
+  EXPECT_EQ(hierarchy.update(), 3u);
+  ASSERT_EQ(hierarchy.nodes().size(), 3u);
+  EXPECT_LT(IndexOf(hierarchy, parent.get()), IndexOf(hierarchy, child.get()));
+  ExpectTranslation(*child, Vector3(0.f, 2.f, 1.f));
+
+  // The reparented node is validated through its parent chain, then the list
+  // is rebuilt by the next update
+  parent->parent = ancestor.get();
+  hierarchy.update();
+  ExpectTranslation(*parent, Vector3(3.f, 2.f, 0.f));
+  ExpectTranslation(*child, Vector3(3.f, 2.f, 1.f));
+  EXPECT_EQ(hierarchy.update(), 0u);
+  EXPECT_LT(IndexOf(hierarchy, ancestor.get()),
+            IndexOf(hierarchy, parent.get()));
+  EXPECT_LT(IndexOf(hierarchy, parent.get()), IndexOf(hierarchy, child.get()));
+
+  // Only the moved subtree is recomputed
+  ancestor->position = Vector3(-3.f, 0.f, 0.f);
+  EXPECT_EQ(hierarchy.update(), 3u);
+  ExpectTranslation(*child, Vector3(-3.f, 2.f, 1.f));
+  parent->position = Vector3(0.f, 4.f, 0.f);
+  EXPECT_EQ(hierarchy.update(), 2u);
+  ExpectTranslation(*child, Vector3(-3.f, 4.f, 1.f));
+}
+
+TEST(TestTransformHierarchy, ExternalParentFallback)
+{
+  using namespace BABYLON;
+
+  auto canvas = std::make_unique<HeadlessCanvas>();
+  auto engine = Engine::New(canvas.get());
+  auto scene  = Scene::New(engine.get());
+  auto camera
+    = FreeCamera::New("camera", Vector3(0.f, 0.f, -10.f), scene.get());
+  // The camera updates its matrices at the beginning of a frame
+  const auto updateCamera = [&camera]() {
+    camera->getViewMatrix(true);
+    camera->getProjectionMatrix(true);
+  };
+  updateCamera();
+
+  // A camera is not a transform node, its children fall back to the
+  // validation of their parent chain
+  auto mesh      = Mesh::New("mesh", scene.get());
+  mesh->parent   = camera.get();
+  mesh->position = Vector3(1.f, 2.f, 3.f);
+
+  TransformHierarchy hierarchy(scene.get());
+  EXPECT_EQ(hierarchy.update(), 1u);
+  ExpectTranslation(*mesh, Vector3(1.f, 2.f, -7.f));
+  EXPECT_EQ(hierarchy.update(), 0u);
+
+  camera->position = Vector3(5.f, 0.f, 0.f);
+  updateCamera();
+  EXPECT_EQ(hierarchy.update(), 1u);
+  ExpectTranslation(*mesh, Vector3(6.f, 2.f, 3.f));
+}
+
+TEST(TestTransformHierarchy, IsUpToDate)
+{
+  using namespace BABYLON;
+
+  auto canvas = std::make_unique<HeadlessCanvas>();
+  auto engine = Engine::New(canvas.get());
+  auto scene  = Scene::New(engine.get());
+
+  auto root    = TransformNode::New("root", scene.get());
+  auto mesh    = Mesh::New("mesh", scene.get());
+  mesh->parent = root.get();
+
+  TransformHierarchy hierarchy(scene.get());
+  EXPECT_FALSE(hierarchy.isUpToDate(mesh.get()));
+  hierarchy.update();
+  EXPECT_TRUE(hierarchy.isUpToDate(root.get()));
+  EXPECT_TRUE(hierarchy.isUpToDate(mesh.get()));
+
+  // A node added after the update has not been validated, until the next
+  // update adds it to the list
+  auto other = Mesh::New("other", scene.get());
+  EXPECT_FALSE(hierarchy.isUpToDate(other.get()));
+  hierarchy.update();
+  EXPECT_TRUE(hierarchy.isUpToDate(other.get()));
+  EXPECT_EQ(hierarchy.nodes().size(), 3u);
+
+  // The removed nodes leave the list
+  scene->removeMesh(other.get());
+  hierarchy.update();
+  EXPECT_EQ(hierarchy.nodes().size(), 2u);
+}
+
+TEST(TestTransformHierarchy, DisabledNodes)
+{
+  using namespace BABYLON;
+
+  auto canvas = std::make_unique<HeadlessCanvas>();
+  auto engine = Engine::New(canvas.get());
+  auto scene  = Scene::New(engine.get());
+  FreeCamera::New("camera", Vector3(0.f, 0.f, -10.f), scene.get());
+  scene->useTransformHierarchy = true;
+  const auto render = [&engine, &scene]() {
+    engine->beginFrame();
+    scene->render();
+    engine->endFrame();
+  };
+
+  auto parent      = Mesh::CreateBox("parent", 1.f, scene.get());
+  auto child       = Mesh::CreateBox("child", 1.f, scene.get());
+  child->parent    = parent.get();
+  child->position  = Vector3(0.f, 1.f, 0.f);
+  parent->position = Vector3(1.f, 0.f, 0.f);
+  render();
+  EXPECT_EQ(scene->getActiveMeshes().size(), 2u);
+
+  // The disabled nodes are neither active nor skipped by the hierarchy: the
+  // world matrices follow the moves made while they are disabled
+  parent->setEnabled(false);
+  parent->position = Vector3(-1.f, 0.f, 0.f);
+  render();
+  EXPECT_TRUE(scene->getActiveMeshes().empty());
+  ExpectTranslation(*parent, Vector3(-1.f, 0.f, 0.f));
+  ExpectTranslation(*child, Vector3(-1.f, 1.f, 0.f));
+
+  parent->setEnabled(true);
+  render();
+  EXPECT_EQ(scene->getActiveMeshes().size(), 2u);
+  ExpectTranslation(*child, Vector3(-1.f, 1.f, 0.f));
+}
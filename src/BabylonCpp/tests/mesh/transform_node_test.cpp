@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#include <babylon/animations/animation_value.h>
+#include <babylon/engines/engine.h>
+#include <babylon/engines/headless/headless_canvas.h>
+#include <babylon/engines/scene.h>
+#include <babylon/math/quaternion.h>
+#include <babylon/meshes/transform_node.h>
+
+namespace {
+
+class TransformNodeStub : public BABYLON::TransformNode {
+
+public:
+  TransformNodeStub(const std::string& iName, BABYLON::Scene* scene)
+      : BABYLON::TransformNode(iName, scene)
+  {
+  }
+
+  using BABYLON::TransformNode::_isDirty;
+
+}; // end of class TransformNodeStub
+
+} // end of anonymous namespace
+
+TEST(TestTransformNode, BindProperty)
+{
+  using namespace BABYLON;
+
+  auto canvas = std::make_unique<HeadlessCanvas>();
+  auto engine = Engine::New(canvas.get());
+  auto scene  = Scene::New(engine.get());
+  auto node   = std::make_shared<TransformNodeStub>("node", scene.get());
+  node->computeWorldMatrix(true);
+  ASSERT_FALSE(node->_isDirty);
+
+  // Vector
+  auto setPosition = node->bindProperty({"position"});
+  ASSERT_TRUE(setPosition);
+  setPosition(AnimationValue(Vector3(1.f, 2.f, 3.f)));
+  EXPECT_TRUE(node->position().equals(Vector3(1.f, 2.f, 3.f)));
+  EXPECT_TRUE(node->_isDirty);
+  node->computeWorldMatrix(true);
+  EXPECT_FALSE(node->_isDirty);
+
+  // Component, the value of an other type is ignored
+  auto setPositionX = node->bindProperty({"position", "x"});
+  ASSERT_TRUE(setPositionX);
+  setPositionX(AnimationValue(Vector3(7.f, 7.f, 7.f)));
+  EXPECT_FALSE(node->_isDirty);
+  setPositionX(AnimationValue(4.f));
+  EXPECT_TRUE(node->position().equals(Vector3(4.f, 2.f, 3.f)));
+  EXPECT_TRUE(node->_isDirty);
+  node->computeWorldMatrix(true);
+  EXPECT_FLOAT_EQ(node->getWorldMatrix().m()[12], 4.f);
+
+  // The rotation replaces the rotation quaternion
+  node->rotationQuaternion = Quaternion::Identity();
+  node->computeWorldMatrix(true);
+  auto setRotation = node->bindProperty({"rotation"});
+  ASSERT_TRUE(setRotation);
+  setRotation(AnimationValue(Vector3(0.f, 0.5f, 0.f)));
+  EXPECT_TRUE(node->rotation().equals(Vector3(0.f, 0.5f, 0.f)));
+  EXPECT_FALSE(node->rotationQuaternion().has_value());
+  EXPECT_TRUE(node->_isDirty);
+}
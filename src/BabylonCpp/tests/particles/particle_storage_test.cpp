@@ -0,0 +1,269 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <babylon/engines/scene.h>
+#include <babylon/materials/textures/raw_texture.h>
+#include <babylon/particles/particle.h>
+#include <babylon/particles/particle_storage.h>
+#include <babylon/particles/particle_system.h>
+
+#include "helpers/headless_scene.h"
+
+namespace {
+
+// Particle whose attributes are all different
+BABYLON::Particle CreateParticle(BABYLON::ParticleSystem* particleSystem,
+                                 float seed, bool hasInitialDirection)
+{
+  using namespace BABYLON;
+  Particle particle(particleSystem);
+  particle.position.copyFromFloats(seed, seed + 0.1f, seed + 0.2f);
+  particle.direction.copyFromFloats(seed + 0.3f, seed + 0.4f, seed + 0.5f);
+  particle.color.set(0.1f, 0.2f, 0.3f, 0.4f);
+  particle.colorStep.set(-0.01f, -0.02f, -0.03f, -0.04f);
+  particle.age          = 0.f;
+  particle.lifeTime     = 10.f + seed;
+  particle.angle        = seed + 0.6f;
+  particle.angularSpeed = 0.05f;
+  particle.size         = seed + 0.7f;
+  particle.scale.copyFromFloats(seed + 0.8f, seed + 0.9f);
+  if (hasInitialDirection) {
+    particle._initialDirection = Vector3(seed, -seed, 1.f);
+  }
+  return particle;
+}
+
+void ExpectSameParticle(const BABYLON::Particle& lhs,
+                        const BABYLON::Particle& rhs)
+{
+  EXPECT_TRUE(lhs.position.equals(rhs.position));
+  EXPECT_TRUE(lhs.direction.equals(rhs.direction));
+  EXPECT_TRUE(lhs.color.equals(rhs.color));
+  EXPECT_TRUE(lhs.colorStep.equals(rhs.colorStep));
+  EXPECT_FLOAT_EQ(lhs.age, rhs.age);
+  EXPECT_FLOAT_EQ(lhs.lifeTime, rhs.lifeTime);
+  EXPECT_FLOAT_EQ(lhs.angle, rhs.angle);
+  EXPECT_FLOAT_EQ(lhs.angularSpeed, rhs.angularSpeed);
+  EXPECT_FLOAT_EQ(lhs.size, rhs.size);
+  EXPECT_TRUE(lhs.scale.equals(rhs.scale));
+  ASSERT_EQ(lhs._initialDirection.has_value(),
+            rhs._initialDirection.has_value());
+  if (lhs._initialDirection) {
+    EXPECT_TRUE(lhs._initialDirection->equals(*rhs._initialDirection));
+  }
+}
+
+// System whose emitted particles only depend on the seed of its generator,
+// owned by the scene
+BABYLON::ParticleSystem* CreateParticleSystem(BABYLON::Scene* scene,
+                                              bool useParticleStorage)
+{
+  using namespace BABYLON;
+  auto particleSystem = new ParticleSystem("particles", 256, scene);
+  particleSystem->useParticleStorage = useParticleStorage;
+  particleSystem->particleTexture
+    = RawTexture::CreateRGBATexture(Uint8Array(4, 255), 1, 1, scene);
+  particleSystem->emitter         = Vector3::Zero();
+  particleSystem->emitRate        = 7;
+  particleSystem->minLifeTime     = 12.f;
+  particleSystem->maxLifeTime     = 12.f;
+  particleSystem->minEmitPower    = 0.5f;
+  particleSystem->maxEmitPower    = 0.5f;
+  particleSystem->minSize         = 0.25f;
+  particleSystem->maxSize         = 0.25f;
+  particleSystem->minAngularSpeed = 0.1f;
+  particleSystem->maxAngularSpeed = 0.1f;
+  particleSystem->color1          = Color4(1.f, 0.5f, 0.f, 1.f);
+  particleSystem->color2          = Color4(1.f, 0.5f, 0.f, 1.f);
+  particleSystem->gravity         = Vector3(0.f, -0.1f, 0.f);
+  // one step per frame of the constant animation delta time
+  particleSystem->updateSpeed = 1.25f;
+
+  auto generator = std::make_shared<std::mt19937>(42);
+  particleSystem->startPositionFunction
+    = [generator](const Matrix&, Vector3& position, Particle*) {
+        std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+        position.copyFromFloats(distribution(*generator),
+                                distribution(*generator),
+                                distribution(*generator));
+      };
+  particleSystem->startDirectionFunction
+    = [generator](const Matrix&, Vector3& direction, Particle*) {
+        std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+        direction.copyFromFloats(distribution(*generator), 1.f,
+                                 distribution(*generator));
+      };
+  particleSystem->start();
+  return particleSystem;
+}
+
+} // end of anonymous namespace
+
+TEST(TestParticleStorage, AddGetRemove)
+{
+  using namespace BABYLON;
+
+  HeadlessScene particleScene;
+  auto particleSystem
+    = new ParticleSystem("particles", 4, particleScene.scene.get());
+
+  ParticleStorage storage;
+  storage.reserve(3);
+  EXPECT_TRUE(storage.empty());
+  std::vector<Particle> particles;
+  for (unsigned int i = 0; i < 4; ++i) {
+    particles.emplace_back(
+      CreateParticle(particleSystem, static_cast<float>(i), i % 2 == 0));
+    storage.add(particles.back());
+  }
+
+  // the storage is full after 3 particles
+  ASSERT_EQ(storage.size(), 3u);
+  Particle particle(particleSystem);
+  for (size_t i = 0; i < storage.size(); ++i) {
+    storage.get(i, particle);
+    ExpectSameParticle(particle, particles[i]);
+    EXPECT_EQ(storage.hasInitialDirection(i), i % 2 == 0);
+  }
+
+  // the last particle takes the place of the removed one
+  storage.remove(0);
+  ASSERT_EQ(storage.size(), 2u);
+  storage.get(0, particle);
+  ExpectSameParticle(particle, particles[2]);
+  storage.get(1, particle);
+  ExpectSameParticle(particle, particles[1]);
+
+  // growing the storage keeps the particles
+  storage.reserve(8);
+  storage.add(particles[3]);
+  ASSERT_EQ(storage.size(), 3u);
+  storage.get(1, particle);
+  ExpectSameParticle(particle, particles[1]);
+  storage.get(2, particle);
+  ExpectSameParticle(particle, particles[3]);
+
+  storage.clear();
+  EXPECT_TRUE(storage.empty());
+}
+
+TEST(TestParticleStorage, UpdateRecyclesDeadParticles)
+{
+  using namespace BABYLON;
+
+  HeadlessScene particleScene;
+  auto particleSystem
+    = new ParticleSystem("particles", 5, particleScene.scene.get());
+
+  // the second and the fourth particles reach their life time
+  ParticleStorage storage;
+  storage.reserve(5);
+  const float lifeTimes[5] = {10.f, 1.f, 10.f, 2.f, 10.f};
+  for (unsigned int i = 0; i < 5; ++i) {
+    auto particle
+      = CreateParticle(particleSystem, static_cast<float>(i), false);
+    particle.lifeTime = lifeTimes[i];
+    storage.add(particle);
+  }
+
+  EXPECT_EQ(storage.update(2.f, Vector3::Zero()), 2u);
+  ASSERT_EQ(storage.size(), 3u);
+  const auto* ages = storage.component(MathKernels::ParticleAge);
+  const auto* storedLifeTimes
+    = storage.component(MathKernels::ParticleLifeTime);
+  for (size_t i = 0; i < storage.size(); ++i) {
+    EXPECT_FLOAT_EQ(ages[i], 2.f);
+    EXPECT_FLOAT_EQ(storedLifeTimes[i], 10.f);
+  }
+
+  // the last particle replaced the second one
+  Particle particle(particleSystem);
+  storage.get(1, particle);
+  EXPECT_FLOAT_EQ(particle.size, 4.7f);
+  storage.get(2, particle);
+  EXPECT_FLOAT_EQ(particle.size, 2.7f);
+}
+
+TEST(TestParticleStorage, ParallelUpdate)
+{
+  using namespace BABYLON;
+
+  HeadlessScene particleScene;
+  auto particleSystem
+    = new ParticleSystem("particles", 1, particleScene.scene.get());
+
+  // the large storage is updated on the thread pool, the small ones on the
+  // calling thread
+  const auto count      = 2 * ParticleStorage::ParallelUpdateThreshold + 5;
+  const auto chunkCount = ParticleStorage::ParallelUpdateThreshold / 2;
+  ParticleStorage storage;
+  storage.reserve(count);
+  std::vector<ParticleStorage> chunks((count + chunkCount - 1) / chunkCount);
+  for (auto& chunk : chunks) {
+    chunk.reserve(chunkCount);
+  }
+  for (size_t i = 0; i < count; ++i) {
+    const auto particle = CreateParticle(
+      particleSystem, static_cast<float>(i % 97) * 0.01f, i % 3 == 0);
+    storage.add(particle);
+    chunks[i / chunkCount].add(particle);
+  }
+
+  const Vector3 gravity(0.f, -9.81f, 0.f);
+  for (unsigned int step = 0; step < 3; ++step) {
+    EXPECT_EQ(storage.update(0.5f, gravity), 0u);
+    for (auto& chunk : chunks) {
+      EXPECT_EQ(chunk.update(0.5f, gravity), 0u);
+    }
+  }
+
+  ASSERT_EQ(storage.size(), count);
+  for (size_t k = 0; k < ParticleStorage::ComponentCount; ++k) {
+    const auto* values = storage.component(k);
+    for (size_t i = 0; i < count; ++i) {
+      const auto* chunkValues = chunks[i / chunkCount].component(k);
+      ASSERT_FLOAT_EQ(values[i], chunkValues[i % chunkCount])
+        << "component " << k << " of particle " << i;
+    }
+  }
+}
+
+TEST(TestParticleStorage, ParticleSystemVertexData)
+{
+  using namespace BABYLON;
+
+  HeadlessScene particleScene;
+  auto scene                           = particleScene.scene.get();
+  scene->useConstantAnimationDeltaTime = true;
+
+  auto particles       = CreateParticleSystem(scene, false);
+  auto particleStorage = CreateParticleSystem(scene, true);
+
+  // the first particles die from the 12th frame
+  for (unsigned int frame = 0; frame < 20; ++frame) {
+    particleScene.render();
+    particles->animate();
+    particleStorage->animate();
+
+    ASSERT_EQ(particleStorage->getActiveCount(), particles->getActiveCount());
+    const auto& vertexData       = particles->_getVertexData();
+    const auto& storedVertexData = particleStorage->_getVertexData();
+    ASSERT_EQ(storedVertexData.size(), vertexData.size());
+    const auto activeSize = vertexData.size() * particles->getActiveCount()
+                            / particles->getCapacity();
+    for (size_t i = 0; i < activeSize; ++i) {
+      ASSERT_NEAR(storedVertexData[i], vertexData[i], 1e-5f)
+        << "frame " << frame << ", float " << i;
+    }
+  }
+  EXPECT_GT(particles->getActiveCount(), 0u);
+  EXPECT_LT(particles->getActiveCount(), 20u * 7u);
+
+  // a custom update function disables the storage
+  particleStorage->updateFunction = [](std::vector<Particle*>&) {};
+  particleScene.render();
+  const auto activeCount = particleStorage->getActiveCount();
+  particleStorage->animate();
+  EXPECT_EQ(particleStorage->getActiveCount(), activeCount + 7);
+}
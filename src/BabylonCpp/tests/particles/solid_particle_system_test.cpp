@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+
+#include <babylon/engines/headless/recording_gl_rendering_context.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/particles/solid_particle.h>
+#include <babylon/particles/solid_particle_system.h>
+
+#include "helpers/headless_scene.h"
+
+namespace {
+
+// Vertices of a box particle
+const size_t BoxVertices = 24;
+
+// System of boxes, each one with its own position, rotation and scaling
+BABYLON::SolidParticleSystemPtr
+CreateSolidParticleSystem(BABYLON::Scene* scene, size_t count)
+{
+  using namespace BABYLON;
+  auto sps   = SolidParticleSystem::New("sps", scene);
+  auto model = Mesh::CreateBox("box", 1.f, scene);
+  sps->addShape(model, count, SolidParticleSystemMeshBuilderOptions{});
+  model->dispose();
+  sps->buildMesh();
+
+  for (size_t i = 0; i < sps->particles.size(); ++i) {
+    auto& particle = sps->particles[i];
+    const auto x   = static_cast<float>(i);
+    particle->position.copyFromFloats(x, x * 0.5f, -x * 0.25f);
+    particle->rotation.copyFromFloats(x * 0.1f, x * 0.2f, x * 0.3f);
+    particle->scaling.copyFromFloats(1.f + x * 0.01f, 1.f, 0.5f);
+  }
+  return sps;
+}
+
+// Records the range passed to the update callbacks
+class UpdateRangeSPS : public BABYLON::SolidParticleSystem {
+
+public:
+  UpdateRangeSPS(const std::string& iName, BABYLON::Scene* scene)
+      : BABYLON::SolidParticleSystem(iName, scene)
+  {
+  }
+
+  void beforeUpdateParticles(unsigned int start, unsigned int stop,
+                             bool /*update*/) override
+  {
+    beforeRange = {start, stop};
+  }
+
+  void afterUpdateParticles(unsigned int start, unsigned int stop,
+                            bool /*update*/) override
+  {
+    afterRange = {start, stop};
+  }
+
+  std::pair<unsigned int, unsigned int> beforeRange;
+  std::pair<unsigned int, unsigned int> afterRange;
+
+}; // end of class UpdateRangeSPS
+
+} // end of anonymous namespace
+
+TEST(TestSolidParticleSystem, SerialAndParallelVertices)
+{
+  using namespace BABYLON;
+
+  HeadlessScene spsScene;
+  const auto count = 2 * SolidParticleSystem::ParallelUpdateThreshold;
+  auto parallelSPS = CreateSolidParticleSystem(spsScene.scene.get(), count);
+  auto serialSPS   = CreateSolidParticleSystem(spsScene.scene.get(), count);
+
+  // all the particles at once on the thread pool, then in chunks small enough
+  // to be set on the calling thread
+  parallelSPS->setParticles();
+  const auto chunk = SolidParticleSystem::ParallelUpdateThreshold / 4;
+  for (unsigned int start = 0; start < count; start += chunk) {
+    const auto end = static_cast<unsigned int>(start + chunk - 1);
+    serialSPS->setParticles(start, end, end + 1 == count);
+  }
+
+  for (const auto& kind :
+       {VertexBuffer::PositionKind, VertexBuffer::NormalKind}) {
+    const auto parallelData = parallelSPS->mesh->getVerticesData(kind);
+    const auto serialData   = serialSPS->mesh->getVerticesData(kind);
+    ASSERT_EQ(parallelData.size(), count * BoxVertices * 3);
+    ASSERT_EQ(serialData.size(), parallelData.size());
+    for (size_t i = 0; i < parallelData.size(); ++i) {
+      ASSERT_FLOAT_EQ(parallelData[i], serialData[i]) << kind << " " << i;
+    }
+  }
+}
+
+TEST(TestSolidParticleSystem, DirtyRangeUpload)
+{
+  using namespace BABYLON;
+
+  HeadlessScene spsScene;
+  auto sps = CreateSolidParticleSystem(spsScene.scene.get(), 100);
+  sps->setParticles();
+
+  // the particles 10 to 19 are uploaded, for each vertex data kind
+  auto& gl = *spsScene.canvas->recordingContext();
+  gl.resetStatistics();
+  gl.clearCalls();
+  sps->setParticles(10, 19);
+  EXPECT_EQ(gl.countCalls("bufferData"), 0u);
+  ASSERT_GT(gl.countCalls("bufferSubData"), 0u);
+  size_t bytesUploaded = 0;
+  for (const auto& call : gl.calls()) {
+    if (std::string(call.name) != "bufferSubData") {
+      continue;
+    }
+    // 2, 3 or 4 floats per vertex
+    const auto byteLength = static_cast<size_t>(call.arguments[1]);
+    const auto stride     = byteLength / (10 * BoxVertices * sizeof(float));
+    EXPECT_TRUE(stride >= 2 && stride <= 4);
+    EXPECT_EQ(byteLength, 10 * BoxVertices * stride * sizeof(float));
+    EXPECT_EQ(call.arguments[2], 10 * BoxVertices * stride * sizeof(float));
+    bytesUploaded += byteLength;
+  }
+  EXPECT_EQ(gl.statistics().bufferBytesUploaded, bytesUploaded);
+
+  // the whole vertex data is uploaded when all the particles are set
+  gl.resetStatistics();
+  gl.clearCalls();
+  sps->setParticles();
+  for (const auto& call : gl.calls()) {
+    if (std::string(call.name) == "bufferSubData") {
+      EXPECT_EQ(call.arguments[2], 0.0);
+    }
+  }
+  EXPECT_EQ(gl.statistics().bufferBytesUploaded, 10 * bytesUploaded);
+}
+
+TEST(TestSolidParticleSystem, DirtyRangeAccumulation)
+{
+  using namespace BABYLON;
+
+  HeadlessScene spsScene;
+  auto sps = CreateSolidParticleSystem(spsScene.scene.get(), 100);
+  sps->setParticles();
+
+  // nothing is uploaded until the mesh is updated, then the span going from
+  // the particle 10 to the particle 59 is
+  auto& gl = *spsScene.canvas->recordingContext();
+  gl.resetStatistics();
+  gl.clearCalls();
+  sps->setParticles(50, 59, false);
+  sps->setParticles(10, 19, false);
+  EXPECT_EQ(gl.statistics().bufferUploads, 0u);
+
+  sps->setParticles(30, 34, true);
+  size_t positionCalls = 0;
+  for (const auto& call : gl.calls()) {
+    if (std::string(call.name) != "bufferSubData") {
+      continue;
+    }
+    const auto byteLength = static_cast<size_t>(call.arguments[1]);
+    const auto stride     = byteLength / (50 * BoxVertices * sizeof(float));
+    EXPECT_EQ(byteLength, 50 * BoxVertices * stride * sizeof(float));
+    EXPECT_EQ(call.arguments[2], 10 * BoxVertices * stride * sizeof(float));
+    if (stride == 3) {
+      ++positionCalls;
+    }
+  }
+  // the positions and the normals
+  EXPECT_EQ(positionCalls, 2u);
+
+  // the range is reset by the update: the positions, normals, colors and uvs
+  // of a single particle are uploaded
+  gl.resetStatistics();
+  sps->setParticles(5, 5, true);
+  EXPECT_EQ(gl.statistics().bufferBytesUploaded,
+            BoxVertices * (3 + 3 + 4 + 2) * sizeof(float));
+}
+
+TEST(TestSolidParticleSystem, UpdateCallbacksRange)
+{
+  using namespace BABYLON;
+
+  HeadlessScene spsScene;
+  UpdateRangeSPS sps("sps", spsScene.scene.get());
+  auto model = Mesh::CreateBox("box", 1.f, spsScene.scene.get());
+  sps.addShape(model, 10, SolidParticleSystemMeshBuilderOptions{});
+  model->dispose();
+  sps.buildMesh();
+
+  // The default end is clamped to the last particle before the callbacks
+  sps.setParticles();
+  EXPECT_EQ(sps.beforeRange, std::make_pair(0u, 9u));
+  EXPECT_EQ(sps.afterRange, std::make_pair(0u, 9u));
+
+  sps.setParticles(2, 20, false);
+  EXPECT_EQ(sps.beforeRange, std::make_pair(2u, 9u));
+  EXPECT_EQ(sps.afterRange, std::make_pair(2u, 9u));
+}
@@ -0,0 +1,237 @@
+#include <gtest/gtest.h>
+
+#include <babylon/culling/bounding_info.h>
+#include <babylon/engines/engine.h>
+#include <babylon/engines/headless/headless_canvas.h>
+#include <babylon/engines/scene.h>
+#include <babylon/physics/iphysics_enabled_object.h>
+#include <babylon/physics/iphysics_engine.h>
+#include <babylon/physics/physics_impostor.h>
+#include <babylon/physics/physics_impostor_parameters.h>
+#include <babylon/physics/plugins/native_physics_plugin.h>
+#include <babylon/physics/plugins/native_physics_world.h>
+
+namespace {
+
+BABYLON::NativePhysicsWorld::BodyId
+CreateGround(BABYLON::NativePhysicsWorld& world)
+{
+  using namespace BABYLON;
+  return world.createBody(NativePhysicsShape::Box(Vector3(10.f, 0.5f, 10.f)),
+                          0.f, Vector3(0.f, -0.5f, 0.f), Quaternion());
+}
+
+// The meshes of the library do not implement IPhysicsEnabledObject
+class PhysicsObject : public BABYLON::IPhysicsEnabledObject {
+
+public:
+  PhysicsObject(const std::string& iName, BABYLON::Scene* scene,
+                const BABYLON::Vector3& extendSize)
+      : BABYLON::IPhysicsEnabledObject(iName, scene)
+  {
+    setBoundingInfo(BABYLON::BoundingInfo(extendSize.negate(), extendSize));
+  }
+
+  BABYLON::AbstractMesh* getParent() override
+  {
+    return nullptr;
+  }
+
+  BABYLON::Scene* getScene() const override
+  {
+    return BABYLON::AbstractMesh::getScene();
+  }
+
+  bool hasBoundingInfo() override
+  {
+    return true;
+  }
+
+  const std::string getClassName() const override
+  {
+    return "PhysicsObject";
+  }
+
+}; // end of class PhysicsObject
+
+void Simulate(BABYLON::NativePhysicsWorld& world, float duration)
+{
+  constexpr float timeStep = 1.f / 60.f;
+  for (float time = 0.f; time < duration; time += timeStep) {
+    world.step(timeStep);
+  }
+}
+
+} // end of anonymous namespace
+
+TEST(TestNativePhysicsWorld, ConvexHull)
+{
+  using namespace BABYLON;
+
+  // Cube with an inner point
+  std::vector<Vector3> points{Vector3(0.f, 0.f, 0.f)};
+  for (float x : {-1.f, 1.f}) {
+    for (float y : {-1.f, 1.f}) {
+      for (float z : {-1.f, 1.f}) {
+        points.emplace_back(Vector3(x, y, z));
+      }
+    }
+  }
+  const auto hull = NativePhysicsShape::ConvexHull(points);
+  EXPECT_EQ(hull.type(), NativePhysicsShape::Type::ConvexHull);
+  EXPECT_EQ(hull.vertices().size(), 8ull);
+  EXPECT_EQ(hull.faces().size(), 6ull);
+  EXPECT_EQ(hull.edges().size(), 12ull);
+  for (const auto& face : hull.faces()) {
+    EXPECT_EQ(face.indices.size(), 4ull);
+    EXPECT_NEAR(face.offset, 1.f, 1e-5f);
+  }
+}
+
+TEST(TestNativePhysicsWorld, SphereRestsOnGround)
+{
+  using namespace BABYLON;
+
+  NativePhysicsWorld world;
+  CreateGround(world);
+  const auto sphere = world.createBody(NativePhysicsShape::Sphere(0.5f), 1.f,
+                                       Vector3(0.f, 3.f, 0.f), Quaternion());
+  Simulate(world, 3.f);
+
+  EXPECT_NEAR(world.position(sphere).y, 0.5f, 0.02f);
+  EXPECT_NEAR(world.linearVelocity(sphere).length(), 0.f, 0.05f);
+}
+
+TEST(TestNativePhysicsWorld, BoxStackFallsAsleep)
+{
+  using namespace BABYLON;
+
+  NativePhysicsWorld world;
+  CreateGround(world);
+  std::vector<NativePhysicsWorld::BodyId> boxes;
+  for (unsigned int i = 0; i < 3; ++i) {
+    boxes.emplace_back(world.createBody(
+      NativePhysicsShape::Box(Vector3(0.5f, 0.5f, 0.5f)), 1.f,
+      Vector3(0.f, 0.5f + 1.01f * i, 0.f), Quaternion()));
+  }
+  Simulate(world, 4.f);
+
+  for (size_t i = 0; i < boxes.size(); ++i) {
+    const auto& position = world.position(boxes[i]);
+    EXPECT_NEAR(position.x, 0.f, 0.05f);
+    EXPECT_NEAR(position.y, 0.5f + i, 0.05f);
+    EXPECT_NEAR(position.z, 0.f, 0.05f);
+    EXPECT_TRUE(world.isSleeping(boxes[i]));
+  }
+}
+
+TEST(TestNativePhysicsWorld, Islands)
+{
+  using namespace BABYLON;
+
+  NativePhysicsWorld world;
+  CreateGround(world);
+  for (float x : {-4.f, 4.f}) {
+    for (unsigned int i = 0; i < 2; ++i) {
+      world.createBody(NativePhysicsShape::Box(Vector3(0.5f, 0.5f, 0.5f)), 1.f,
+                       Vector3(x, 0.5f + i, 0.f), Quaternion());
+    }
+  }
+  world.step(1.f / 60.f);
+
+  // The static ground does not link the stacks together
+  EXPECT_EQ(world.islandCount(), 2ull);
+  EXPECT_GT(world.contactCount(), 0ull);
+}
+
+TEST(TestNativePhysicsWorld, Raycast)
+{
+  using namespace BABYLON;
+
+  NativePhysicsWorld world;
+  const auto ground = CreateGround(world);
+  const auto sphere = world.createBody(NativePhysicsShape::Sphere(1.f), 0.f,
+                                       Vector3(0.f, 3.f, 0.f), Quaternion());
+
+  Vector3 point, normal;
+  EXPECT_EQ(world.raycast(Vector3(0.f, 10.f, 0.f), Vector3(0.f, -10.f, 0.f),
+                          point, normal),
+            sphere);
+  EXPECT_NEAR(point.y, 4.f, 1e-4f);
+  EXPECT_NEAR(normal.y, 1.f, 1e-4f);
+
+  EXPECT_EQ(world.raycast(Vector3(5.f, 10.f, 0.f), Vector3(5.f, -10.f, 0.f),
+                          point, normal),
+            ground);
+  EXPECT_NEAR(point.y, 0.f, 1e-4f);
+
+  EXPECT_EQ(world.raycast(Vector3(20.f, 10.f, 0.f), Vector3(20.f, -10.f, 0.f),
+                          point, normal),
+            NativePhysicsWorld::InvalidId);
+}
+
+TEST(TestNativePhysicsWorld, DistanceJoint)
+{
+  using namespace BABYLON;
+
+  NativePhysicsWorld world;
+  const auto anchor = world.createBody(NativePhysicsShape::Sphere(0.1f), 0.f,
+                                       Vector3(0.f, 5.f, 0.f), Quaternion());
+  const auto bob = world.createBody(NativePhysicsShape::Sphere(0.1f), 1.f,
+                                    Vector3(2.f, 5.f, 0.f), Quaternion());
+  world.createDistanceJoint(anchor, bob, Vector3(), Vector3(), 0.f, 2.f,
+                            false);
+  Simulate(world, 2.f);
+
+  const auto distance
+    = (world.position(bob) - world.position(anchor)).length();
+  EXPECT_NEAR(distance, 2.f, 0.05f);
+  EXPECT_LT(world.position(bob).y, 5.f);
+}
+
+TEST(TestNativePhysicsWorld, PhysicsEngine)
+{
+  using namespace BABYLON;
+
+  // The plugin is not owned by the physics engine
+  NativePhysicsPlugin plugin;
+  auto canvas = std::make_unique<HeadlessCanvas>();
+  auto engine = Engine::New(canvas.get());
+  auto scene  = Scene::New(engine.get());
+  ASSERT_TRUE(scene->enablePhysics(Vector3(0.f, -9.81f, 0.f), &plugin));
+  auto& physicsEngine = scene->getPhysicsEngine();
+
+  PhysicsObject ground("ground", scene.get(), Vector3(10.f, 0.5f, 10.f));
+  PhysicsObject sphere("sphere", scene.get(), Vector3(0.5f, 0.5f, 0.5f));
+  ground.position = Vector3(0.f, -0.5f, 0.f);
+  sphere.position = Vector3(0.f, 3.f, 0.f);
+  PhysicsImpostorParameters groundParams, sphereParams;
+  groundParams.mass = 0.f;
+  sphereParams.mass = 1.f;
+
+  // The physics engine takes the ownership of the impostors
+  auto sphereImpostor = new PhysicsImpostor(
+    &sphere, PhysicsImpostor::SphereImpostor, sphereParams, scene.get());
+  new PhysicsImpostor(&ground, PhysicsImpostor::BoxImpostor, groundParams,
+                      scene.get());
+  ASSERT_EQ(physicsEngine->getImpostors().size(), 2ull);
+  EXPECT_FALSE(sphereImpostor->isBodyInitRequired());
+  EXPECT_EQ(plugin.getWorld().bodyCount(), 2ull);
+
+  for (unsigned int i = 0; i < 180; ++i) {
+    physicsEngine->_step(1.f / 60.f);
+  }
+
+  // The steps move the objects, the sphere rests on the ground
+  EXPECT_NEAR(sphere.position().x, 0.f, 0.02f);
+  EXPECT_NEAR(sphere.position().y, 0.5f, 0.02f);
+  EXPECT_NEAR(plugin.getLinearVelocity(*sphereImpostor).length(), 0.f, 0.05f);
+  EXPECT_NEAR(ground.position().y, -0.5f, 1e-5f);
+
+  // A new body replaces the previous one in the world
+  plugin.generatePhysicsBody(*sphereImpostor);
+  EXPECT_EQ(plugin.getWorld().bodyCount(), 2ull);
+
+  scene->disablePhysicsEngine();
+  EXPECT_EQ(plugin.getWorld().bodyCount(), 0ull);
+}
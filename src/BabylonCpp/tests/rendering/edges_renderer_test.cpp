@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/engine.h>
+#include <babylon/engines/headless/headless_canvas.h>
+#include <babylon/engines/headless/recording_gl_rendering_context.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/rendering/edges_renderer.h>
+
+namespace {
+
+class EdgesRendererStub : public BABYLON::EdgesRenderer {
+
+public:
+  EdgesRendererStub(const BABYLON::AbstractMeshPtr& source,
+                    bool generateEdgesLinesInBackground)
+      : BABYLON::EdgesRenderer(source, 0.95f, false, true,
+                               generateEdgesLinesInBackground)
+  {
+  }
+
+  using BABYLON::EdgesRenderer::_linesIndices;
+  using BABYLON::EdgesRenderer::_linesNormals;
+  using BABYLON::EdgesRenderer::_linesPositions;
+
+}; // end of class EdgesRendererStub
+
+} // end of anonymous namespace
+
+TEST(TestEdgesRenderer, BackgroundGeneration)
+{
+  using namespace BABYLON;
+
+  auto canvas = std::make_unique<HeadlessCanvas>();
+  auto engine = Engine::New(canvas.get());
+  auto scene  = Scene::New(engine.get());
+  FreeCamera::New("camera", Vector3(0.f, 0.f, -10.f), scene.get());
+  auto box = Mesh::CreateBox("box", 1.f, scene.get());
+
+  auto& gl = *canvas->recordingContext();
+  gl.clearCalls();
+  EdgesRendererStub expected(box, false);
+  ASSERT_FALSE(expected._linesIndices.empty());
+  const auto bufferCount = gl.countCalls("createBuffer");
+
+  // The lines are created once the adjacencies are available
+  EdgesRendererStub renderer(box, true);
+  for (unsigned int i = 0; i < 1000 && !renderer.isReady(); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  ASSERT_TRUE(renderer.isReady());
+  EXPECT_EQ(renderer._linesPositions, expected._linesPositions);
+  EXPECT_EQ(renderer._linesNormals, expected._linesNormals);
+  EXPECT_EQ(renderer._linesIndices, expected._linesIndices);
+
+  // A rebuild completing the generation creates the buffers only once
+  EdgesRendererStub rebuilt(box, true);
+  gl.clearCalls();
+  for (unsigned int i = 0; i < 1000 && rebuilt._linesIndices.empty(); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    rebuilt._rebuild();
+  }
+  ASSERT_EQ(rebuilt._linesIndices, expected._linesIndices);
+  EXPECT_EQ(gl.countCalls("createBuffer"), bufferCount);
+
+  expected.dispose();
+  renderer.dispose();
+  rebuilt.dispose();
+}
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include <babylon/rendering/face_adjacencies_builder.h>
+
+TEST(TestFaceAdjacenciesBuilder, Indices)
+{
+  using namespace BABYLON;
+
+  // Quad made of two triangles sharing the edge 0-2
+  const Float32Array positions{0.f, 0.f, 0.f, 1.f, 0.f, 0.f,
+                               1.f, 1.f, 0.f, 0.f, 1.f, 0.f};
+  const IndicesArray indices{0, 1, 2, 0, 2, 3};
+
+  const auto adjacencies
+    = FaceAdjacenciesBuilder::Build(positions, indices, false);
+  ASSERT_EQ(adjacencies.size(), 2ull);
+  EXPECT_EQ(adjacencies[0].edges, Int32Array({-1, -1, 1}));
+  EXPECT_EQ(adjacencies[1].edges, Int32Array({0, -1, -1}));
+  EXPECT_EQ(adjacencies[0].edgesConnectedCount, 1);
+  EXPECT_EQ(adjacencies[1].edgesConnectedCount, 1);
+  EXPECT_TRUE(adjacencies[1].p2.equals(Vector3(0.f, 1.f, 0.f)));
+
+  const auto faceNormals
+    = FaceAdjacenciesBuilder::ComputeFaceNormals(adjacencies);
+  ASSERT_EQ(faceNormals.size(), 2ull);
+  EXPECT_TRUE(faceNormals[0].equalsWithEpsilon(Vector3(0.f, 0.f, 1.f)));
+}
+
+TEST(TestFaceAdjacenciesBuilder, Vertices)
+{
+  using namespace BABYLON;
+
+  // Same quad, without shared vertices
+  const Float32Array positions{0.f, 0.f,     0.f, 1.f, 0.f, 0.f,
+                               1.f, 1.f,     0.f, 0.f, 0.f, 0.0004f,
+                               1.f, 1.0004f, 0.f, 0.f, 1.f, 0.f};
+  const IndicesArray indices{0, 1, 2, 3, 4, 5};
+
+  const auto welded = FaceAdjacenciesBuilder::WeldVertices(positions);
+  EXPECT_EQ(welded, Uint32Array({0, 1, 2, 0, 2, 5}));
+
+  auto adjacencies = FaceAdjacenciesBuilder::Build(positions, indices, false);
+  EXPECT_EQ(adjacencies[0].edges, Int32Array({-1, -1, -1}));
+
+  adjacencies = FaceAdjacenciesBuilder::Build(positions, indices, true);
+  EXPECT_EQ(adjacencies[0].edges, Int32Array({-1, -1, 1}));
+  EXPECT_EQ(adjacencies[1].edges, Int32Array({0, -1, -1}));
+}
+
+TEST(TestFaceAdjacenciesBuilder, Grid)
+{
+  using namespace BABYLON;
+
+  // Grid of 2 * size * size triangles, each interior edge being shared by two
+  // faces
+  const uint32_t size = 300;
+  Float32Array positions;
+  for (uint32_t y = 0; y <= size; ++y) {
+    for (uint32_t x = 0; x <= size; ++x) {
+      positions.insert(positions.end(), {static_cast<float>(x),
+                                         static_cast<float>(y), 0.f});
+    }
+  }
+  IndicesArray indices;
+  for (uint32_t y = 0; y < size; ++y) {
+    for (uint32_t x = 0; x < size; ++x) {
+      const auto i = y * (size + 1) + x;
+      indices.insert(indices.end(),
+                     {i, i + 1, i + size + 2, i, i + size + 2, i + size + 1});
+    }
+  }
+
+  for (auto checkVertices : {false, true}) {
+    const auto adjacencies
+      = FaceAdjacenciesBuilder::Build(positions, indices, checkVertices);
+    ASSERT_EQ(adjacencies.size(), 2ull * size * size);
+
+    size_t borderEdges = 0;
+    for (size_t face = 0; face < adjacencies.size(); ++face) {
+      for (auto other : adjacencies[face].edges) {
+        if (other == -1) {
+          ++borderEdges;
+          continue;
+        }
+        const auto& otherEdges
+          = adjacencies[static_cast<size_t>(other)].edges;
+        EXPECT_NE(std::find(otherEdges.begin(), otherEdges.end(),
+                            static_cast<int>(face)),
+                  otherEdges.end());
+      }
+    }
+    EXPECT_EQ(borderEdges, 4ull * size);
+  }
+}
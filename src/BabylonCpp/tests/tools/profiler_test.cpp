@@ -0,0 +1,217 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <thread>
+
+#include <babylon/instrumentation/scene_instrumentation.h>
+#include <babylon/misc/profiler.h>
+
+#include "helpers/headless_scene.h"
+
+namespace {
+
+const BABYLON::ProfileSummary*
+FindSummary(const std::vector<BABYLON::ProfileSummary>& summaries,
+            const std::string& name)
+{
+  for (const auto& summary : summaries) {
+    if (summary.name == name) {
+      return &summary;
+    }
+  }
+  return nullptr;
+}
+
+} // end of anonymous namespace
+
+TEST(TestProfiler, NestedScopes)
+{
+  using namespace BABYLON;
+
+  Profiler profiler;
+  profiler.setEnabled(true);
+  profiler.begin("frame");
+  profiler.begin("update");
+  profiler.end("update");
+  profiler.begin("render");
+  profiler.begin("update");
+  profiler.end("update");
+  profiler.end("render");
+  profiler.end("frame");
+
+  const auto& frame = profiler.endFrame();
+  ASSERT_EQ(frame.events.size(), 4ull);
+  EXPECT_EQ(frame.droppedEventCount, 0ull);
+  EXPECT_EQ(frame.events[0].depth, 0u);
+  EXPECT_EQ(frame.events[1].depth, 1u);
+  EXPECT_EQ(frame.events[2].depth, 1u);
+  EXPECT_EQ(frame.events[3].depth, 2u);
+  for (size_t i = 1; i < frame.events.size(); ++i) {
+    EXPECT_LE(frame.events[i - 1].start, frame.events[i].start);
+  }
+
+  // The root scope comes first, its self time excludes its children
+  ASSERT_EQ(frame.summaries.size(), 3ull);
+  EXPECT_EQ(frame.summaries[0].name, "frame");
+  const auto frameSummary  = FindSummary(frame.summaries, "frame");
+  const auto renderSummary = FindSummary(frame.summaries, "render");
+  const auto updateSummary = FindSummary(frame.summaries, "update");
+  ASSERT_TRUE(frameSummary && renderSummary && updateSummary);
+  EXPECT_EQ(updateSummary->count, 2ull);
+  EXPECT_EQ(updateSummary->selfTime, updateSummary->totalTime);
+  EXPECT_EQ(frameSummary->selfTime,
+            frameSummary->totalTime - renderSummary->totalTime
+              - (updateSummary->totalTime - frame.events[3].duration));
+  EXPECT_EQ(renderSummary->selfTime,
+            renderSummary->totalTime - frame.events[3].duration);
+
+  // Events are only collected once
+  EXPECT_TRUE(profiler.endFrame().events.empty());
+  EXPECT_EQ(profiler.frames().size(), 2ull);
+}
+
+TEST(TestProfiler, Disabled)
+{
+  using namespace BABYLON;
+
+  Profiler profiler;
+  profiler.begin("ignored");
+  profiler.end("ignored");
+  profiler.end("unknown");
+  EXPECT_TRUE(profiler.endFrame().events.empty());
+
+  // Scopes opened while enabled are closed after disabling
+  profiler.setEnabled(true);
+  profiler.begin("scope");
+  profiler.setEnabled(false);
+  profiler.end("scope");
+  EXPECT_EQ(profiler.endFrame().events.size(), 1ull);
+}
+
+TEST(TestProfiler, MultipleThreads)
+{
+  using namespace BABYLON;
+
+  Profiler profiler;
+  profiler.setEnabled(true);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < 4; ++i) {
+    threads.emplace_back([&profiler]() {
+      for (size_t j = 0; j < 100; ++j) {
+        profiler.begin("job");
+        profiler.begin("task");
+        profiler.end("task");
+        profiler.end("job");
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  const auto& frame = profiler.endFrame();
+  EXPECT_EQ(frame.events.size(), 800ull);
+  const auto jobSummary  = FindSummary(frame.summaries, "job");
+  const auto taskSummary = FindSummary(frame.summaries, "task");
+  ASSERT_TRUE(jobSummary && taskSummary);
+  EXPECT_EQ(jobSummary->count, 400ull);
+  EXPECT_EQ(taskSummary->count, 400ull);
+  EXPECT_EQ(jobSummary->selfTime,
+            jobSummary->totalTime - taskSummary->totalTime);
+}
+
+TEST(TestProfiler, Export)
+{
+  using namespace BABYLON;
+
+  Profiler profiler;
+  profiler.setEnabled(true);
+  for (size_t i = 0; i < 3; ++i) {
+    profiler.begin("frame \"" + std::to_string(i) + "\"");
+    profiler.begin("render");
+    profiler.end("render");
+    profiler.end("frame \"" + std::to_string(i) + "\"");
+    profiler.endFrame();
+  }
+
+  std::ostringstream trace;
+  profiler.exportChromeTrace(trace);
+  EXPECT_NE(trace.str().find("\"traceEvents\""), std::string::npos);
+  EXPECT_NE(trace.str().find("\"frame \\\"2\\\"\""), std::string::npos);
+
+  std::stringstream binary;
+  profiler.exportBinary(binary);
+  std::vector<std::string> names;
+  const auto frames = Profiler::ImportBinary(binary, names);
+  EXPECT_EQ(names, profiler.names());
+  ASSERT_EQ(frames.size(), profiler.frames().size());
+  for (size_t i = 0; i < frames.size(); ++i) {
+    const auto& expected = profiler.frames()[i];
+    EXPECT_EQ(frames[i].id, expected.id);
+    EXPECT_EQ(frames[i].start, expected.start);
+    EXPECT_EQ(frames[i].end, expected.end);
+    ASSERT_EQ(frames[i].events.size(), expected.events.size());
+    for (size_t j = 0; j < frames[i].events.size(); ++j) {
+      EXPECT_EQ(frames[i].events[j].nameId, expected.events[j].nameId);
+      EXPECT_EQ(frames[i].events[j].depth, expected.events[j].depth);
+      EXPECT_EQ(frames[i].events[j].start, expected.events[j].start);
+      EXPECT_EQ(frames[i].events[j].duration, expected.events[j].duration);
+    }
+    ASSERT_EQ(frames[i].summaries.size(), expected.summaries.size());
+    EXPECT_EQ(frames[i].summaries[0].selfTime,
+              expected.summaries[0].selfTime);
+  }
+
+  std::istringstream invalid("not a profile");
+  EXPECT_TRUE(Profiler::ImportBinary(invalid, names).empty());
+}
+
+TEST(TestProfiler, ExportScopeAcrossFrames)
+{
+  using namespace BABYLON;
+
+  // The scope is collected by the frame it ends in, before the frame start
+  Profiler profiler;
+  profiler.setEnabled(true);
+  profiler.begin("loading");
+  profiler.endFrame();
+  profiler.begin("render");
+  profiler.end("render");
+  profiler.end("loading");
+  const auto& frame = profiler.endFrame();
+  ASSERT_EQ(frame.events.size(), 2ull);
+  EXPECT_LT(frame.events[0].start, frame.start);
+
+  std::stringstream binary;
+  profiler.exportBinary(binary);
+  std::vector<std::string> names;
+  const auto frames = Profiler::ImportBinary(binary, names);
+  ASSERT_EQ(frames.size(), 2ull);
+  ASSERT_EQ(frames[1].events.size(), frame.events.size());
+  for (size_t i = 0; i < frame.events.size(); ++i) {
+    EXPECT_EQ(frames[1].events[i].start, frame.events[i].start);
+    EXPECT_EQ(frames[1].events[i].duration, frame.events[i].duration);
+  }
+}
+
+TEST(TestProfiler, SceneInstrumentationCapture)
+{
+  using namespace BABYLON;
+
+  HeadlessScene headlessScene;
+  SceneInstrumentation instrumentation(headlessScene.scene.get());
+  instrumentation.captureFrameTime = true;
+  instrumentation.captureProfile   = true;
+  EXPECT_TRUE(Profiler::Default().isEnabled());
+
+  // The summaries of the default profiler are collected after each frame
+  headlessScene.render();
+  const auto renderingSummary
+    = FindSummary(instrumentation.frameProfileSummaries(), "Scene rendering");
+  ASSERT_TRUE(renderingSummary);
+  EXPECT_EQ(renderingSummary->count, 1ull);
+
+  instrumentation.captureProfile = false;
+  EXPECT_FALSE(Profiler::Default().isEnabled());
+  EXPECT_TRUE(instrumentation.frameProfileSummaries().empty());
+}
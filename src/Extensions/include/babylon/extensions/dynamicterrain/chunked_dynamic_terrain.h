@@ -0,0 +1,243 @@
+#ifndef BABYLON_EXTENSIONS_DYNAMIC_TERRAIN_CHUNKED_DYNAMIC_TERRAIN_H
+#define BABYLON_EXTENSIONS_DYNAMIC_TERRAIN_CHUNKED_DYNAMIC_TERRAIN_H
+
+#include <future>
+#include <memory>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/extensions/dynamicterrain/height_map_quadtree.h>
+#include <babylon/math/vector3.h>
+#include <babylon/misc/observer.h>
+
+namespace BABYLON {
+
+class Camera;
+class Mesh;
+class Scene;
+using CameraPtr = std::shared_ptr<Camera>;
+using MeshPtr   = std::shared_ptr<Mesh>;
+
+namespace Extensions {
+
+struct ChunkedDynamicTerrainOptions;
+
+/**
+ * @brief The ChunkedDynamicTerrain class displays a data map split into square
+ * tiles with independent LOD.
+ *
+ * Where the DynamicTerrain ribbon follows the camera and is rebuilt as a whole
+ * on the render thread, each tile is a mesh covering a fixed part of the map,
+ * positioned in the map space. The tile LOD depends on the camera distance to
+ * the tile bounding box. When it changes, the tile vertices and normals are
+ * computed on a worker thread into a back buffer, which is swapped into the
+ * tile mesh once ready. The former tile geometry is rendered meanwhile.
+ *
+ * The map altitudes are indexed by a min/max quadtree giving the bounding
+ * boxes of the tiles and the height range of any area of the map.
+ */
+class ChunkedDynamicTerrain {
+
+public:
+  /**
+   * @brief Constructor, builds the tiles at their initial LOD.
+   * @param name
+   * @param options
+   * @param scene
+   */
+  ChunkedDynamicTerrain(const std::string& name,
+                        const ChunkedDynamicTerrainOptions& options,
+                        Scene* scene);
+  virtual ~ChunkedDynamicTerrain();
+
+  /**
+   * @brief Installs the tile geometries computed since the last call, then
+   * queues the computation of the tiles whose LOD changed. Called before each
+   * scene render.
+   * @param force Recomputes all the tiles which are not already queued.
+   * @returns The terrain.
+   */
+  ChunkedDynamicTerrain& update(bool force = false);
+
+  /**
+   * @brief Waits for the queued tiles and installs their geometries.
+   * @returns The terrain.
+   */
+  ChunkedDynamicTerrain& finishPendingUpdates();
+
+  /**
+   * @brief Waits for the queued tiles, removes the scene observer, then
+   * releases the tile meshes. Called by the destructor.
+   */
+  void dispose();
+
+  /**
+   * @brief Returns the altitude (float) at the coordinates (x, z) of the map.
+   */
+  float getHeightFromMap(float x, float z) const;
+
+  /**
+   * @brief Computes the range of the altitudes of the map area between the
+   * coordinates (minX, minZ) and (maxX, maxZ), from the map quadtree.
+   * @returns false if the map has less than 2 x 2 points.
+   */
+  bool getHeightRangeFromMap(float minX, float minZ, float maxX, float maxZ,
+                             float& minHeight, float& maxHeight) const;
+
+  // Getters / Setters
+
+  /**
+   * The root mesh of the terrain, parent of the tile meshes.
+   */
+  MeshPtr& mesh();
+
+  /**
+   * The camera the terrain is linked to.
+   */
+  CameraPtr& camera();
+  void setCamera(const CameraPtr& val);
+
+  /**
+   * Number of tiles.
+   */
+  size_t tileCount() const;
+
+  /**
+   * Mesh of a tile.
+   */
+  MeshPtr& tileMesh(size_t index);
+
+  /**
+   * Current LOD of a tile : the tile resolution is the map one divided by 2 to
+   * the power of the LOD.
+   */
+  unsigned int tileLOD(size_t index) const;
+
+  /**
+   * Number of tiles whose geometry is being computed.
+   */
+  size_t pendingTileCount() const;
+
+  /**
+   * Lowest LOD, where a tile side has a single cell.
+   */
+  unsigned int maxLOD() const;
+
+  /**
+   * The camera distances from which the tile resolution is halved once more.
+   * This array is always sorted in the ascending order once set.
+   */
+  const Float32Array& LODDistances() const;
+  void setLODDistances(Float32Array val);
+
+  /**
+   * The min/max quadtree of the map altitudes.
+   */
+  const HeightMapQuadtree& heightQuadtree() const;
+
+  // User custom functions.
+
+  /**
+   * @brief Custom function returning the LOD of a tile from its distance to
+   * the camera. By default, the number of LOD distances lower than or equal
+   * to the passed distance.
+   */
+  virtual unsigned int computeTileLOD(float distance) const;
+
+private:
+  struct TileGeometry {
+    Float32Array positions;
+    Float32Array normals;
+    Float32Array uvs;
+    Float32Array colors;
+    IndicesArray indices;
+  }; // end of struct TileGeometry
+
+  struct Tile {
+    // map points covered by the tile, bounds included
+    unsigned int col0;
+    unsigned int row0;
+    unsigned int col1;
+    unsigned int row1;
+    // bounding box in the map space
+    Vector3 minimum;
+    Vector3 maximum;
+    MeshPtr mesh;
+    // LOD of the installed geometry
+    unsigned int lod;
+    // LOD of the geometry computed in the back buffer
+    unsigned int pendingLOD;
+    std::unique_ptr<TileGeometry> backBuffer;
+    std::future<void> pending;
+  }; // end of struct Tile
+
+  /**
+   * @brief Computes the geometry of a tile at the given LOD, only reads the
+   * map so it can run on worker threads.
+   */
+  void _computeTileGeometry(const Tile& tile, unsigned int lod,
+                            TileGeometry& geometry) const;
+
+  /**
+   * @brief Sets the back buffer of a tile to its mesh.
+   */
+  void _installTileGeometry(Tile& tile);
+
+  /**
+   * @brief Computes the normal of a map point from its neighbours.
+   */
+  void _computeMapNormal(unsigned int col, unsigned int row,
+                         float* normal) const;
+
+  /**
+   * @brief Returns the LOD of a tile from the camera position.
+   */
+  unsigned int _getTileLOD(const Tile& tile,
+                           const Vector3& cameraPosition) const;
+
+public:
+  std::string name;
+
+private:
+  // data of the map
+  Float32Array _mapData;
+  // map number of subdivisions on X axis
+  unsigned int _mapSubX;
+  // map number of subdivisions on Z axis
+  unsigned int _mapSubZ;
+  // UV data of the map
+  Float32Array _mapUVs;
+  // Color data of the map
+  Float32Array _mapColors;
+  // Normal data of the map
+  Float32Array _mapNormals;
+  // map x size
+  float _mapSizeX;
+  // map z size
+  float _mapSizeZ;
+  // number of map cells along a tile side
+  unsigned int _tileSub;
+  // lowest LOD
+  unsigned int _maxLOD;
+  // distances changing the LOD
+  Float32Array _LODDistances;
+  // depth of the tile skirts
+  float _skirtDepth;
+  // map altitudes quadtree
+  HeightMapQuadtree _heightQuadtree;
+  // current scene
+  Scene* _scene;
+  // camera linked to the terrain
+  CameraPtr _terrainCamera;
+  // root mesh
+  MeshPtr _terrain;
+  std::vector<Tile> _tiles;
+  Observer<Scene>::Ptr _beforeRenderObserver;
+
+}; // end of class ChunkedDynamicTerrain
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_EXTENSIONS_DYNAMIC_TERRAIN_CHUNKED_DYNAMIC_TERRAIN_H
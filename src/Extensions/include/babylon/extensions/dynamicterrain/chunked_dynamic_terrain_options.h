@@ -0,0 +1,51 @@
+#ifndef BABYLON_EXTENSIONS_DYNAMIC_TERRAIN_CHUNKED_DYNAMIC_TERRAIN_OPTIONS_H
+#define BABYLON_EXTENSIONS_DYNAMIC_TERRAIN_CHUNKED_DYNAMIC_TERRAIN_OPTIONS_H
+
+#include <memory>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+class Camera;
+using CameraPtr = std::shared_ptr<Camera>;
+
+namespace Extensions {
+
+struct ChunkedDynamicTerrainOptions {
+  // mapData the array of the map 3D data: x, y, z successive float values, on
+  // a regular grid
+  Float32Array mapData;
+  // mapSubX the data map number of x subdivisions
+  int mapSubX = 0;
+  // mapSubZ the data map number of z subdivisions
+  int mapSubZ = 0;
+  // mapUVs the array of the map UV data: u,v successive values, each between 0
+  // and 1. Optional, by default the UVs fit the whole map
+  Float32Array mapUVs;
+  // mapColors the array of the map Color data: r,g,b successive float values.
+  // Optional
+  Float32Array mapColors;
+  // mapNormals the array of the map normal data: x, y, z successive float
+  // values. Optional, by default the normals are computed with the tiles
+  Float32Array mapNormals;
+  // tileSub the number of map cells along a tile side at the highest LOD :
+  // integer, power of 2 (default 32)
+  unsigned int tileSub = 32;
+  // LODDistances the camera distances from which the tile resolution is halved
+  // once more, in ascending order. Optional, by default all the tiles keep the
+  // highest LOD
+  Float32Array LODDistances;
+  // skirtDepth the depth of the skirts hiding the cracks between tiles of
+  // different LOD, 0 to disable them (default 1)
+  float skirtDepth = 1.f;
+  // camera the camera to link the terrain to. Optional, by default the scene
+  // active camera
+  CameraPtr camera = nullptr;
+}; // end of struct ChunkedDynamicTerrainOptions
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_EXTENSIONS_DYNAMIC_TERRAIN_CHUNKED_DYNAMIC_TERRAIN_OPTIONS_H
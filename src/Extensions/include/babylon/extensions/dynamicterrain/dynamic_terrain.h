@@ -580,13 +580,6 @@ private:
   bool _isAlwaysVisible;
   bool _precomputeNormalsFromMap;
   // tmp vectors
-  static Vector3 _v1;
-  static Vector3 _v2;
-  static Vector3 _v3;
-  static Vector3 _v4;
-  static Vector3 _vAvB;
-  static Vector3 _vAvC;
-  static Vector3 _norm;
   static Vector3 _bbMin;
   static Vector3 _bbMax;
 
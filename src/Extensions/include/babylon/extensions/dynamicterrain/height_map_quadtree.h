@@ -0,0 +1,83 @@
+#ifndef BABYLON_EXTENSIONS_DYNAMIC_TERRAIN_HEIGHT_MAP_QUADTREE_H
+#define BABYLON_EXTENSIONS_DYNAMIC_TERRAIN_HEIGHT_MAP_QUADTREE_H
+
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+namespace Extensions {
+
+/**
+ * @brief Min/max quadtree over the cells of a data map, giving the height
+ * range of any area of the map without visiting all of its points.
+ *
+ * The tree is stored as a pyramid of levels : the first level holds the height
+ * range of each map cell, each next level merges the ranges of 2 x 2 nodes of
+ * the previous one, up to the root holding the range of the whole map.
+ */
+class HeightMapQuadtree {
+
+public:
+  HeightMapQuadtree();
+  ~HeightMapQuadtree();
+
+  /**
+   * @brief Builds the quadtree of a data map.
+   * @param mapData the array of the map 3D data: x, y, z successive float
+   * values
+   * @param mapSubX the number of points along the map width
+   * @param mapSubZ the number of points along the map height
+   */
+  void build(const Float32Array& mapData, unsigned int mapSubX,
+             unsigned int mapSubZ);
+
+  /**
+   * @brief Returns true if no map with at least 2 x 2 points was built.
+   */
+  bool empty() const;
+
+  /**
+   * @brief Returns the minimum altitude of the whole map.
+   */
+  float minHeight() const;
+
+  /**
+   * @brief Returns the maximum altitude of the whole map.
+   */
+  float maxHeight() const;
+
+  /**
+   * @brief Computes the height range of the map points in the passed columns
+   * and rows. The range is the one of the map cells containing these points,
+   * so it may be larger when a single column or row is passed.
+   * @param col0 the first column
+   * @param row0 the first row
+   * @param col1 the last column, included
+   * @param row1 the last row, included
+   * @param minHeight the minimum altitude of the area
+   * @param maxHeight the maximum altitude of the area
+   * @returns false if the quadtree is empty
+   */
+  bool getHeightRange(unsigned int col0, unsigned int row0, unsigned int col1,
+                      unsigned int row1, float& minHeight,
+                      float& maxHeight) const;
+
+private:
+  struct Level {
+    unsigned int sizeX = 0;
+    unsigned int sizeZ = 0;
+    Float32Array minHeights;
+    Float32Array maxHeights;
+  }; // end of struct Level
+
+  // the map cells first, the root last
+  std::vector<Level> _levels;
+
+}; // end of class HeightMapQuadtree
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_EXTENSIONS_DYNAMIC_TERRAIN_HEIGHT_MAP_QUADTREE_H
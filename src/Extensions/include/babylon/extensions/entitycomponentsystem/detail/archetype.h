@@ -0,0 +1,184 @@
+#ifndef BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_ARCHETYPE_H
+#define BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_ARCHETYPE_H
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+#include <babylon/extensions/entitycomponentsystem/detail/class_type_id.h>
+#include <babylon/extensions/entitycomponentsystem/detail/component_type_info.h>
+#include <babylon/extensions/entitycomponentsystem/detail/component_type_list.h>
+
+#include <babylon/extensions/entitycomponentsystem/component.h>
+#include <babylon/extensions/entitycomponentsystem/config.h>
+#include <babylon/extensions/entitycomponentsystem/entity.h>
+
+namespace BABYLON {
+namespace Extensions {
+namespace ECS {
+namespace detail {
+
+class Archetype;
+
+/// \brief A fixed size block of memory storing the components of the
+/// entities of an archetype
+///
+/// The components of each type are stored contiguously, one array per
+/// component type, in the same row order as the IDs of the entities.
+class BABYLON_SHARED_EXPORT ArchetypeChunk {
+
+public:
+  explicit ArchetypeChunk(const Archetype& archetype);
+  ~ArchetypeChunk();
+
+  ArchetypeChunk(const ArchetypeChunk&) = delete;
+  ArchetypeChunk& operator=(const ArchetypeChunk&) = delete;
+
+  /// \return The amount of entities stored in the chunk
+  std::size_t size() const
+  {
+    return m_entityIds.size();
+  }
+
+  /// \return The ID of the entity stored at the given row
+  const Entity::Id& getEntityId(std::size_t row) const
+  {
+    return m_entityIds[row];
+  }
+
+  /// \tparam T The type of component you wish to retrieve
+  /// \return The array of the components of type T, indexed by row, or
+  /// nullptr if the archetype does not contain T
+  template <typename T>
+  T* getComponents() const;
+
+private:
+  friend class Archetype;
+
+  void* getComponent(std::size_t column, std::size_t row) const;
+
+  /// The archetype owning the chunk
+  const Archetype& m_archetype;
+
+  /// The raw storage of the component arrays
+  unsigned char* m_data;
+
+  /// The IDs of the entities stored in the chunk
+  std::vector<Entity::Id> m_entityIds;
+
+}; // end of class ArchetypeChunk
+
+/// \brief Stores the components of all the entities having exactly the same
+/// set of component types
+///
+/// The entities are packed in chunks of CHUNK_SIZE bytes: every chunk but
+/// the last one is full, and removing an entity moves the last entity of the
+/// archetype into the freed row.
+class BABYLON_SHARED_EXPORT Archetype {
+
+public:
+  /// The size in bytes of the component arrays of a chunk
+  static constexpr std::size_t CHUNK_SIZE = 16 * 1024;
+
+  /// Describes a component type stored by the archetype
+  using ComponentType = std::pair<TypeId, const ComponentTypeInfo*>;
+
+  /// Describes the location of an entity within the archetype
+  struct Location {
+    std::size_t chunk;
+    std::size_t row;
+  };
+
+  /// \param componentTypes The component types of the archetype
+  explicit Archetype(const std::vector<ComponentType>& componentTypes);
+  ~Archetype();
+
+  Archetype(const Archetype&) = delete;
+  Archetype& operator=(const Archetype&) = delete;
+
+  /// \return The component types of the archetype, as a type list
+  const ComponentTypeList& getComponentTypeList() const;
+
+  /// \return The component types of the archetype, sorted by type ID
+  const std::vector<ComponentType>& getComponentTypes() const;
+
+  /// \return The index of the column storing a component type, or
+  /// NO_COLUMN if the archetype does not contain it
+  std::size_t getColumn(TypeId componentTypeId) const;
+
+  /// \return The offset in bytes of a column within a chunk
+  std::size_t getColumnOffset(std::size_t column) const;
+
+  /// \return The maximum amount of entities stored in a chunk
+  std::size_t getChunkCapacity() const;
+
+  /// \return The size in bytes of the storage of a chunk
+  std::size_t getChunkSize() const;
+
+  /// \return The alignment in bytes of the storage of a chunk
+  std::size_t getChunkAlignment() const;
+
+  /// \return The chunks of the archetype
+  const std::vector<std::unique_ptr<ArchetypeChunk>>& getChunks() const;
+
+  /// \return The amount of entities stored in the archetype
+  std::size_t size() const;
+
+  /// \return The address of a component of an entity
+  void* getComponent(const Location& location, std::size_t column) const;
+
+  /// Appends a row for an entity. The components of the row are left
+  /// uninitialized and must be constructed by the caller.
+  /// \param entityId The ID of the entity
+  /// \return The location of the new row
+  Location pushBack(const Entity::Id& entityId);
+
+  /// Destroys all the components of a row
+  void destroy(const Location& location);
+
+  /// Removes a row whose components were moved or destroyed, by moving the
+  /// last row of the archetype into it
+  /// \return The ID of the entity moved into the row, null if the removed row
+  /// was the last one
+  Entity::Id erase(const Location& location);
+
+  /// Destroys all the components and releases the chunks
+  void clear();
+
+public:
+  static constexpr std::size_t NO_COLUMN = static_cast<std::size_t>(-1);
+
+private:
+  ComponentTypeList m_componentTypeList;
+  std::vector<ComponentType> m_componentTypes;
+  std::array<std::size_t, MAX_AMOUNT_OF_COMPONENTS> m_columns;
+  std::vector<std::size_t> m_columnOffsets;
+  std::size_t m_chunkCapacity;
+  std::size_t m_chunkSize;
+  std::size_t m_chunkAlignment;
+  std::vector<std::unique_ptr<ArchetypeChunk>> m_chunks;
+
+}; // end of class Archetype
+
+template <typename T>
+T* ArchetypeChunk::getComponents() const
+{
+  static_assert(std::is_base_of<Component, T>(),
+                "T is not a component, cannot retrieve T from a chunk");
+  const auto column = m_archetype.getColumn(ComponentTypeId<T>());
+  if (column == Archetype::NO_COLUMN) {
+    return nullptr;
+  }
+  return reinterpret_cast<T*>(m_data + m_archetype.getColumnOffset(column));
+}
+
+} // end of namespace detail
+} // end of namespace ECS
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif // BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_ARCHETYPE_H
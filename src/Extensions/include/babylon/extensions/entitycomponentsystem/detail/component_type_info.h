@@ -0,0 +1,62 @@
+#ifndef BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_COMPONENT_TYPE_INFO_H
+#define BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_COMPONENT_TYPE_INFO_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <babylon/extensions/entitycomponentsystem/component.h>
+
+namespace BABYLON {
+namespace Extensions {
+namespace ECS {
+namespace detail {
+
+/// \brief Describes how to handle the raw storage of a component type
+///
+/// Components are stored by value in the chunks of the archetypes, so the
+/// storage only needs to know the size and alignment of a component type and
+/// how to move, destroy and upcast an instance of it.
+struct ComponentTypeInfo {
+  /// The size of the component type in bytes
+  std::size_t size;
+
+  /// The alignment of the component type in bytes
+  std::size_t alignment;
+
+  /// Move constructs a component at destination from the one at source
+  void (*moveConstruct)(void* destination, void* source);
+
+  /// Destroys the component at the given address
+  void (*destroy)(void* component);
+
+  /// Converts the address of a component to its Component base
+  Component* (*toComponent)(void* component);
+
+  /// \tparam T The type of component to describe
+  /// \return The description of the component type
+  template <typename T>
+  static const ComponentTypeInfo& Get()
+  {
+    static_assert(std::is_base_of<Component, T>(),
+                  "T is not a component, cannot describe its storage");
+    static_assert(std::is_move_constructible<T>(),
+                  "T must be move constructible to be stored in a chunk");
+    static const ComponentTypeInfo info{
+      sizeof(T), alignof(T),
+      [](void* destination, void* source) {
+        new (destination) T(std::move(*static_cast<T*>(source)));
+      },
+      [](void* component) { static_cast<T*>(component)->~T(); },
+      [](void* component) -> Component* { return static_cast<T*>(component); }};
+    return info;
+  }
+};
+
+} // end of namespace detail
+} // end of namespace ECS
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif // BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_COMPONENT_TYPE_INFO_H
@@ -29,12 +29,15 @@
 #ifndef BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_ENTITY_COMPONENT_STORAGE_H
 #define BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_ENTITY_COMPONENT_STORAGE_H
 
-#include <array>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 #include <babylon/babylon_api.h>
 
+#include <babylon/extensions/entitycomponentsystem/detail/archetype.h>
 #include <babylon/extensions/entitycomponentsystem/detail/class_type_id.h>
+#include <babylon/extensions/entitycomponentsystem/detail/component_type_info.h>
 #include <babylon/extensions/entitycomponentsystem/detail/component_type_list.h>
 
 #include <babylon/extensions/entitycomponentsystem/component.h>
@@ -49,22 +52,32 @@ namespace detail {
 /// \brief A class to store components for entities within a world
 ///
 ///
-/// Used to store the components
+/// Used to store the components. The components are stored by value, in the
+/// chunks of the archetype matching the component types of their entity, so
+/// that the components of a type are contiguous in memory. Adding or removing
+/// a component moves the components of the entity to another archetype.
 ///
+/// \note Adding or removing components invalidates the references to the
+/// components of the other entities of the same archetypes.
 ///
 /// \author Miguel Martin
 class BABYLON_SHARED_EXPORT EntityComponentStorage {
 
 public:
   explicit EntityComponentStorage(std::size_t entityAmount);
+  ~EntityComponentStorage();
 
   EntityComponentStorage(const EntityComponentStorage&) = delete;
   EntityComponentStorage(EntityComponentStorage&&)      = delete;
   EntityComponentStorage& operator=(const EntityComponentStorage&) = delete;
   EntityComponentStorage& operator=(EntityComponentStorage&&) = delete;
 
-  void addComponent(Entity& entity, Component* component,
-                    TypeId componentTypeId);
+  /// Adds a component to an entity, or replaces the existing one
+  /// \param component The component to move into the storage
+  /// \return The stored component
+  Component& addComponent(Entity& entity, void* component,
+                          TypeId componentTypeId,
+                          const ComponentTypeInfo& componentTypeInfo);
 
   void removeComponent(Entity& entity, TypeId componentTypeId);
 
@@ -78,47 +91,45 @@ public:
 
   bool hasComponent(const Entity& entity, TypeId componentTypeId) const;
 
+  /// Collects the chunks of the archetypes containing the given component
+  /// types
+  /// \param componentTypeList The component types which are required
+  /// \param chunks The array to which the chunks are appended
+  void getChunks(const ComponentTypeList& componentTypeList,
+                 std::vector<ArchetypeChunk*>& chunks) const;
+
   void resize(std::size_t entityAmount);
 
   void clear();
 
 private:
-  typedef std::array<std::unique_ptr<Component>, MAX_AMOUNT_OF_COMPONENTS>
-    ImplComponentArray;
-
-  /// \brief A data structure to describe the components
-  /// within an entity
-  ///
-  /// \author Miguel Martin
-  struct EntityComponents {
-    EntityComponents() = default;
-
-    // bug in clang? won't work w/o this
-    // http://stackoverflow.com/questions/8560994/stdmake-shared-stdunique-ptr-and-move-constructors
-    // I think it's due to ComponentTypeList (may have to update boost)
-    EntityComponents(EntityComponents&& e)
-        : components(std::move(e.components))
-        , componentTypeList(std::move(e.componentTypeList))
-    {
-    }
-
-    /// The components of an entity. The
-    /// index of this array is the same as the TypeId
-    /// of the component.
-    ImplComponentArray components;
-
-    /// A list of component types, which resembles
-    /// what components an entity has
-    ComponentTypeList componentTypeList;
+  /// \brief Describes where the components of an entity are stored
+  struct EntityLocation {
+    /// The archetype of the entity, null if it has no component
+    Archetype* archetype = nullptr;
+
+    /// The position of the entity in its archetype
+    Archetype::Location position = {0, 0};
   };
 
-  /// All the components for every entity, which has
-  /// an entity. The indices of this array is the same
-  /// as the index component of an entity's ID.
-  std::vector<EntityComponents> m_componentEntries;
+  /// \return The archetype with the given component types, created if needed
+  Archetype&
+  getArchetype(const std::vector<Archetype::ComponentType>& componentTypes);
+
+  /// Moves the components of an entity to another archetype. The components
+  /// missing in the destination archetype are destroyed, the ones missing in
+  /// the source archetype are left uninitialized.
+  void moveEntity(const Entity::Id& entityId, Archetype* destination);
+
+  /// The location of the components of every entity. The indices of this
+  /// array is the same as the index component of an entity's ID.
+  std::vector<EntityLocation> m_entityLocations;
+
+  /// All the archetypes created so far
+  std::vector<std::unique_ptr<Archetype>> m_archetypes;
 
-  ImplComponentArray& getComponentsImpl(const Entity& e);
-  const ImplComponentArray& getComponentsImpl(const Entity& e) const;
+  /// The archetypes, indexed by their component types
+  std::unordered_map<ComponentTypeList, Archetype*> m_archetypeIndex;
 
 }; // end of class EntityComponentStorage
 
@@ -27,12 +27,14 @@
 #define BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_WORLD_H
 
 #include <memory>
+#include <tuple>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include <babylon/babylon_api.h>
+#include <babylon/core/thread_pool.h>
 
 #include <babylon/extensions/entitycomponentsystem/detail/entity_component_storage.h>
 #include <babylon/extensions/entitycomponentsystem/detail/entity_id_pool.h>
@@ -180,7 +182,30 @@ public:
   /// to the world
   Entity getEntity(std::size_t index);
 
+  /// Calls a function with the components of every activated entity having
+  /// (at least) the given component types. The components are visited chunk
+  /// by chunk, in the order they are laid out in memory.
+  /// \tparam Ts The types of component you wish to visit
+  /// \param fn The function to call, taking a reference to each component
+  /// \note Components must not be added or removed, and entities must not be
+  /// refreshed, from within the function
+  template <typename... Ts, typename Fn>
+  void forEach(Fn&& fn);
+
+  /// Same as forEach, but the chunks are processed in parallel on the worker
+  /// threads of the default thread pool
+  /// \note The function must be safe to call concurrently for different
+  /// entities
+  template <typename... Ts, typename Fn>
+  void parallelForEach(Fn&& fn);
+
 private:
+  template <typename... Ts>
+  std::vector<detail::ArchetypeChunk*> getChunks() const;
+
+  template <typename... Ts, typename Fn>
+  void forEachInChunk(detail::ArchetypeChunk& chunk, Fn& fn) const;
+
   /// Systems attached with the world.
   SystemArray m_systems;
 
@@ -316,6 +341,53 @@ bool World::doesSystemExist(const TSystem& system) const
   return system.m_world == this && doesSystemExist<TSystem>();
 }
 
+template <typename... Ts, typename Fn>
+void World::forEach(Fn&& fn)
+{
+  for (auto* chunk : getChunks<Ts...>()) {
+    forEachInChunk<Ts...>(*chunk, fn);
+  }
+}
+
+template <typename... Ts, typename Fn>
+void World::parallelForEach(Fn&& fn)
+{
+  const auto chunks = getChunks<Ts...>();
+  ThreadPool::Default().parallelFor(
+    chunks.size(), 1, [&](size_t begin, size_t end) {
+      for (auto i = begin; i < end; ++i) {
+        forEachInChunk<Ts...>(*chunks[i], fn);
+      }
+    });
+}
+
+template <typename... Ts>
+std::vector<detail::ArchetypeChunk*> World::getChunks() const
+{
+  static_assert(sizeof...(Ts) > 0, "At least one component type is required");
+  static_assert(std::conjunction<std::is_base_of<Component, Ts>...>(),
+                "Every visited type must be a component");
+
+  detail::ComponentTypeList componentTypeList;
+  (componentTypeList.set(ComponentTypeId<Ts>()), ...);
+
+  std::vector<detail::ArchetypeChunk*> chunks;
+  m_entityAttributes.componentStorage.getChunks(componentTypeList, chunks);
+  return chunks;
+}
+
+template <typename... Ts, typename Fn>
+void World::forEachInChunk(detail::ArchetypeChunk& chunk, Fn& fn) const
+{
+  const auto components = std::make_tuple(chunk.getComponents<Ts>()...);
+  for (std::size_t row = 0; row < chunk.size(); ++row) {
+    if (m_entityAttributes.attributes[chunk.getEntityId(row).index]
+          .activated) {
+      fn(std::get<Ts*>(components)[row]...);
+    }
+  }
+}
+
 } // end of namespace ECS
 } // end of namespace Extensions
 } // end of namespace BABYLON
@@ -8,6 +8,10 @@
 #include <babylon/math/vector2.h>
 
 namespace BABYLON {
+
+class Mesh;
+using MeshPtr = std::shared_ptr<Mesh>;
+
 namespace Extensions {
 
 namespace RVO2 {
@@ -29,10 +33,22 @@ public:
   /* Specify the global time step of the simulation. */
   void setTimeStep(float timeStep);
 
+  /**
+   * @brief Draws the agents as thin instances of a single mesh instead of one
+   * mesh per agent: the transformations of all the agents are written to the
+   * thin instance matrix buffer of the mesh on each update. The height and
+   * scaling of the mesh are applied to every instance, which is rotated
+   * around the Y axis to face the direction of its agent.
+   * @param mesh defines the mesh drawn for each agent
+   */
+  void enableInstancedRendering(const MeshPtr& mesh);
+
   /* Agent management functions */
   size_t addAgent(const AbstractMeshPtr& mesh);
   size_t addAgent(const AbstractMeshPtr& mesh, const Vector2& position);
   size_t addAgent(const AbstractMeshPtr& mesh, const Vector3& position);
+  /* Adds an agent without mesh, drawn by the instanced rendering */
+  size_t addAgent(const Vector2& position);
   void setAgentGoal(size_t agentId, const BABYLON::Vector2& goal);
   void setAgentMaxSpeed(size_t agentId, float speed);
 
@@ -56,6 +72,10 @@ public:
   /* Updates the simulation */
   void update();
 
+private:
+  // Writes the agent transformations to the thin instances
+  void _updateInstances();
+
 private:
   // Simulator instance
   std::unique_ptr<RVO2::RVOSimulator> _simulator;
@@ -67,6 +87,19 @@ private:
   CrowdMeshUpdaterSystem _crowdMeshUpdaterSystem;
   // The crowd agents
   std::vector<ECS::Entity> _agents;
+  // The mesh drawn for each agent by the instanced rendering
+  MeshPtr _instancedMesh;
+  // The radius of the agents without mesh
+  float _instanceRadius;
+  // Simulator ids of the agents without mesh, drawn as instances
+  std::vector<size_t> _instanceAgentIds;
+  // Heading of each agent, kept when the agent stops
+  std::vector<float> _instanceHeadings;
+  // Scaling, rotation and translation of each agent, composed into the thin
+  // instance matrices by the math kernels
+  std::vector<float> _instanceScalings;
+  std::vector<float> _instanceRotations;
+  std::vector<float> _instanceTranslations;
 
 }; // end of class CrowdSimulation
 
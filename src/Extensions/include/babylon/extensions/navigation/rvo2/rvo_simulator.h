@@ -210,7 +210,8 @@ public:
   /**
    * \brief      Lets the simulator perform a simulation step and updates the
    *             two-dimensional position and two-dimensional velocity of
-   *             each agent.
+   *             each agent. The agents are processed in parallel on the
+   *             worker threads of the default thread pool.
    */
   void doStep();
 
@@ -0,0 +1,462 @@
+#include <babylon/extensions/dynamicterrain/chunked_dynamic_terrain.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <babylon/babylon_stl_util.h>
+#include <babylon/cameras/camera.h>
+#include <babylon/core/thread_pool.h>
+#include <babylon/engines/scene.h>
+#include <babylon/extensions/dynamicterrain/chunked_dynamic_terrain_options.h>
+#include <babylon/extensions/dynamicterrain/dynamic_terrain.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/meshes/vertex_data.h>
+
+namespace BABYLON {
+namespace Extensions {
+
+ChunkedDynamicTerrain::ChunkedDynamicTerrain(
+  const std::string& iName, const ChunkedDynamicTerrainOptions& options,
+  Scene* scene)
+    : name{iName}
+    , _mapData{options.mapData}
+    , _mapSubX{static_cast<unsigned>(std::max(options.mapSubX, 2))}
+    , _mapSubZ{static_cast<unsigned>(std::max(options.mapSubZ, 2))}
+    , _mapUVs{options.mapUVs}
+    , _mapColors{options.mapColors}
+    , _mapNormals{options.mapNormals}
+    , _mapSizeX{0.f}
+    , _mapSizeZ{0.f}
+    , _tileSub{1}
+    , _maxLOD{0}
+    , _skirtDepth{options.skirtDepth}
+    , _scene{scene}
+    , _terrainCamera{options.camera ? options.camera : scene->activeCamera}
+    , _terrain{nullptr}
+    , _beforeRenderObserver{nullptr}
+{
+  // flat map by default
+  if (_mapData.size() < _mapSubX * _mapSubZ * 3) {
+    _mapData = Float32Array(_mapSubX * _mapSubZ * 3);
+    for (unsigned int row = 0; row < _mapSubZ; ++row) {
+      for (unsigned int col = 0; col < _mapSubX; ++col) {
+        const auto index    = 3 * (row * _mapSubX + col);
+        _mapData[index]     = static_cast<float>(col);
+        _mapData[index + 2] = static_cast<float>(row);
+      }
+    }
+  }
+  // UVs fitting the whole map by default
+  if (_mapUVs.size() < _mapSubX * _mapSubZ * 2) {
+    _mapUVs = Float32Array(_mapSubX * _mapSubZ * 2);
+    for (unsigned int row = 0; row < _mapSubZ; ++row) {
+      for (unsigned int col = 0; col < _mapSubX; ++col) {
+        const auto index   = 2 * (row * _mapSubX + col);
+        _mapUVs[index]     = static_cast<float>(col) / (_mapSubX - 1);
+        _mapUVs[index + 1] = static_cast<float>(row) / (_mapSubZ - 1);
+      }
+    }
+  }
+  if (_mapColors.size() < _mapSubX * _mapSubZ * 3) {
+    _mapColors.clear();
+  }
+  if (_mapNormals.size() < _mapSubX * _mapSubZ * 3) {
+    _mapNormals.clear();
+  }
+
+  _mapSizeX = std::abs(_mapData[(_mapSubX - 1) * 3] - _mapData[0]);
+  _mapSizeZ
+    = std::abs(_mapData[(_mapSubZ - 1) * _mapSubX * 3 + 2] - _mapData[2]);
+  _heightQuadtree.build(_mapData, _mapSubX, _mapSubZ);
+
+  // the tile side is a power of 2 number of cells
+  while (_tileSub * 2 <= std::max(options.tileSub, 1u)) {
+    _tileSub *= 2;
+    ++_maxLOD;
+  }
+  setLODDistances(options.LODDistances);
+
+  // tiles, the last ones of each axis may be smaller
+  _terrain = Mesh::New(name, _scene);
+  for (unsigned int row0 = 0; row0 < _mapSubZ - 1; row0 += _tileSub) {
+    for (unsigned int col0 = 0; col0 < _mapSubX - 1; col0 += _tileSub) {
+      Tile tile;
+      tile.col0 = col0;
+      tile.row0 = row0;
+      tile.col1 = std::min(col0 + _tileSub, _mapSubX - 1);
+      tile.row1 = std::min(row0 + _tileSub, _mapSubZ - 1);
+      float minHeight = 0.f, maxHeight = 0.f;
+      _heightQuadtree.getHeightRange(tile.col0, tile.row0, tile.col1,
+                                     tile.row1, minHeight, maxHeight);
+      const auto* first = &_mapData[3 * (tile.row0 * _mapSubX + tile.col0)];
+      const auto* last  = &_mapData[3 * (tile.row1 * _mapSubX + tile.col1)];
+      tile.minimum.copyFromFloats(std::min(first[0], last[0]),
+                                  minHeight - _skirtDepth,
+                                  std::min(first[2], last[2]));
+      tile.maximum.copyFromFloats(std::max(first[0], last[0]), maxHeight,
+                                  std::max(first[2], last[2]));
+      const auto tileName = name + "_tile_" + std::to_string(_tiles.size());
+      tile.mesh           = Mesh::New(tileName, _scene);
+      tile.mesh->parent   = _terrain.get();
+      tile.lod          = 0;
+      tile.pendingLOD   = 0;
+      tile.backBuffer   = std::make_unique<TileGeometry>();
+      _tiles.emplace_back(std::move(tile));
+    }
+  }
+
+  // initial geometries, computed in parallel
+  const auto cameraPosition
+    = _terrainCamera ? _terrainCamera->globalPosition() : Vector3::Zero();
+  ThreadPool::Default().parallelFor(
+    _tiles.size(), 1, [this, &cameraPosition](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        auto& tile      = _tiles[i];
+        tile.pendingLOD = _getTileLOD(tile, cameraPosition);
+        _computeTileGeometry(tile, tile.pendingLOD, *tile.backBuffer);
+      }
+    });
+  for (auto& tile : _tiles) {
+    _installTileGeometry(tile);
+  }
+
+  _beforeRenderObserver = _scene->onBeforeRenderObservable.add(
+    [this](Scene*, EventState&) { update(); });
+}
+
+ChunkedDynamicTerrain::~ChunkedDynamicTerrain()
+{
+  // the queued tiles and the scene observer reference the terrain
+  dispose();
+}
+
+ChunkedDynamicTerrain& ChunkedDynamicTerrain::update(bool force)
+{
+  // installs the tiles computed since the last update
+  for (auto& tile : _tiles) {
+    if (tile.pending.valid()
+        && tile.pending.wait_for(std::chrono::seconds(0))
+             == std::future_status::ready) {
+      // rethrows the exceptions raised on the worker threads
+      tile.pending.get();
+      _installTileGeometry(tile);
+    }
+  }
+
+  if (!_terrainCamera || !_terrain) {
+    return *this;
+  }
+
+  const auto cameraPosition
+    = _terrainCamera->globalPosition().subtract(_terrain->position());
+  for (auto& tile : _tiles) {
+    if (tile.pending.valid()) {
+      continue;
+    }
+    const auto lod = _getTileLOD(tile, cameraPosition);
+    if (!force && lod == tile.lod) {
+      continue;
+    }
+    // the tile keeps its former geometry until the new one is installed
+    tile.pendingLOD = lod;
+    tile.pending    = ThreadPool::Default().enqueue([this, &tile]() {
+      _computeTileGeometry(tile, tile.pendingLOD, *tile.backBuffer);
+    });
+  }
+
+  return *this;
+}
+
+ChunkedDynamicTerrain& ChunkedDynamicTerrain::finishPendingUpdates()
+{
+  for (auto& tile : _tiles) {
+    if (tile.pending.valid()) {
+      tile.pending.get();
+      _installTileGeometry(tile);
+    }
+  }
+  return *this;
+}
+
+void ChunkedDynamicTerrain::dispose()
+{
+  if (_beforeRenderObserver) {
+    _scene->onBeforeRenderObservable.remove(_beforeRenderObserver);
+    _beforeRenderObserver = nullptr;
+  }
+  for (auto& tile : _tiles) {
+    if (tile.pending.valid()) {
+      tile.pending.wait();
+    }
+    tile.mesh->dispose();
+  }
+  _tiles.clear();
+  if (_terrain) {
+    _terrain->dispose();
+    _terrain = nullptr;
+  }
+}
+
+void ChunkedDynamicTerrain::_computeTileGeometry(const Tile& tile,
+                                                 unsigned int lod,
+                                                 TileGeometry& geometry) const
+{
+  // columns and rows of the LOD, the tile bounds are always kept
+  const auto step = 1u << std::min(lod, _maxLOD);
+  std::vector<unsigned int> cols;
+  std::vector<unsigned int> rows;
+  for (auto col = tile.col0; col < tile.col1; col += step) {
+    cols.emplace_back(col);
+  }
+  cols.emplace_back(tile.col1);
+  for (auto row = tile.row0; row < tile.row1; row += step) {
+    rows.emplace_back(row);
+  }
+  rows.emplace_back(tile.row1);
+
+  const auto nbCols     = cols.size();
+  const auto nbRows     = rows.size();
+  const auto nbVertices = nbCols * nbRows;
+  const auto nbBorder   = (_skirtDepth > 0.f) ? 2 * (nbCols + nbRows) : 0;
+  geometry.positions.resize((nbVertices + nbBorder) * 3);
+  geometry.normals.resize((nbVertices + nbBorder) * 3);
+  geometry.uvs.resize((nbVertices + nbBorder) * 2);
+  geometry.colors.resize(_mapColors.empty() ? 0 :
+                                              (nbVertices + nbBorder) * 4);
+  geometry.indices.clear();
+
+  // copies a map point to a tile vertex
+  const auto setVertex = [this, &geometry](size_t vertex, unsigned int col,
+                                           unsigned int row, float depth) {
+    const auto index = row * _mapSubX + col;
+    geometry.positions[3 * vertex]     = _mapData[3 * index];
+    geometry.positions[3 * vertex + 1] = _mapData[3 * index + 1] - depth;
+    geometry.positions[3 * vertex + 2] = _mapData[3 * index + 2];
+    if (_mapNormals.empty()) {
+      _computeMapNormal(col, row, &geometry.normals[3 * vertex]);
+    }
+    else {
+      std::copy_n(&_mapNormals[3 * index], 3, &geometry.normals[3 * vertex]);
+    }
+    std::copy_n(&_mapUVs[2 * index], 2, &geometry.uvs[2 * vertex]);
+    if (!_mapColors.empty()) {
+      std::copy_n(&_mapColors[3 * index], 3, &geometry.colors[4 * vertex]);
+      geometry.colors[4 * vertex + 3] = 1.f;
+    }
+  };
+
+  for (size_t j = 0; j < nbRows; ++j) {
+    for (size_t i = 0; i < nbCols; ++i) {
+      setVertex(j * nbCols + i, cols[i], rows[j], 0.f);
+    }
+  }
+  for (uint32_t j = 0; j + 1 < nbRows; ++j) {
+    for (uint32_t i = 0; i + 1 < nbCols; ++i) {
+      const auto v1 = static_cast<uint32_t>(j * nbCols + i);
+      const auto v2 = v1 + 1;
+      const auto v3 = static_cast<uint32_t>(v1 + nbCols);
+      const auto v4 = v3 + 1;
+      stl_util::concat(geometry.indices, {v1, v2, v4, v1, v4, v3});
+    }
+  }
+
+  // skirts : the border vertices lowered by the skirt depth, the faces are
+  // set with both orientations so they are seen from inside and outside
+  if (nbBorder > 0) {
+    auto skirtVertex = static_cast<uint32_t>(nbVertices);
+    const auto addSkirt
+      = [&](const std::vector<uint32_t>& border,
+            const std::vector<std::pair<unsigned, unsigned>>& points) {
+          const auto first = skirtVertex;
+          for (size_t k = 0; k < border.size(); ++k) {
+            setVertex(skirtVertex++, points[k].first, points[k].second,
+                      _skirtDepth);
+          }
+          for (uint32_t k = 0; k + 1 < border.size(); ++k) {
+            const auto v1 = border[k];
+            const auto v2 = border[k + 1];
+            const auto v3 = first + k;
+            const auto v4 = v3 + 1;
+            stl_util::concat(geometry.indices, {v1, v2, v4, v1, v4, v3, v1, v4,
+                                                v2, v1, v3, v4});
+          }
+        };
+    std::vector<uint32_t> border;
+    std::vector<std::pair<unsigned, unsigned>> points;
+    const auto nbColsIdx = static_cast<uint32_t>(nbCols);
+    for (const auto j : {size_t(0), nbRows - 1}) {
+      border.clear();
+      points.clear();
+      for (uint32_t i = 0; i < nbColsIdx; ++i) {
+        border.emplace_back(static_cast<uint32_t>(j * nbCols + i));
+        points.emplace_back(cols[i], rows[j]);
+      }
+      addSkirt(border, points);
+    }
+    for (const auto i : {size_t(0), nbCols - 1}) {
+      border.clear();
+      points.clear();
+      for (size_t j = 0; j < nbRows; ++j) {
+        border.emplace_back(static_cast<uint32_t>(j * nbCols + i));
+        points.emplace_back(cols[i], rows[j]);
+      }
+      addSkirt(border, points);
+    }
+  }
+}
+
+void ChunkedDynamicTerrain::_installTileGeometry(Tile& tile)
+{
+  const auto& geometry = *tile.backBuffer;
+  auto vertexData      = std::make_unique<VertexData>();
+  vertexData->indices  = geometry.indices;
+  vertexData->set(geometry.positions, VertexBuffer::PositionKind);
+  vertexData->set(geometry.normals, VertexBuffer::NormalKind);
+  vertexData->set(geometry.uvs, VertexBuffer::UVKind);
+  if (!geometry.colors.empty()) {
+    vertexData->set(geometry.colors, VertexBuffer::ColorKind);
+  }
+  vertexData->applyToMesh(*tile.mesh, true);
+  tile.lod = tile.pendingLOD;
+}
+
+void ChunkedDynamicTerrain::_computeMapNormal(unsigned int col,
+                                              unsigned int row,
+                                              float* normal) const
+{
+  // central differences, one sided on the map borders
+  const auto colL = (col > 0) ? col - 1 : col;
+  const auto colR = (col + 1 < _mapSubX) ? col + 1 : col;
+  const auto rowD = (row > 0) ? row - 1 : row;
+  const auto rowU = (row + 1 < _mapSubZ) ? row + 1 : row;
+  const auto* pL  = &_mapData[3 * (row * _mapSubX + colL)];
+  const auto* pR  = &_mapData[3 * (row * _mapSubX + colR)];
+  const auto* pD  = &_mapData[3 * (rowD * _mapSubX + col)];
+  const auto* pU  = &_mapData[3 * (rowU * _mapSubX + col)];
+  const auto dx   = pR[0] - pL[0];
+  const auto dz   = pU[2] - pD[2];
+  const auto nx   = (dx != 0.f) ? -(pR[1] - pL[1]) / dx : 0.f;
+  const auto nz   = (dz != 0.f) ? -(pU[1] - pD[1]) / dz : 0.f;
+  const auto norm = std::sqrt(nx * nx + 1.f + nz * nz);
+  normal[0]       = nx / norm;
+  normal[1]       = 1.f / norm;
+  normal[2]       = nz / norm;
+}
+
+unsigned int
+ChunkedDynamicTerrain::_getTileLOD(const Tile& tile,
+                                   const Vector3& cameraPosition) const
+{
+  // distance from the camera to the tile bounding box
+  const auto dx = std::max({tile.minimum.x - cameraPosition.x, 0.f,
+                            cameraPosition.x - tile.maximum.x});
+  const auto dy = std::max({tile.minimum.y - cameraPosition.y, 0.f,
+                            cameraPosition.y - tile.maximum.y});
+  const auto dz = std::max({tile.minimum.z - cameraPosition.z, 0.f,
+                            cameraPosition.z - tile.maximum.z});
+  return std::min(computeTileLOD(std::sqrt(dx * dx + dy * dy + dz * dz)),
+                  _maxLOD);
+}
+
+float ChunkedDynamicTerrain::getHeightFromMap(float x, float z) const
+{
+  return DynamicTerrain::_GetHeightFromMap(x, z, _mapData, _mapSubX, _mapSubZ,
+                                           _mapSizeX, _mapSizeZ);
+}
+
+bool ChunkedDynamicTerrain::getHeightRangeFromMap(float minX, float minZ,
+                                                  float maxX, float maxZ,
+                                                  float& minHeight,
+                                                  float& maxHeight) const
+{
+  if (_mapSizeX <= 0.f || _mapSizeZ <= 0.f) {
+    return false;
+  }
+
+  // map points around the area
+  const auto cellSizeX = _mapSizeX / (_mapSubX - 1);
+  const auto cellSizeZ = _mapSizeZ / (_mapSubZ - 1);
+  const auto toIndex = [](float value, unsigned int sub) {
+    return static_cast<unsigned>(
+      std::clamp(value, 0.f, static_cast<float>(sub - 1)));
+  };
+  const auto col0
+    = toIndex(std::floor((minX - _mapData[0]) / cellSizeX), _mapSubX);
+  const auto col1
+    = toIndex(std::ceil((maxX - _mapData[0]) / cellSizeX), _mapSubX);
+  const auto row0
+    = toIndex(std::floor((minZ - _mapData[2]) / cellSizeZ), _mapSubZ);
+  const auto row1
+    = toIndex(std::ceil((maxZ - _mapData[2]) / cellSizeZ), _mapSubZ);
+  return _heightQuadtree.getHeightRange(col0, row0, col1, row1, minHeight,
+                                        maxHeight);
+}
+
+unsigned int ChunkedDynamicTerrain::computeTileLOD(float distance) const
+{
+  return static_cast<unsigned>(
+    std::upper_bound(_LODDistances.begin(), _LODDistances.end(), distance)
+    - _LODDistances.begin());
+}
+
+MeshPtr& ChunkedDynamicTerrain::mesh()
+{
+  return _terrain;
+}
+
+CameraPtr& ChunkedDynamicTerrain::camera()
+{
+  return _terrainCamera;
+}
+
+void ChunkedDynamicTerrain::setCamera(const CameraPtr& val)
+{
+  _terrainCamera = val;
+}
+
+size_t ChunkedDynamicTerrain::tileCount() const
+{
+  return _tiles.size();
+}
+
+MeshPtr& ChunkedDynamicTerrain::tileMesh(size_t index)
+{
+  return _tiles[index].mesh;
+}
+
+unsigned int ChunkedDynamicTerrain::tileLOD(size_t index) const
+{
+  return _tiles[index].lod;
+}
+
+size_t ChunkedDynamicTerrain::pendingTileCount() const
+{
+  return static_cast<size_t>(
+    std::count_if(_tiles.begin(), _tiles.end(),
+                  [](const Tile& tile) { return tile.pending.valid(); }));
+}
+
+unsigned int ChunkedDynamicTerrain::maxLOD() const
+{
+  return _maxLOD;
+}
+
+const Float32Array& ChunkedDynamicTerrain::LODDistances() const
+{
+  return _LODDistances;
+}
+
+void ChunkedDynamicTerrain::setLODDistances(Float32Array val)
+{
+  std::sort(val.begin(), val.end());
+  _LODDistances = std::move(val);
+}
+
+const HeightMapQuadtree& ChunkedDynamicTerrain::heightQuadtree() const
+{
+  return _heightQuadtree;
+}
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
@@ -15,13 +15,6 @@
 namespace BABYLON {
 namespace Extensions {
 
-Vector3 DynamicTerrain::_v1    = Vector3::Zero();
-Vector3 DynamicTerrain::_v2    = Vector3::Zero();
-Vector3 DynamicTerrain::_v3    = Vector3::Zero();
-Vector3 DynamicTerrain::_v4    = Vector3::Zero();
-Vector3 DynamicTerrain::_vAvB  = Vector3::Zero();
-Vector3 DynamicTerrain::_vAvC  = Vector3::Zero();
-Vector3 DynamicTerrain::_norm  = Vector3::Zero();
 Vector3 DynamicTerrain::_bbMin = Vector3::Zero();
 Vector3 DynamicTerrain::_bbMax = Vector3::Zero();
 
@@ -531,54 +524,50 @@ float DynamicTerrain::_GetHeightFromMap(float x, float z,
   const unsigned int idx3 = 3 * ((row2)*mapSubX + col1);
   const unsigned int idx4 = 3 * ((row2)*mapSubX + col2);
 
-  DynamicTerrain::_v1.copyFromFloats(mapData[idx1], mapData[idx1 + 1],
-                                     mapData[idx1 + 2]);
-  DynamicTerrain::_v2.copyFromFloats(mapData[idx2], mapData[idx2 + 1],
-                                     mapData[idx2 + 2]);
-  DynamicTerrain::_v3.copyFromFloats(mapData[idx3], mapData[idx3 + 1],
-                                     mapData[idx3 + 2]);
-  DynamicTerrain::_v4.copyFromFloats(mapData[idx4], mapData[idx4 + 1],
-                                     mapData[idx4 + 2]);
+  // local vectors, so the map can be queried from several threads
+  const Vector3 v1(mapData[idx1], mapData[idx1 + 1], mapData[idx1 + 2]);
+  const Vector3 v2(mapData[idx2], mapData[idx2 + 1], mapData[idx2 + 2]);
+  const Vector3 v3(mapData[idx3], mapData[idx3 + 1], mapData[idx3 + 2]);
+  const Vector3 v4(mapData[idx4], mapData[idx4 + 1], mapData[idx4 + 2]);
 
-  Vector3 vA = DynamicTerrain::_v1;
+  Vector3 vA = v1;
   Vector3 vB;
   Vector3 vC;
   Vector3 v;
 
-  const float xv4v1 = DynamicTerrain::_v4.x - DynamicTerrain::_v1.x;
-  const float zv4v1 = DynamicTerrain::_v4.z - DynamicTerrain::_v1.z;
+  const float xv4v1 = v4.x - v1.x;
+  const float zv4v1 = v4.z - v1.z;
   if (stl_util::almost_equal(xv4v1, 0.f)
       || stl_util::almost_equal(zv4v1, 0.f)) {
-    return DynamicTerrain::_v1.y;
+    return v1.y;
   }
   const float cd = zv4v1 / xv4v1;
-  const float h  = DynamicTerrain::_v1.z - cd * DynamicTerrain::_v1.x;
+  const float h  = v1.z - cd * v1.x;
   if (z < cd * x + h) {
-    vB = DynamicTerrain::_v4;
-    vC = DynamicTerrain::_v2;
+    vB = v4;
+    vC = v2;
     v  = vA;
   }
   else {
-    vB = DynamicTerrain::_v3;
-    vC = DynamicTerrain::_v4;
+    vB = v3;
+    vC = v4;
     v  = vB;
   }
-  vB.subtractToRef(vA, DynamicTerrain::_vAvB);
-  vC.subtractToRef(vA, DynamicTerrain::_vAvC);
-  Vector3::CrossToRef(DynamicTerrain::_vAvB, DynamicTerrain::_vAvC,
-                      DynamicTerrain::_norm);
-  DynamicTerrain::_norm.normalize();
+  Vector3 vAvB;
+  Vector3 vAvC;
+  Vector3 norm;
+  vB.subtractToRef(vA, vAvB);
+  vC.subtractToRef(vA, vAvC);
+  Vector3::CrossToRef(vAvB, vAvC, norm);
+  norm.normalize();
   if (normal != Vector3::Zero()) {
     auto tmpVector = normal;
-    tmpVector.copyFrom(DynamicTerrain::_norm);
+    tmpVector.copyFrom(norm);
   }
-  const float d
-    = -(DynamicTerrain::_norm.x * v.x + DynamicTerrain::_norm.y * v.y
-        + DynamicTerrain::_norm.z * v.z);
-  float y = v.y;
-  if (!stl_util::almost_equal(DynamicTerrain::_norm.y, 0.f)) {
-    y = -(DynamicTerrain::_norm.x * x + DynamicTerrain::_norm.z * z + d)
-        / DynamicTerrain::_norm.y;
+  const float d = -(norm.x * v.x + norm.y * v.y + norm.z * v.z);
+  float y       = v.y;
+  if (!stl_util::almost_equal(norm.y, 0.f)) {
+    y = -(norm.x * x + norm.z * z + d) / norm.y;
   }
 
   return y;
@@ -0,0 +1,159 @@
+#include <babylon/extensions/dynamicterrain/height_map_quadtree.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace BABYLON {
+namespace Extensions {
+
+HeightMapQuadtree::HeightMapQuadtree() = default;
+
+HeightMapQuadtree::~HeightMapQuadtree() = default;
+
+void HeightMapQuadtree::build(const Float32Array& mapData,
+                              unsigned int mapSubX, unsigned int mapSubZ)
+{
+  _levels.clear();
+  if (mapSubX < 2 || mapSubZ < 2 || mapData.size() < mapSubX * mapSubZ * 3) {
+    return;
+  }
+
+  // cell ranges from their 4 corner altitudes
+  Level cells;
+  cells.sizeX = mapSubX - 1;
+  cells.sizeZ = mapSubZ - 1;
+  cells.minHeights.resize(cells.sizeX * cells.sizeZ);
+  cells.maxHeights.resize(cells.sizeX * cells.sizeZ);
+  const auto height = [&mapData, mapSubX](unsigned int col, unsigned int row) {
+    return mapData[3 * (row * mapSubX + col) + 1];
+  };
+  for (unsigned int row = 0; row < cells.sizeZ; ++row) {
+    for (unsigned int col = 0; col < cells.sizeX; ++col) {
+      const auto y1 = height(col, row);
+      const auto y2 = height(col + 1, row);
+      const auto y3 = height(col, row + 1);
+      const auto y4 = height(col + 1, row + 1);
+
+      const auto cell        = row * cells.sizeX + col;
+      cells.minHeights[cell] = std::min({y1, y2, y3, y4});
+      cells.maxHeights[cell] = std::max({y1, y2, y3, y4});
+    }
+  }
+  _levels.emplace_back(std::move(cells));
+
+  // merges 2 x 2 nodes up to the root
+  while (_levels.back().sizeX > 1 || _levels.back().sizeZ > 1) {
+    const auto& children = _levels.back();
+    Level level;
+    level.sizeX = (children.sizeX + 1) / 2;
+    level.sizeZ = (children.sizeZ + 1) / 2;
+    level.minHeights.resize(level.sizeX * level.sizeZ,
+                            std::numeric_limits<float>::max());
+    level.maxHeights.resize(level.sizeX * level.sizeZ,
+                            std::numeric_limits<float>::lowest());
+    for (unsigned int z = 0; z < children.sizeZ; ++z) {
+      for (unsigned int x = 0; x < children.sizeX; ++x) {
+        const auto child = z * children.sizeX + x;
+        const auto node  = (z / 2) * level.sizeX + x / 2;
+        level.minHeights[node]
+          = std::min(level.minHeights[node], children.minHeights[child]);
+        level.maxHeights[node]
+          = std::max(level.maxHeights[node], children.maxHeights[child]);
+      }
+    }
+    _levels.emplace_back(std::move(level));
+  }
+}
+
+bool HeightMapQuadtree::empty() const
+{
+  return _levels.empty();
+}
+
+float HeightMapQuadtree::minHeight() const
+{
+  return _levels.empty() ? 0.f : _levels.back().minHeights[0];
+}
+
+float HeightMapQuadtree::maxHeight() const
+{
+  return _levels.empty() ? 0.f : _levels.back().maxHeights[0];
+}
+
+bool HeightMapQuadtree::getHeightRange(unsigned int col0, unsigned int row0,
+                                       unsigned int col1, unsigned int row1,
+                                       float& minHeight, float& maxHeight) const
+{
+  if (_levels.empty()) {
+    return false;
+  }
+
+  // cells [cellX0, endX) x [cellZ0, endZ) containing the points
+  const auto& cells  = _levels.front();
+  const auto cellX0  = std::min(std::min(col0, col1), cells.sizeX - 1);
+  const auto cellZ0  = std::min(std::min(row0, row1), cells.sizeZ - 1);
+  const auto cellX1  = std::min(std::max(col0, col1), cells.sizeX);
+  const auto cellZ1  = std::min(std::max(row0, row1), cells.sizeZ);
+  const auto endX    = std::max(cellX1, cellX0 + 1);
+  const auto endZ    = std::max(cellZ1, cellZ0 + 1);
+  const auto rootMin = _levels.back().minHeights[0];
+  const auto rootMax = _levels.back().maxHeights[0];
+
+  minHeight = std::numeric_limits<float>::max();
+  maxHeight = std::numeric_limits<float>::lowest();
+
+  struct Node {
+    size_t level;
+    unsigned int x;
+    unsigned int z;
+  };
+  std::vector<Node> stack{{_levels.size() - 1, 0, 0}};
+  while (!stack.empty()) {
+    const auto node = stack.back();
+    stack.pop_back();
+
+    // cells covered by the node
+    const auto& level = _levels[node.level];
+    const auto nodeX0 = node.x << node.level;
+    const auto nodeZ0 = node.z << node.level;
+    const auto nodeX1 = (node.x + 1) << node.level;
+    const auto nodeZ1 = (node.z + 1) << node.level;
+    if (nodeX0 >= endX || nodeX1 <= cellX0 || nodeZ0 >= endZ
+        || nodeZ1 <= cellZ0) {
+      continue;
+    }
+
+    // the node can't extend the current range
+    const auto index = node.z * level.sizeX + node.x;
+    if (level.minHeights[index] >= minHeight
+        && level.maxHeights[index] <= maxHeight) {
+      continue;
+    }
+
+    const auto contained = nodeX0 >= cellX0 && nodeX1 <= endX
+                           && nodeZ0 >= cellZ0 && nodeZ1 <= endZ;
+    if (contained || node.level == 0) {
+      minHeight = std::min(minHeight, level.minHeights[index]);
+      maxHeight = std::max(maxHeight, level.maxHeights[index]);
+      // no other node can extend the range of the whole map
+      if (minHeight <= rootMin && maxHeight >= rootMax) {
+        break;
+      }
+      continue;
+    }
+
+    const auto& children = _levels[node.level - 1];
+    const auto childX1   = std::min(node.x * 2 + 2, children.sizeX);
+    const auto childZ1   = std::min(node.z * 2 + 2, children.sizeZ);
+    for (unsigned int z = node.z * 2; z < childZ1; ++z) {
+      for (unsigned int x = node.x * 2; x < childX1; ++x) {
+        stack.push_back({node.level - 1, x, z});
+      }
+    }
+  }
+
+  return true;
+}
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
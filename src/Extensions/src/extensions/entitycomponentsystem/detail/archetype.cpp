@@ -0,0 +1,191 @@
+#include <babylon/extensions/entitycomponentsystem/detail/archetype.h>
+
+#include <algorithm>
+
+#include <babylon/extensions/entitycomponentsystem/detail/anax_assert.h>
+
+namespace BABYLON {
+namespace Extensions {
+namespace ECS {
+namespace detail {
+
+ArchetypeChunk::ArchetypeChunk(const Archetype& archetype)
+    : m_archetype{archetype}
+    , m_data{static_cast<unsigned char*>(::operator new(
+        archetype.getChunkSize(),
+        std::align_val_t(archetype.getChunkAlignment())))}
+{
+  m_entityIds.reserve(archetype.getChunkCapacity());
+}
+
+ArchetypeChunk::~ArchetypeChunk()
+{
+  ::operator delete(m_data, std::align_val_t(m_archetype.getChunkAlignment()));
+}
+
+void* ArchetypeChunk::getComponent(std::size_t column, std::size_t row) const
+{
+  const auto& componentType = m_archetype.getComponentTypes()[column];
+  return m_data + m_archetype.getColumnOffset(column)
+         + row * componentType.second->size;
+}
+
+Archetype::Archetype(const std::vector<ComponentType>& componentTypes)
+    : m_componentTypes{componentTypes}
+    , m_chunkCapacity{1}
+    , m_chunkSize{0}
+    , m_chunkAlignment{alignof(std::max_align_t)}
+{
+  std::sort(m_componentTypes.begin(), m_componentTypes.end(),
+            [](const ComponentType& a, const ComponentType& b) {
+              return a.first < b.first;
+            });
+  m_columns.fill(NO_COLUMN);
+
+  std::size_t rowSize = 0;
+  for (std::size_t column = 0; column < m_componentTypes.size(); ++column) {
+    const auto& componentType = m_componentTypes[column];
+    m_componentTypeList.set(componentType.first);
+    m_columns[componentType.first] = column;
+    rowSize += componentType.second->size;
+    m_chunkAlignment
+      = std::max(m_chunkAlignment, componentType.second->alignment);
+  }
+  m_chunkCapacity = std::max<std::size_t>(1, CHUNK_SIZE / rowSize);
+
+  // Lay the component arrays out one after the other, each one aligned on
+  // the alignment of its component type
+  for (const auto& componentType : m_componentTypes) {
+    const auto alignment = componentType.second->alignment;
+    m_chunkSize = (m_chunkSize + alignment - 1) / alignment * alignment;
+    m_columnOffsets.emplace_back(m_chunkSize);
+    m_chunkSize += componentType.second->size * m_chunkCapacity;
+  }
+}
+
+Archetype::~Archetype()
+{
+  clear();
+}
+
+const ComponentTypeList& Archetype::getComponentTypeList() const
+{
+  return m_componentTypeList;
+}
+
+const std::vector<Archetype::ComponentType>&
+Archetype::getComponentTypes() const
+{
+  return m_componentTypes;
+}
+
+std::size_t Archetype::getColumn(TypeId componentTypeId) const
+{
+  return componentTypeId < m_columns.size() ? m_columns[componentTypeId] :
+                                              NO_COLUMN;
+}
+
+std::size_t Archetype::getColumnOffset(std::size_t column) const
+{
+  return m_columnOffsets[column];
+}
+
+std::size_t Archetype::getChunkCapacity() const
+{
+  return m_chunkCapacity;
+}
+
+std::size_t Archetype::getChunkSize() const
+{
+  return m_chunkSize;
+}
+
+std::size_t Archetype::getChunkAlignment() const
+{
+  return m_chunkAlignment;
+}
+
+const std::vector<std::unique_ptr<ArchetypeChunk>>&
+Archetype::getChunks() const
+{
+  return m_chunks;
+}
+
+std::size_t Archetype::size() const
+{
+  return m_chunks.empty() ?
+           0 :
+           (m_chunks.size() - 1) * m_chunkCapacity + m_chunks.back()->size();
+}
+
+void* Archetype::getComponent(const Location& location,
+                              std::size_t column) const
+{
+  return m_chunks[location.chunk]->getComponent(column, location.row);
+}
+
+Archetype::Location Archetype::pushBack(const Entity::Id& entityId)
+{
+  if (m_chunks.empty() || m_chunks.back()->size() == m_chunkCapacity) {
+    m_chunks.emplace_back(std::make_unique<ArchetypeChunk>(*this));
+  }
+
+  auto& chunk = *m_chunks.back();
+  chunk.m_entityIds.emplace_back(entityId);
+  return {m_chunks.size() - 1, chunk.size() - 1};
+}
+
+void Archetype::destroy(const Location& location)
+{
+  auto& chunk = *m_chunks[location.chunk];
+  for (std::size_t column = 0; column < m_componentTypes.size(); ++column) {
+    m_componentTypes[column].second->destroy(
+      chunk.getComponent(column, location.row));
+  }
+}
+
+Entity::Id Archetype::erase(const Location& location)
+{
+  ANAX_ASSERT(location.chunk < m_chunks.size()
+                && location.row < m_chunks[location.chunk]->size(),
+              "invalid location in archetype");
+
+  auto& chunk  = *m_chunks[location.chunk];
+  auto& last   = *m_chunks.back();
+  auto lastRow = last.size() - 1;
+  Entity::Id movedEntityId;
+
+  if (&chunk != &last || location.row != lastRow) {
+    for (std::size_t column = 0; column < m_componentTypes.size(); ++column) {
+      const auto& typeInfo = *m_componentTypes[column].second;
+      auto* lastComponent  = last.getComponent(column, lastRow);
+      typeInfo.moveConstruct(chunk.getComponent(column, location.row),
+                             lastComponent);
+      typeInfo.destroy(lastComponent);
+    }
+    movedEntityId                   = last.m_entityIds[lastRow];
+    chunk.m_entityIds[location.row] = movedEntityId;
+  }
+
+  last.m_entityIds.pop_back();
+  if (last.size() == 0) {
+    m_chunks.pop_back();
+  }
+
+  return movedEntityId;
+}
+
+void Archetype::clear()
+{
+  for (std::size_t chunk = 0; chunk < m_chunks.size(); ++chunk) {
+    for (std::size_t row = 0; row < m_chunks[chunk]->size(); ++row) {
+      destroy({chunk, row});
+    }
+  }
+  m_chunks.clear();
+}
+
+} // end of namespace detail
+} // end of namespace ECS
+} // end of namespace Extensions
+} // end of namespace BABYLON
@@ -9,21 +9,46 @@ namespace ECS {
 namespace detail {
 
 EntityComponentStorage::EntityComponentStorage(std::size_t entityAmount)
-    : m_componentEntries(entityAmount)
+    : m_entityLocations(entityAmount)
 {
 }
 
-void EntityComponentStorage::addComponent(Entity& entity, Component* component,
-                                          TypeId componentTypeId)
+EntityComponentStorage::~EntityComponentStorage()
+{
+}
+
+Component& EntityComponentStorage::addComponent(
+  Entity& entity, void* component, TypeId componentTypeId,
+  const ComponentTypeInfo& componentTypeInfo)
 {
   ANAX_ASSERT(entity.isValid(),
               "invalid entity cannot have components added to it");
 
-  auto index                   = entity.getId().index;
-  auto& componentDataForEntity = m_componentEntries[index];
-
-  componentDataForEntity.components[componentTypeId].reset(component);
-  componentDataForEntity.componentTypeList[componentTypeId] = true;
+  auto& location = m_entityLocations[entity.getId().index];
+
+  // The entity already has a component of this type: replace it in place
+  if (location.archetype
+      && location.archetype->getComponentTypeList()[componentTypeId]) {
+    auto column = location.archetype->getColumn(componentTypeId);
+    auto* slot  = location.archetype->getComponent(location.position, column);
+    componentTypeInfo.destroy(slot);
+    componentTypeInfo.moveConstruct(slot, component);
+    return *componentTypeInfo.toComponent(slot);
+  }
+
+  std::vector<Archetype::ComponentType> componentTypes;
+  if (location.archetype) {
+    componentTypes = location.archetype->getComponentTypes();
+  }
+  componentTypes.emplace_back(componentTypeId, &componentTypeInfo);
+
+  auto& archetype = getArchetype(componentTypes);
+  moveEntity(entity.getId(), &archetype);
+
+  auto* slot = archetype.getComponent(location.position,
+                                      archetype.getColumn(componentTypeId));
+  componentTypeInfo.moveConstruct(slot, component);
+  return *componentTypeInfo.toComponent(slot);
 }
 
 void EntityComponentStorage::removeComponent(Entity& entity,
@@ -31,21 +56,26 @@ void EntityComponentStorage::removeComponent(Entity& entity,
 {
   ANAX_ASSERT(entity.isValid(), "invalid entity cannot remove components");
 
-  auto index                   = entity.getId().index;
-  auto& componentDataForEntity = m_componentEntries[index];
-
-  componentDataForEntity.components[componentTypeId].reset();
-  componentDataForEntity.componentTypeList[componentTypeId] = false;
+  auto& location = m_entityLocations[entity.getId().index];
+  if (!location.archetype
+      || !location.archetype->getComponentTypeList()[componentTypeId]) {
+    return;
+  }
+
+  std::vector<Archetype::ComponentType> componentTypes;
+  for (const auto& componentType : location.archetype->getComponentTypes()) {
+    if (componentType.first != componentTypeId) {
+      componentTypes.emplace_back(componentType);
+    }
+  }
+
+  moveEntity(entity.getId(),
+             componentTypes.empty() ? nullptr : &getArchetype(componentTypes));
 }
 
 void EntityComponentStorage::removeAllComponents(Entity& entity)
 {
-  auto index                   = entity.getId().index;
-  auto& componentDataForEntity = m_componentEntries[index];
-
-  for (auto& c : componentDataForEntity.components)
-    c.reset();
-  componentDataForEntity.componentTypeList.reset();
+  moveEntity(entity.getId(), nullptr);
 }
 
 Component& EntityComponentStorage::getComponent(const Entity& entity,
@@ -54,7 +84,11 @@ Component& EntityComponentStorage::getComponent(const Entity& entity,
   ANAX_ASSERT(entity.isValid() && hasComponent(entity, componentTypeId),
               "Entity is not valid or does not contain component");
 
-  return *getComponentsImpl(entity)[componentTypeId];
+  const auto& location = m_entityLocations[entity.getId().index];
+  const auto column    = location.archetype->getColumn(componentTypeId);
+  const auto& componentType = location.archetype->getComponentTypes()[column];
+  return *componentType.second->toComponent(
+    location.archetype->getComponent(location.position, column));
 }
 
 ComponentTypeList
@@ -63,7 +97,9 @@ EntityComponentStorage::getComponentTypeList(const Entity& entity) const
   ANAX_ASSERT(entity.isValid(),
               "invalid entity cannot retrieve the component list");
 
-  return m_componentEntries[entity.getId().index].componentTypeList;
+  const auto& location = m_entityLocations[entity.getId().index];
+  return location.archetype ? location.archetype->getComponentTypeList() :
+                              ComponentTypeList{};
 }
 
 ComponentArray EntityComponentStorage::getComponents(const Entity& entity) const
@@ -71,13 +107,18 @@ ComponentArray EntityComponentStorage::getComponents(const Entity& entity) const
   ANAX_ASSERT(entity.isValid(),
               "invalid entity cannot retrieve components, as it has none");
 
-  auto& componentsToConvert = getComponentsImpl(entity);
-
-  ComponentArray temp;
-  temp.reserve(componentsToConvert.size());
+  // Keep the layout of the array: the index is the type ID of the component
+  ComponentArray temp(MAX_AMOUNT_OF_COMPONENTS, nullptr);
 
-  for (auto& i : componentsToConvert)
-    temp.emplace_back(i.get());
+  const auto& location = m_entityLocations[entity.getId().index];
+  if (location.archetype) {
+    const auto& componentTypes = location.archetype->getComponentTypes();
+    for (std::size_t column = 0; column < componentTypes.size(); ++column) {
+      temp[componentTypes[column].first]
+        = componentTypes[column].second->toComponent(
+          location.archetype->getComponent(location.position, column));
+    }
+  }
 
   return temp;
 }
@@ -88,32 +129,96 @@ bool EntityComponentStorage::hasComponent(const Entity& entity,
   ANAX_ASSERT(entity.isValid(),
               "invalid entity cannot check if it has components");
 
-  auto& components = getComponentsImpl(entity);
+  const auto& location = m_entityLocations[entity.getId().index];
+  return location.archetype
+         && location.archetype->getColumn(componentTypeId)
+              != Archetype::NO_COLUMN;
+}
 
-  return components.size() > componentTypeId
-         && components[componentTypeId] != nullptr;
+void EntityComponentStorage::getChunks(
+  const ComponentTypeList& componentTypeList,
+  std::vector<ArchetypeChunk*>& chunks) const
+{
+  for (const auto& archetype : m_archetypes) {
+    if ((archetype->getComponentTypeList() & componentTypeList)
+        != componentTypeList) {
+      continue;
+    }
+    for (const auto& chunk : archetype->getChunks()) {
+      chunks.emplace_back(chunk.get());
+    }
+  }
 }
 
 void EntityComponentStorage::resize(std::size_t entityAmount)
 {
-  m_componentEntries.resize(entityAmount);
+  m_entityLocations.resize(entityAmount);
 }
 
 void EntityComponentStorage::clear()
 {
-  m_componentEntries.clear();
+  m_entityLocations.clear();
+  m_archetypeIndex.clear();
+  m_archetypes.clear();
 }
 
-EntityComponentStorage::ImplComponentArray&
-EntityComponentStorage::getComponentsImpl(const Entity& e)
+Archetype& EntityComponentStorage::getArchetype(
+  const std::vector<Archetype::ComponentType>& componentTypes)
 {
-  return m_componentEntries[e.getId().index].components;
+  ComponentTypeList componentTypeList;
+  for (const auto& componentType : componentTypes) {
+    componentTypeList.set(componentType.first);
+  }
+
+  auto it = m_archetypeIndex.find(componentTypeList);
+  if (it != m_archetypeIndex.end()) {
+    return *it->second;
+  }
+
+  m_archetypes.emplace_back(std::make_unique<Archetype>(componentTypes));
+  m_archetypeIndex[componentTypeList] = m_archetypes.back().get();
+  return *m_archetypes.back();
 }
 
-const EntityComponentStorage::ImplComponentArray&
-EntityComponentStorage::getComponentsImpl(const Entity& e) const
+void EntityComponentStorage::moveEntity(const Entity::Id& entityId,
+                                        Archetype* destination)
 {
-  return m_componentEntries[e.getId().index].components;
+  auto& location = m_entityLocations[entityId.index];
+  auto* source   = location.archetype;
+  if (source == destination) {
+    return;
+  }
+
+  EntityLocation newLocation{destination, {0, 0}};
+  if (destination) {
+    newLocation.position = destination->pushBack(entityId);
+  }
+
+  if (source) {
+    // Move the components shared by both archetypes, destroy the others
+    const auto& componentTypes = source->getComponentTypes();
+    for (std::size_t column = 0; column < componentTypes.size(); ++column) {
+      const auto& componentType = componentTypes[column];
+      auto* component = source->getComponent(location.position, column);
+      auto destinationColumn
+        = destination ? destination->getColumn(componentType.first) :
+                        Archetype::NO_COLUMN;
+      if (destinationColumn != Archetype::NO_COLUMN) {
+        componentType.second->moveConstruct(
+          destination->getComponent(newLocation.position, destinationColumn),
+          component);
+      }
+      componentType.second->destroy(component);
+    }
+
+    // Fill the hole left in the source archetype
+    auto movedEntityId = source->erase(location.position);
+    if (!movedEntityId.isNull()) {
+      m_entityLocations[movedEntityId.index].position = location.position;
+    }
+  }
+
+  location = newLocation;
 }
 
 } // end of namespace detail
@@ -77,10 +77,12 @@ bool Entity::operator==(const Entity& entity) const
   return m_id == entity.m_id && entity.m_world == m_world;
 }
 
-void Entity::addComponent(Component* component, detail::TypeId componentTypeId)
+Component&
+Entity::addComponent(void* component, detail::TypeId componentTypeId,
+                     const detail::ComponentTypeInfo& componentTypeInfo)
 {
-  getWorld().m_entityAttributes.componentStorage.addComponent(*this, component,
-                                                              componentTypeId);
+  return getWorld().m_entityAttributes.componentStorage.addComponent(
+    *this, component, componentTypeId, componentTypeInfo);
 }
 
 void Entity::removeComponent(detail::TypeId componentTypeId)
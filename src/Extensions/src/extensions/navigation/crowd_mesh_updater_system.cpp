@@ -1,5 +1,6 @@
 #include <babylon/extensions/navigation/crowd_mesh_updater_system.h>
 
+#include <babylon/extensions/entitycomponentsystem/world.h>
 #include <babylon/meshes/abstract_mesh.h>
 
 namespace BABYLON {
@@ -15,14 +16,14 @@ CrowdMeshUpdaterSystem::~CrowdMeshUpdaterSystem()
 
 void CrowdMeshUpdaterSystem::update()
 {
-  auto entities = getEntities();
-  for (auto& entity : entities) {
-    auto crowdAgent              = entity.getComponent<CrowdAgent>();
-    auto crowdMesh               = entity.getComponent<CrowdMesh>();
-    const auto& position         = crowdAgent.position();
-    crowdMesh.mesh->position().x = position.x();
-    crowdMesh.mesh->position().z = position.y();
-  }
+  // Each agent only writes the position of its own mesh, so the chunks of
+  // components can be processed in parallel
+  getWorld().parallelForEach<CrowdAgent, CrowdMesh>(
+    [](const CrowdAgent& crowdAgent, CrowdMesh& crowdMesh) {
+      const auto& position         = crowdAgent.position();
+      crowdMesh.mesh->position().x = position.x();
+      crowdMesh.mesh->position().z = position.y();
+    });
 }
 
 } // end of namespace Extensions
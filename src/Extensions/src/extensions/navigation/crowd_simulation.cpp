@@ -1,10 +1,15 @@
 #include <babylon/extensions/navigation/crowd_simulation.h>
 
+#include <algorithm>
+#include <cmath>
+
 #include <babylon/culling/bounding_box.h>
 #include <babylon/culling/bounding_info.h>
 #include <babylon/extensions/navigation/crowd_roadmap_vertex.h>
 #include <babylon/extensions/navigation/rvo2/rvo_simulator.h>
+#include <babylon/math/math_kernels.h>
 #include <babylon/meshes/abstract_mesh.h>
+#include <babylon/meshes/mesh.h>
 
 namespace BABYLON {
 namespace Extensions {
@@ -13,6 +18,8 @@ CrowdSimulation::CrowdSimulation()
     : _simulator{std::make_unique<RVO2::RVOSimulator>()}
     , _crowdCollisionAvoidanceSystem{
         CrowdCollisionAvoidanceSystem(_simulator.get())}
+    , _instancedMesh{nullptr}
+    , _instanceRadius{0.f}
 {
   initializeWorld();
   _simulator->setAgentDefaults(15.0f, 10, 5.0f, 5.0f, 2.0f, 2.0f);
@@ -33,6 +40,25 @@ void CrowdSimulation::setTimeStep(float timeStep)
   _simulator->setTimeStep(timeStep);
 }
 
+void CrowdSimulation::enableInstancedRendering(const MeshPtr& mesh)
+{
+  _instancedMesh = mesh;
+  if (!_instancedMesh) {
+    return;
+  }
+
+  // Measure the agent radius before the bounding info of the mesh is replaced
+  // by the one enclosing its thin instances
+  _instancedMesh->computeWorldMatrix(true);
+  const auto& bbox = _instancedMesh->getBoundingInfo()->boundingBox;
+  const auto box   = bbox.maximumWorld.subtract(bbox.minimumWorld).scale(0.5f);
+  _instanceRadius  = (box.x + box.z) * 0.5f;
+
+  // The agents move on every update: the mesh is always drawn rather than
+  // culled with a bounding info refreshed each frame
+  _instancedMesh->alwaysSelectAsActiveMesh = true;
+}
+
 size_t CrowdSimulation::addAgent(const AbstractMeshPtr& mesh)
 {
   BABYLON::Vector2 position(mesh->position().x, mesh->position().z);
@@ -73,6 +99,25 @@ size_t CrowdSimulation::addAgent(const AbstractMeshPtr& mesh,
   return addAgent(mesh, Vector2(position.x, position.z));
 }
 
+size_t CrowdSimulation::addAgent(const Vector2& position)
+{
+  // Create the crowd agent entity
+  auto agent = _world.createEntity();
+
+  // Set the agent's properties
+  auto& agentComp = agent.addComponent<CrowdAgent>(_simulator.get(), position);
+  if (_instanceRadius > 0.f) {
+    agentComp.setRadius(_instanceRadius);
+  }
+
+  // Activate and store the crowd agent entity
+  agent.activate();
+  _agents.emplace_back(agent);
+  _instanceAgentIds.emplace_back(agentComp.id());
+
+  return agentComp.id();
+}
+
 void CrowdSimulation::setAgentGoal(size_t agentId, const BABYLON::Vector2& goal)
 {
   _agents[agentId].getComponent<CrowdAgent>().setGoal(goal);
@@ -215,7 +260,7 @@ void CrowdSimulation::setPrecision(unsigned int precision)
   }
 
   for (auto& agent : _agents) {
-    auto crowdAgent = agent.getComponent<CrowdAgent>();
+    auto& crowdAgent = agent.getComponent<CrowdAgent>();
 
     crowdAgent.setAgentMaxNeighbors(neighborsMax);
     crowdAgent.setAgentNeighborDist(neighborDist);
@@ -242,6 +287,61 @@ void CrowdSimulation::update()
   _crowdCollisionAvoidanceSystem.update();
   _crowdMeshUpdaterSystem.update();
   //}
+  if (_instancedMesh) {
+    _updateInstances();
+  }
+}
+
+void CrowdSimulation::_updateInstances()
+{
+  // The agents with their own mesh are not drawn as instances
+  const auto count = _instanceAgentIds.size();
+  _instanceHeadings.resize(count, 0.f);
+  _instanceScalings.resize(count * 3);
+  _instanceRotations.resize(count * 4);
+  _instanceTranslations.resize(count * 3);
+
+  // Gather the transformations of the agents in flat arrays
+  const auto& scaling = _instancedMesh->scaling();
+  const auto height   = _instancedMesh->position().y;
+  for (size_t i = 0; i < count; ++i) {
+    const auto agentId   = _instanceAgentIds[i];
+    const auto& position = _simulator->getAgentPosition(agentId);
+    const auto& velocity = _simulator->getAgentVelocity(agentId);
+    if (RVO2::absSq(velocity) > 1e-6f) {
+      _instanceHeadings[i] = std::atan2(velocity.x(), velocity.y());
+    }
+    const auto halfHeading = _instanceHeadings[i] * 0.5f;
+
+    auto* s = &_instanceScalings[i * 3];
+    s[0]    = scaling.x;
+    s[1]    = scaling.y;
+    s[2]    = scaling.z;
+
+    auto* r = &_instanceRotations[i * 4];
+    r[0]    = 0.f;
+    r[1]    = std::sin(halfHeading);
+    r[2]    = 0.f;
+    r[3]    = std::cos(halfHeading);
+
+    auto* t = &_instanceTranslations[i * 3];
+    t[0]    = position.x();
+    t[1]    = height;
+    t[2]    = position.y();
+  }
+
+  // Compose the matrices straight into the thin instance buffer, growing it
+  // geometrically as the GPU buffer is recreated each time it grows
+  auto& matrices = _instancedMesh->thinInstanceGetMatrixBuffer();
+  if (matrices.size() < count * 16) {
+    matrices.resize(std::max(count, matrices.size() / 16 * 2) * 16);
+  }
+  MathKernels::Get().composeMatrices(
+    _instanceScalings.data(), _instanceRotations.data(),
+    _instanceTranslations.data(), matrices.data(), count);
+
+  _instancedMesh->setThinInstanceCount(count);
+  _instancedMesh->thinInstanceBufferUpdated("matrix");
 }
 
 } // end of namespace Extensions
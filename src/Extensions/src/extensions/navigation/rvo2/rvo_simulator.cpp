@@ -32,14 +32,11 @@
 
 #include <babylon/extensions/navigation/rvo2/rvo_simulator.h>
 
+#include <babylon/core/thread_pool.h>
 #include <babylon/extensions/navigation/rvo2/agent.h>
 #include <babylon/extensions/navigation/rvo2/kd_tree.h>
 #include <babylon/extensions/navigation/rvo2/obstacle.h>
 
-#ifdef _OPENMP
-#include <omp.h>
-#endif
-
 namespace BABYLON {
 namespace Extensions {
 namespace RVO2 {
@@ -177,22 +174,28 @@ size_t RVOSimulator::addObstacle(const std::vector<Vector2>& vertices)
 
 void RVOSimulator::doStep()
 {
-  kdTree_->buildAgentTree();
+  // Number of agents processed by a task of the thread pool
+  static constexpr size_t AGENTS_GRAIN_SIZE = 64;
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-  for (int i = 0; i < static_cast<int>(agents_.size()); ++i) {
-    agents_[i]->computeNeighbors();
-    agents_[i]->computeNewVelocity();
-  }
+  kdTree_->buildAgentTree();
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-  for (int i = 0; i < static_cast<int>(agents_.size()); ++i) {
-    agents_[i]->update();
-  }
+  // Each agent only writes its own neighbors and new velocity, reading the
+  // agent tree and the velocities of the previous step
+  auto& threadPool = ThreadPool::Default();
+  threadPool.parallelFor(agents_.size(), AGENTS_GRAIN_SIZE,
+                         [this](size_t begin, size_t end) {
+                           for (size_t i = begin; i < end; ++i) {
+                             agents_[i]->computeNeighbors();
+                             agents_[i]->computeNewVelocity();
+                           }
+                         });
+
+  threadPool.parallelFor(agents_.size(), AGENTS_GRAIN_SIZE,
+                         [this](size_t begin, size_t end) {
+                           for (size_t i = begin; i < end; ++i) {
+                             agents_[i]->update();
+                           }
+                         });
 
   globalTime_ += timeStep_;
 }
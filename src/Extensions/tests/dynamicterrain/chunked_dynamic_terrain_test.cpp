@@ -0,0 +1,208 @@
+#include <gtest/gtest.h>
+
+#include <future>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/extensions/dynamicterrain/chunked_dynamic_terrain.h>
+#include <babylon/extensions/dynamicterrain/chunked_dynamic_terrain_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+#include "helpers/headless_scene.h"
+
+namespace {
+
+const unsigned int MapSub    = 17;
+const unsigned int TileSub   = 8;
+const float SkirtDepth       = 2.f;
+const unsigned int TileCount = 4;
+
+float MapHeight(float x, float z)
+{
+  return 0.5f * x + 0.25f * z;
+}
+
+BABYLON::Extensions::ChunkedDynamicTerrainOptions
+CreateOptions(const BABYLON::CameraPtr& camera)
+{
+  BABYLON::Extensions::ChunkedDynamicTerrainOptions options;
+  options.mapData = BABYLON::Float32Array(MapSub * MapSub * 3);
+  for (unsigned int row = 0; row < MapSub; ++row) {
+    for (unsigned int col = 0; col < MapSub; ++col) {
+      const auto index           = 3 * (row * MapSub + col);
+      const auto x               = static_cast<float>(col);
+      const auto z               = static_cast<float>(row);
+      options.mapData[index]     = x;
+      options.mapData[index + 1] = MapHeight(x, z);
+      options.mapData[index + 2] = z;
+    }
+  }
+  options.mapSubX    = MapSub;
+  options.mapSubZ    = MapSub;
+  options.tileSub    = TileSub;
+  options.skirtDepth = SkirtDepth;
+  options.camera     = camera;
+  return options;
+}
+
+// Terrain whose tiles all get the same LOD
+class FixedLODTerrain : public BABYLON::Extensions::ChunkedDynamicTerrain {
+public:
+  using ChunkedDynamicTerrain::ChunkedDynamicTerrain;
+
+  unsigned int computeTileLOD(float /*distance*/) const override
+  {
+    return lod;
+  }
+
+  unsigned int lod = 0;
+};
+
+struct TerrainScene : public BABYLON::HeadlessScene {
+  TerrainScene() : BABYLON::HeadlessScene(BABYLON::Vector3(4.f, 3.f, 4.f))
+  {
+    // The terrain is updated from the camera before the first frame
+    camera->getViewMatrix(true);
+  }
+};
+
+} // end of anonymous namespace
+
+TEST(TestChunkedDynamicTerrain, TileGeometry)
+{
+  using namespace BABYLON;
+  using namespace BABYLON::Extensions;
+
+  TerrainScene terrainScene;
+  FixedLODTerrain terrain("terrain", CreateOptions(terrainScene.camera),
+                          terrainScene.scene.get());
+  ASSERT_EQ(terrain.tileCount(), TileCount);
+  ASSERT_EQ(terrain.maxLOD(), 3u);
+
+  for (unsigned int lod = 0; lod <= terrain.maxLOD(); ++lod) {
+    terrain.lod = lod;
+    terrain.update(true);
+    terrain.finishPendingUpdates();
+
+    // points along a tile side, then the 4 skirts lowering the borders
+    const auto n            = (TileSub >> lod) + 1;
+    const auto nbVertices   = n * n;
+    const auto nbSkirts     = 4 * n;
+    const auto nbQuads      = (n - 1) * (n - 1);
+    const auto nbSkirtQuads = 4 * (n - 1);
+    for (size_t i = 0; i < terrain.tileCount(); ++i) {
+      EXPECT_EQ(terrain.tileLOD(i), lod);
+      auto& mesh = terrain.tileMesh(i);
+      ASSERT_EQ(mesh->getTotalVertices(), nbVertices + nbSkirts);
+      // the skirt quads are double sided
+      EXPECT_EQ(mesh->getTotalIndices(), 6 * nbQuads + 12 * nbSkirtQuads);
+
+      const auto positions
+        = mesh->getVerticesData(VertexBuffer::PositionKind);
+      for (size_t v = 0; v < nbVertices + nbSkirts; ++v) {
+        const auto x     = positions[3 * v];
+        const auto y     = positions[3 * v + 1];
+        const auto z     = positions[3 * v + 2];
+        const auto depth = (v < nbVertices) ? 0.f : SkirtDepth;
+        EXPECT_FLOAT_EQ(y, MapHeight(x, z) - depth);
+      }
+    }
+  }
+}
+
+TEST(TestChunkedDynamicTerrain, LODSelection)
+{
+  using namespace BABYLON;
+  using namespace BABYLON::Extensions;
+
+  TerrainScene terrainScene;
+  auto options         = CreateOptions(terrainScene.camera);
+  options.LODDistances = {5.f, 2.f};
+  ChunkedDynamicTerrain terrain("terrain", options,
+                                terrainScene.scene.get());
+
+  EXPECT_EQ(terrain.LODDistances(), Float32Array({2.f, 5.f}));
+  EXPECT_EQ(terrain.computeTileLOD(0.f), 0u);
+  EXPECT_EQ(terrain.computeTileLOD(2.f), 1u);
+  EXPECT_EQ(terrain.computeTileLOD(4.f), 1u);
+  EXPECT_EQ(terrain.computeTileLOD(100.f), 2u);
+
+  // the camera is above the first tile, at 4 of the two next ones and at
+  // sqrt(4 * 4 + 4 * 4 + 1) of the last one
+  EXPECT_EQ(terrain.tileLOD(0), 0u);
+  EXPECT_EQ(terrain.tileLOD(1), 1u);
+  EXPECT_EQ(terrain.tileLOD(2), 1u);
+  EXPECT_EQ(terrain.tileLOD(3), 2u);
+
+  // moving the camera away lowers the resolution of all the tiles
+  terrainScene.camera->position = Vector3(8.f, 3.f, -20.f);
+  terrainScene.camera->getViewMatrix(true);
+  terrain.update();
+  terrain.finishPendingUpdates();
+  for (size_t i = 0; i < terrain.tileCount(); ++i) {
+    EXPECT_EQ(terrain.tileLOD(i), 2u);
+  }
+}
+
+TEST(TestChunkedDynamicTerrain, BackBufferSwap)
+{
+  using namespace BABYLON;
+  using namespace BABYLON::Extensions;
+
+  TerrainScene terrainScene;
+  FixedLODTerrain terrain("terrain", CreateOptions(terrainScene.camera),
+                          terrainScene.scene.get());
+  const auto highestLODVertices = terrain.tileMesh(0)->getTotalVertices();
+
+  // keeps all the workers busy so the tiles stay queued
+  auto& threadPool = ThreadPool::Default();
+  std::promise<void> release;
+  std::shared_future<void> released = release.get_future().share();
+  std::vector<std::future<void>> blockers;
+  for (size_t i = 0; i < threadPool.threadCount(); ++i) {
+    blockers.emplace_back(
+      threadPool.enqueue([released]() { released.wait(); }));
+  }
+
+  terrain.lod = terrain.maxLOD();
+  terrain.update();
+  EXPECT_EQ(terrain.pendingTileCount(), TileCount);
+
+  // the former geometry is kept while the tiles are computed
+  terrain.update();
+  EXPECT_EQ(terrain.pendingTileCount(), TileCount);
+  for (size_t i = 0; i < terrain.tileCount(); ++i) {
+    EXPECT_EQ(terrain.tileLOD(i), 0u);
+    EXPECT_EQ(terrain.tileMesh(i)->getTotalVertices(), highestLODVertices);
+  }
+
+  release.set_value();
+  for (auto& blocker : blockers) {
+    blocker.wait();
+  }
+  terrain.finishPendingUpdates();
+  EXPECT_EQ(terrain.pendingTileCount(), 0u);
+  for (size_t i = 0; i < terrain.tileCount(); ++i) {
+    EXPECT_EQ(terrain.tileLOD(i), terrain.maxLOD());
+    EXPECT_EQ(terrain.tileMesh(i)->getTotalVertices(), 2 * 2 + 4 * 2);
+  }
+}
+
+TEST(TestChunkedDynamicTerrain, DestructorRemovesObserver)
+{
+  using namespace BABYLON;
+  using namespace BABYLON::Extensions;
+
+  TerrainScene terrainScene;
+  auto& observable        = terrainScene.scene->onBeforeRenderObservable;
+  const auto hadObservers = observable.hasObservers();
+  {
+    ChunkedDynamicTerrain terrain("terrain", CreateOptions(terrainScene.camera),
+                                  terrainScene.scene.get());
+    EXPECT_TRUE(observable.hasObservers());
+  }
+  EXPECT_EQ(observable.hasObservers(), hadObservers);
+
+  // no terrain update is called once it is destroyed
+  terrainScene.render();
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include <babylon/extensions/dynamicterrain/height_map_quadtree.h>
+
+TEST(TestHeightMapQuadtree, HeightRange)
+{
+  using namespace BABYLON;
+  using namespace BABYLON::Extensions;
+
+  const unsigned int mapSubX = 37;
+  const unsigned int mapSubZ = 23;
+  std::mt19937 generator(5);
+  std::uniform_real_distribution<float> distribution(-50.f, 50.f);
+  Float32Array mapData(mapSubX * mapSubZ * 3);
+  for (unsigned int row = 0; row < mapSubZ; ++row) {
+    for (unsigned int col = 0; col < mapSubX; ++col) {
+      const auto index   = 3 * (row * mapSubX + col);
+      mapData[index]     = static_cast<float>(col);
+      mapData[index + 1] = distribution(generator);
+      mapData[index + 2] = static_cast<float>(row);
+    }
+  }
+
+  HeightMapQuadtree quadtree;
+  quadtree.build(mapData, mapSubX, mapSubZ);
+  ASSERT_FALSE(quadtree.empty());
+
+  const auto heightRange = [&](unsigned int col0, unsigned int row0,
+                               unsigned int col1, unsigned int row1) {
+    auto minHeight = mapData[3 * (row0 * mapSubX + col0) + 1];
+    auto maxHeight = minHeight;
+    for (auto row = row0; row <= row1; ++row) {
+      for (auto col = col0; col <= col1; ++col) {
+        const auto y = mapData[3 * (row * mapSubX + col) + 1];
+        minHeight    = std::min(minHeight, y);
+        maxHeight    = std::max(maxHeight, y);
+      }
+    }
+    return std::make_pair(minHeight, maxHeight);
+  };
+
+  const auto whole = heightRange(0, 0, mapSubX - 1, mapSubZ - 1);
+  EXPECT_EQ(quadtree.minHeight(), whole.first);
+  EXPECT_EQ(quadtree.maxHeight(), whole.second);
+
+  std::uniform_int_distribution<unsigned int> colDistribution(0, mapSubX - 1);
+  std::uniform_int_distribution<unsigned int> rowDistribution(0, mapSubZ - 1);
+  for (int i = 0; i < 200; ++i) {
+    auto col0 = colDistribution(generator);
+    auto col1 = colDistribution(generator);
+    auto row0 = rowDistribution(generator);
+    auto row1 = rowDistribution(generator);
+    if (col0 == col1 || row0 == row1) {
+      continue;
+    }
+    if (col0 > col1) {
+      std::swap(col0, col1);
+    }
+    if (row0 > row1) {
+      std::swap(row0, row1);
+    }
+
+    float minHeight = 0.f, maxHeight = 0.f;
+    ASSERT_TRUE(
+      quadtree.getHeightRange(col0, row0, col1, row1, minHeight, maxHeight));
+    const auto expected = heightRange(col0, row0, col1, row1);
+    EXPECT_EQ(minHeight, expected.first);
+    EXPECT_EQ(maxHeight, expected.second);
+  }
+}
+
+TEST(TestHeightMapQuadtree, Empty)
+{
+  using namespace BABYLON;
+  using namespace BABYLON::Extensions;
+
+  HeightMapQuadtree quadtree;
+  quadtree.build(Float32Array(3), 1, 1);
+  EXPECT_TRUE(quadtree.empty());
+
+  float minHeight = 0.f, maxHeight = 0.f;
+  EXPECT_FALSE(quadtree.getHeightRange(0, 0, 0, 0, minHeight, maxHeight));
+}
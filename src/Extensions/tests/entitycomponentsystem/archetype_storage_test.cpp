@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+#define ANAX_TEST_CASE_BUILD
+
+#include <babylon/extensions/entitycomponentsystem/detail/anax_assert.h>
+#include <babylon/extensions/entitycomponentsystem/entity.h>
+#include <babylon/extensions/entitycomponentsystem/world.h>
+
+#include "components.h"
+
+using namespace BABYLON::Extensions::ECS;
+
+namespace {
+
+struct ResourceComponent : Component {
+  explicit ResourceComponent(std::shared_ptr<int> resource_)
+      : resource{std::move(resource_)}
+  {
+  }
+
+  std::shared_ptr<int> resource;
+};
+
+void addPosition(Entity& e, float x, float y, float z)
+{
+  auto& position = e.addComponent<PositionComponent>();
+  position.x     = x;
+  position.y     = y;
+  position.z     = z;
+}
+
+void addVelocity(Entity& e, float x, float y, float z)
+{
+  auto& velocity = e.addComponent<VelocityComponent>();
+  velocity.x     = x;
+  velocity.y     = y;
+  velocity.z     = z;
+}
+
+} // end of anonymous namespace
+
+TEST(TestArchetypeStorage, Components_survive_archetype_changes)
+{
+  World world;
+  auto e = world.createEntity();
+
+  addPosition(e, 1.f, 2.f, 3.f);
+  e.addComponent<PlayerComponent>().name = "player";
+  addVelocity(e, 4.f, 5.f, 6.f);
+
+  EXPECT_EQ(e.getComponent<PositionComponent>().y, 2.f);
+  EXPECT_EQ(e.getComponent<PlayerComponent>().name, "player");
+  EXPECT_EQ(e.getComponent<VelocityComponent>().z, 6.f);
+
+  e.removeComponent<PositionComponent>();
+  EXPECT_FALSE(e.hasComponent<PositionComponent>());
+  EXPECT_EQ(e.getComponent<PlayerComponent>().name, "player");
+  EXPECT_EQ(e.getComponent<VelocityComponent>().x, 4.f);
+}
+
+TEST(TestArchetypeStorage, Removing_an_entity_keeps_the_others)
+{
+  World world;
+  auto entities = world.createEntities(100);
+  for (std::size_t i = 0; i < entities.size(); ++i) {
+    auto& position = entities[i].addComponent<PositionComponent>();
+    position.x     = static_cast<float>(i);
+  }
+
+  // Removing the components of the even entities moves the last entities of
+  // the archetype into the freed rows
+  for (std::size_t i = 0; i < entities.size(); i += 2) {
+    entities[i].removeAllComponents();
+  }
+
+  for (std::size_t i = 0; i < entities.size(); ++i) {
+    ASSERT_EQ(entities[i].hasComponent<PositionComponent>(), i % 2 == 1);
+    if (i % 2 == 1) {
+      EXPECT_EQ(entities[i].getComponent<PositionComponent>().x,
+                static_cast<float>(i));
+    }
+  }
+}
+
+TEST(TestArchetypeStorage, Replacing_and_destroying_components)
+{
+  auto resource = std::make_shared<int>(42);
+  {
+    World world;
+    auto e = world.createEntity();
+    e.addComponent<ResourceComponent>(resource);
+    e.addComponent<ResourceComponent>(resource);
+    EXPECT_EQ(resource.use_count(), 2);
+
+    e.addComponent<PositionComponent>();
+    EXPECT_EQ(resource.use_count(), 2);
+
+    e.removeComponent<ResourceComponent>();
+    EXPECT_EQ(resource.use_count(), 1);
+
+    e.addComponent<ResourceComponent>(resource);
+    EXPECT_EQ(resource.use_count(), 2);
+  }
+  EXPECT_EQ(resource.use_count(), 1);
+}
+
+TEST(TestArchetypeStorage, For_each_visits_activated_entities)
+{
+  World world;
+  for (std::size_t i = 0; i < 5000; ++i) {
+    auto e = world.createEntity();
+    addPosition(e, 1.f, 0.f, 0.f);
+    if (i % 3 == 0) {
+      addVelocity(e, 2.f, 0.f, 0.f);
+    }
+    if (i % 5 != 0) {
+      e.activate();
+    }
+  }
+  world.refresh();
+
+  std::size_t positionCount = 0;
+  world.forEach<PositionComponent>(
+    [&](PositionComponent& position) { positionCount += position.x == 1.f; });
+  EXPECT_EQ(positionCount, 4000u);
+
+  std::atomic<std::size_t> movingCount{0};
+  world.parallelForEach<PositionComponent, VelocityComponent>(
+    [&](PositionComponent& position, const VelocityComponent& velocity) {
+      position.x += velocity.x;
+      ++movingCount;
+    });
+  EXPECT_EQ(movingCount, 1333u);
+
+  float sum = 0.f;
+  world.forEach<PositionComponent>(
+    [&](const PositionComponent& position) { sum += position.x; });
+  EXPECT_EQ(sum, 4000.f + 2.f * 1333.f);
+}
@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+
+#include <babylon/extensions/navigation/crowd_simulation.h>
+#include <babylon/meshes/mesh.h>
+
+#include "helpers/headless_scene.h"
+
+TEST(TestCrowdSimulation, InstancedRendering)
+{
+  using namespace BABYLON;
+  using namespace BABYLON::Extensions;
+
+  HeadlessScene crowdScene;
+  auto scene              = crowdScene.scene.get();
+  auto instancedMesh      = Mesh::CreateBox("agent", 1.f, scene);
+  instancedMesh->position = Vector3(0.f, 0.5f, 0.f);
+  auto agentMesh          = Mesh::CreateBox("mesh", 1.f, scene);
+  agentMesh->position     = Vector3(10.f, 0.f, 10.f);
+  agentMesh->computeWorldMatrix(true);
+
+  CrowdSimulation crowd;
+  crowd.enableInstancedRendering(instancedMesh);
+  const std::vector<Vector2> positions{Vector2(-5.f, 2.f), Vector2(5.f, -2.f)};
+  crowd.addAgent(positions[0]);
+  crowd.addAgent(agentMesh);
+  crowd.addAgent(positions[1]);
+  crowd.update();
+
+  // The agent with its own mesh has no instance
+  ASSERT_EQ(instancedMesh->thinInstanceCount(), positions.size());
+  const auto& matrices = instancedMesh->thinInstanceGetMatrixBuffer();
+  for (size_t i = 0; i < positions.size(); ++i) {
+    const auto* m = &matrices[i * 16];
+    EXPECT_NEAR(m[12], positions[i].x, 1e-3f);
+    EXPECT_NEAR(m[13], 0.5f, 1e-5f);
+    EXPECT_NEAR(m[14], positions[i].y, 1e-3f);
+  }
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include <babylon/extensions/navigation/rvo2/rvo_simulator.h>
+
+namespace {
+
+// Agents placed on a circle, each one heading to the opposite point
+std::vector<BABYLON::Extensions::RVO2::Vector2> simulateCircle(size_t count,
+                                                               size_t steps)
+{
+  using namespace BABYLON::Extensions::RVO2;
+
+  RVOSimulator simulator;
+  simulator.setTimeStep(0.25f);
+  simulator.setAgentDefaults(15.f, 10, 10.f, 10.f, 1.5f, 2.f);
+
+  std::vector<Vector2> goals;
+  for (size_t i = 0; i < count; ++i) {
+    const auto angle = static_cast<float>(i) * 6.2831853f / count;
+    const Vector2 position(200.f * std::cos(angle), 200.f * std::sin(angle));
+    simulator.addAgent(position);
+    goals.emplace_back(-position);
+  }
+
+  for (size_t step = 0; step < steps; ++step) {
+    for (size_t i = 0; i < count; ++i) {
+      auto goalVector = goals[i] - simulator.getAgentPosition(i);
+      if (absSq(goalVector) > 1.f) {
+        goalVector = normalize(goalVector);
+      }
+      simulator.setAgentPrefVelocity(i, goalVector);
+    }
+    simulator.doStep();
+  }
+
+  std::vector<Vector2> positions;
+  for (size_t i = 0; i < count; ++i) {
+    positions.emplace_back(simulator.getAgentPosition(i));
+  }
+  return positions;
+}
+
+} // end of anonymous namespace
+
+TEST(TestRVOSimulator, ParallelStepIsDeterministic)
+{
+  using namespace BABYLON::Extensions::RVO2;
+
+  // The agents are processed in parallel, each one only reading the state of
+  // the previous step: two runs give exactly the same positions
+  const auto positions      = simulateCircle(200, 50);
+  const auto positionsAgain = simulateCircle(200, 50);
+  ASSERT_EQ(positions.size(), positionsAgain.size());
+  for (size_t i = 0; i < positions.size(); ++i) {
+    EXPECT_EQ(positions[i].x(), positionsAgain[i].x());
+    EXPECT_EQ(positions[i].y(), positionsAgain[i].y());
+    // Every agent moved towards its goal
+    EXPECT_LT(abs(positions[i]), 200.f);
+  }
+}
@@ -4,13 +4,16 @@
 #include <babylon/imgui/imgui_utils.h>
 
 #include <iostream>
+#include <mutex>
 
 namespace BABYLON {
 
-// Data
+// Data, the messages are received on the logger thread
+static std::mutex _messagesMutex;
 static std::vector<LogMessage> _messages;
 static auto logListenerDelegate = SA::delegate<void(const LogMessage&)>{
   [](const BABYLON::LogMessage& logMessage) {
+    std::lock_guard<std::mutex> lock{_messagesMutex};
     _messages.emplace_back(logMessage);
   }};
 
@@ -89,6 +92,7 @@ void LogsTabComponent::render()
   // Log messages
   ImGui::Separator();
   if (ImGui::BeginChild("log_messages")) {
+    std::lock_guard<std::mutex> lock{_messagesMutex};
     for (auto& message : _messages) {
       ImGui::TextWithColors("{%s}[%s]: %s",
                             (message.level() == LogLevels::LEVEL_INFO) ?